@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+
+# Trainboard Firmware
+# Copyright (C) 2024 Emile Décosterd
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+# Prints the log messages sent by the board as tokens, see src/Util/Logging.h.
+# The format strings are read from the sources, the text printed by the board passes through unchanged.
+#
+#   python3 build/log_decoder.py --port /dev/ttyACM0
+#   python3 build/log_decoder.py < capture.bin
+#
+# Frame, little endian: marker, level, number of arguments, text length, time in ms, token, arguments, text
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+FRAME_MARKER = 0xFE
+HEADER = struct.Struct("<BBBII")  # Level, number of arguments, text length, time, token
+LEVELS = ["[ERROR]   : ", "[WARN]    : ", "[INFO]    : ", "[DEBUG]   : "]
+
+LOG_CALL = re.compile(r'LOG_(?:ERROR|WARN|INFO|DEBUG)\(\s*"((?:[^"\\]|\\.)*)"')
+CONVERSION = re.compile(r"%([-+ #0]*\d*(?:\.\d+)?)(?:hh|h|ll|l|z)?([diuxXcs%])")  # Flags, width and precision, length, type
+
+
+def get_token(text):
+    """FNV-1a hash of the format string, as LogToken in src/Util/LogBuffer.h"""
+    token = 2166136261
+    for byte in text.encode("utf-8"):
+        token = ((token ^ byte) * 16777619) & 0xFFFFFFFF
+    return token
+
+
+def read_formats(source_folder):
+    formats = {}
+    for root, _, files in os.walk(source_folder):
+        for name in files:
+            if not name.endswith((".cpp", ".h")):
+                continue
+            with open(os.path.join(root, name), "r", encoding="utf-8", errors="replace") as file:
+                for literal in LOG_CALL.findall(file.read()):
+                    text = literal.encode("utf-8").decode("unicode_escape").encode("latin-1").decode("utf-8")
+                    token = get_token(text)
+                    if formats.get(token, text) != text:
+                        print(f"WARNING: \"{text}\" and \"{formats[token]}\" have the same token", file=sys.stderr)
+                    formats[token] = text
+    return formats
+
+
+def format_message(text, arguments, string):
+    values = iter(arguments)
+
+    def convert(match):
+        spec, conversion = match.groups()
+        if conversion == "%":
+            return "%"
+        if conversion == "s":
+            return f"%{spec}s" % string
+        value = next(values, 0)
+        if conversion in "di":
+            return f"%{spec}d" % (value - (1 << 32) if value & 0x80000000 else value)
+        if conversion == "c":
+            return f"%{spec}c" % chr(value & 0xFF)
+        return f"%{spec}{'d' if conversion == 'u' else conversion}" % value
+
+    return CONVERSION.sub(convert, text)
+
+
+def decode(read, write, formats):
+    """Read one byte at a time until read returns nothing"""
+    while True:
+        byte = read(1)
+        if not byte:
+            return
+        if byte[0] != FRAME_MARKER:
+            write(byte.decode("utf-8", errors="replace"))
+            continue
+
+        header = read(HEADER.size)
+        if len(header) < HEADER.size:
+            return
+        level, number_of_arguments, text_length, time_ms, token = HEADER.unpack(header)
+        arguments = struct.unpack(f"<{number_of_arguments}I", read(4 * number_of_arguments))
+        string = read(text_length).decode("utf-8", errors="replace")
+
+        prefix = LEVELS[level] if level < len(LEVELS) else "[?]       : "
+        if token in formats:
+            message = format_message(formats[token], arguments, string)
+        else:
+            message = f"Unknown token {token:08x} {' '.join(str(argument) for argument in arguments)} {string}"
+        write(f"{time_ms} {prefix}{message}\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Prints the tokenised log messages of the board")
+    parser.add_argument("--port", help="Serial port of the board, the standard input is read if not given")
+    parser.add_argument("--baudrate", type=int, default=115200)
+    parser.add_argument("--src", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src"), help="Firmware sources")
+    args = parser.parse_args()
+
+    formats = read_formats(args.src)
+
+    def write(text):
+        sys.stdout.write(text)
+        sys.stdout.flush()
+
+    try:
+        if args.port:
+            import serial  # pyserial
+
+            with serial.Serial(args.port, args.baudrate) as port:
+                decode(port.read, write, formats)
+        else:
+            decode(sys.stdin.buffer.read, write, formats)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+
+# Trainboard Firmware
+# Copyright (C) 2024 Emile Décosterd
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+# Creates a delta patch from the firmware running on the boards to a new one,
+# in the format applied by src/Connectivity/DeltaPatcher.
+#
+#   python3 build/make_delta_patch.py old/firmware.bin .pio/build/trainboard/firmware.bin firmware.patch
+#
+# The server sends the patch on /ota/delta to the boards running the old firmware.
+
+import argparse
+import hashlib
+import struct
+
+MAGIC = b"TBDP"
+VERSION = 1
+OP_END = 0x00
+OP_COPY = 0x01
+OP_INSERT = 0x02
+
+KEY_LENGTH = 8      # Bytes hashed to find matches
+INDEX_STRIDE = 4    # Only every few source positions are indexed, matches are searched at every target position
+MAX_CANDIDATES = 8  # Source positions kept per key
+MIN_COPY = 16       # Shorter matches cost more than inserting the bytes
+
+
+def match_length(source, source_pos, target, target_pos):
+    length = 0
+    max_length = min(len(source) - source_pos, len(target) - target_pos)
+    # Compare by blocks first, it is much faster in Python
+    block = 64
+    while length + block <= max_length and source[source_pos + length:source_pos + length + block] == target[target_pos + length:target_pos + length + block]:
+        length += block
+    while length < max_length and source[source_pos + length] == target[target_pos + length]:
+        length += 1
+    return length
+
+
+def make_operations(source, target):
+    index = {}
+    for position in range(0, len(source) - KEY_LENGTH + 1, INDEX_STRIDE):
+        candidates = index.setdefault(source[position:position + KEY_LENGTH], [])
+        if len(candidates) < MAX_CANDIDATES:
+            candidates.append(position)
+
+    operations = []
+    literal_start = 0
+    position = 0
+    last_delta = 0
+    while position < len(target):
+        best_length = 0
+        best_source = 0
+        # After a change, the code usually goes on at the same shift as before
+        candidates = [position + last_delta] if 0 <= position + last_delta < len(source) else []
+        candidates += index.get(target[position:position + KEY_LENGTH], [])
+        for candidate in candidates:
+            length = match_length(source, candidate, target, position)
+            if length > best_length:
+                best_length = length
+                best_source = candidate
+        if best_length >= MIN_COPY:
+            if literal_start < position:
+                operations.append((OP_INSERT, target[literal_start:position]))
+            operations.append((OP_COPY, best_source, best_length))
+            last_delta = best_source - position
+            position += best_length
+            literal_start = position
+        else:
+            position += 1
+    if literal_start < len(target):
+        operations.append((OP_INSERT, target[literal_start:]))
+    return operations
+
+
+def make_patch(source, target):
+    patch = bytearray()
+    patch += MAGIC + struct.pack("<B3xII", VERSION, len(source), len(target))
+    patch += hashlib.sha256(source).digest() + hashlib.sha256(target).digest()
+    for operation in make_operations(source, target):
+        if operation[0] == OP_COPY:
+            patch += struct.pack("<BII", OP_COPY, operation[2], operation[1])
+        else:
+            patch += struct.pack("<BI", OP_INSERT, len(operation[1])) + operation[1]
+    patch += struct.pack("<BI", OP_END, 0)
+    return bytes(patch)
+
+
+def apply_patch(source, patch):
+    # Reference implementation, used to check the created patch
+    target = bytearray()
+    position = 80
+    while True:
+        op_code, length = struct.unpack_from("<BI", patch, position)
+        position += 5
+        if op_code == OP_END:
+            return bytes(target)
+        if op_code == OP_COPY:
+            offset, = struct.unpack_from("<I", patch, position)
+            position += 4
+            target += source[offset:offset + length]
+        else:
+            target += patch[position:position + length]
+            position += length
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Create a delta patch between two firmware images")
+    parser.add_argument("source", help="Firmware image running on the boards")
+    parser.add_argument("target", help="New firmware image")
+    parser.add_argument("patch", help="Patch file to create")
+    args = parser.parse_args()
+
+    with open(args.source, "rb") as file:
+        source = file.read()
+    with open(args.target, "rb") as file:
+        target = file.read()
+
+    patch = make_patch(source, target)
+    assert apply_patch(source, patch) == target
+
+    with open(args.patch, "wb") as file:
+        file.write(patch)
+    print("Patch: {} bytes, {:.1f} % of the new image".format(len(patch), 100.0 * len(patch) / max(len(target), 1)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+
+# Trainboard Firmware
+# Copyright (C) 2024 Emile Décosterd
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+# Static memory usage of the firmware per module, read from the linker map file (-Wl,-Map,output.map).
+#
+#   python3 build/memory_report.py output.map --json output/memory_profile.json
+#   python3 build/memory_report.py output.map --compare output/memory_profile_previous.json
+#
+# The modules are the folders of src/ and the libraries. Fails if a region or a module is over its budget.
+# The runtime usage (heap, PSRAM, task stacks) is printed by the board, type `m` in the serial monitor.
+
+import argparse
+import fnmatch
+import json
+import os
+import re
+import sys
+
+# Output sections of the ESP32-S3 linker scripts, by memory region
+REGIONS = {
+    "iram": (".iram0.",),
+    "dram": (".dram0.", ".noinit"),
+    "flash": (".flash.text", ".flash.rodata", ".flash.appdesc"),
+    "psram": (".ext_ram.",),
+    "rtc": (".rtc.", ".rtc_"),
+}
+
+# Bytes, a warning is printed above WARNING_RATIO of the budget
+REGION_BUDGETS = {
+    "iram": 100 * 1024,
+    "dram": 160 * 1024,   # The rest of the internal RAM is left to the heap, TLS needs about 40 kB per connection
+    "flash": 0x140000,    # Size of an OTA app partition
+}
+MODULE_BUDGETS = {
+    "src*": {"dram": 16 * 1024},  # The large buffers are allocated in PSRAM at start-up, see OswMemoryAllocate
+}
+WARNING_RATIO = 0.9
+
+INPUT_SECTION = re.compile(r"^ (\.\S+|COMMON)(?:\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(.+))?$")
+WRAPPED_INPUT_SECTION = re.compile(r"^\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(.+)$")
+OUTPUT_SECTION = re.compile(r"^(\.\S+)")
+
+
+def get_region(output_section):
+    for region, prefixes in REGIONS.items():
+        if output_section.startswith(prefixes):
+            return region
+    return None
+
+
+def get_module(object_file):
+    object_file = object_file.strip().replace("\\", "/")
+    archive = re.match(r"(.+)\.a\((.+)\)$", object_file)
+    if archive:
+        name = os.path.basename(archive.group(1))
+        return name[3:] if name.startswith("lib") else name
+    index = object_file.rfind("/src/")
+    if index >= 0:
+        folder = os.path.dirname(object_file[index + 1:])
+        return folder
+    return os.path.basename(object_file)
+
+
+def parse_map(path):
+    """Returns {module: {region: bytes}}"""
+    modules = {}
+    with open(path, "r", errors="replace") as file:
+        lines = file.read().splitlines()
+
+    start = next((i for i, line in enumerate(lines) if line.startswith("Linker script and memory map")), 0)
+    region = None
+    pending = False  # Input section name whose address and size are on the next line
+    for line in lines[start:]:
+        if OUTPUT_SECTION.match(line):
+            region = get_region(OUTPUT_SECTION.match(line).group(1))
+            pending = False
+            continue
+        if region is None:
+            continue
+
+        size = None
+        object_file = None
+        match = INPUT_SECTION.match(line)
+        if match:
+            if match.group(2) is None:
+                pending = True
+            else:
+                size, object_file = int(match.group(3), 16), match.group(4)
+        elif pending:
+            pending = False
+            match = WRAPPED_INPUT_SECTION.match(line)
+            if match:
+                size, object_file = int(match.group(2), 16), match.group(3)
+
+        if size:
+            module = modules.setdefault(get_module(object_file), {})
+            module[region] = module.get(region, 0) + size
+    return modules
+
+
+def get_region_totals(modules):
+    totals = {region: 0 for region in REGIONS}
+    for usage in modules.values():
+        for region, size in usage.items():
+            totals[region] += size
+    return totals
+
+
+def check_budget(name, region, size, budget):
+    if size > budget:
+        print(f"ERROR: {name} uses {size} bytes of {region}, over its budget of {budget} bytes")
+        return False
+    if size > WARNING_RATIO * budget:
+        print(f"WARNING: {name} uses {size} bytes of {region}, {100 * size // budget}% of its budget")
+    return True
+
+
+def check_budgets(modules, totals):
+    is_within_budget = True
+    for region, budget in REGION_BUDGETS.items():
+        is_within_budget &= check_budget("The firmware", region, totals[region], budget)
+    for pattern, budgets in MODULE_BUDGETS.items():
+        for module in fnmatch.filter(modules, pattern):
+            for region, budget in budgets.items():
+                is_within_budget &= check_budget(module, region, modules[module].get(region, 0), budget)
+    return is_within_budget
+
+
+def print_report(modules, totals, number_of_modules):
+    columns = list(REGIONS)
+    print(f"{'Module':<32}" + "".join(f"{region:>10}" for region in columns))
+    ranked = sorted(modules.items(), key=lambda item: (item[1].get("dram", 0) + item[1].get("iram", 0), item[1].get("flash", 0)), reverse=True)
+    for module, usage in ranked[:number_of_modules]:
+        print(f"{module:<32}" + "".join(f"{usage.get(region, 0):>10}" for region in columns))
+    print(f"{'Total':<32}" + "".join(f"{totals[region]:>10}" for region in columns))
+
+
+def print_comparison(modules, totals, previous):
+    print("Changes since the previous profile, in bytes:")
+    for region in REGIONS:
+        delta = totals[region] - previous["regions"].get(region, 0)
+        if delta != 0:
+            print(f"  {region:<8}{delta:+}")
+    names = sorted(set(modules) | set(previous["modules"]))
+    for module in names:
+        for region in REGIONS:
+            delta = modules.get(module, {}).get(region, 0) - previous["modules"].get(module, {}).get(region, 0)
+            if delta != 0:
+                print(f"  {module:<32}{region:<8}{delta:+}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Static memory usage per module, from the linker map file")
+    parser.add_argument("map", help="Linker map file")
+    parser.add_argument("--json", help="Write the memory profile to this file")
+    parser.add_argument("--compare", help="Memory profile of a previous build to compare with")
+    parser.add_argument("--top", type=int, default=25, help="Number of modules printed")
+    args = parser.parse_args()
+
+    modules = parse_map(args.map)
+    totals = get_region_totals(modules)
+    print_report(modules, totals, args.top)
+
+    if args.compare:
+        with open(args.compare, "r") as file:
+            print_comparison(modules, totals, json.load(file))
+
+    if args.json:
+        os.makedirs(os.path.dirname(os.path.abspath(args.json)), exist_ok=True)
+        with open(args.json, "w") as file:
+            json.dump({"regions": totals, "modules": modules}, file, indent=2, sort_keys=True)
+        print(f"Memory profile written to {args.json}")
+
+    if not check_budgets(modules, totals):
+        sys.exit(-1)
+
+
+if __name__ == "__main__":
+    main()
@@ -14,46 +14,90 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
+#include "AsyncLedPresenter.h"
 #include "BoardConfiguration.h"
+#include "ColorCalibration.h"
 #include "ConnectionListener.h"
+#include "DataManager.h"
 #include "FastLedPresenter.h"
 #include "FastLedStrip.h"
 #include "FwConfig.h"
 #include "LedManager_Trainboard.h"
 #include "LightSensor.h"
 #include "LightSensorLtr303.h"
+#include "MemoryReport.h"
 #include "PushButton.h"
+#include "ServerCommunication.h"
 #include "TimerTicker.h"
 #include "Trainboard.h"
 
+#include <optional>
+
+#include "etl/algorithm.h"
+#include "etl/array.h"
+
 using Manager = TrainboardLedManager<kNumberOfStrips>;
 using StripArray = etl::array<Manager::Strip, kNumberOfStrips>;
 
-// LEDs V1
-// Strip drivers <Chipset, #leds on strip, Pin number>
-static FastLedStrip<WS2812B, kV1Strip1NLeds, 13> v1_strip1{};
-static FastLedStrip<WS2812B, kV1Strip2NLeds, 12> v1_strip2{};
-static FastLedStrip<WS2812B, kV1Strip3NLeds, 11> v1_strip3{};
-static FastLedStrip<WS2812B, kV1Strip4NLeds, 10> v1_strip4{};
-StripArray strips_v1_{v1_strip1, v1_strip2, v1_strip3, v1_strip4};
-
-// LEDs V1_1
-// Strip drivers <Chipset, #leds on strip, Pin number>
-static FastLedStrip<WS2812B, kV11Strip1NLeds, 13> v1_1_strip1{};
-static FastLedStrip<WS2812B, kV11Strip2NLeds, 12> v1_1_strip2{};
-static FastLedStrip<WS2812B, kV11Strip3NLeds, 11> v1_1_strip3{};
-static FastLedStrip<WS2812B, kV11Strip4NLeds, 10> v1_1_strip4{};
-StripArray strips_v1_1_{v1_1_strip1, v1_1_strip2, v1_1_strip3, v1_1_strip4};
-
-// LEDs V1_2
-// Strip drivers <Chipset, #leds on strip, Pin number>
-static FastLedStrip<WS2812B, kV12Strip1NLeds, 13> v1_2_strip1{};
-static FastLedStrip<WS2812B, kV12Strip2NLeds, 12> v1_2_strip2{};
-static FastLedStrip<WS2812B, kV12Strip3NLeds, 11> v1_2_strip3{};
-static FastLedStrip<WS2812B, kV12Strip4NLeds, 10> v1_2_strip4{};
-StripArray strips_v1_2_{v1_2_strip1, v1_2_strip2, v1_2_strip3, v1_2_strip4};
+// Layout of the LED strips of each hardware version, a new version only needs a new entry
+struct StripLayout
+{
+    BoardConfig::HardwareVersion hw_version;
+    etl::array<uint32_t, kNumberOfStrips> number_of_leds;
+    const ColorLut& color_lut;
+};
+
+static constexpr ColorLut kV1ColorLut{kV1ColorCalibration};
+static constexpr ColorLut kV11ColorLut{kV11ColorCalibration};
+static constexpr ColorLut kV12ColorLut{kV12ColorCalibration};
+
+static constexpr StripLayout kStripLayouts[] = {
+    {BoardConfig::HardwareVersion::kV1, {kV1Strip1NLeds, kV1Strip2NLeds, kV1Strip3NLeds, kV1Strip4NLeds}, kV1ColorLut},
+    {BoardConfig::HardwareVersion::kV1_1, {kV11Strip1NLeds, kV11Strip2NLeds, kV11Strip3NLeds, kV11Strip4NLeds}, kV11ColorLut},
+    {BoardConfig::HardwareVersion::kV1_2, {kV12Strip1NLeds, kV12Strip2NLeds, kV12Strip3NLeds, kV12Strip4NLeds}, kV12ColorLut},
+};
+
+static constexpr bool AreLayoutsValid()
+{
+    bool are_valid = true;
+    for (const auto& layout : kStripLayouts)
+    {
+        for (auto i = 0U; i < kNumberOfStrips; i++)
+        {
+            are_valid = are_valid && (layout.number_of_leds[i] <= kMaxLedsPerStrip);
+        }
+    }
+    return are_valid;
+}
+static_assert(AreLayoutsValid(), "A layout has a strip longer than a frame can address");
+
+static constexpr uint32_t GetMaxNumberOfLeds()
+{
+    uint32_t max_number_of_leds = 0U;
+    for (const auto& layout : kStripLayouts)
+    {
+        uint32_t number_of_leds = 0U;
+        for (auto i = 0U; i < kNumberOfStrips; i++)
+        {
+            number_of_leds += layout.number_of_leds[i];
+        }
+        max_number_of_leds = etl::max(max_number_of_leds, number_of_leds);
+    }
+    return max_number_of_leds;
+}
+
+// Buffers of the strips, sliced for the layout of the board: only the largest layout is paid for
+static etl::array<CRGB, GetMaxNumberOfLeds() * kFastLedStripBuffers> _strip_storage;
+
+// Strip drivers <Chipset, Pin number>, the same on all the hardware versions
+// Only constructed once the layout of the board is known
+static std::optional<FastLedStrip<WS2812B, 13>> strip1_{};
+static std::optional<FastLedStrip<WS2812B, 12>> strip2_{};
+static std::optional<FastLedStrip<WS2812B, 11>> strip3_{};
+static std::optional<FastLedStrip<WS2812B, 10>> strip4_{};
 
 static FastLedPresenter fast_led_presenter_;
+static AsyncLedPresenter async_presenter_{fast_led_presenter_};  // Shows from the render task
 
 static EventQueue _event_queue;
 static ConnectionListener connection_listener_(_event_queue);
@@ -64,31 +108,34 @@ static Trainboard* p_trainboard_{nullptr};
 static inline bool InitLedManagerAndStatemachine()
 {
     const auto hw_version = BoardConfig::Get().GetHwVersion();
-    auto is_hw_version_valid = true;
-    StripArray* strips_{nullptr};
-    switch (hw_version)
+    const StripLayout* layout{nullptr};
+    for (const auto& candidate : kStripLayouts)
     {
-        case BoardConfig::HardwareVersion::kV1:
-            strips_ = &strips_v1_;
-            break;
-
-        case BoardConfig::HardwareVersion::kV1_1:
-            strips_ = &strips_v1_1_;
-            break;
-
-        case BoardConfig::HardwareVersion::kV1_2:
-            strips_ = &strips_v1_2_;
-            break;
-        default:
-            is_hw_version_valid = false;
-            break;
+        if (hw_version == candidate.hw_version)
+        {
+            layout = &candidate;
+        }
     }
 
+    const auto is_hw_version_valid = (nullptr != layout);
     if (is_hw_version_valid)
     {
+        etl::array<CRGB*, kNumberOfStrips> storage{};
+        storage[0] = _strip_storage.data();
+        for (auto i = 1U; i < kNumberOfStrips; i++)
+        {
+            storage[i] = storage[i - 1U] + (layout->number_of_leds[i - 1U] * kFastLedStripBuffers);
+        }
+        strip1_.emplace(layout->number_of_leds[0], layout->color_lut, storage[0]);
+        strip2_.emplace(layout->number_of_leds[1], layout->color_lut, storage[1]);
+        strip3_.emplace(layout->number_of_leds[2], layout->color_lut, storage[2]);
+        strip4_.emplace(layout->number_of_leds[3], layout->color_lut, storage[3]);
+        static_assert(4U == kNumberOfStrips);
+
         // As we must assign the strips at runtime in the constructor, manager and
         // train board must be initialized here.
-        static Manager led_manager_{*strips_, fast_led_presenter_, kTransitionDurationInTicks};
+        static StripArray strips_{*strip1_, *strip2_, *strip3_, *strip4_};
+        static Manager led_manager_{strips_, async_presenter_, kTransitionDurationInTicks, kTrainMotionDurationInTicks};
         static Trainboard trainboard_{_event_queue, led_manager_};
 
         p_manager_ = &led_manager_;
@@ -97,6 +144,33 @@ static inline bool InitLedManagerAndStatemachine()
     return is_hw_version_valid;
 }
 
+static void PrintLine(const char* line)
+{
+    // The reports are formatted at runtime, they are printed as text and not as log tokens
+    Serial.println(line);
+}
+
+static void HandleSerialCommand()
+{
+    // Single character commands, to query the board over the serial monitor
+    if (Serial.available() > 0)
+    {
+        const auto command = Serial.read();
+        if ('n' == command)
+        {
+            ServerCom_GetDataRequestMetrics().Report(PrintLine);
+        }
+        else if ('m' == command)
+        {
+            MemoryReport_Print(PrintLine);
+        }
+        else
+        {
+            // Unknown command
+        }
+    }
+}
+
 EventQueue* Application_GetEventQueue()
 {
     return &_event_queue;
@@ -113,12 +187,15 @@ bool Application_Init()
         ASSERT(nullptr != p_trainboard_);
 
         [[maybe_unused]] auto _ = TimerTicker_Start(kTickPeriodMilliSeconds);
+        DataMgr_Init();
+        ServerCom_Init();
         LightSensorLtr303_Init();
         push_button_.Init();
         p_manager_->Init();
         delay(400);  // Let FastLED initialize...
         fast_led_presenter_.Init();
-        p_trainboard_->Init();
+        async_presenter_.Init(kRenderTaskStackSize, kRenderTaskPriority, kRenderTaskCore);
+        p_trainboard_->Init(esp_random());  // Each board polls with its own jitter
     }
     else
     {
@@ -132,5 +209,9 @@ void Application_Dispatch(uint16_t event)
     connection_listener_.Dispatch(event);
     p_trainboard_->DispatchEvent(event);
     push_button_.Dispatch(event);
-    LightSensorLtr393_Dispatch(event);
+
+    if (TICK == event)
+    {
+        HandleSerialCommand();
+    }
 }
\ No newline at end of file
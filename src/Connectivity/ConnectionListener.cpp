@@ -55,15 +55,12 @@ void ConnectionListener::ServerNokStateFunc()
 {
     if (WifiProv_IsConnectedToWifi())
     {
-        constexpr uint32_t kConnectionCheckIntervalInSeconds = 30;
-        if (IsTimeElapsed(kConnectionCheckIntervalInSeconds))
+        const auto is_reachable = IsServerReachable(kServerRetryIntervalSeconds);
+        if (is_reachable.value_or(false))
         {
-            if (Ping())
-            {
-                LOG_INFO("Connection listener - Connected");
-                state_ = State::kServerOk;
-                event_queue_.push(CONNECTED);
-            }
+            LOG_INFO("Connection listener - Connected");
+            state_ = State::kServerOk;
+            event_queue_.push(CONNECTED);
         }
     }
     else
@@ -76,10 +73,12 @@ void ConnectionListener::ServerOkStateFunc()
 {
     if (WifiProv_IsConnectedToWifi())
     {
-        constexpr uint32_t kDisconnectionCheckIntervalInSeconds = 60;
-        if (IsTimeElapsed(kDisconnectionCheckIntervalInSeconds))
+        const auto is_reachable = IsServerReachable(kServerSilenceBeforePingSeconds);
+        if (is_reachable.has_value() && !is_reachable.value())
         {
-            if (!Ping())
+            // A failed request of another module may have had other causes, make sure the server is really down.
+            // Our own failed ping is not repeated.
+            if (is_pinged_ || !Ping())
             {
                 LOG_INFO("Connection listener - Disconnected");
                 state_ = State::kServerNok;
@@ -93,6 +92,30 @@ void ConnectionListener::ServerOkStateFunc()
     }
 }
 
+std::optional<bool> ConnectionListener::IsServerReachable(uint32_t silence_seconds)
+{
+    std::optional<bool> is_reachable{std::nullopt};
+    is_pinged_ = false;
+    const auto status = ServerCom_GetStatus();
+    if (status.request_cnt != request_cnt_)
+    {
+        // Other modules talked to the server in the meantime, no need to ping it
+        request_cnt_ = status.request_cnt;
+        cnt_ = 0;
+        is_reachable = status.was_reachable;
+    }
+    else if (IsTimeElapsed(silence_seconds))
+    {
+        is_reachable = Ping();
+        is_pinged_ = true;
+    }
+    else
+    {
+        // Nothing new
+    }
+    return is_reachable;
+}
+
 bool ConnectionListener::Ping()
 {
     auto is_server_reachable = false;
@@ -101,6 +124,7 @@ bool ConnectionListener::Ping()
     {
         is_server_reachable = ping_result.value();
     }
+    request_cnt_ = ServerCom_GetStatus().request_cnt;  // Do not count our own ping as activity
     return is_server_reachable;
 }
 
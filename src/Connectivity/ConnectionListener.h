@@ -18,6 +18,7 @@
 #define CONNECTION_LISTENER_H_
 
 #include <cstdint>
+#include <optional>
 
 class EventQueue;
 
@@ -37,9 +38,12 @@ class ConnectionListener
     EventQueue& event_queue_;
     State state_{State::kWifiNok};
     uint32_t cnt_{0};
+    uint32_t request_cnt_{0};
+    bool is_pinged_{false};  // The last reachability comes from our own ping
     void WifiNokStateFunc();
     void ServerNokStateFunc();
     void ServerOkStateFunc();
+    std::optional<bool> IsServerReachable(uint32_t silence_seconds);
     bool Ping();
     bool IsTimeElapsed(uint32_t seconds);
     void HandleNetworkDown();
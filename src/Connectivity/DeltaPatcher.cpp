@@ -0,0 +1,268 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "DeltaPatcher.h"
+
+#include "Logging.h"
+#include "etl/algorithm.h"
+
+static constexpr uint8_t kMagic[] = {'T', 'B', 'D', 'P'};
+static constexpr uint8_t kVersion = 1U;
+static constexpr uint32_t kSourceHashOffset = 16U;
+static constexpr uint32_t kTargetHashOffset = kSourceHashOffset + Sha256::kDigestSize;
+
+static inline uint32_t ReadLittleEndian(const uint8_t* const data)
+{
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) | (static_cast<uint32_t>(data[2]) << 16) |
+           (static_cast<uint32_t>(data[3]) << 24);
+}
+
+void DeltaPatcher::Reset()
+{
+    if (is_target_started_ && (State::kDone != state_) && (State::kFailed != state_))
+    {
+        (void)target_.End(false);
+    }
+    state_ = State::kHeader;
+    header_length_ = 0U;
+    operation_length_ = 0U;
+    insert_remaining_ = 0U;
+    source_size_ = 0U;
+    target_size_ = 0U;
+    written_size_ = 0U;
+    is_target_started_ = false;
+    sha_.Init();
+}
+
+std::optional<bool> DeltaPatcher::Feed(const uint8_t* const data, uint32_t length)
+{
+    uint32_t i = 0U;
+    while ((i < length) && (State::kDone != state_) && (State::kFailed != state_))
+    {
+        if (State::kHeader == state_)
+        {
+            const auto n = etl::min(length - i, kHeaderSize - header_length_);
+            etl::copy_n(data + i, n, header_.data() + header_length_);
+            header_length_ += n;
+            i += n;
+            if ((kHeaderSize == header_length_) && !StartPatch())
+            {
+                state_ = State::kFailed;
+            }
+        }
+        else if (State::kOperation == state_)
+        {
+            const auto n = etl::min(length - i, GetOperationSize() - operation_length_);
+            etl::copy_n(data + i, n, operation_.data() + operation_length_);
+            operation_length_ += n;
+            i += n;
+            if (GetOperationSize() == operation_length_)
+            {
+                operation_length_ = 0U;
+                if (!ExecuteOperation())
+                {
+                    state_ = State::kFailed;
+                }
+            }
+        }
+        else
+        {
+            // Insert data
+            const auto n = etl::min(length - i, insert_remaining_);
+            if (!WriteTarget(data + i, n))
+            {
+                state_ = State::kFailed;
+            }
+            insert_remaining_ -= n;
+            i += n;
+            if ((State::kInsertData == state_) && (0U == insert_remaining_))
+            {
+                state_ = State::kOperation;
+            }
+        }
+    }
+
+    std::optional<bool> result{std::nullopt};
+    if (State::kDone == state_)
+    {
+        result = true;
+    }
+    else if (State::kFailed == state_)
+    {
+        result = false;
+    }
+    else
+    {
+        // Waiting for more data
+    }
+    return result;
+}
+
+uint32_t DeltaPatcher::GetOperationSize() const
+{
+    // COPY has one more argument than the other operations
+    const auto is_copy = (operation_length_ > 0U) && (kCopy == operation_[0]);
+    return is_copy ? kCopyOperationSize : kOperationSize;
+}
+
+bool DeltaPatcher::StartPatch()
+{
+    bool is_started = false;
+    const auto is_magic_valid = etl::equal(kMagic, kMagic + sizeof(kMagic), header_.begin());
+    if (!is_magic_valid || (kVersion != header_[4]))
+    {
+        Fail("Not a supported patch");
+    }
+    else
+    {
+        source_size_ = ReadLittleEndian(&header_[8]);
+        target_size_ = ReadLittleEndian(&header_[12]);
+        if (!VerifySource())
+        {
+            Fail("Patch made for another source image");
+        }
+        else if (!target_.Begin(target_size_))
+        {
+            Fail("Could not start writing the target");
+        }
+        else
+        {
+            is_target_started_ = true;
+            sha_.Init();
+            state_ = State::kOperation;
+            is_started = true;
+        }
+    }
+    return is_started;
+}
+
+bool DeltaPatcher::VerifySource()
+{
+    bool could_read = true;
+    sha_.Init();
+    for (uint32_t offset = 0U; could_read && (offset < source_size_); offset += kChunkSize)
+    {
+        const auto n = etl::min(source_size_ - offset, kChunkSize);
+        could_read = source_.Read(offset, chunk_.data(), n);
+        sha_.Update(chunk_.data(), n);
+    }
+    const auto digest = sha_.Finish();
+    return could_read && etl::equal(digest.begin(), digest.end(), header_.begin() + kSourceHashOffset);
+}
+
+bool DeltaPatcher::ExecuteOperation()
+{
+    bool is_valid = true;
+    const auto op_code = operation_[0];
+    const auto op_length = ReadLittleEndian(&operation_[1]);
+    if (op_length > (target_size_ - written_size_))
+    {
+        Fail("Target larger than announced");
+        is_valid = false;
+    }
+    else if ((kEnd == op_code) && (0U == op_length))
+    {
+        is_valid = Finish();
+    }
+    else if (kCopy == op_code)
+    {
+        is_valid = Copy(ReadLittleEndian(&operation_[kOperationSize]), op_length);
+    }
+    else if (kInsert == op_code)
+    {
+        insert_remaining_ = op_length;
+        state_ = (0U == op_length) ? State::kOperation : State::kInsertData;
+    }
+    else
+    {
+        Fail("Unknown operation");
+        is_valid = false;
+    }
+    return is_valid;
+}
+
+bool DeltaPatcher::Copy(uint32_t source_offset, uint32_t length)
+{
+    bool is_copied = true;
+    if ((source_offset > source_size_) || (length > (source_size_ - source_offset)))
+    {
+        Fail("Copy out of the source");
+        is_copied = false;
+    }
+    for (uint32_t offset = 0U; is_copied && (offset < length); offset += kChunkSize)
+    {
+        const auto n = etl::min(length - offset, kChunkSize);
+        if (!source_.Read(source_offset + offset, chunk_.data(), n))
+        {
+            Fail("Could not read the source");
+            is_copied = false;
+        }
+        else
+        {
+            is_copied = WriteTarget(chunk_.data(), n);
+        }
+    }
+    return is_copied;
+}
+
+bool DeltaPatcher::WriteTarget(const uint8_t* const data, uint32_t length)
+{
+    bool is_written = true;
+    sha_.Update(data, length);
+    if (!target_.Write(data, length))
+    {
+        Fail("Could not write the target");
+        is_written = false;
+    }
+    written_size_ += length;
+    return is_written;
+}
+
+bool DeltaPatcher::Finish()
+{
+    bool is_valid = false;
+    const auto digest = sha_.Finish();
+    if (written_size_ != target_size_)
+    {
+        Fail("Target smaller than announced");
+    }
+    else if (!etl::equal(digest.begin(), digest.end(), header_.begin() + kTargetHashOffset))
+    {
+        Fail("Wrong target hash");
+    }
+    else if (!target_.End(true))
+    {
+        LOG_WARN("Delta patch - Could not activate the target");
+        state_ = State::kFailed;
+    }
+    else
+    {
+        state_ = State::kDone;
+        is_valid = true;
+    }
+    return is_valid;
+}
+
+void DeltaPatcher::Fail(const char* reason)
+{
+    LOG_WARN("Delta patch - %s", reason);
+    if (is_target_started_ && (State::kDone != state_) && (State::kFailed != state_))
+    {
+        (void)target_.End(false);
+    }
+    state_ = State::kFailed;
+}
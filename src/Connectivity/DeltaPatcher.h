@@ -0,0 +1,137 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef DELTA_PATCHER_H_
+#define DELTA_PATCHER_H_
+
+#include <cstdint>
+#include <optional>
+
+#include "Sha256.h"
+#include "etl/array.h"
+
+/// @brief Abstract class representing the image the patch was made against, e.g. the running firmware
+class PatchSource
+{
+  public:
+    /// @brief Read `length` bytes starting at `offset`
+    /// @return `false` if the data could not be read
+    virtual bool Read(uint32_t offset, uint8_t* const buffer, uint32_t length) = 0;
+    virtual ~PatchSource() = default;
+};
+
+/// @brief Abstract class representing where the patched image is written to, e.g. the inactive OTA partition
+class PatchTarget
+{
+  public:
+    /// @brief Prepare to receive an image of the given size
+    virtual bool Begin(uint32_t size) = 0;
+
+    /// @brief Write the next bytes of the image
+    virtual bool Write(const uint8_t* const data, uint32_t length) = 0;
+
+    /// @brief Finish writing
+    /// @param is_valid `true` if the whole image was written and its hash is correct, it can then be activated.
+    /// `false` if the image must be discarded.
+    /// @return `false` if the image could not be activated
+    virtual bool End(bool is_valid) = 0;
+
+    virtual ~PatchTarget() = default;
+};
+
+/// @brief Applies a delta patch to a source image as the patch is received, with bounded memory
+/// @details
+/// The patch is created by build/make_delta_patch.py. All integers are little endian.
+///
+///     Header: "TBDP" | version (1 byte) | 3 reserved bytes | source size (4) | target size (4)
+///             | source SHA-256 (32) | target SHA-256 (32)
+///     Operations, until END:
+///       END    0x00 | 0 (4)
+///       COPY   0x01 | length (4) | source offset (4)    Copy bytes of the source
+///       INSERT 0x02 | length (4) | bytes                Bytes not found in the source
+///
+/// The source is checked against its hash before anything is written, the target hash is checked at END.
+/// Data after END is ignored.
+class DeltaPatcher
+{
+  public:
+    static constexpr uint32_t kHeaderSize = 80U;
+    static constexpr uint32_t kChunkSize = 256U;
+
+    DeltaPatcher(PatchSource& source, PatchTarget& target) : source_(source), target_(target) {}
+
+    /// @brief Forget the patch being applied, to apply a new one
+    void Reset();
+
+    /// @brief Apply the next received bytes of the patch
+    /// @return
+    /// - `std::nullopt` if more patch data is expected
+    /// - `false` if the patch could not be applied, the target was then discarded
+    /// - `true` if the patch was applied and the target hash is correct
+    std::optional<bool> Feed(const uint8_t* const data, uint32_t length);
+
+    /// @brief Get the number of bytes written to the target so far
+    uint32_t GetWrittenSize() const { return written_size_; }
+
+  private:
+    enum class State
+    {
+        kHeader,
+        kOperation,
+        kInsertData,
+        kDone,
+        kFailed
+    };
+
+    enum OpCode : uint8_t
+    {
+        kEnd = 0x00,
+        kCopy = 0x01,
+        kInsert = 0x02
+    };
+
+    static constexpr uint32_t kOperationSize = 5U;  // Op code and length
+    static constexpr uint32_t kCopyOperationSize = kOperationSize + 4U;
+
+    uint32_t GetOperationSize() const;
+    bool StartPatch();
+    bool VerifySource();
+    bool ExecuteOperation();
+    bool Copy(uint32_t source_offset, uint32_t length);
+    bool WriteTarget(const uint8_t* const data, uint32_t length);
+    bool Finish();
+    void Fail(const char* reason);
+
+    PatchSource& source_;
+    PatchTarget& target_;
+
+    State state_{State::kHeader};
+    etl::array<uint8_t, kHeaderSize> header_{};
+    uint32_t header_length_{0U};
+    etl::array<uint8_t, kCopyOperationSize> operation_{};
+    uint32_t operation_length_{0U};
+    uint32_t insert_remaining_{0U};
+
+    uint32_t source_size_{0U};
+    uint32_t target_size_{0U};
+    uint32_t written_size_{0U};
+    bool is_target_started_{false};
+    Sha256 sha_{};
+    etl::array<uint8_t, kChunkSize> chunk_{};
+};
+
+#endif  // DELTA_PATCHER_H_
@@ -0,0 +1,72 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "PollScheduler.h"
+
+#include "etl/algorithm.h"
+
+void PollScheduler::Seed(uint32_t seed)
+{
+    // xorshift must not be seeded with 0
+    random_state_ = (0U != seed) ? seed : 0x9E3779B9U;
+}
+
+uint32_t PollScheduler::OnSuccess(std::optional<uint32_t> hint_seconds)
+{
+    constexpr uint32_t kIntervalMilliSeconds = kPollIntervalSeconds * 1000U;
+    constexpr uint32_t kJitterMilliSeconds = (kIntervalMilliSeconds / 100U) * kPollJitterPercent;
+
+    fail_cnt_ = 0U;
+    if (hint_seconds.has_value())
+    {
+        // The server knows when its next frame is ready, spread the polls after that.
+        // A hint of 0 must not poll right away again, nor give a delay the poll timer cannot resolve.
+        const auto hint_ms = etl::min(hint_seconds.value(), kPollHintMaxSeconds) * 1000U;
+        delay_ms_ = etl::max(hint_ms + Random(kJitterMilliSeconds), kPollRetryMinSeconds * 1000U);
+    }
+    else
+    {
+        delay_ms_ = (kIntervalMilliSeconds - kJitterMilliSeconds) + Random(2U * kJitterMilliSeconds);
+    }
+    return delay_ms_;
+}
+
+uint32_t PollScheduler::OnFailure(std::optional<uint32_t> hint_seconds)
+{
+    constexpr uint32_t kMaxDoublings = 16U;
+
+    fail_cnt_++;
+    const auto doublings = etl::min(fail_cnt_ - 1U, kMaxDoublings);
+    const auto backoff_ms = etl::min(kPollRetryMinSeconds << doublings, kPollRetryMaxSeconds) * 1000U;
+    delay_ms_ = (backoff_ms / 2U) + Random(backoff_ms / 2U);
+
+    if (hint_seconds.has_value())
+    {
+        const auto hint_ms = etl::min(hint_seconds.value(), kPollHintMaxSeconds) * 1000U;
+        delay_ms_ = etl::max(delay_ms_, hint_ms);
+    }
+    return delay_ms_;
+}
+
+uint32_t PollScheduler::Random(uint32_t max)
+{
+    // xorshift32, good enough to spread the polls
+    random_state_ ^= random_state_ << 13;
+    random_state_ ^= random_state_ >> 17;
+    random_state_ ^= random_state_ << 5;
+    return random_state_ % (max + 1U);
+}
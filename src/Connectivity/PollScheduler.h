@@ -0,0 +1,65 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef POLL_SCHEDULER_H_
+#define POLL_SCHEDULER_H_
+
+#include <cstdint>
+#include <optional>
+
+#include "FwConfig.h"
+
+/// @brief Decides when the server is polled next
+/// @details
+/// - After a successful poll, the next one is due after the poll interval, or after the delay hinted
+///   by the server, plus a random jitter so that the boards do not all poll at the same time. The delay
+///   is at least the minimum retry delay, even if the server hints at 0.
+/// - After a failed poll, the delay doubles with every consecutive failure up to a cap, and half of it
+///   is random. A delay hinted by the server (e.g. Retry-After) is the minimum.
+/// All delays are in milliseconds.
+class PollScheduler
+{
+  public:
+    /// @brief Seed the jitter, the seed should differ from board to board
+    void Seed(uint32_t seed);
+
+    /// @brief Schedule the next poll after a successful one
+    /// @param hint_seconds Delay until the next poll asked by the server, if any
+    /// @return The delay until the next poll
+    uint32_t OnSuccess(std::optional<uint32_t> hint_seconds);
+
+    /// @brief Schedule the retry after a failed poll
+    /// @param hint_seconds Delay until the next poll asked by the server, if any
+    /// @return The delay until the retry
+    uint32_t OnFailure(std::optional<uint32_t> hint_seconds);
+
+    /// @brief Get the delay until the next poll, as computed on the last success or failure
+    uint32_t GetDelayMilliSeconds() const { return delay_ms_; }
+
+    /// @brief Get the number of consecutive failed polls
+    uint32_t GetFailCount() const { return fail_cnt_; }
+
+  private:
+    /// @brief Get a pseudo-random number in [0, max]
+    uint32_t Random(uint32_t max);
+
+    uint32_t delay_ms_{kPollIntervalSeconds * 1000U};
+    uint32_t fail_cnt_{0U};
+    uint32_t random_state_{0x9E3779B9U};
+};
+
+#endif  // POLL_SCHEDULER_H_
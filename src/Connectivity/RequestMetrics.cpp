@@ -0,0 +1,137 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "RequestMetrics.h"
+
+#include "etl/algorithm.h"
+#include "etl/string.h"
+#include "etl/to_string.h"
+
+static constexpr const char* kMetricNames[] = {"dns ms", "connect ms", "first byte ms", "transfer ms", "total ms", "payload bytes"};
+static constexpr const char* kErrorNames[] = {"none", "dns", "connect", "tls", "timeout", "lost", "4xx", "5xx", "transfer"};
+static_assert((sizeof(kMetricNames) / sizeof(kMetricNames[0])) == static_cast<uint32_t>(RequestMetrics::Metric::kNumberOfMetrics));
+static_assert((sizeof(kErrorNames) / sizeof(kErrorNames[0])) == static_cast<uint32_t>(RequestMetrics::Error::kNumberOfErrors));
+
+void RequestMetrics::Record(const Sample& sample)
+{
+    for (uint32_t i = 0U; i < windows_.size(); i++)
+    {
+        if (sample.values[i].has_value())
+        {
+            auto& window = windows_[i];
+            window.values[window.next] = sample.values[i].value();
+            window.next = (window.next + 1U) % kWindowSize;
+            window.count = etl::min(window.count + 1U, kWindowSize);
+        }
+    }
+
+    request_cnt_++;
+    error_cnt_[static_cast<uint32_t>(sample.error)]++;
+    total_bytes_ += sample.values[static_cast<uint32_t>(Metric::kPayloadBytes)].value_or(0U);
+}
+
+void RequestMetrics::Reset()
+{
+    windows_ = {};
+    error_cnt_ = {};
+    request_cnt_ = 0U;
+    total_bytes_ = 0U;
+}
+
+RequestMetrics::Histogram RequestMetrics::GetHistogram(Metric metric) const
+{
+    Histogram histogram{};
+    const auto& window = windows_[static_cast<uint32_t>(metric)];
+    for (uint32_t i = 0U; i < window.count; i++)
+    {
+        histogram[GetBucket(window.values[i])]++;
+    }
+    return histogram;
+}
+
+std::optional<uint32_t> RequestMetrics::GetPercentile(Metric metric, uint8_t percent) const
+{
+    std::optional<uint32_t> percentile{std::nullopt};
+    const auto& window = windows_[static_cast<uint32_t>(metric)];
+    if ((window.count > 0U) && (percent > 0U) && (percent <= 100U))
+    {
+        auto sorted = window.values;
+        etl::sort(sorted.begin(), sorted.begin() + window.count);
+        const auto rank = ((percent * window.count) + 99U) / 100U;  // Rounded up, at least 1
+        percentile = sorted[rank - 1U];
+    }
+    return percentile;
+}
+
+uint32_t RequestMetrics::GetSampleCount(Metric metric) const
+{
+    return windows_[static_cast<uint32_t>(metric)].count;
+}
+
+uint32_t RequestMetrics::GetBucket(uint32_t value)
+{
+    uint32_t bucket = 0U;
+    while ((0U != value) && (bucket < (kNumberOfBuckets - 1U)))
+    {
+        value >>= 1U;
+        bucket++;
+    }
+    return bucket;
+}
+
+void RequestMetrics::Report(void (*print)(const char*)) const
+{
+    etl::string<160> line{"Requests: "};
+    etl::to_string(request_cnt_, line, true);
+    line.append(", bytes: ");
+    etl::to_string(total_bytes_, line, true);
+    print(line.c_str());
+
+    line.assign("Errors:");
+    for (uint32_t i = 1U; i < error_cnt_.size(); i++)
+    {
+        line.append(" ");
+        line.append(kErrorNames[i]);
+        line.append(" ");
+        etl::to_string(error_cnt_[i], line, true);
+    }
+    print(line.c_str());
+
+    for (uint32_t i = 0U; i < windows_.size(); i++)
+    {
+        const auto metric = static_cast<Metric>(i);
+        line.assign(kMetricNames[i]);
+        line.append(": n ");
+        etl::to_string(GetSampleCount(metric), line, true);
+        if (GetSampleCount(metric) > 0U)
+        {
+            line.append(", p50 ");
+            etl::to_string(GetPercentile(metric, 50U).value_or(0U), line, true);
+            line.append(", p90 ");
+            etl::to_string(GetPercentile(metric, 90U).value_or(0U), line, true);
+            line.append(", max ");
+            etl::to_string(GetPercentile(metric, 100U).value_or(0U), line, true);
+            line.append(", log2 histogram");
+            for (const auto count : GetHistogram(metric))
+            {
+                line.append(" ");
+                etl::to_string(count, line, true);
+            }
+        }
+        print(line.c_str());
+    }
+}
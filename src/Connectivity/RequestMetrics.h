@@ -0,0 +1,114 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef REQUEST_METRICS_H_
+#define REQUEST_METRICS_H_
+
+#include <cstdint>
+#include <optional>
+
+#include "etl/array.h"
+
+/// @brief Timings, sizes and outcomes of the requests sent to the server
+/// @details
+/// The timings and sizes of the last `kWindowSize` requests are kept per metric, giving rolling
+/// histograms and percentiles. The request, byte and error counters are kept since start-up.
+class RequestMetrics
+{
+  public:
+    enum class Metric : uint8_t
+    {
+        kDnsMs,          /// Host name resolution
+        kConnectMs,      /// TCP connection and TLS handshake, done in one call by the secure client
+        kFirstByteMs,    /// Request sent until the response header is received, i.e. server time and round trip
+        kTransferMs,     /// Reception of the payload
+        kTotalMs,        /// Whole request
+        kPayloadBytes,   /// Size of the received payload
+        kNumberOfMetrics
+    };
+
+    enum class Error : uint8_t
+    {
+        kNone,
+        kDns,             /// Host name could not be resolved
+        kConnect,         /// TCP connection failed
+        kTls,             /// TLS handshake failed, e.g. certificate not valid
+        kTimeout,         /// No response in time
+        kConnectionLost,  /// Connection lost while sending or receiving
+        kHttpClient,      /// HTTP status 4xx
+        kHttpServer,      /// HTTP status 5xx or any other unexpected status
+        kTransfer,        /// Less payload received than announced
+        kNumberOfErrors
+    };
+
+    static constexpr uint32_t kWindowSize = 32U;
+    static constexpr uint32_t kNumberOfBuckets = 20U;
+    using Histogram = etl::array<uint16_t, kNumberOfBuckets>;
+
+    /// @brief Everything measured during one request, the metrics of the phases not reached are empty
+    struct Sample
+    {
+        etl::array<std::optional<uint32_t>, static_cast<uint32_t>(Metric::kNumberOfMetrics)> values{};
+        Error error{Error::kNone};
+
+        void Set(Metric metric, uint32_t value) { values[static_cast<uint32_t>(metric)] = value; }
+    };
+
+    /// @brief Add the sample of a finished request
+    void Record(const Sample& sample);
+
+    /// @brief Drop all samples and counters
+    void Reset();
+
+    /// @brief Get the histogram of the metric over the last requests
+    /// @details Bucket 0 counts the value 0, bucket i counts the values in [2^(i-1), 2^i[, the last bucket counts all greater values.
+    Histogram GetHistogram(Metric metric) const;
+
+    /// @brief Get a percentile of the metric over the last requests (nearest rank)
+    /// @param percent Between 1 and 100, 50 gives the median and 100 the maximum
+    /// @return `std::nullopt` if no request reached this phase
+    std::optional<uint32_t> GetPercentile(Metric metric, uint8_t percent) const;
+
+    /// @brief Get the number of last requests the metric was measured in, at most `kWindowSize`
+    uint32_t GetSampleCount(Metric metric) const;
+
+    uint32_t GetRequestCount() const { return request_cnt_; }
+    uint32_t GetErrorCount(Error error) const { return error_cnt_[static_cast<uint32_t>(error)]; }
+    uint32_t GetTotalBytes() const { return total_bytes_; }
+
+    /// @brief Get the histogram bucket of a value
+    static uint32_t GetBucket(uint32_t value);
+
+    /// @brief Write a human readable report, line by line
+    /// @param print Function printing one line, e.g. a log function
+    void Report(void (*print)(const char*)) const;
+
+  private:
+    struct Window
+    {
+        etl::array<uint32_t, kWindowSize> values{};
+        uint32_t next{0U};
+        uint32_t count{0U};
+    };
+
+    etl::array<Window, static_cast<uint32_t>(Metric::kNumberOfMetrics)> windows_{};
+    etl::array<uint32_t, static_cast<uint32_t>(Error::kNumberOfErrors)> error_cnt_{};
+    uint32_t request_cnt_{0U};
+    uint32_t total_bytes_{0U};
+};
+
+#endif  // REQUEST_METRICS_H_
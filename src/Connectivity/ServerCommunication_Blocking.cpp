@@ -20,26 +20,147 @@
 #include "BoardConfiguration.h"
 #include "BuildInfo.h"
 #include "Certificates.h"
+#include "DeltaPatcher.h"
 #include "FwConfig.h"
 #include "Logging.h"
+#include "Mutex.h"
+#include "OsWrapper.h"
+#include "RequestMetrics.h"
+#include "SseParser.h"
 
 // Libraries
 #include <Arduino.h>
-#include <HTTPUpdate.h>
+#include <Update.h>
+#include <atomic>
 #include "HTTPClient.h"
 #include "WiFi.h"
+#include "WiFiClientSecure.h"
+#include "esp_ota_ops.h"
+#include "esp_partition.h"
 #include "etl/algorithm.h"
-#include "etl/to_string.h"
 
-static std::optional<uint32_t> GetData(uint8_t* const buffer, const uint32_t max_length, bool is_history_mode)
+static std::optional<uint32_t> _last_sequence{std::nullopt};
+static std::optional<uint32_t> _poll_hint{std::nullopt};
+static ServerComStatus _status{0U, false};
+static Mutex _status_mutex{};  // The OTA thread records its requests too
+static RequestMetrics _data_metrics{};  // Frame requests only, see ServerCom_GetDataRequestMetrics
+
+// Push channel, kept open between calls
+static WiFiClientSecure _push_secure;
+static HTTPClient _push_client;
+static SseParser _sse_parser;
+static bool _is_push_channel_open{false};
+
+// OTA update, downloaded in a background task
+static void* _ota_queue{nullptr};
+static std::atomic<OtaStatus> _ota_status{OtaStatus::kIdle};
+
+static void RecordRequest(bool was_reachable)
+{
+    MutexLock lock{_status_mutex};
+    _status.request_cnt++;
+    _status.was_reachable = was_reachable;
+}
+
+static void SetCertificate(WiFiClientSecure& secure)
+{
+#ifdef SERVER_INSECURE
+    secure.setInsecure();  // Local stand-in server with a self-signed certificate, never use in production!
+#else
+    secure.setCACert(kServerRootCACertificate);
+#endif
+}
+
+static void GetServerHostAndPort(String& host, uint16_t& port)
+{
+    // SERVER_URL is "https://<host>[:<port>]"
+    host = SERVER_URL;
+    const auto scheme_end = host.indexOf("://");
+    if (scheme_end >= 0)
+    {
+        host = host.substring(scheme_end + 3);
+    }
+    port = 443U;
+    const auto port_start = host.indexOf(':');
+    if (port_start >= 0)
+    {
+        port = static_cast<uint16_t>(host.substring(port_start + 1).toInt());
+        host = host.substring(0, port_start);
+    }
+}
+
+/// Resolve the server name and open the secure connection, measuring both phases.
+/// The HTTP client then reuses the open connection.
+static bool ConnectTimed(WiFiClientSecure& secure, RequestMetrics::Sample& sample)
+{
+    bool is_connected = false;
+
+    String host;
+    uint16_t port;
+    GetServerHostAndPort(host, port);
+
+    IPAddress ip;
+    auto phase_start_ms = millis();
+    if (1 != WiFi.hostByName(host.c_str(), ip))
+    {
+        sample.error = RequestMetrics::Error::kDns;
+    }
+    else
+    {
+        sample.Set(RequestMetrics::Metric::kDnsMs, millis() - phase_start_ms);
+
+        // Connect by name for the certificate check, it is resolved from the DNS cache this time
+        phase_start_ms = millis();
+        if (1 == secure.connect(host.c_str(), port))
+        {
+            sample.Set(RequestMetrics::Metric::kConnectMs, millis() - phase_start_ms);
+            is_connected = true;
+        }
+        else
+        {
+            // The secure client reports -1 if the TCP connection failed, an mbedTLS error code otherwise
+            char error_text[2];
+            const auto is_tcp_error = (-1 == secure.lastError(error_text, sizeof(error_text)));
+            sample.error = is_tcp_error ? RequestMetrics::Error::kConnect : RequestMetrics::Error::kTls;
+        }
+    }
+    return is_connected;
+}
+
+static RequestMetrics::Error ClassifyResponse(int response)
+{
+    auto error = RequestMetrics::Error::kHttpServer;
+    if (HTTPC_ERROR_READ_TIMEOUT == response)
+    {
+        error = RequestMetrics::Error::kTimeout;
+    }
+    else if (response < 0)
+    {
+        error = RequestMetrics::Error::kConnectionLost;
+    }
+    else if ((response >= 400) && (response < 500))
+    {
+        error = RequestMetrics::Error::kHttpClient;
+    }
+    else
+    {
+        // Server error or unexpected status
+    }
+    return error;
+}
+
+static std::optional<uint32_t> GetData(uint8_t* const buffer, const uint32_t max_length, bool is_history_mode, std::optional<uint32_t> since_sequence)
 {
     uint32_t data_length = 0U;
 
-    const String kServerUrl = "https://api.trainboard.ch";
+    const String kServerUrl = SERVER_URL;
     const String kProductUrl = "/tb1_1";
+    const char* kSequenceHeader = "seq";
+    const char* kNextPollHeader = "next-poll";
+    const char* kRetryAfterHeader = "Retry-After";
 
     WiFiClientSecure secure;
-    secure.setCACert(kServerRootCACertificate);
+    SetCertificate(secure);
     HTTPClient client;
 
     // Prepare request
@@ -51,13 +172,46 @@ static std::optional<uint32_t> GetData(uint8_t* const buffer, const uint32_t max
     {
         client.addHeader("com", "history_" + String(kNumberOfHistoryFrames));
     }
+    if (since_sequence.has_value())
+    {
+        // Only the frames newer than this one are sent back
+        client.addHeader(kSequenceHeader, String(since_sequence.value()));
+    }
     client.setReuse(false);
+    const char* headers_to_collect[] = {kSequenceHeader, kNextPollHeader, kRetryAfterHeader};
+    client.collectHeaders(headers_to_collect, 3);
 
     // Send it
-    const int response = client.GET();
+    _last_sequence = std::nullopt;
+    _poll_hint = std::nullopt;
+    RequestMetrics::Sample sample{};
+    const auto start_ms = millis();
+    const auto is_connected = ConnectTimed(secure, sample);
+    const auto request_ms = millis();
+    const int response = is_connected ? client.GET() : HTTPC_ERROR_CONNECTION_REFUSED;
+    RecordRequest(response > 0);
+    if (response > 0)
+    {
+        sample.Set(RequestMetrics::Metric::kFirstByteMs, millis() - request_ms);
+    }
+
+    // The server may ask to come back later, whatever the response
+    if ((response > 0) && client.hasHeader(kNextPollHeader))
+    {
+        _poll_hint = static_cast<uint32_t>(client.header(kNextPollHeader).toInt());
+    }
+    else if ((response > 0) && (client.header(kRetryAfterHeader).toInt() > 0))
+    {
+        // Only the delay in seconds is supported, not the HTTP date
+        _poll_hint = static_cast<uint32_t>(client.header(kRetryAfterHeader).toInt());
+    }
+    else
+    {
+        // No hint
+    }
 
     // Evaluate result
-    if (response > 0)
+    if (HTTP_CODE_OK == response)
     {
         LOG_DEBUG("Success getting data from server!");
 
@@ -69,91 +223,415 @@ static std::optional<uint32_t> GetData(uint8_t* const buffer, const uint32_t max
 
         // Write data to buffer
         const auto received_data_length = static_cast<uint32_t>(client.getSize());
-        etl::string<64> msg{"Received data length : "};
-        etl::to_string(received_data_length, msg, true);
-        msg.append("bytes");
-        LOG_DEBUG(msg.c_str());
+        LOG_DEBUG("Received data length : %u bytes", received_data_length);
 
+        const auto transfer_start_ms = millis();
         const auto payload = client.getString();
+        sample.Set(RequestMetrics::Metric::kTransferMs, millis() - transfer_start_ms);
+        sample.Set(RequestMetrics::Metric::kPayloadBytes, payload.length());
+        if ((client.getSize() > 0) && (payload.length() < static_cast<uint32_t>(client.getSize())))
+        {
+            sample.error = RequestMetrics::Error::kTransfer;
+        }
         const auto length = etl::min(received_data_length, max_length);
 
-        msg.clear();
-        msg.append("Effective data length: ");
-        etl::to_string(length, msg, true);
-        msg.append("bytes");
-        LOG_DEBUG(msg.c_str());
+        LOG_DEBUG("Effective data length: %u bytes", length);
 
         for (auto i = 0; i < length; i++)
         {
             buffer[i] = payload[i];
         }
         data_length = length;
+
+        if (client.hasHeader(kSequenceHeader))
+        {
+            _last_sequence = static_cast<uint32_t>(client.header(kSequenceHeader).toInt());
+        }
     }
     else
     {
-        etl::string<64> error_message{"Error getting data from server, HTTP response: "};
-        etl::to_string(response, error_message, true);
-        LOG_WARN(error_message.c_str());
+        if (RequestMetrics::Error::kNone == sample.error)
+        {
+            sample.error = ClassifyResponse(response);
+        }
+        LOG_WARN("Error getting data from server, HTTP response: %d", response);
     }
 
+    sample.Set(RequestMetrics::Metric::kTotalMs, millis() - start_ms);
+    _data_metrics.Record(sample);
+
     return data_length;
 }
 
 std::optional<uint32_t> ServerCom_GetData(uint8_t* const buffer, const uint32_t max_length)
 {
     constexpr auto kLiveMode = false;
-    return GetData(buffer, max_length, kLiveMode);
+    return GetData(buffer, max_length, kLiveMode, std::nullopt);
 }
 
 std::optional<uint32_t> ServerCom_GetHistoryData(uint8_t* const buffer, const uint32_t max_length)
 {
     constexpr auto kHistoryMode = true;
-    return GetData(buffer, max_length, kHistoryMode);
+    return GetData(buffer, max_length, kHistoryMode, std::nullopt);
+}
+
+std::optional<uint32_t> ServerCom_GetHistoryDataSince(uint8_t* const buffer, const uint32_t max_length, const uint32_t sequence)
+{
+    constexpr auto kHistoryMode = true;
+    return GetData(buffer, max_length, kHistoryMode, sequence);
+}
+
+std::optional<uint32_t> ServerCom_GetLastSequence()
+{
+    return _last_sequence;
+}
+
+std::optional<uint32_t> ServerCom_GetPollHint()
+{
+    return _poll_hint;
+}
+
+const RequestMetrics& ServerCom_GetDataRequestMetrics()
+{
+    return _data_metrics;
+}
+
+void ServerCom_Init()
+{
+    _status_mutex.Init();
+}
+
+ServerComStatus ServerCom_GetStatus()
+{
+    MutexLock lock{_status_mutex};
+    return _status;
+}
+
+bool ServerCom_OpenPushChannel()
+{
+    const String kPushUrl = SERVER_URL "/tb1_1/push";
+
+    ServerCom_ClosePushChannel();
+
+    SetCertificate(_push_secure);
+    _push_client.begin(_push_secure, kPushUrl);
+    _push_client.addHeader("fwv", String(FW_VERSION_FULL));
+    _push_client.addHeader("hwv", BoardConfig::Get().GetHwVersionString().c_str());
+    _push_client.addHeader("mac", String(WiFi.macAddress()));
+    _push_client.addHeader("Accept", "text/event-stream");
+
+    // Only the response header is read here, the events are read as they come in
+    const int response = _push_client.GET();
+    RecordRequest(response > 0);
+
+    if (HTTP_CODE_OK == response)
+    {
+        LOG_INFO("Push channel open");
+        _sse_parser.Reset();
+        _is_push_channel_open = true;
+    }
+    else
+    {
+        LOG_INFO("Push channel not available, HTTP response: %d", response);
+        _push_client.end();
+    }
+    return _is_push_channel_open;
+}
+
+bool ServerCom_IsPushChannelOpen()
+{
+    return _is_push_channel_open && _push_client.connected();
+}
+
+void ServerCom_ClosePushChannel()
+{
+    if (_is_push_channel_open)
+    {
+        _push_client.end();
+        _sse_parser.Reset();
+        _is_push_channel_open = false;
+    }
 }
 
-bool ServerCom_UpdateOta()
+std::optional<uint32_t> ServerCom_GetPushedData(uint8_t* const buffer, const uint32_t max_length)
 {
-    bool did_succeed_updating = true;
+    // At most one frame worth of bytes per call, the rest is read on the next tick: a server flooding the
+    // channel must not hold the main loop
+    constexpr uint32_t kMaxReadBytes = kBufferSizeInBytes;
 
-    WiFiClientSecure client;
-    client.setCACert(kServerRootCACertificate);
-    auto ret = httpUpdate.update(client, "https://api.trainboard.ch/ota", FW_VERSION);
+    std::optional<uint32_t> data_length{std::nullopt};
 
-    switch (ret)
+    if (ServerCom_IsPushChannelOpen())
     {
-        case HTTP_UPDATE_FAILED:
+        // Only the newest frame is kept
+        auto stream = _push_client.getStreamPtr();
+        uint32_t read_bytes = 0U;
+        while ((read_bytes < kMaxReadBytes) && (stream->available() > 0))
         {
-            etl::string<128> error_message{"OTA update failed. Error "};
-            etl::to_string(httpUpdate.getLastError(), error_message, true);
-            etl::to_string(httpUpdate.getLastErrorString().c_str(), error_message, true);
-            LOG_WARN(error_message.c_str());
-            did_succeed_updating = false;
-            break;
+            read_bytes++;
+            if (_sse_parser.Parse(static_cast<char>(stream->read())))
+            {
+                const auto length = etl::min(_sse_parser.GetFrameLength(), max_length);
+                etl::copy_n(_sse_parser.GetFrame(), length, buffer);
+                data_length = length;
+                _last_sequence = _sse_parser.GetSequence();
+            }
         }
-        case HTTP_UPDATE_NO_UPDATES:
-            LOG_INFO("No OTA update available");
-            did_succeed_updating = false;
-            break;
 
-        case HTTP_UPDATE_OK:
-            LOG_INFO("OTA update ok");
-            break;
-        default:
-            break;
+        if (data_length.has_value())
+        {
+            RecordRequest(true);
+        }
+    }
+    else
+    {
+        data_length = 0U;
     }
 
-    return did_succeed_updating;
+    return data_length;
+}
+
+/// The running firmware, the delta patches are made against it
+class RunningFirmware : public PatchSource
+{
+  public:
+    bool Read(uint32_t offset, uint8_t* const buffer, uint32_t length) override
+    {
+        const auto partition = esp_ota_get_running_partition();
+        return (nullptr != partition) && (ESP_OK == esp_partition_read(partition, offset, buffer, length));
+    }
+};
+
+/// The inactive OTA partition, set as boot partition once the whole image is written and verified
+class InactiveOtaPartition : public PatchTarget
+{
+  public:
+    bool Begin(uint32_t size) override
+    {
+        return Update.begin(size, U_FLASH);
+    }
+    bool Write(const uint8_t* const data, uint32_t length) override
+    {
+        return Update.write(const_cast<uint8_t*>(data), length) == length;
+    }
+    bool End(bool is_valid) override
+    {
+        bool is_activated = false;
+        if (is_valid)
+        {
+            is_activated = Update.end();
+        }
+        else
+        {
+            Update.abort();
+        }
+        return is_activated;
+    }
+};
+
+/// Read the response body in chunks and hand them to the sink, pausing after each chunk.
+/// The pauses throttle the download so that the live display keeps its share of the network and of the CPU.
+/// @return the first value returned by the sink, `false` if the stream timed out before
+template <typename Sink>
+static bool ReadThrottled(HTTPClient& client, Sink sink)
+{
+    static uint8_t chunk[kOtaChunkSizeInBytes];  // Only used by the OTA thread, kept off its stack
+    auto stream = client.getStreamPtr();
+    std::optional<bool> is_done{std::nullopt};
+    size_t length = 1U;
+    while (!is_done.has_value() && (0U != length))
+    {
+        length = stream->readBytes(chunk, sizeof(chunk));  // 0 on time-out
+        is_done = sink(chunk, static_cast<uint32_t>(length));
+        OswTaskDelay(kOtaChunkPauseMilliSeconds);
+    }
+    return is_done.value_or(false);
+}
+
+/// Send a conditional OTA request, the server answers 304 if the running firmware is up to date
+static int GetOta(HTTPClient& client, WiFiClientSecure& secure, const char* const url)
+{
+    const char* kMd5Header = "x-MD5";
+
+    client.begin(secure, url);
+    client.addHeader("fwv", String(FW_VERSION_FULL));
+    client.addHeader("hwv", BoardConfig::Get().GetHwVersionString().c_str());
+    client.addHeader("mac", String(WiFi.macAddress()));
+    client.addHeader("x-ESP32-version", FW_VERSION);  // As sent by HTTPUpdate
+    client.addHeader("If-None-Match", "\"" FW_VERSION "\"");
+    client.setReuse(false);
+    const char* headers_to_collect[] = {kMd5Header};
+    client.collectHeaders(headers_to_collect, 1);
+    const int response = client.GET();
+    RecordRequest(response > 0);
+
+    // The poll and push sessions may be open as well, each TLS session takes about 40 kB of internal RAM
+    const auto memory = OswMemoryGetStats(OswMemoryRegion::kInternal);
+    LOG_INFO("OTA session open, free internal RAM: %u bytes, minimum ever: %u bytes", memory.free, memory.minimum_free);
+    return response;
+}
+
+/// @return
+/// - `std::nullopt` if the server has no delta patch for the running firmware or if it could not be applied
+/// - `false` if no update is available
+/// - `true` if the update was written
+static std::optional<bool> DownloadOtaDelta()
+{
+    std::optional<bool> did_update{std::nullopt};
+
+    WiFiClientSecure secure;
+    SetCertificate(secure);
+    HTTPClient client;
+    const int response = GetOta(client, secure, SERVER_URL "/ota/delta");
+
+    if (HTTP_CODE_NOT_MODIFIED == response)
+    {
+        LOG_INFO("No OTA update available");
+        did_update = false;
+    }
+    else if (HTTP_CODE_OK == response)
+    {
+        // The patch is applied as it is received, it is never stored as a whole
+        RunningFirmware source;
+        InactiveOtaPartition target;
+        DeltaPatcher patcher{source, target};
+        const auto is_patched = ReadThrottled(client, [&patcher](const uint8_t* const data, uint32_t length) { return patcher.Feed(data, length); });
+        if (is_patched)
+        {
+            LOG_INFO("Delta OTA update downloaded");
+            did_update = true;
+        }
+        else
+        {
+            patcher.Reset();
+            LOG_WARN("Delta OTA update failed, trying the full image");
+        }
+    }
+    else
+    {
+        // No delta patch for this firmware
+    }
+    return did_update;
+}
+
+/// @return `true` if the update was written, `false` if no update is available or if it failed
+static bool DownloadOtaFull()
+{
+    bool did_update = false;
+
+    WiFiClientSecure secure;
+    SetCertificate(secure);
+    HTTPClient client;
+    const int response = GetOta(client, secure, SERVER_URL "/ota");
+
+    if (HTTP_CODE_NOT_MODIFIED == response)
+    {
+        LOG_INFO("No OTA update available");
+    }
+    else if ((HTTP_CODE_OK == response) && (client.getSize() > 0))
+    {
+        const auto image_size = static_cast<uint32_t>(client.getSize());
+        InactiveOtaPartition target;
+        if (target.Begin(image_size))
+        {
+            if (32U == client.header("x-MD5").length())
+            {
+                (void)Update.setMD5(client.header("x-MD5").c_str());
+            }
+
+            uint32_t written_size = 0U;
+            const auto is_written = ReadThrottled(client, [&target, &written_size, image_size](const uint8_t* const data, uint32_t length) {
+                std::optional<bool> is_done{std::nullopt};
+                if (!target.Write(data, length))
+                {
+                    is_done = false;
+                }
+                else
+                {
+                    written_size += length;
+                    if (written_size >= image_size)
+                    {
+                        is_done = true;
+                    }
+                }
+                return is_done;
+            });
+            did_update = target.End(is_written);
+        }
+
+        if (did_update)
+        {
+            LOG_INFO("OTA update downloaded");
+        }
+        else
+        {
+            LOG_WARN("OTA update failed");
+        }
+    }
+    else
+    {
+        LOG_WARN("OTA update failed, HTTP response: %d", response);
+    }
+    return did_update;
+}
+
+static void OtaThread(void*)
+{
+    // The requests sent from here are recorded in the server status like those of the main loop
+    while (true)
+    {
+        uint8_t request = 0U;
+        if (OswQueueGet(_ota_queue, &request))
+        {
+            const auto did_update_with_delta = DownloadOtaDelta();
+            const auto did_update = did_update_with_delta.has_value() ? did_update_with_delta.value() : DownloadOtaFull();
+            _ota_status = did_update ? OtaStatus::kReady : OtaStatus::kIdle;
+            LOG_INFO("OTA thread stack never used: %u bytes", OswTaskGetHighWaterMark());
+        }
+    }
+}
+
+bool ServerCom_StartOtaUpdate()
+{
+    bool is_started = false;
+    if (nullptr == _ota_queue)
+    {
+        _ota_queue = OswQueueCreate(1U, sizeof(uint8_t));
+        OswTaskCreate(OtaThread, "OTA Thread", nullptr, kOtaThreadStackSize, kOtaThreadPriority);
+    }
+
+    if (OtaStatus::kIdle == _ota_status)
+    {
+        _ota_status = OtaStatus::kDownloading;
+        const uint8_t request = 1U;
+        OswQueuePut(_ota_queue, &request);
+        is_started = true;
+    }
+    return is_started;
+}
+
+OtaStatus ServerCom_GetOtaStatus()
+{
+    return _ota_status;
+}
+
+void ServerCom_ApplyOtaUpdate()
+{
+    ASSERT(OtaStatus::kReady == _ota_status);
+    LOG_INFO("Restarting into the new firmware");
+    delay(100);  // Let the UART send the information
+    ESP.restart();
 }
 
 std::optional<bool> ServerCom_Ping()
 {
-    const String kPingUrl = "https://api.trainboard.ch/ping";
+    const String kPingUrl = SERVER_URL "/ping";
     constexpr uint16_t kPingTimeoutMilliSeconds = 5000;
 
     bool is_ping_successful = false;
 
     WiFiClientSecure secure;
-    secure.setCACert(kServerRootCACertificate);
+    SetCertificate(secure);
     HTTPClient client;
 
     // Ping the server
@@ -161,6 +639,7 @@ std::optional<bool> ServerCom_Ping()
     client.setReuse(false);
     client.setTimeout(kPingTimeoutMilliSeconds);
     const int response = client.GET();
+    RecordRequest(response > 0);
 
     // Evaluate response
     if (response > 0)
@@ -0,0 +1,237 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "SseParser.h"
+
+#include "Logging.h"
+
+static constexpr const char* kFrameEventName = "frame";
+
+static std::optional<uint8_t> Base64Value(char c)
+{
+    std::optional<uint8_t> value{std::nullopt};
+    if ((c >= 'A') && (c <= 'Z'))
+    {
+        value = static_cast<uint8_t>(c - 'A');
+    }
+    else if ((c >= 'a') && (c <= 'z'))
+    {
+        value = static_cast<uint8_t>(c - 'a' + 26);
+    }
+    else if ((c >= '0') && (c <= '9'))
+    {
+        value = static_cast<uint8_t>(c - '0' + 52);
+    }
+    else if ('+' == c)
+    {
+        value = 62U;
+    }
+    else if ('/' == c)
+    {
+        value = 63U;
+    }
+    else
+    {
+        // Not a base64 digit
+    }
+    return value;
+}
+
+bool SseParser::Parse(char c)
+{
+    bool is_frame_complete = false;
+    if ('\r' == c)
+    {
+        // Lines end with "\n" or "\r\n"
+    }
+    else if ('\n' == c)
+    {
+        if ((Field::kName == field_) && name_.empty())
+        {
+            // An empty line ends the event
+            is_frame_complete = DispatchEvent();
+        }
+        else if (Field::kName == field_)
+        {
+            // A field without value
+            EndFieldName();
+        }
+        else
+        {
+            // Nothing to do, multiple data lines are concatenated
+        }
+        field_ = Field::kName;
+        name_.clear();
+    }
+    else if (Field::kName == field_)
+    {
+        if (':' == c)
+        {
+            EndFieldName();
+        }
+        else if (name_.full())
+        {
+            field_ = Field::kSkip;
+        }
+        else
+        {
+            name_.push_back(c);
+        }
+    }
+    else if (Field::kSkip == field_)
+    {
+        // Ignored
+    }
+    else
+    {
+        ParseValue(c);
+    }
+    return is_frame_complete;
+}
+
+void SseParser::Reset()
+{
+    field_ = Field::kName;
+    name_.clear();
+    if (0U != data_length_)
+    {
+        // The last frame was partly overwritten
+        frame_length_ = 0U;
+    }
+    ResetEvent();
+}
+
+bool SseParser::DispatchEvent()
+{
+    const bool is_frame = is_event_valid_ && (event_ == kFrameEventName) && (data_length_ > 0U);
+    if (is_frame)
+    {
+        frame_length_ = data_length_;
+        sequence_ = id_;
+    }
+    ResetEvent();
+    return is_frame;
+}
+
+void SseParser::ResetEvent()
+{
+    event_.clear();
+    id_ = std::nullopt;
+    data_length_ = 0U;
+    base64_bits_ = 0U;
+    base64_n_bits_ = 0U;
+    is_event_valid_ = true;
+}
+
+void SseParser::EndFieldName()
+{
+    is_value_start_ = true;
+    if (name_ == "event")
+    {
+        event_.clear();
+        field_ = Field::kEvent;
+    }
+    else if (name_ == "id")
+    {
+        id_ = 0U;
+        field_ = Field::kId;
+    }
+    else if (name_ == "data")
+    {
+        field_ = Field::kData;
+    }
+    else
+    {
+        // Comment, "retry" or unknown field
+        field_ = Field::kSkip;
+    }
+}
+
+void SseParser::ParseValue(char c)
+{
+    if (is_value_start_ && (' ' == c))
+    {
+        // A single space after the colon is not part of the value
+    }
+    else if (Field::kEvent == field_)
+    {
+        if (!event_.full())
+        {
+            event_.push_back(c);
+        }
+    }
+    else if (Field::kId == field_)
+    {
+        if ((c >= '0') && (c <= '9'))
+        {
+            id_ = (id_.value_or(0U) * 10U) + static_cast<uint32_t>(c - '0');
+        }
+        else
+        {
+            id_ = std::nullopt;
+            field_ = Field::kSkip;
+        }
+    }
+    else
+    {
+        DecodeBase64(c);
+    }
+    is_value_start_ = false;
+}
+
+void SseParser::DecodeBase64(char c)
+{
+    const auto value = Base64Value(c);
+    if (value.has_value())
+    {
+        if (0U == data_length_)
+        {
+            // The previous frame is being overwritten
+            frame_length_ = 0U;
+        }
+
+        base64_bits_ = (base64_bits_ << 6) | value.value();
+        base64_n_bits_ += 6U;
+        if (base64_n_bits_ >= 8U)
+        {
+            base64_n_bits_ -= 8U;
+            if (data_length_ < frame_.size())
+            {
+                frame_[data_length_] = static_cast<uint8_t>(base64_bits_ >> base64_n_bits_);
+                data_length_++;
+            }
+            else if (is_event_valid_)
+            {
+                LOG_WARN("SSE - Frame does not fit into the buffer");
+                is_event_valid_ = false;
+            }
+            else
+            {
+                // Already reported
+            }
+            base64_bits_ &= (1U << base64_n_bits_) - 1U;
+        }
+    }
+    else if ('=' == c)
+    {
+        // Padding, the remaining bits are dropped
+    }
+    else
+    {
+        is_event_valid_ = false;
+    }
+}
@@ -0,0 +1,89 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef SSE_PARSER_H_
+#define SSE_PARSER_H_
+
+#include <cstdint>
+#include <optional>
+
+#include "etl/array.h"
+#include "etl/string.h"
+
+#include "FwConfig.h"
+
+/// @brief Incremental parser for the server-sent events of the push channel
+/// @details
+/// The stream is fed byte by byte, as it is received. A frame event looks like
+///
+///     event: frame
+///     id: <sequence number>
+///     data: <frame, base64 encoded>
+///     <empty line>
+///
+/// Comment lines (starting with ':') are used as keep-alive by the server and are ignored,
+/// as are unknown fields and events. The frame is decoded on the fly, the raw lines are never stored.
+class SseParser
+{
+  public:
+    /// @brief Feed the next received character
+    /// @return `true` if it completed a frame event, the frame can then be read until the next call
+    bool Parse(char c);
+
+    /// @brief Drop the event being parsed, e.g. when the connection is lost
+    void Reset();
+
+    const uint8_t* GetFrame() const { return frame_.data(); }
+    uint32_t GetFrameLength() const { return frame_length_; }
+    std::optional<uint32_t> GetSequence() const { return sequence_; }
+
+  private:
+    enum class Field
+    {
+        kName,     /// Reading the field name, up to ':'
+        kSkip,     /// Ignored field or comment
+        kEvent,
+        kId,
+        kData
+    };
+
+    bool DispatchEvent();
+    void ResetEvent();
+    void EndFieldName();
+    void ParseValue(char c);
+    void DecodeBase64(char c);
+
+    // Line being parsed
+    Field field_{Field::kName};
+    etl::string<8> name_{};
+    bool is_value_start_{false};
+
+    // Event being parsed
+    etl::string<8> event_{};
+    std::optional<uint32_t> id_{};
+    uint32_t data_length_{0U};
+    uint32_t base64_bits_{0U};
+    uint8_t base64_n_bits_{0U};
+    bool is_event_valid_{true};
+
+    // Last complete frame event
+    etl::array<uint8_t, kBufferSizeInBytes> frame_{};
+    uint32_t frame_length_{0U};
+    std::optional<uint32_t> sequence_{};
+};
+
+#endif  // SSE_PARSER_H_
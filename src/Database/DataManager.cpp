@@ -17,55 +17,102 @@
 #include "DataManager.h"
 #include "DataManagerTypes.h"
 
-#include "FakeData.h"
+#include "DelayStats.h"
+#include "FrameFormat.h"
 #include "FwConfig.h"
 #include "Logging.h"
+#include "OfflineData.h"
+#include "OsWrapper.h"
+#include "SeqLock.h"
 #include "WifiProvisioning.h"
 
 #include "etl/array.h"
 #include "etl/circular_buffer.h"
 
-// WARNING: NOTHING IS THREAD-SAFE HERE!
+// One writer task, any number of reader tasks. The writers change the history between BeginWrite and
+// EndWrite of its sequence number and publish its newest frame in a double buffer. The readers copy a
+// frame without lock and copy it again if it was changed meanwhile, see SeqLock.h. The modes are only
+// changed by the state machine.
+
+// Copy a frame of the store, its length is checked since the frame may be changed during the copy
+static uint32_t CopyFrame(const Frame& frame, uint8_t* const data, const uint32_t max_length)
+{
+    const auto frame_length = frame.length;
+    uint32_t read_frame_length = 0U;
+    if ((frame_length > max_length) || (frame_length > kBufferSizeInBytes))
+    {
+        read_frame_length = 0U;
+    }
+    else
+    {
+        for (auto i = 0U; i < frame_length; i++)
+        {
+            data[i] = frame.data[i];
+        }
+        read_frame_length = frame_length;
+    }
+    return read_frame_length;
+}
+
+static void PublishNewestFrame();
+
+/// @brief Reads through another reader, again if the data was changed during the read
+class SequencedDataReader : public DataReader
+{
+  public:
+    SequencedDataReader(DataReader& reader, const SeqLock& sequence) : reader_(reader), sequence_(sequence) {}
+
+    uint32_t ReadData(uint8_t* const data, const uint32_t max_length) override
+    {
+        uint32_t read_length = 0U;
+        const auto is_consistent = sequence_.Read(kDataReadAttempts, [&]() { read_length = reader_.ReadData(data, max_length); });
+        was_busy_ = !is_consistent;
+        return is_consistent ? read_length : 0U;
+    }
+    bool WasBusy() const override
+    {
+        return was_busy_;
+    }
+
+  private:
+    DataReader& reader_;
+    const SeqLock& sequence_;
+    bool was_busy_{false};
+};
 
 class LiveDataStoreReader : public DataReader
 {
   public:
-    explicit LiveDataStoreReader(const RealDataCircularBuffer& circular_buffer) : buffer_(circular_buffer) {}
+    explicit LiveDataStoreReader(const SeqLockBuffer<Frame>& newest_frame) : newest_frame_(newest_frame) {}
 
     uint32_t ReadData(uint8_t* const data, const uint32_t max_length) override
     {
+        was_busy_ = false;
         if ((nullptr == data) || (0U == max_length))
         {
             return 0U;
         }
 
         uint32_t read_frame_length = 0U;
-        const Frame& newest_frame = buffer_.back();
-        const auto frame_length = newest_frame.length;
-        if (frame_length > max_length)
-        {
-            read_frame_length = 0U;
-        }
-        else
-        {
-            for (auto i = 0U; i < frame_length; i++)
-            {
-                data[i] = newest_frame.data[i];
-            }
-            read_frame_length = frame_length;
-        }
-
-        return read_frame_length;
+        const auto is_consistent = newest_frame_.Read(kDataReadAttempts, [&](const Frame& newest_frame) { read_frame_length = CopyFrame(newest_frame, data, max_length); });
+        was_busy_ = !is_consistent;
+        return is_consistent ? read_frame_length : 0U;
+    }
+    bool WasBusy() const override
+    {
+        return was_busy_;
     }
 
   private:
-    const RealDataCircularBuffer& buffer_;
+    const SeqLockBuffer<Frame>& newest_frame_;
+    bool was_busy_{false};
 };
 
 class LiveDataStoreWriter : public DataWriter
 {
   public:
-    explicit LiveDataStoreWriter(RealDataCircularBuffer& circular_buffer) : buffer_(circular_buffer) {}
+    LiveDataStoreWriter(RealDataCircularBuffer& circular_buffer, DelayStats& delay_stats, SeqLock& sequence)
+        : buffer_(circular_buffer), delay_stats_(delay_stats), sequence_(sequence) {}
     bool SaveData(const uint8_t* const data, const uint32_t data_length) override
     {
         if ((nullptr == data) || (0U == data_length) || kBufferSizeInBytes < data_length)
@@ -78,37 +125,51 @@ class LiveDataStoreWriter : public DataWriter
         {
             new_frame.data[i] = data[i];
         }
+        sequence_.BeginWrite();
         buffer_.push(new_frame);
+        delay_stats_.AddFrame(data, data_length);
+        sequence_.EndWrite();
+        PublishNewestFrame();
 
         return true;
     }
 
   private:
     RealDataCircularBuffer& buffer_;
+    DelayStats& delay_stats_;
+    SeqLock& sequence_;
 };
 
 class HistoryDataStoreReader : public DataReader
 {
   public:
-    explicit HistoryDataStoreReader(const RealDataCircularBuffer& circular_buffer) : buffer_(circular_buffer) {}
+    HistoryDataStoreReader(const RealDataCircularBuffer& circular_buffer, const SeqLock& sequence) : buffer_(circular_buffer), sequence_(sequence) {}
 
     uint32_t ReadData(uint8_t* const data, const uint32_t max_length) override
     {
-        const Frame& frame = buffer_[frame_index_];
-
-        if ((nullptr == data) || (0U == max_length) || frame.length > max_length)
+        was_busy_ = false;
+        if ((nullptr == data) || (0U == max_length))
         {
             return 0U;
         }
 
-        for (auto i = 0U; i < max_length; i++)
+        uint32_t read_frame_length = 0U;
+        const auto is_consistent = sequence_.Read(kDataReadAttempts, [&]() { read_frame_length = CopyFrame(buffer_[frame_index_], data, max_length); });
+        if (!is_consistent)
         {
-            data[i] = frame.data[i];
+            // The same frame is read again next time
+            was_busy_ = true;
+            return 0U;
         }
 
+        // An empty or invalid frame is skipped, the replay goes on with the next one
         IncrementFrameIndex();
 
-        return frame.length;
+        return read_frame_length;
+    }
+    bool WasBusy() const override
+    {
+        return was_busy_;
     }
     void Reset()
     {
@@ -117,7 +178,9 @@ class HistoryDataStoreReader : public DataReader
 
   private:
     const RealDataCircularBuffer& buffer_;
-    uint8_t frame_index_{0};
+    const SeqLock& sequence_;
+    uint8_t frame_index_{0};  // Only used by the reader task
+    bool was_busy_{false};
 
     void IncrementFrameIndex()
     {
@@ -132,7 +195,8 @@ class HistoryDataStoreReader : public DataReader
 class HistoryDataStoreWriter : public DataWriter
 {
   public:
-    explicit HistoryDataStoreWriter(RealDataCircularBuffer& circular_buffer) : buffer_(circular_buffer) {}
+    HistoryDataStoreWriter(RealDataCircularBuffer& circular_buffer, DelayStats& delay_stats, SeqLock& sequence)
+        : buffer_(circular_buffer), delay_stats_(delay_stats), sequence_(sequence) {}
     bool SaveData(const uint8_t* const data, const uint32_t data_length) override
     {
         if ((nullptr == data) || (0U == data_length) || (kBufferSizeInBytes * kNumberOfHistoryFrames < data_length))
@@ -143,14 +207,15 @@ class HistoryDataStoreWriter : public DataWriter
         size_t frame_start_index = 0U;
         auto is_frame_length_info_in_valid_memory = [&]() { return frame_start_index + kBytesInHeader < data_length; };
 
+        sequence_.BeginWrite();
         buffer_.clear();  // Discard the old data
+        delay_stats_.Clear();
         while (!buffer_.full() && is_frame_length_info_in_valid_memory())
         {
-            const auto second_byte_in_frame = frame_start_index + 1;
-            const auto frame_length = kBytesInHeader + (data[second_byte_in_frame] * kBytesPerLed);
-            if (frame_start_index + frame_length > data_length)
+            const auto frame_length = FrameFormat_GetLength(&data[frame_start_index], data_length - frame_start_index);
+            if ((frame_length > kBufferSizeInBytes) || (frame_start_index + frame_length > data_length))
             {
-                // We would read further than the buffer size
+                // Frame would not fit or we would read further than the buffer size
                 break;
             }
             Frame frame{frame_length, {}};
@@ -158,33 +223,140 @@ class HistoryDataStoreWriter : public DataWriter
             {
                 frame.data[i] = data[frame_start_index + i];
             }
+            delay_stats_.AddFrame(&data[frame_start_index], frame_length);
             frame_start_index += frame_length;
             buffer_.push(frame);
         }
 
-        return buffer_.full();  // Buffer has the size of the history. If it full, all data was correctly written
+        const auto is_history_full = buffer_.full();  // Buffer has the size of the history. If it full, all data was correctly written
+        sequence_.EndWrite();
+        PublishNewestFrame();
+
+        return is_history_full;
     }
 
   private:
     RealDataCircularBuffer& buffer_;
+    DelayStats& delay_stats_;
+    SeqLock& sequence_;
 };
 
-static Frame _real_data_buffer[kNumberOfHistoryFrames + 1]{};
-static RealDataCircularBuffer _real_data{static_cast<void*>(&_real_data_buffer[0]), kNumberOfHistoryFrames};
+class HistoryDataStoreAppender : public DataWriter
+{
+  public:
+    HistoryDataStoreAppender(RealDataCircularBuffer& circular_buffer, DelayStats& delay_stats, SeqLock& sequence)
+        : buffer_(circular_buffer), delay_stats_(delay_stats), sequence_(sequence) {}
+    bool SaveData(const uint8_t* const data, const uint32_t data_length) override
+    {
+        if ((nullptr == data) || (0U == data_length) || (kBufferSizeInBytes * kNumberOfHistoryFrames < data_length))
+        {
+            return false;
+        }
+
+        size_t frame_start_index = 0U;
+        uint32_t frame_cnt = 0U;
+        auto is_frame_length_info_in_valid_memory = [&]() { return frame_start_index + kBytesInHeader < data_length; };
+
+        // Keep the old data, the new frames overwrite the oldest ones
+        sequence_.BeginWrite();
+        while ((frame_cnt < kNumberOfHistoryFrames) && is_frame_length_info_in_valid_memory())
+        {
+            const auto frame_length = FrameFormat_GetLength(&data[frame_start_index], data_length - frame_start_index);
+            if ((frame_length > kBufferSizeInBytes) || (frame_start_index + frame_length > data_length))
+            {
+                // Frame would not fit or we would read further than the buffer size
+                break;
+            }
+            Frame frame{frame_length, {}};
+            for (auto i = 0U; i < frame_length; i++)
+            {
+                frame.data[i] = data[frame_start_index + i];
+            }
+            delay_stats_.AddFrame(&data[frame_start_index], frame_length);
+            frame_start_index += frame_length;
+            frame_cnt++;
+            buffer_.push(frame);
+        }
+
+        sequence_.EndWrite();
+        PublishNewestFrame();
+
+        return (frame_cnt > 0U) && (frame_start_index == data_length);  // All data must have been appended
+    }
+
+  private:
+    RealDataCircularBuffer& buffer_;
+    DelayStats& delay_stats_;
+    SeqLock& sequence_;
+};
+
+// Bulk storage, allocated in the external RAM by DataMgr_Init
+static Frame* _real_data_buffer{nullptr};
+static RealDataCircularBuffer _real_data{kNumberOfHistoryFrames};
+static DelayStats _delay_stats{};  // Follows the frames saved in _real_data
+static Frame* _newest_frame_banks{nullptr};
+static SeqLockBuffer<Frame> _newest_frame{};  // Copy of the newest frame of _real_data, read by the live reader
+static SeqLock _real_data_sequence{};         // Changes of _real_data and _delay_stats
 
 static DataReaderMode _data_reader_mode{DataReaderMode::kLive};
 static DataWriterMode _data_writer_mode{DataWriterMode::kMultiple};
-static LiveDataStoreWriter _live_data_store_writer{_real_data};
-static LiveDataStoreReader _live_data_store_reader{_real_data};
-static HistoryDataStoreWriter _history_data_store_writer{_real_data};
-static HistoryDataStoreReader _history_data_store_reader{_real_data};
-static HistoryDataStoreReader _fake_data_store_reader{g_fake_data};
+static std::optional<uint32_t> _newest_sequence{std::nullopt};
+static LiveDataStoreWriter _live_data_store_writer{_real_data, _delay_stats, _real_data_sequence};
+static LiveDataStoreReader _live_data_store_reader{_newest_frame};
+static HistoryDataStoreWriter _history_data_store_writer{_real_data, _delay_stats, _real_data_sequence};
+static HistoryDataStoreAppender _history_data_store_appender{_real_data, _delay_stats, _real_data_sequence};
+static HistoryDataStoreReader _history_data_store_reader{_real_data, _real_data_sequence};
+static OfflineDataReader _offline_data_reader{};
+static DelayDataReader _delay_data_reader{_delay_stats};
+static SequencedDataReader _sequenced_delay_data_reader{_delay_data_reader, _real_data_sequence};
+
+static void PublishNewestFrame()
+{
+    auto& newest_frame = _newest_frame.BeginWrite();
+    newest_frame.length = 0U;
+    if (!_real_data.empty())
+    {
+        const auto& frame = _real_data.back();
+        for (auto i = 0U; i < frame.length; i++)
+        {
+            newest_frame.data[i] = frame.data[i];
+        }
+        newest_frame.length = frame.length;
+    }
+    else
+    {
+        // No frame, the live reader reads nothing
+    }
+    _newest_frame.EndWrite();
+}
+
+void DataMgr_Init()
+{
+    if (nullptr == _real_data_buffer)
+    {
+        _real_data_buffer = static_cast<Frame*>(OswMemoryAllocate(sizeof(Frame) * (kNumberOfHistoryFrames + 1), OswMemoryRegion::kExternal));
+        _real_data.set_buffer(_real_data_buffer);
+        _newest_frame_banks = static_cast<Frame*>(OswMemoryAllocate(sizeof(Frame) * 2U, OswMemoryRegion::kExternal));
+        _newest_frame.Init(_newest_frame_banks);
+        PublishNewestFrame();
+        _delay_stats.Init();
+
+        uint32_t offline_data_size = 0U;
+        const auto offline_data = OfflineData_GetBlob(offline_data_size);
+        (void)_offline_data_reader.Init(offline_data, offline_data_size);
+    }
+}
 
 void DataMgr_Reset()
 {
     _data_reader_mode = DataReaderMode::kLive;
     _data_writer_mode = DataWriterMode::kMultiple;
+    _real_data_sequence.BeginWrite();
     _real_data.clear();
+    _delay_stats.Clear();
+    _real_data_sequence.EndWrite();
+    PublishNewestFrame();
+    _newest_sequence = std::nullopt;
     _history_data_store_reader.Reset();
 }
 
@@ -208,6 +380,35 @@ DataWriterMode DataMgr_GetWriterMode()
     return _data_writer_mode;
 }
 
+void DataMgr_SetNewestSequence(std::optional<uint32_t> sequence)
+{
+    const auto is_following_sequence = sequence.has_value() && _newest_sequence.has_value() && (sequence.value() == (_newest_sequence.value() + 1U));
+    if ((DataWriterMode::kSingle == _data_writer_mode) && !is_following_sequence)
+    {
+        // A frame was missed or received twice, the history must be loaded completely again
+        _newest_sequence = std::nullopt;
+    }
+    else
+    {
+        _newest_sequence = sequence;
+    }
+}
+
+std::optional<uint32_t> DataMgr_GetNewestSequence()
+{
+    return _newest_sequence;
+}
+
+bool DataMgr_IsNewerSequence(std::optional<uint32_t> sequence)
+{
+    return !sequence.has_value() || !_newest_sequence.has_value() || (sequence.value() > _newest_sequence.value());
+}
+
+bool DataMgr_CanAppendHistory()
+{
+    return _newest_sequence.has_value() && _real_data.full();
+}
+
 DataWriter* DataMgr_GetWriter()
 {
     DataWriter* writer = nullptr;
@@ -219,6 +420,10 @@ DataWriter* DataMgr_GetWriter()
     {
         writer = &_history_data_store_writer;
     }
+    else if (DataWriterMode::kAppend == _data_writer_mode)
+    {
+        writer = &_history_data_store_appender;
+    }
     else
     {
         // Not allowed to write
@@ -238,7 +443,10 @@ DataReader* DataMgr_GetReader()
             reader = &_history_data_store_reader;
             break;
         case DataReaderMode::kOffline:
-            reader = &_fake_data_store_reader;
+            reader = &_offline_data_reader;
+            break;
+        case DataReaderMode::kDelay:
+            reader = &_sequenced_delay_data_reader;
             break;
     }
     return reader;
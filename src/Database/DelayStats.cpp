@@ -0,0 +1,253 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "DelayStats.h"
+
+#include "FrameFormat.h"
+#include "Logging.h"
+#include "OsWrapper.h"
+
+#include "etl/algorithm.h"
+#include "etl/array.h"
+
+void DelayStats::Init()
+{
+    if (nullptr == frames_)
+    {
+        frames_ = static_cast<FrameSamples*>(OswMemoryAllocate(sizeof(FrameSamples) * kNumberOfHistoryFrames, OswMemoryRegion::kExternal));
+        segments_ = static_cast<SegmentStats*>(OswMemoryAllocate(sizeof(SegmentStats) * kMaxSegments, OswMemoryRegion::kExternal));
+        active_segments_ = static_cast<uint16_t*>(OswMemoryAllocate(sizeof(uint16_t) * kMaxSegments, OswMemoryRegion::kExternal));
+    }
+    Clear();
+}
+
+void DelayStats::Clear()
+{
+    for (auto i = 0U; i < number_of_active_segments_; i++)
+    {
+        segments_[active_segments_[i]] = SegmentStats{};
+    }
+    number_of_active_segments_ = 0U;
+    oldest_frame_ = 0U;
+    number_of_frames_ = 0U;
+}
+
+void DelayStats::AddFrame(const uint8_t* const frame, uint32_t length)
+{
+    ASSERT(nullptr != frames_);
+    if (0U != number_of_frames_)
+    {
+        for (auto i = 0U; i < GetNewestFrame().count; i++)
+        {
+            segments_[GetNewestFrame().samples[i].segment].current = 0U;
+        }
+    }
+    if (kNumberOfHistoryFrames == number_of_frames_)
+    {
+        DropOldestFrame();
+    }
+
+    number_of_frames_++;
+    auto& newest_frame = GetNewestFrame();
+    ExtractSamples(frame, length, newest_frame);
+    for (auto i = 0U; i < newest_frame.count; i++)
+    {
+        AddSample(newest_frame.samples[i]);
+    }
+}
+
+std::optional<DelayStats::SegmentDelay> DelayStats::GetSegment(uint16_t led_id) const
+{
+    std::optional<SegmentDelay> delay{std::nullopt};
+    const auto stats = ((led_id < kMaxSegments) && (nullptr != segments_)) ? segments_[led_id] : SegmentStats{};
+    if (0U != stats.count)
+    {
+        const auto average = (stats.sum + (stats.count / 2U)) / stats.count;
+        delay = SegmentDelay{stats.current, stats.max, static_cast<uint8_t>(average)};
+    }
+    else
+    {
+        // No train on this segment
+    }
+    return delay;
+}
+
+uint16_t DelayStats::GetSegmentId(uint32_t index) const
+{
+    ASSERT((index < kMaxSegments) && (nullptr != active_segments_));
+    return active_segments_[index];
+}
+
+void DelayStats::DropOldestFrame()
+{
+    // Dropped from the ring first, so that it is not searched for the new maximums
+    const auto& oldest_frame = frames_[oldest_frame_];
+    oldest_frame_ = (oldest_frame_ + 1U) % kNumberOfHistoryFrames;
+    number_of_frames_--;
+    for (auto i = 0U; i < oldest_frame.count; i++)
+    {
+        RemoveSample(oldest_frame.samples[i]);
+    }
+}
+
+void DelayStats::AddSample(const Sample& sample)
+{
+    auto& stats = segments_[sample.segment];
+    if (0U == stats.count)
+    {
+        stats.active_index = static_cast<uint16_t>(number_of_active_segments_);
+        active_segments_[number_of_active_segments_] = sample.segment;
+        number_of_active_segments_++;
+    }
+    stats.sum += sample.delay;
+    stats.count++;
+    stats.max = etl::max(stats.max, sample.delay);
+    stats.current = etl::max(stats.current, sample.delay);  // Several trains on the same segment
+}
+
+void DelayStats::RemoveSample(const Sample& sample)
+{
+    auto& stats = segments_[sample.segment];
+    ASSERT(0U != stats.count);
+    stats.sum -= sample.delay;
+    stats.count--;
+    if (0U == stats.count)
+    {
+        // Replaced by the last active segment
+        const auto last_segment = active_segments_[number_of_active_segments_ - 1U];
+        active_segments_[stats.active_index] = last_segment;
+        segments_[last_segment].active_index = stats.active_index;
+        number_of_active_segments_--;
+        stats = SegmentStats{};
+    }
+    else if (sample.delay == stats.max)
+    {
+        stats.max = FindMaxDelay(sample.segment);
+    }
+    else
+    {
+        // The maximum is still in the stored frames
+    }
+}
+
+uint8_t DelayStats::FindMaxDelay(uint16_t segment) const
+{
+    uint8_t max_delay = 0U;
+    for (auto i = 0U; i < number_of_frames_; i++)
+    {
+        const auto& frame = frames_[(oldest_frame_ + i) % kNumberOfHistoryFrames];
+        for (auto j = 0U; j < frame.count; j++)
+        {
+            if (frame.samples[j].segment == segment)
+            {
+                max_delay = etl::max(max_delay, frame.samples[j].delay);
+            }
+        }
+    }
+    return max_delay;
+}
+
+void DelayStats::ExtractSamples(const uint8_t* const frame, uint32_t length, FrameSamples& samples)
+{
+    samples.count = 0U;
+    const auto has_delays = (nullptr != frame) && (length >= kBytesInHeader) && FrameFormat_HasTrains(frame) && FrameFormat_HasDelays(frame) &&
+                            (FrameFormat_GetLength(frame, length) == length);
+    if (has_delays)
+    {
+        const auto nr_of_leds = FrameFormat_GetNumberOfLeds(frame);
+        const auto nr_of_trains = etl::min(FrameFormat_GetNumberOfTrains(frame), kMaxTrains);
+        const auto trains_offset = FrameFormat_GetTrainsOffset(frame) + kBytesInTrainHeader;
+        const auto delays_offset = FrameFormat_GetDelaysOffset(frame);
+        for (auto i = 0U; i < nr_of_trains; i++)
+        {
+            const auto pos = trains_offset + (i * kBytesPerTrain);
+            const auto led_index = static_cast<uint32_t>((frame[pos + 2U] << 8) | frame[pos + 3U]);
+            const auto led_pos = kBytesInHeader + (led_index * kBytesPerLed);
+            const auto segment = (led_index < nr_of_leds) ? ((frame[led_pos] << 8U) | frame[led_pos + 1U]) : kMaxSegments;  // LED id
+            if (segment < kMaxSegments)
+            {
+                samples.samples[samples.count] = Sample{static_cast<uint16_t>(segment), frame[delays_offset + i]};
+                samples.count++;
+            }
+            else
+            {
+                // Invalid train, ignored
+            }
+        }
+    }
+    else
+    {
+        // No delays, e.g. a frame of a server that does not send them yet
+    }
+}
+
+uint32_t DelayDataReader::ReadData(uint8_t* const data, const uint32_t max_length)
+{
+    uint32_t length = 0U;
+    if ((nullptr == data) || (max_length < kBytesInHeader))
+    {
+        // Nothing to read
+    }
+    else
+    {
+        const auto max_leds = etl::min((max_length - kBytesInHeader) / kBytesPerLed, kMaxLedsOn);
+        const auto nr_of_leds = etl::min(delay_stats_.GetNumberOfSegments(), max_leds);
+        data[0] = static_cast<uint8_t>(nr_of_leds >> 8U);
+        data[1] = static_cast<uint8_t>(nr_of_leds);
+        // The statistics may be changed by the writer during the read, see DataManager.cpp: the count is only read
+        // once, the segments dropped meanwhile are read as inactive and the sequence check discards the frame
+        for (auto i = 0U; i < nr_of_leds; i++)
+        {
+            const auto segment = delay_stats_.GetSegmentId(i);
+            const auto segment_delay = delay_stats_.GetSegment(segment);
+            const auto color = GetDelayColor(segment_delay.has_value() ? segment_delay.value().average : 0U);
+            auto* led = &data[kBytesInHeader + (i * kBytesPerLed)];
+            led[0] = static_cast<uint8_t>(segment >> 8U);
+            led[1] = static_cast<uint8_t>(segment);
+            led[2] = static_cast<uint8_t>(color >> 16U);
+            led[3] = static_cast<uint8_t>(color >> 8U);
+            led[4] = static_cast<uint8_t>(color);
+        }
+        length = kBytesInHeader + (nr_of_leds * kBytesPerLed);
+    }
+    return length;
+}
+
+uint32_t DelayDataReader::GetDelayColor(uint8_t delay_minutes)
+{
+    struct DelayColor
+    {
+        uint8_t min_delay_minutes;
+        uint32_t color;
+    };
+    // clang-format off
+    static constexpr etl::array<DelayColor, 4> kDelayColors{{
+        {0U,  0x00FF00U},  // On time
+        {3U,  0xFFFF00U},  // Late by the punctuality of the Swiss railways
+        {6U,  0xFF8000U},
+        {10U, 0xFF0000U},
+    }};
+    // clang-format on
+    uint32_t color = kDelayColors[0].color;
+    for (const auto& delay_color : kDelayColors)
+    {
+        if (delay_minutes >= delay_color.min_delay_minutes)
+        {
+            color = delay_color.color;
+        }
+    }
+    return color;
+}
@@ -0,0 +1,115 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DELAY_STATS_H_
+#define DELAY_STATS_H_
+
+#include "DataManager.h"
+#include "FwConfig.h"
+
+#include <cstdint>
+#include <optional>
+
+/// @brief Delays of the trains per segment of the network over the stored history
+/// @details A segment is the part of the network shown by a LED, it has the id of the LED. The
+/// delays come from the frames with a train section and delays, see FrameFormat.h. The statistics
+/// are updated with each saved frame, only the segments of the newest and the dropped frames are
+/// touched. The maximum of a segment is searched again in the kept samples only when its maximum
+/// is dropped.
+class DelayStats
+{
+  public:
+    struct SegmentDelay
+    {
+        uint8_t current;  // Minutes, delay of the train on the segment in the newest frame, 0 if none
+        uint8_t max;      // Minutes, over the stored frames
+        uint8_t average;  // Minutes, over the trains that were on the segment in the stored frames
+    };
+
+    /// @brief Allocate the statistics in the external RAM, call it once before any other function
+    void Init();
+
+    /// @brief Forget all frames, as when the history is cleared
+    void Clear();
+
+    /// @brief Add the delays of the newest frame saved in the history, dropping the oldest frame
+    /// if there are already `kNumberOfHistoryFrames`. A frame without delays counts as a frame
+    /// without trains.
+    void AddFrame(const uint8_t* const frame, uint32_t length);
+
+    /// @return `std::nullopt` if no train was on the segment in the stored frames
+    std::optional<SegmentDelay> GetSegment(uint16_t led_id) const;
+
+    /// @brief Segments on which a train was in the stored frames, in no particular order
+    uint32_t GetNumberOfSegments() const { return number_of_active_segments_; }
+
+    /// @brief Only bounded by the storage: a reader racing the writer may use a count that was read before segments
+    /// were dropped, it then gets the id of an inactive segment.
+    uint16_t GetSegmentId(uint32_t index) const;
+
+  private:
+    static constexpr uint32_t kMaxSegments = kNumberOfStrips << 8U;  // All the LED ids
+
+    struct Sample
+    {
+        uint16_t segment;
+        uint8_t delay;
+    };
+    struct FrameSamples
+    {
+        uint32_t count;
+        Sample samples[kMaxTrains];
+    };
+    struct SegmentStats
+    {
+        uint32_t sum;
+        uint16_t count;  // Trains on the segment in the stored frames
+        uint8_t max;
+        uint8_t current;
+        uint16_t active_index;  // Index in the active segments if count is not zero
+    };
+
+    FrameSamples* frames_{nullptr};  // Ring of kNumberOfHistoryFrames
+    uint32_t oldest_frame_{0U};
+    uint32_t number_of_frames_{0U};
+    SegmentStats* segments_{nullptr};  // Indexed by the segment id
+    uint16_t* active_segments_{nullptr};
+    uint32_t number_of_active_segments_{0U};
+
+    FrameSamples& GetNewestFrame() { return frames_[(oldest_frame_ + number_of_frames_ - 1U) % kNumberOfHistoryFrames]; }
+    void DropOldestFrame();
+    void AddSample(const Sample& sample);
+    void RemoveSample(const Sample& sample);
+    uint8_t FindMaxDelay(uint16_t segment) const;
+    static void ExtractSamples(const uint8_t* const frame, uint32_t length, FrameSamples& samples);
+};
+
+/// @brief Reads the delay view, one LED per segment of the delay statistics with the color of its average delay
+/// @details The view is a frame without train section, at most `kMaxLedsOn` LEDs as a live frame.
+class DelayDataReader : public DataReader
+{
+  public:
+    explicit DelayDataReader(const DelayStats& delay_stats) : delay_stats_(delay_stats) {}
+    uint32_t ReadData(uint8_t* const data, const uint32_t max_length) override;
+
+    /// @brief Color of the segments, from green (on time) to red
+    static uint32_t GetDelayColor(uint8_t delay_minutes);
+
+  private:
+    const DelayStats& delay_stats_;
+};
+
+#endif  // DELAY_STATS_H_
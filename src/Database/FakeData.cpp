@@ -1,77 +0,0 @@
-
-// Trainboard.ch
-// Copyright (C) 2024 Emile Dcosterd
-//
-// This program is free software: you can redistribute it and/or modify
-// it under the terms of the GNU General Public License as published by
-// the Free Software Foundation, either version 3 of the License, or
-// (at your option) any later version.
-//
-// This program is distributed in the hope that it will be useful,
-// but WITHOUT ANY WARRANTY; without even the implied warranty of
-// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-// GNU General Public License for more details.
-//
-// You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
-
-#include "FakeData.h"
-#include "DataManagerTypes.h"
-
-#include <etl/array.h>
-#include <etl/circular_buffer.h>
-
-// clang-format off
-static const Frame _fake_frames[kNumberOfHistoryFrames + 1] = {
-    {247, {0, 49, 2, 58, 255, 255, 255, 2, 61, 255, 255, 255, 2, 44, 255, 255, 255, 1, 63, 255, 255, 255, 3, 44, 255, 255, 255, 1, 0, 255, 0, 0, 3, 80, 255, 0, 0, 1, 0, 255, 0, 0, 3, 80, 255, 0, 0, 2, 49, 252, 3, 248, 2, 47, 252, 3, 248, 2, 66, 254, 199, 11, 2, 52, 254, 199, 11, 2, 35, 254, 199, 11, 2, 15, 0, 152, 74, 3, 45, 0, 152, 74, 3, 45, 0, 152, 74, 3, 31, 0, 152, 74, 3, 83, 255, 128, 0, 3, 67, 255, 128, 0, 0, 9, 255, 128, 0, 3, 67, 255, 128, 0, 0, 79, 255, 128, 0, 0, 69, 255, 128, 0, 0, 52, 255, 128, 0, 0, 52, 255, 128, 0, 0, 68, 255, 128, 0, 0, 9, 255, 128, 0, 0, 79, 255, 128, 0, 2, 3, 255, 0, 0, 2, 4, 255, 0, 0, 1, 45, 140, 198, 62, 2, 9, 140, 198, 62, 1, 43, 140, 198, 62, 1, 34, 252, 3, 248, 1, 34, 252, 3, 248, 2, 9, 252, 3, 248, 1, 33, 0, 138, 198, 2, 16, 255, 255, 255, 0, 3, 0, 0, 255, 0, 49, 0, 0, 255, 0, 19, 0, 0, 255, 0, 3, 0, 0, 255, 0, 41, 0, 0, 255, 0, 49, 0, 0, 255, 0, 19, 0, 0, 255, 0, 40, 0, 0, 255, 0, 28, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {247, {0, 49, 2, 60, 255, 255, 255, 2, 74, 255, 255, 255, 2, 44, 255, 255, 255, 1, 63, 255, 255, 255, 2, 58, 255, 255, 255, 3, 44, 255, 255, 255, 1, 0, 255, 0, 0, 3, 80, 255, 0, 0, 1, 0, 255, 0, 0, 3, 80, 255, 0, 0, 2, 49, 252, 3, 248, 2, 47, 252, 3, 248, 2, 65, 254, 199, 11, 2, 19, 254, 199, 11, 2, 52, 254, 199, 11, 2, 35, 254, 199, 11, 2, 15, 0, 152, 74, 3, 45, 0, 152, 74, 3, 45, 0, 152, 74, 3, 30, 0, 152, 74, 0, 51, 255, 128, 0, 0, 10, 255, 128, 0, 3, 67, 255, 128, 0, 0, 79, 255, 128, 0, 0, 68, 255, 128, 0, 3, 1, 255, 128, 0, 3, 11, 255, 128, 0, 0, 8, 255, 128, 0, 3, 83, 255, 128, 0, 0, 80, 255, 128, 0, 0, 69, 255, 128, 0, 0, 52, 255, 128, 0, 2, 3, 255, 0, 0, 2, 4, 255, 0, 0, 2, 9, 140, 198, 62, 1, 45, 140, 198, 62, 1, 34, 252, 3, 248, 1, 34, 252, 3, 248, 2, 9, 252, 3, 248, 1, 34, 0, 138, 198, 2, 16, 255, 255, 255, 0, 42, 0, 0, 255, 0, 2, 0, 0, 255, 0, 19, 0, 0, 255, 0, 49, 0, 0, 255, 0, 49, 0, 0, 255, 0, 40, 0, 0, 255, 0, 19, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {257, {0, 51, 2, 74, 255, 255, 255, 1, 62, 255, 255, 255, 3, 45, 255, 255, 255, 2, 44, 255, 255, 255, 2, 60, 255, 255, 255, 2, 58, 255, 255, 255, 3, 80, 255, 0, 0, 1, 1, 255, 0, 0, 1, 21, 255, 0, 0, 3, 80, 255, 0, 0, 0, 19, 255, 0, 0, 3, 20, 252, 3, 248, 2, 49, 252, 3, 248, 2, 47, 252, 3, 248, 2, 35, 254, 199, 11, 2, 65, 254, 199, 11, 2, 19, 254, 199, 11, 2, 52, 254, 199, 11, 2, 15, 0, 152, 74, 3, 30, 0, 152, 74, 3, 44, 0, 152, 74, 3, 46, 0, 152, 74, 0, 10, 255, 128, 0, 0, 53, 255, 128, 0, 0, 51, 255, 128, 0, 0, 69, 255, 128, 0, 0, 8, 255, 128, 0, 0, 80, 255, 128, 0, 0, 68, 255, 128, 0, 3, 11, 255, 128, 0, 0, 79, 255, 128, 0, 3, 1, 255, 128, 0, 3, 2, 255, 128, 0, 3, 67, 255, 128, 0, 2, 4, 255, 0, 0, 2, 3, 255, 0, 0, 1, 44, 140, 198, 62, 2, 9, 140, 198, 62, 1, 33, 252, 3, 248, 2, 9, 252, 3, 248, 3, 66, 0, 138, 198, 1, 34, 0, 138, 198, 3, 2, 255, 255, 255, 0, 2, 0, 0, 255, 0, 29, 0, 0, 255, 0, 49, 0, 0, 255, 0, 20, 0, 0, 255, 0, 19, 0, 0, 255, 0, 39, 0, 0, 255, 0, 42, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {257, {0, 51, 3, 64, 255, 255, 255, 2, 74, 255, 255, 255, 1, 62, 255, 255, 255, 3, 45, 255, 255, 255, 2, 43, 255, 255, 255, 3, 12, 255, 255, 255, 2, 60, 255, 255, 255, 2, 58, 255, 255, 255, 0, 4, 255, 0, 0, 1, 1, 255, 0, 0, 3, 11, 255, 0, 0, 1, 21, 255, 0, 0, 0, 19, 255, 0, 0, 2, 47, 252, 3, 248, 2, 49, 252, 3, 248, 3, 20, 252, 3, 248, 2, 35, 254, 199, 11, 2, 19, 254, 199, 11, 2, 53, 254, 199, 11, 2, 65, 254, 199, 11, 3, 29, 0, 152, 74, 2, 14, 0, 152, 74, 3, 46, 0, 152, 74, 3, 44, 0, 152, 74, 0, 67, 255, 128, 0, 0, 50, 255, 128, 0, 3, 11, 255, 128, 0, 3, 67, 255, 128, 0, 0, 7, 255, 128, 0, 0, 11, 255, 128, 0, 0, 53, 255, 128, 0, 0, 79, 255, 128, 0, 0, 70, 255, 128, 0, 3, 2, 255, 128, 0, 0, 80, 255, 128, 0, 3, 1, 255, 128, 0, 2, 4, 255, 0, 0, 2, 3, 255, 0, 0, 1, 44, 140, 198, 62, 2, 9, 140, 198, 62, 1, 44, 140, 198, 62, 1, 32, 252, 3, 248, 3, 0, 0, 138, 198, 3, 66, 0, 138, 198, 3, 2, 255, 255, 255, 0, 29, 0, 0, 255, 0, 19, 0, 0, 255, 0, 20, 0, 0, 255, 0, 43, 0, 0, 255, 0, 2, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {247, {0, 49, 1, 61, 255, 255, 255, 3, 12, 255, 255, 255, 2, 60, 255, 255, 255, 3, 64, 255, 255, 255, 2, 73, 255, 255, 255, 2, 43, 255, 255, 255, 2, 59, 255, 255, 255, 3, 46, 255, 255, 255, 3, 63, 171, 140, 34, 1, 1, 255, 0, 0, 0, 4, 255, 0, 0, 3, 11, 255, 0, 0, 1, 22, 255, 0, 0, 0, 19, 255, 0, 0, 3, 20, 252, 3, 248, 2, 48, 252, 3, 248, 2, 34, 254, 199, 11, 2, 20, 254, 199, 11, 2, 65, 254, 199, 11, 2, 53, 254, 199, 11, 3, 43, 0, 152, 74, 2, 14, 0, 152, 74, 3, 29, 0, 152, 74, 3, 1, 255, 128, 0, 0, 7, 255, 128, 0, 3, 77, 255, 128, 0, 3, 10, 255, 128, 0, 0, 50, 255, 128, 0, 0, 12, 255, 128, 0, 0, 67, 255, 128, 0, 3, 66, 255, 128, 0, 3, 3, 255, 128, 0, 0, 54, 255, 128, 0, 0, 70, 255, 128, 0, 2, 4, 255, 0, 0, 2, 3, 255, 0, 0, 1, 44, 140, 198, 62, 1, 44, 140, 198, 62, 2, 8, 140, 198, 62, 2, 18, 252, 3, 248, 1, 32, 252, 3, 248, 3, 66, 0, 138, 198, 3, 0, 0, 138, 198, 3, 3, 255, 255, 255, 0, 30, 0, 0, 255, 0, 19, 0, 0, 255, 0, 1, 0, 0, 255, 0, 20, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {277, {0, 55, 1, 61, 255, 255, 255, 3, 12, 255, 255, 255, 2, 59, 255, 255, 255, 3, 64, 255, 255, 255, 2, 73, 255, 255, 255, 2, 43, 255, 255, 255, 2, 59, 255, 255, 255, 3, 46, 255, 255, 255, 3, 63, 171, 140, 34, 1, 2, 255, 0, 0, 0, 4, 255, 0, 0, 3, 10, 255, 0, 0, 3, 79, 255, 0, 0, 1, 22, 255, 0, 0, 3, 81, 255, 0, 0, 0, 18, 255, 0, 0, 1, 20, 255, 0, 0, 3, 20, 252, 3, 248, 2, 48, 252, 3, 248, 2, 34, 254, 199, 11, 2, 20, 254, 199, 11, 2, 64, 254, 199, 11, 2, 53, 254, 199, 11, 3, 43, 0, 152, 74, 2, 14, 0, 152, 74, 3, 28, 0, 152, 74, 3, 0, 255, 128, 0, 0, 6, 255, 128, 0, 3, 77, 255, 128, 0, 3, 10, 255, 128, 0, 0, 50, 255, 128, 0, 0, 12, 255, 128, 0, 3, 66, 255, 128, 0, 0, 78, 255, 128, 0, 3, 3, 255, 128, 0, 0, 54, 255, 128, 0, 0, 71, 255, 128, 0, 2, 4, 255, 0, 0, 2, 3, 255, 0, 0, 1, 44, 140, 198, 62, 1, 44, 140, 198, 62, 2, 8, 140, 198, 62, 1, 35, 140, 198, 62, 2, 18, 252, 3, 248, 2, 10, 252, 3, 248, 1, 31, 252, 3, 248, 3, 66, 0, 138, 198, 3, 1, 0, 138, 198, 3, 3, 255, 255, 255, 0, 30, 0, 0, 255, 0, 18, 0, 0, 255, 0, 4, 0, 0, 255, 0, 0, 0, 0, 255, 0, 38, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {282, {0, 56, 1, 60, 255, 255, 255, 3, 13, 255, 255, 255, 2, 59, 255, 255, 255, 3, 64, 255, 255, 255, 2, 72, 255, 255, 255, 2, 43, 255, 255, 255, 2, 59, 255, 255, 255, 3, 63, 171, 140, 34, 1, 2, 255, 0, 0, 0, 4, 255, 0, 0, 3, 10, 255, 0, 0, 3, 79, 255, 0, 0, 1, 22, 255, 0, 0, 3, 81, 255, 0, 0, 0, 18, 255, 0, 0, 1, 20, 255, 0, 0, 3, 20, 252, 3, 248, 2, 48, 252, 3, 248, 2, 69, 252, 3, 248, 2, 34, 254, 199, 11, 2, 21, 254, 199, 11, 2, 64, 254, 199, 11, 2, 53, 254, 199, 11, 3, 42, 0, 152, 74, 2, 13, 0, 152, 74, 3, 28, 0, 152, 74, 3, 47, 0, 152, 74, 3, 0, 255, 128, 0, 0, 6, 255, 128, 0, 3, 77, 255, 128, 0, 3, 10, 255, 128, 0, 0, 13, 255, 128, 0, 3, 66, 255, 128, 0, 0, 78, 255, 128, 0, 3, 3, 255, 128, 0, 0, 81, 255, 128, 0, 0, 54, 255, 128, 0, 0, 71, 255, 128, 0, 2, 3, 255, 0, 0, 1, 44, 140, 198, 62, 2, 8, 140, 198, 62, 1, 35, 140, 198, 62, 2, 18, 252, 3, 248, 2, 10, 252, 3, 248, 1, 31, 252, 3, 248, 3, 66, 0, 138, 198, 3, 1, 0, 138, 198, 3, 3, 255, 255, 255, 0, 31, 0, 0, 255, 0, 18, 0, 0, 255, 0, 4, 0, 0, 255, 0, 0, 0, 0, 255, 0, 48, 0, 0, 255, 0, 38, 0, 0, 255, 0, 44, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {307, {0, 61, 1, 60, 255, 255, 255, 3, 13, 255, 255, 255, 2, 59, 255, 255, 255, 3, 65, 255, 255, 255, 2, 72, 255, 255, 255, 2, 42, 255, 255, 255, 2, 59, 255, 255, 255, 3, 63, 171, 140, 34, 1, 2, 255, 0, 0, 0, 4, 255, 0, 0, 3, 9, 255, 0, 0, 3, 79, 255, 0, 0, 1, 23, 255, 0, 0, 3, 81, 255, 0, 0, 0, 18, 255, 0, 0, 1, 19, 255, 0, 0, 3, 21, 252, 3, 248, 2, 48, 252, 3, 248, 2, 69, 252, 3, 248, 2, 33, 254, 199, 11, 2, 21, 254, 199, 11, 2, 64, 254, 199, 11, 2, 54, 254, 199, 11, 3, 42, 0, 152, 74, 2, 13, 0, 152, 74, 3, 27, 0, 152, 74, 3, 48, 0, 152, 74, 3, 0, 255, 128, 0, 0, 5, 255, 128, 0, 3, 77, 255, 128, 0, 3, 9, 255, 128, 0, 0, 58, 255, 128, 0, 0, 13, 255, 128, 0, 0, 66, 255, 128, 0, 3, 66, 255, 128, 0, 0, 77, 255, 128, 0, 3, 4, 255, 128, 0, 0, 81, 255, 128, 0, 0, 55, 255, 128, 0, 0, 72, 255, 128, 0, 2, 5, 255, 0, 0, 2, 3, 255, 0, 0, 1, 43, 140, 198, 62, 1, 44, 140, 198, 62, 2, 8, 140, 198, 62, 1, 36, 140, 198, 62, 2, 18, 252, 3, 248, 2, 10, 252, 3, 248, 1, 30, 252, 3, 248, 3, 66, 0, 138, 198, 3, 2, 0, 138, 198, 3, 4, 255, 255, 255, 0, 31, 0, 0, 255, 0, 18, 0, 0, 255, 0, 4, 0, 0, 255, 0, 5, 0, 0, 255, 0, 48, 0, 0, 255, 0, 38, 0, 0, 255, 0, 22, 0, 0, 255, 0, 44, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {307, {0, 61, 1, 59, 255, 255, 255, 3, 13, 255, 255, 255, 2, 58, 255, 255, 255, 3, 65, 255, 255, 255, 2, 71, 255, 255, 255, 2, 42, 255, 255, 255, 2, 60, 255, 255, 255, 3, 62, 171, 140, 34, 1, 2, 255, 0, 0, 0, 4, 255, 0, 0, 3, 9, 255, 0, 0, 3, 79, 255, 0, 0, 1, 23, 255, 0, 0, 3, 81, 255, 0, 0, 0, 18, 255, 0, 0, 1, 19, 255, 0, 0, 3, 21, 252, 3, 248, 2, 40, 252, 3, 248, 2, 70, 252, 3, 248, 2, 33, 254, 199, 11, 2, 21, 254, 199, 11, 2, 64, 254, 199, 11, 2, 54, 254, 199, 11, 3, 41, 0, 152, 74, 2, 12, 0, 152, 74, 3, 27, 0, 152, 74, 3, 48, 0, 152, 74, 3, 0, 255, 128, 0, 0, 5, 255, 128, 0, 3, 78, 255, 128, 0, 3, 9, 255, 128, 0, 0, 58, 255, 128, 0, 0, 14, 255, 128, 0, 0, 66, 255, 128, 0, 3, 66, 255, 128, 0, 0, 77, 255, 128, 0, 3, 4, 255, 128, 0, 0, 81, 255, 128, 0, 0, 55, 255, 128, 0, 0, 72, 255, 128, 0, 2, 5, 255, 0, 0, 2, 3, 255, 0, 0, 1, 43, 140, 198, 62, 1, 45, 140, 198, 62, 2, 7, 140, 198, 62, 1, 36, 140, 198, 62, 2, 18, 252, 3, 248, 2, 11, 252, 3, 248, 1, 30, 252, 3, 248, 3, 66, 0, 138, 198, 3, 2, 0, 138, 198, 3, 4, 255, 255, 255, 0, 32, 0, 0, 255, 0, 17, 0, 0, 255, 0, 4, 0, 0, 255, 0, 6, 0, 0, 255, 0, 48, 0, 0, 255, 0, 37, 0, 0, 255, 0, 22, 0, 0, 255, 0, 44, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {287, {0, 57, 1, 59, 255, 255, 255, 3, 13, 255, 255, 255, 2, 58, 255, 255, 255, 3, 65, 255, 255, 255, 2, 71, 255, 255, 255, 2, 42, 255, 255, 255, 2, 60, 255, 255, 255, 3, 62, 171, 140, 34, 1, 3, 255, 0, 0, 3, 8, 255, 0, 0, 3, 78, 255, 0, 0, 1, 24, 255, 0, 0, 0, 17, 255, 0, 0, 1, 18, 255, 0, 0, 3, 22, 252, 3, 248, 2, 40, 252, 3, 248, 2, 70, 252, 3, 248, 2, 33, 254, 199, 11, 2, 22, 254, 199, 11, 2, 63, 254, 199, 11, 2, 54, 254, 199, 11, 3, 41, 0, 152, 74, 2, 12, 0, 152, 74, 3, 26, 0, 152, 74, 3, 49, 0, 152, 74, 3, 12, 0, 152, 74, 0, 0, 255, 128, 0, 3, 78, 255, 128, 0, 3, 8, 255, 128, 0, 0, 58, 255, 128, 0, 0, 65, 255, 128, 0, 3, 66, 255, 128, 0, 0, 76, 255, 128, 0, 3, 5, 255, 128, 0, 0, 81, 255, 128, 0, 0, 55, 255, 128, 0, 0, 73, 255, 128, 0, 2, 5, 255, 0, 0, 1, 43, 140, 198, 62, 1, 45, 140, 198, 62, 1, 37, 140, 198, 62, 2, 17, 252, 3, 248, 2, 11, 252, 3, 248, 1, 29, 252, 3, 248, 1, 21, 252, 3, 248, 3, 66, 0, 138, 198, 3, 3, 0, 138, 198, 3, 4, 255, 255, 255, 0, 32, 0, 0, 255, 0, 17, 0, 0, 255, 0, 4, 0, 0, 255, 0, 6, 0, 0, 255, 0, 47, 0, 0, 255, 0, 37, 0, 0, 255, 0, 21, 0, 0, 255, 0, 45, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {292, {0, 58, 2, 42, 255, 255, 255, 2, 58, 255, 255, 255, 3, 14, 255, 255, 255, 3, 65, 255, 255, 255, 1, 58, 255, 255, 255, 2, 70, 255, 255, 255, 2, 60, 255, 255, 255, 3, 62, 171, 140, 34, 3, 64, 255, 0, 0, 1, 18, 255, 0, 0, 3, 8, 255, 0, 0, 0, 17, 255, 0, 0, 3, 78, 255, 0, 0, 1, 24, 255, 0, 0, 1, 3, 255, 0, 0, 2, 40, 252, 3, 248, 3, 22, 252, 3, 248, 2, 71, 252, 3, 248, 2, 63, 254, 199, 11, 2, 22, 254, 199, 11, 2, 33, 254, 199, 11, 2, 54, 254, 199, 11, 2, 12, 0, 152, 74, 3, 40, 0, 152, 74, 3, 12, 0, 152, 74, 3, 26, 0, 152, 74, 3, 49, 0, 152, 74, 0, 76, 255, 128, 0, 0, 0, 255, 128, 0, 3, 66, 255, 128, 0, 3, 78, 255, 128, 0, 0, 65, 255, 128, 0, 0, 56, 255, 128, 0, 0, 73, 255, 128, 0, 0, 81, 255, 128, 0, 3, 5, 255, 128, 0, 3, 8, 255, 128, 0, 0, 59, 255, 128, 0, 2, 5, 255, 0, 0, 1, 37, 140, 198, 62, 1, 45, 140, 198, 62, 1, 42, 140, 198, 62, 2, 11, 252, 3, 248, 1, 21, 252, 3, 248, 1, 29, 252, 3, 248, 2, 17, 252, 3, 248, 3, 66, 0, 138, 198, 3, 3, 0, 138, 198, 3, 5, 255, 255, 255, 0, 7, 0, 0, 255, 0, 33, 0, 0, 255, 0, 47, 0, 0, 255, 0, 22, 0, 0, 255, 0, 17, 0, 0, 255, 0, 45, 0, 0, 255, 0, 4, 0, 0, 255, 0, 36, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {282, {0, 56, 1, 57, 255, 255, 255, 2, 70, 255, 255, 255, 2, 41, 255, 255, 255, 2, 60, 255, 255, 255, 3, 14, 255, 255, 255, 2, 57, 255, 255, 255, 3, 61, 171, 140, 34, 3, 82, 255, 0, 0, 3, 7, 255, 0, 0, 1, 3, 255, 0, 0, 1, 25, 255, 0, 0, 3, 78, 255, 0, 0, 0, 17, 255, 0, 0, 1, 18, 255, 0, 0, 3, 64, 255, 0, 0, 2, 71, 252, 3, 248, 2, 41, 252, 3, 248, 3, 22, 252, 3, 248, 2, 63, 254, 199, 11, 2, 55, 254, 199, 11, 2, 23, 254, 199, 11, 3, 25, 0, 152, 74, 3, 13, 0, 152, 74, 3, 50, 0, 152, 74, 2, 11, 0, 152, 74, 3, 40, 0, 152, 74, 0, 59, 255, 128, 0, 0, 1, 255, 128, 0, 3, 78, 255, 128, 0, 0, 15, 255, 128, 0, 3, 66, 255, 128, 0, 0, 65, 255, 128, 0, 0, 56, 255, 128, 0, 0, 75, 255, 128, 0, 0, 82, 255, 128, 0, 3, 5, 255, 128, 0, 1, 34, 255, 128, 0, 3, 8, 255, 128, 0, 0, 74, 255, 128, 0, 2, 5, 255, 0, 0, 1, 41, 140, 198, 62, 1, 38, 140, 198, 62, 2, 12, 252, 3, 248, 1, 22, 252, 3, 248, 1, 28, 252, 3, 248, 2, 17, 252, 3, 248, 3, 66, 0, 138, 198, 3, 4, 0, 138, 198, 3, 5, 255, 255, 255, 0, 8, 0, 0, 255, 0, 46, 0, 0, 255, 0, 33, 0, 0, 255, 0, 22, 0, 0, 255, 0, 45, 0, 0, 255, 0, 36, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {257, {0, 51, 3, 14, 255, 255, 255, 2, 70, 255, 255, 255, 1, 57, 255, 255, 255, 2, 41, 255, 255, 255, 2, 57, 255, 255, 255, 2, 61, 255, 255, 255, 3, 61, 171, 140, 34, 3, 82, 255, 0, 0, 3, 78, 255, 0, 0, 3, 7, 255, 0, 0, 1, 4, 255, 0, 0, 1, 17, 255, 0, 0, 3, 64, 255, 0, 0, 1, 25, 255, 0, 0, 2, 38, 252, 3, 248, 2, 41, 252, 3, 248, 2, 72, 252, 3, 248, 2, 63, 254, 199, 11, 2, 55, 254, 199, 11, 2, 23, 254, 199, 11, 3, 50, 0, 152, 74, 3, 13, 0, 152, 74, 3, 39, 0, 152, 74, 2, 11, 0, 152, 74, 3, 25, 0, 152, 74, 3, 66, 255, 128, 0, 0, 15, 255, 128, 0, 0, 57, 255, 128, 0, 0, 75, 255, 128, 0, 0, 64, 255, 128, 0, 3, 7, 255, 128, 0, 0, 82, 255, 128, 0, 0, 74, 255, 128, 0, 1, 34, 255, 128, 0, 3, 79, 255, 128, 0, 0, 1, 255, 128, 0, 3, 6, 255, 128, 0, 0, 59, 255, 128, 0, 2, 5, 255, 0, 0, 1, 41, 140, 198, 62, 1, 38, 140, 198, 62, 2, 13, 252, 3, 248, 2, 12, 252, 3, 248, 1, 28, 252, 3, 248, 1, 22, 252, 3, 248, 3, 66, 0, 138, 198, 3, 4, 0, 138, 198, 3, 5, 255, 255, 255, 0, 46, 0, 0, 255, 0, 36, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {277, {0, 55, 3, 66, 255, 255, 255, 3, 15, 255, 255, 255, 2, 69, 255, 255, 255, 1, 56, 255, 255, 255, 2, 41, 255, 255, 255, 2, 57, 255, 255, 255, 2, 61, 255, 255, 255, 3, 61, 171, 140, 34, 3, 82, 255, 0, 0, 0, 3, 255, 0, 0, 3, 77, 255, 0, 0, 3, 6, 255, 0, 0, 1, 4, 255, 0, 0, 1, 17, 255, 0, 0, 3, 64, 255, 0, 0, 1, 26, 255, 0, 0, 2, 38, 252, 3, 248, 2, 41, 252, 3, 248, 2, 72, 252, 3, 248, 2, 62, 254, 199, 11, 2, 55, 254, 199, 11, 2, 24, 254, 199, 11, 3, 13, 0, 152, 74, 3, 39, 0, 152, 74, 2, 11, 0, 152, 74, 3, 24, 0, 152, 74, 3, 66, 255, 128, 0, 0, 16, 255, 128, 0, 0, 57, 255, 128, 0, 0, 75, 255, 128, 0, 0, 64, 255, 128, 0, 3, 7, 255, 128, 0, 0, 82, 255, 128, 0, 1, 34, 255, 128, 0, 3, 79, 255, 128, 0, 0, 2, 255, 128, 0, 3, 6, 255, 128, 0, 0, 59, 255, 128, 0, 2, 5, 255, 0, 0, 2, 0, 255, 0, 0, 1, 40, 140, 198, 62, 1, 39, 140, 198, 62, 1, 51, 140, 198, 62, 2, 13, 252, 3, 248, 2, 12, 252, 3, 248, 1, 27, 252, 3, 248, 1, 23, 252, 3, 248, 3, 66, 0, 138, 198, 3, 5, 0, 138, 198, 3, 6, 255, 255, 255, 0, 46, 0, 0, 255, 0, 35, 0, 0, 255, 0, 23, 0, 0, 255, 0, 34, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {282, {0, 56, 3, 66, 255, 255, 255, 3, 15, 255, 255, 255, 2, 69, 255, 255, 255, 1, 56, 255, 255, 255, 2, 41, 255, 255, 255, 2, 56, 255, 255, 255, 2, 61, 255, 255, 255, 3, 61, 171, 140, 34, 3, 82, 255, 0, 0, 0, 3, 255, 0, 0, 3, 77, 255, 0, 0, 3, 6, 255, 0, 0, 1, 4, 255, 0, 0, 1, 16, 255, 0, 0, 0, 16, 255, 0, 0, 3, 64, 255, 0, 0, 1, 26, 255, 0, 0, 2, 38, 252, 3, 248, 2, 41, 252, 3, 248, 2, 73, 252, 3, 248, 2, 62, 254, 199, 11, 2, 56, 254, 199, 11, 2, 24, 254, 199, 11, 3, 14, 0, 152, 74, 3, 38, 0, 152, 74, 2, 10, 0, 152, 74, 3, 24, 0, 152, 74, 3, 66, 255, 128, 0, 0, 16, 255, 128, 0, 0, 57, 255, 128, 0, 0, 75, 255, 128, 0, 0, 63, 255, 128, 0, 3, 6, 255, 128, 0, 0, 82, 255, 128, 0, 1, 33, 255, 128, 0, 3, 79, 255, 128, 0, 0, 2, 255, 128, 0, 3, 7, 255, 128, 0, 0, 60, 255, 128, 0, 2, 5, 255, 0, 0, 2, 0, 255, 0, 0, 1, 40, 140, 198, 62, 1, 39, 140, 198, 62, 1, 52, 140, 198, 62, 2, 13, 252, 3, 248, 2, 13, 252, 3, 248, 1, 27, 252, 3, 248, 1, 23, 252, 3, 248, 3, 5, 0, 138, 198, 3, 6, 255, 255, 255, 0, 45, 0, 0, 255, 0, 35, 0, 0, 255, 0, 23, 0, 0, 255, 0, 46, 0, 0, 255, 0, 34, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {272, {0, 54, 3, 66, 255, 255, 255, 3, 15, 255, 255, 255, 1, 55, 255, 255, 255, 2, 41, 255, 255, 255, 2, 56, 255, 255, 255, 2, 61, 255, 255, 255, 3, 60, 171, 140, 34, 0, 2, 255, 0, 0, 3, 77, 255, 0, 0, 3, 5, 255, 0, 0, 1, 5, 255, 0, 0, 3, 64, 255, 0, 0, 1, 16, 255, 0, 0, 0, 16, 255, 0, 0, 1, 27, 255, 0, 0, 2, 73, 252, 3, 248, 2, 39, 252, 3, 248, 2, 41, 252, 3, 248, 2, 62, 254, 199, 11, 2, 24, 254, 199, 11, 2, 56, 254, 199, 11, 3, 14, 0, 152, 74, 2, 10, 0, 152, 74, 3, 51, 0, 152, 74, 3, 38, 0, 152, 74, 3, 23, 0, 152, 74, 0, 63, 255, 128, 0, 3, 66, 255, 128, 0, 3, 6, 255, 128, 0, 3, 7, 255, 128, 0, 0, 82, 255, 128, 0, 3, 79, 255, 128, 0, 1, 33, 255, 128, 0, 0, 3, 255, 128, 0, 0, 60, 255, 128, 0, 0, 16, 255, 128, 0, 2, 0, 255, 0, 0, 2, 5, 255, 0, 0, 1, 39, 140, 198, 62, 1, 40, 140, 198, 62, 1, 52, 140, 198, 62, 1, 24, 252, 3, 248, 2, 12, 252, 3, 248, 1, 26, 252, 3, 248, 2, 13, 252, 3, 248, 3, 6, 0, 138, 198, 3, 6, 255, 255, 255, 0, 45, 0, 0, 255, 0, 34, 0, 0, 255, 0, 34, 0, 0, 255, 0, 23, 0, 0, 255, 0, 46, 0, 0, 255, 0, 9, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {277, {0, 55, 3, 66, 255, 255, 255, 3, 16, 255, 255, 255, 1, 55, 255, 255, 255, 2, 41, 255, 255, 255, 2, 56, 255, 255, 255, 2, 62, 255, 255, 255, 3, 60, 171, 140, 34, 3, 83, 255, 0, 0, 0, 2, 255, 0, 0, 3, 77, 255, 0, 0, 3, 5, 255, 0, 0, 1, 5, 255, 0, 0, 1, 15, 255, 0, 0, 0, 15, 255, 0, 0, 1, 27, 255, 0, 0, 2, 74, 252, 3, 248, 2, 39, 252, 3, 248, 2, 39, 252, 3, 248, 2, 41, 252, 3, 248, 2, 62, 254, 199, 11, 2, 25, 254, 199, 11, 2, 56, 254, 199, 11, 3, 23, 0, 152, 74, 2, 10, 0, 152, 74, 3, 51, 0, 152, 74, 3, 37, 0, 152, 74, 3, 23, 0, 152, 74, 0, 62, 255, 128, 0, 3, 66, 255, 128, 0, 3, 6, 255, 128, 0, 3, 8, 255, 128, 0, 3, 80, 255, 128, 0, 1, 32, 255, 128, 0, 0, 3, 255, 128, 0, 0, 61, 255, 128, 0, 0, 57, 255, 128, 0, 2, 0, 255, 0, 0, 2, 5, 255, 0, 0, 1, 39, 140, 198, 62, 1, 41, 140, 198, 62, 1, 53, 140, 198, 62, 1, 24, 252, 3, 248, 2, 12, 252, 3, 248, 1, 26, 252, 3, 248, 2, 13, 252, 3, 248, 3, 6, 0, 138, 198, 3, 65, 0, 138, 198, 3, 7, 255, 255, 255, 0, 45, 0, 0, 255, 0, 34, 0, 0, 255, 0, 35, 0, 0, 255, 0, 23, 0, 0, 255, 0, 47, 0, 0, 255, 0, 9, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {297, {0, 59, 3, 16, 255, 255, 255, 2, 68, 255, 255, 255, 3, 79, 255, 255, 255, 1, 53, 255, 255, 255, 2, 41, 255, 255, 255, 3, 66, 255, 255, 255, 2, 53, 255, 255, 255, 2, 62, 255, 255, 255, 3, 60, 171, 140, 34, 3, 56, 171, 140, 34, 0, 1, 255, 0, 0, 3, 77, 255, 0, 0, 1, 6, 255, 0, 0, 3, 4, 255, 0, 0, 3, 83, 255, 0, 0, 3, 65, 255, 0, 0, 1, 14, 255, 0, 0, 1, 28, 255, 0, 0, 0, 14, 255, 0, 0, 2, 74, 252, 3, 248, 2, 41, 252, 3, 248, 2, 39, 252, 3, 248, 2, 57, 254, 199, 11, 2, 61, 254, 199, 11, 2, 25, 254, 199, 11, 3, 14, 0, 152, 74, 3, 36, 0, 152, 74, 2, 9, 0, 152, 74, 3, 24, 0, 152, 74, 3, 52, 0, 152, 74, 0, 60, 255, 128, 0, 0, 63, 255, 128, 0, 3, 8, 255, 128, 0, 0, 73, 255, 128, 0, 3, 5, 255, 128, 0, 0, 83, 255, 128, 0, 0, 75, 255, 128, 0, 1, 32, 255, 128, 0, 3, 80, 255, 128, 0, 0, 56, 255, 128, 0, 2, 6, 255, 0, 0, 2, 0, 255, 0, 0, 1, 41, 140, 198, 62, 1, 57, 140, 198, 62, 1, 37, 140, 198, 62, 2, 17, 252, 3, 248, 1, 25, 252, 3, 248, 1, 25, 252, 3, 248, 2, 11, 252, 3, 248, 3, 65, 0, 138, 198, 3, 7, 0, 138, 198, 1, 25, 0, 138, 198, 3, 7, 255, 255, 255, 0, 10, 0, 0, 255, 0, 35, 0, 0, 255, 0, 44, 0, 0, 255, 0, 24, 0, 0, 255, 0, 47, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {277, {0, 55, 2, 40, 255, 255, 255, 3, 66, 255, 255, 255, 3, 16, 255, 255, 255, 2, 68, 255, 255, 255, 1, 54, 255, 255, 255, 2, 55, 255, 255, 255, 2, 62, 255, 255, 255, 3, 59, 171, 140, 34, 3, 83, 255, 0, 0, 3, 65, 255, 0, 0, 1, 6, 255, 0, 0, 3, 67, 255, 0, 0, 0, 15, 255, 0, 0, 0, 1, 255, 0, 0, 3, 4, 255, 0, 0, 1, 28, 255, 0, 0, 1, 14, 255, 0, 0, 2, 41, 252, 3, 248, 2, 39, 252, 3, 248, 2, 26, 254, 199, 11, 2, 57, 254, 199, 11, 2, 61, 254, 199, 11, 2, 9, 0, 152, 74, 3, 36, 0, 152, 74, 3, 24, 0, 152, 74, 3, 51, 0, 152, 74, 3, 14, 0, 152, 74, 3, 80, 255, 128, 0, 0, 62, 255, 128, 0, 3, 5, 255, 128, 0, 0, 56, 255, 128, 0, 3, 8, 255, 128, 0, 1, 32, 255, 128, 0, 0, 61, 255, 128, 0, 0, 74, 255, 128, 0, 0, 75, 255, 128, 0, 0, 83, 255, 128, 0, 2, 0, 255, 0, 0, 2, 6, 255, 0, 0, 1, 38, 140, 198, 62, 1, 54, 140, 198, 62, 1, 42, 140, 198, 62, 1, 25, 252, 3, 248, 2, 11, 252, 3, 248, 1, 26, 252, 3, 248, 2, 17, 252, 3, 248, 3, 7, 0, 138, 198, 3, 65, 0, 138, 198, 3, 7, 255, 255, 255, 0, 23, 0, 0, 255, 0, 36, 0, 0, 255, 0, 47, 0, 0, 255, 0, 44, 0, 0, 255, 0, 10, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {297, {0, 59, 2, 63, 255, 255, 255, 3, 66, 255, 255, 255, 3, 17, 255, 255, 255, 1, 53, 255, 255, 255, 2, 55, 255, 255, 255, 2, 68, 255, 255, 255, 2, 40, 255, 255, 255, 3, 59, 171, 140, 34, 3, 4, 255, 0, 0, 3, 67, 255, 0, 0, 3, 83, 255, 0, 0, 0, 0, 255, 0, 0, 1, 14, 255, 0, 0, 3, 65, 255, 0, 0, 0, 15, 255, 0, 0, 1, 29, 255, 0, 0, 1, 6, 255, 0, 0, 2, 42, 252, 3, 248, 2, 38, 252, 3, 248, 2, 26, 254, 199, 11, 2, 61, 254, 199, 11, 2, 57, 254, 199, 11, 3, 36, 0, 152, 74, 2, 8, 0, 152, 74, 3, 13, 0, 152, 74, 3, 25, 0, 152, 74, 3, 52, 0, 152, 74, 0, 73, 255, 128, 0, 3, 80, 255, 128, 0, 0, 61, 255, 128, 0, 3, 9, 255, 128, 0, 3, 4, 255, 128, 0, 0, 62, 255, 128, 0, 0, 56, 255, 128, 0, 0, 76, 255, 128, 0, 1, 32, 255, 128, 0, 0, 83, 255, 128, 0, 3, 65, 255, 128, 0, 2, 0, 255, 0, 0, 2, 6, 255, 0, 0, 1, 55, 140, 198, 62, 1, 42, 140, 198, 62, 1, 37, 140, 198, 62, 2, 11, 252, 3, 248, 1, 24, 252, 3, 248, 1, 26, 252, 3, 248, 2, 17, 252, 3, 248, 0, 49, 0, 138, 198, 3, 7, 0, 138, 198, 3, 65, 0, 138, 198, 3, 8, 255, 255, 255, 0, 36, 0, 0, 255, 0, 33, 0, 0, 255, 0, 23, 0, 0, 255, 0, 10, 0, 0, 255, 0, 16, 0, 0, 255, 0, 47, 0, 0, 255, 0, 44, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {307, {0, 61, 2, 63, 255, 255, 255, 2, 40, 255, 255, 255, 1, 53, 255, 255, 255, 2, 68, 255, 255, 255, 3, 17, 255, 255, 255, 3, 66, 255, 255, 255, 2, 55, 255, 255, 255, 3, 59, 171, 140, 34, 0, 0, 255, 0, 0, 3, 3, 255, 0, 0, 3, 67, 255, 0, 0, 1, 6, 255, 0, 0, 3, 83, 255, 0, 0, 1, 13, 255, 0, 0, 0, 14, 255, 0, 0, 3, 65, 255, 0, 0, 1, 29, 255, 0, 0, 2, 42, 252, 3, 248, 2, 47, 252, 3, 248, 2, 38, 252, 3, 248, 2, 57, 254, 199, 11, 2, 61, 254, 199, 11, 2, 26, 254, 199, 11, 3, 35, 0, 152, 74, 3, 52, 0, 152, 74, 3, 13, 0, 152, 74, 3, 25, 0, 152, 74, 2, 8, 0, 152, 74, 0, 63, 255, 128, 0, 3, 4, 255, 128, 0, 0, 60, 255, 128, 0, 0, 55, 255, 128, 0, 3, 81, 255, 128, 0, 0, 4, 255, 128, 0, 3, 9, 255, 128, 0, 3, 65, 255, 128, 0, 1, 32, 255, 128, 0, 0, 72, 255, 128, 0, 0, 76, 255, 128, 0, 0, 83, 255, 128, 0, 2, 6, 255, 0, 0, 2, 0, 255, 0, 0, 0, 75, 255, 0, 0, 1, 43, 140, 198, 62, 1, 56, 140, 198, 62, 1, 36, 140, 198, 62, 2, 11, 252, 3, 248, 2, 18, 252, 3, 248, 1, 27, 252, 3, 248, 1, 23, 252, 3, 248, 3, 65, 0, 138, 198, 3, 8, 0, 138, 198, 0, 49, 0, 138, 198, 3, 8, 255, 255, 255, 0, 33, 0, 0, 255, 0, 10, 0, 0, 255, 0, 48, 0, 0, 255, 0, 36, 0, 0, 255, 0, 24, 0, 0, 255, 0, 16, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {317, {0, 63, 2, 63, 255, 255, 255, 2, 40, 255, 255, 255, 1, 52, 255, 255, 255, 2, 68, 255, 255, 255, 3, 17, 255, 255, 255, 3, 66, 255, 255, 255, 2, 54, 255, 255, 255, 3, 59, 171, 140, 34, 3, 56, 171, 140, 34, 0, 5, 255, 0, 0, 3, 3, 255, 0, 0, 3, 67, 255, 0, 0, 1, 7, 255, 0, 0, 3, 83, 255, 0, 0, 1, 13, 255, 0, 0, 0, 14, 255, 0, 0, 3, 65, 255, 0, 0, 1, 29, 255, 0, 0, 2, 42, 252, 3, 248, 2, 47, 252, 3, 248, 2, 38, 252, 3, 248, 2, 57, 254, 199, 11, 2, 61, 254, 199, 11, 2, 27, 254, 199, 11, 3, 35, 0, 152, 74, 3, 52, 0, 152, 74, 3, 12, 0, 152, 74, 3, 26, 0, 152, 74, 2, 8, 0, 152, 74, 0, 63, 255, 128, 0, 3, 4, 255, 128, 0, 0, 59, 255, 128, 0, 0, 55, 255, 128, 0, 3, 81, 255, 128, 0, 0, 4, 255, 128, 0, 3, 10, 255, 128, 0, 3, 65, 255, 128, 0, 1, 32, 255, 128, 0, 0, 72, 255, 128, 0, 0, 77, 255, 128, 0, 0, 82, 255, 128, 0, 2, 6, 255, 0, 0, 2, 0, 255, 0, 0, 0, 75, 255, 0, 0, 1, 43, 140, 198, 62, 1, 56, 140, 198, 62, 1, 36, 140, 198, 62, 2, 10, 252, 3, 248, 2, 18, 252, 3, 248, 1, 27, 252, 3, 248, 1, 23, 252, 3, 248, 3, 64, 0, 138, 198, 3, 8, 0, 138, 198, 0, 49, 0, 138, 198, 3, 9, 255, 255, 255, 0, 43, 0, 0, 255, 0, 32, 0, 0, 255, 0, 11, 0, 0, 255, 0, 48, 0, 0, 255, 0, 37, 0, 0, 255, 0, 24, 0, 0, 255, 0, 16, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {292, {0, 58, 2, 48, 255, 255, 255, 2, 67, 255, 255, 255, 2, 54, 255, 255, 255, 2, 63, 255, 255, 255, 3, 17, 255, 255, 255, 3, 66, 255, 255, 255, 1, 52, 255, 255, 255, 3, 56, 171, 140, 34, 3, 58, 171, 140, 34, 1, 12, 255, 0, 0, 0, 13, 255, 0, 0, 1, 7, 255, 0, 0, 3, 2, 255, 0, 0, 0, 5, 255, 0, 0, 1, 30, 255, 0, 0, 2, 43, 252, 3, 248, 3, 22, 252, 3, 248, 2, 47, 252, 3, 248, 2, 27, 254, 199, 11, 2, 58, 254, 199, 11, 2, 60, 254, 199, 11, 2, 7, 0, 152, 74, 3, 34, 0, 152, 74, 3, 26, 0, 152, 74, 3, 12, 0, 152, 74, 3, 65, 255, 128, 0, 0, 64, 255, 128, 0, 3, 3, 255, 128, 0, 0, 54, 255, 128, 0, 0, 4, 255, 128, 0, 3, 81, 255, 128, 0, 0, 59, 255, 128, 0, 3, 10, 255, 128, 0, 0, 82, 255, 128, 0, 0, 71, 255, 128, 0, 1, 33, 255, 128, 0, 0, 77, 255, 128, 0, 2, 6, 255, 0, 0, 0, 76, 255, 0, 0, 2, 0, 255, 0, 0, 1, 57, 140, 198, 62, 1, 35, 140, 198, 62, 2, 10, 252, 3, 248, 2, 18, 252, 3, 248, 1, 28, 252, 3, 248, 1, 22, 252, 3, 248, 3, 9, 0, 138, 198, 3, 64, 0, 138, 198, 0, 49, 0, 138, 198, 3, 9, 255, 255, 255, 0, 43, 0, 0, 255, 0, 24, 0, 0, 255, 0, 16, 0, 0, 255, 0, 48, 0, 0, 255, 0, 37, 0, 0, 255, 0, 32, 0, 0, 255, 0, 11, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {277, {0, 55, 3, 18, 255, 255, 255, 2, 64, 255, 255, 255, 2, 67, 255, 255, 255, 3, 66, 255, 255, 255, 1, 51, 255, 255, 255, 2, 54, 255, 255, 255, 2, 48, 255, 255, 255, 3, 56, 171, 140, 34, 3, 58, 171, 140, 34, 3, 2, 255, 0, 0, 1, 7, 255, 0, 0, 0, 6, 255, 0, 0, 1, 30, 255, 0, 0, 0, 13, 255, 0, 0, 1, 12, 255, 0, 0, 3, 22, 252, 3, 248, 2, 47, 252, 3, 248, 2, 43, 252, 3, 248, 2, 58, 254, 199, 11, 2, 28, 254, 199, 11, 2, 60, 254, 199, 11, 3, 34, 0, 152, 74, 2, 7, 0, 152, 74, 3, 27, 0, 152, 74, 3, 3, 255, 128, 0, 3, 65, 255, 128, 0, 0, 4, 255, 128, 0, 0, 65, 255, 128, 0, 0, 54, 255, 128, 0, 0, 78, 255, 128, 0, 0, 82, 255, 128, 0, 3, 10, 255, 128, 0, 0, 58, 255, 128, 0, 3, 81, 255, 128, 0, 0, 71, 255, 128, 0, 1, 33, 255, 128, 0, 2, 6, 255, 0, 0, 0, 76, 255, 0, 0, 1, 58, 140, 198, 62, 1, 35, 140, 198, 62, 2, 7, 252, 3, 248, 1, 22, 252, 3, 248, 1, 28, 252, 3, 248, 2, 10, 252, 3, 248, 3, 64, 0, 138, 198, 0, 49, 0, 138, 198, 3, 9, 0, 138, 198, 3, 9, 255, 255, 255, 0, 42, 0, 0, 255, 0, 31, 0, 0, 255, 0, 38, 0, 0, 255, 0, 24, 0, 0, 255, 0, 16, 0, 0, 255, 0, 11, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {272, {0, 54, 2, 53, 255, 255, 255, 2, 64, 255, 255, 255, 2, 67, 255, 255, 255, 3, 66, 255, 255, 255, 1, 51, 255, 255, 255, 3, 18, 255, 255, 255, 2, 48, 255, 255, 255, 3, 58, 171, 140, 34, 3, 55, 171, 140, 34, 3, 1, 255, 0, 0, 1, 8, 255, 0, 0, 0, 6, 255, 0, 0, 1, 31, 255, 0, 0, 1, 11, 255, 0, 0, 3, 66, 255, 0, 0, 0, 12, 255, 0, 0, 2, 43, 252, 3, 248, 3, 22, 252, 3, 248, 2, 46, 252, 3, 248, 2, 58, 254, 199, 11, 2, 28, 254, 199, 11, 2, 60, 254, 199, 11, 2, 7, 0, 152, 74, 3, 27, 0, 152, 74, 3, 33, 0, 152, 74, 3, 64, 255, 128, 0, 3, 2, 255, 128, 0, 0, 4, 255, 128, 0, 0, 65, 255, 128, 0, 0, 53, 255, 128, 0, 0, 78, 255, 128, 0, 0, 81, 255, 128, 0, 3, 11, 255, 128, 0, 0, 58, 255, 128, 0, 3, 82, 255, 128, 0, 0, 70, 255, 128, 0, 1, 34, 255, 128, 0, 2, 6, 255, 0, 0, 0, 76, 255, 0, 0, 2, 1, 255, 0, 0, 1, 59, 140, 198, 62, 2, 7, 252, 3, 248, 1, 21, 252, 3, 248, 1, 29, 252, 3, 248, 3, 64, 0, 138, 198, 0, 49, 0, 138, 198, 3, 10, 0, 138, 198, 3, 10, 255, 255, 255, 0, 42, 0, 0, 255, 0, 30, 0, 0, 255, 0, 38, 0, 0, 255, 0, 15, 0, 0, 255, 0, 12, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {257, {0, 51, 2, 48, 255, 255, 255, 2, 67, 255, 255, 255, 2, 53, 255, 255, 255, 2, 64, 255, 255, 255, 3, 18, 255, 255, 255, 3, 66, 255, 255, 255, 3, 55, 171, 140, 34, 3, 57, 171, 140, 34, 1, 11, 255, 0, 0, 0, 12, 255, 0, 0, 3, 66, 255, 0, 0, 1, 8, 255, 0, 0, 3, 66, 255, 0, 0, 3, 1, 255, 0, 0, 0, 7, 255, 0, 0, 1, 31, 255, 0, 0, 2, 43, 252, 3, 248, 3, 21, 252, 3, 248, 2, 46, 252, 3, 248, 2, 60, 254, 199, 11, 2, 32, 254, 199, 11, 2, 58, 254, 199, 11, 2, 29, 254, 199, 11, 3, 33, 0, 152, 74, 3, 28, 0, 152, 74, 0, 66, 255, 128, 0, 3, 64, 255, 128, 0, 0, 53, 255, 128, 0, 3, 2, 255, 128, 0, 0, 4, 255, 128, 0, 3, 82, 255, 128, 0, 3, 11, 255, 128, 0, 0, 70, 255, 128, 0, 0, 81, 255, 128, 0, 1, 34, 255, 128, 0, 0, 79, 255, 128, 0, 0, 77, 255, 0, 0, 2, 1, 255, 0, 0, 1, 60, 140, 198, 62, 1, 44, 140, 198, 62, 1, 29, 252, 3, 248, 1, 21, 252, 3, 248, 2, 7, 252, 3, 248, 3, 10, 0, 138, 198, 3, 10, 255, 255, 255, 0, 41, 0, 0, 255, 0, 12, 0, 0, 255, 0, 15, 0, 0, 255, 0, 38, 0, 0, 255, 0, 30, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {252, {0, 50, 3, 19, 255, 255, 255, 2, 49, 255, 255, 255, 2, 66, 255, 255, 255, 3, 66, 255, 255, 255, 2, 53, 255, 255, 255, 2, 64, 255, 255, 255, 3, 55, 171, 140, 34, 3, 57, 171, 140, 34, 0, 7, 255, 0, 0, 0, 11, 255, 0, 0, 3, 66, 255, 0, 0, 3, 0, 255, 0, 0, 3, 66, 255, 0, 0, 1, 32, 255, 0, 0, 1, 8, 255, 0, 0, 3, 21, 252, 3, 248, 2, 46, 252, 3, 248, 2, 44, 252, 3, 248, 2, 32, 254, 199, 11, 2, 29, 254, 199, 11, 2, 59, 254, 199, 11, 2, 59, 254, 199, 11, 3, 28, 0, 152, 74, 3, 32, 0, 152, 74, 3, 2, 255, 128, 0, 3, 64, 255, 128, 0, 0, 52, 255, 128, 0, 3, 82, 255, 128, 0, 0, 66, 255, 128, 0, 1, 34, 255, 128, 0, 0, 79, 255, 128, 0, 0, 81, 255, 128, 0, 0, 50, 255, 128, 0, 0, 69, 255, 128, 0, 2, 1, 255, 0, 0, 0, 77, 255, 0, 0, 1, 44, 140, 198, 62, 1, 60, 140, 198, 62, 2, 8, 252, 3, 248, 1, 30, 252, 3, 248, 2, 9, 252, 3, 248, 3, 11, 0, 138, 198, 3, 10, 255, 255, 255, 0, 41, 0, 0, 255, 0, 29, 0, 0, 255, 0, 25, 0, 0, 255, 0, 15, 0, 0, 255, 0, 49, 0, 0, 255, 0, 13, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {242, {0, 48, 1, 45, 255, 255, 255, 2, 49, 255, 255, 255, 2, 52, 255, 255, 255, 3, 19, 255, 255, 255, 2, 66, 255, 255, 255, 2, 65, 255, 255, 255, 3, 57, 171, 140, 34, 3, 54, 171, 140, 34, 1, 9, 255, 0, 0, 0, 7, 255, 0, 0, 1, 32, 255, 0, 0, 3, 66, 255, 0, 0, 3, 0, 255, 0, 0, 0, 11, 255, 0, 0, 3, 66, 255, 0, 0, 2, 44, 252, 3, 248, 3, 20, 252, 3, 248, 2, 46, 252, 3, 248, 2, 32, 254, 199, 11, 2, 59, 254, 199, 11, 2, 59, 254, 199, 11, 2, 29, 254, 199, 11, 3, 32, 0, 152, 74, 3, 29, 0, 152, 74, 0, 52, 255, 128, 0, 3, 1, 255, 128, 0, 3, 82, 255, 128, 0, 0, 50, 255, 128, 0, 0, 69, 255, 128, 0, 0, 80, 255, 128, 0, 2, 2, 255, 0, 0, 0, 78, 255, 0, 0, 1, 61, 140, 198, 62, 1, 44, 140, 198, 62, 2, 9, 252, 3, 248, 2, 8, 252, 3, 248, 1, 30, 252, 3, 248, 3, 11, 0, 138, 198, 3, 11, 255, 255, 255, 0, 13, 0, 0, 255, 0, 29, 0, 0, 255, 0, 39, 0, 0, 255, 0, 26, 0, 0, 255, 0, 15, 0, 0, 255, 0, 49, 0, 0, 255, 0, 40, 0, 0, 255, 0, 49, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {257, {0, 51, 2, 52, 255, 255, 255, 2, 66, 255, 255, 255, 1, 45, 255, 255, 255, 2, 49, 255, 255, 255, 3, 19, 255, 255, 255, 3, 67, 255, 255, 255, 2, 65, 255, 255, 255, 3, 57, 171, 140, 34, 3, 54, 171, 140, 34, 1, 10, 255, 0, 0, 1, 9, 255, 0, 0, 3, 66, 255, 0, 0, 0, 10, 255, 0, 0, 1, 34, 255, 0, 0, 3, 66, 255, 0, 0, 0, 8, 255, 0, 0, 1, 33, 255, 0, 0, 3, 20, 252, 3, 248, 2, 45, 252, 3, 248, 2, 44, 252, 3, 248, 2, 31, 254, 199, 11, 2, 59, 254, 199, 11, 2, 59, 254, 199, 11, 2, 30, 254, 199, 11, 3, 31, 0, 152, 74, 3, 29, 0, 152, 74, 3, 83, 255, 128, 0, 3, 1, 255, 128, 0, 0, 52, 255, 128, 0, 3, 83, 255, 128, 0, 0, 80, 255, 128, 0, 0, 68, 255, 128, 0, 0, 51, 255, 128, 0, 2, 2, 255, 0, 0, 0, 78, 255, 0, 0, 1, 44, 140, 198, 62, 1, 62, 140, 198, 62, 1, 31, 252, 3, 248, 2, 8, 252, 3, 248, 2, 9, 252, 3, 248, 1, 64, 0, 138, 198, 3, 11, 255, 255, 255, 0, 28, 0, 0, 255, 0, 15, 0, 0, 255, 0, 39, 0, 0, 255, 0, 14, 0, 0, 255, 0, 26, 0, 0, 255, 0, 49, 0, 0, 255, 0, 49, 0, 0, 255, 0, 39, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {257, {0, 51, 2, 49, 255, 255, 255, 2, 52, 255, 255, 255, 3, 67, 255, 255, 255, 2, 65, 255, 255, 255, 2, 65, 255, 255, 255, 1, 45, 255, 255, 255, 3, 53, 171, 140, 34, 3, 54, 171, 140, 34, 0, 10, 255, 0, 0, 3, 66, 255, 0, 0, 0, 8, 255, 0, 0, 1, 9, 255, 0, 0, 1, 34, 255, 0, 0, 1, 33, 255, 0, 0, 1, 10, 255, 0, 0, 3, 66, 255, 0, 0, 2, 45, 252, 3, 248, 3, 20, 252, 3, 248, 2, 44, 252, 3, 248, 2, 59, 254, 199, 11, 2, 31, 254, 199, 11, 2, 60, 254, 199, 11, 2, 30, 254, 199, 11, 3, 31, 0, 152, 74, 3, 30, 0, 152, 74, 0, 67, 255, 128, 0, 3, 0, 255, 128, 0, 0, 51, 255, 128, 0, 3, 83, 255, 128, 0, 0, 51, 255, 128, 0, 3, 83, 255, 128, 0, 0, 67, 255, 128, 0, 0, 80, 255, 128, 0, 2, 2, 255, 0, 0, 1, 45, 140, 198, 62, 1, 63, 140, 198, 62, 2, 9, 252, 3, 248, 2, 8, 252, 3, 248, 1, 34, 252, 3, 248, 1, 32, 252, 3, 248, 1, 64, 0, 138, 198, 3, 11, 255, 255, 255, 3, 11, 255, 255, 255, 0, 14, 0, 0, 255, 0, 28, 0, 0, 255, 0, 27, 0, 0, 255, 0, 49, 0, 0, 255, 0, 49, 0, 0, 255, 0, 39, 0, 0, 255, 0, 40, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {252, {0, 50, 1, 44, 255, 255, 255, 3, 20, 255, 255, 255, 2, 65, 255, 255, 255, 2, 51, 255, 255, 255, 2, 65, 255, 255, 255, 3, 67, 255, 255, 255, 2, 50, 255, 255, 255, 3, 53, 171, 140, 34, 3, 53, 171, 140, 34, 1, 10, 255, 0, 0, 1, 33, 255, 0, 0, 3, 66, 255, 0, 0, 0, 9, 255, 0, 0, 1, 34, 255, 0, 0, 1, 10, 255, 0, 0, 0, 9, 255, 0, 0, 3, 66, 255, 0, 0, 2, 45, 252, 3, 248, 2, 45, 252, 3, 248, 2, 30, 254, 199, 11, 2, 60, 254, 199, 11, 2, 31, 254, 199, 11, 2, 58, 254, 199, 11, 3, 30, 0, 152, 74, 3, 30, 0, 152, 74, 0, 67, 255, 128, 0, 3, 0, 255, 128, 0, 0, 51, 255, 128, 0, 3, 83, 255, 128, 0, 0, 67, 255, 128, 0, 0, 51, 255, 128, 0, 3, 0, 255, 128, 0, 0, 80, 255, 128, 0, 3, 83, 255, 128, 0, 2, 2, 255, 0, 0, 1, 45, 140, 198, 62, 1, 63, 140, 198, 62, 2, 9, 252, 3, 248, 1, 32, 252, 3, 248, 1, 34, 252, 3, 248, 2, 8, 252, 3, 248, 1, 63, 0, 138, 198, 3, 11, 255, 255, 255, 0, 15, 0, 0, 255, 0, 27, 0, 0, 255, 0, 40, 0, 0, 255, 0, 27, 0, 0, 255, 0, 49, 0, 0, 255, 0, 49, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {277, {0, 55, 1, 44, 255, 255, 255, 3, 20, 255, 255, 255, 2, 66, 255, 255, 255, 2, 51, 255, 255, 255, 2, 65, 255, 255, 255, 3, 67, 255, 255, 255, 2, 50, 255, 255, 255, 3, 53, 171, 140, 34, 3, 53, 171, 140, 34, 1, 10, 255, 0, 0, 1, 33, 255, 0, 0, 3, 66, 255, 0, 0, 0, 9, 255, 0, 0, 1, 34, 255, 0, 0, 1, 9, 255, 0, 0, 0, 9, 255, 0, 0, 3, 66, 255, 0, 0, 2, 45, 252, 3, 248, 2, 44, 252, 3, 248, 3, 19, 252, 3, 248, 2, 30, 254, 199, 11, 2, 60, 254, 199, 11, 2, 31, 254, 199, 11, 2, 58, 254, 199, 11, 3, 31, 0, 152, 74, 3, 30, 0, 152, 74, 0, 68, 255, 128, 0, 3, 0, 255, 128, 0, 0, 50, 255, 128, 0, 3, 83, 255, 128, 0, 0, 52, 255, 128, 0, 3, 0, 255, 128, 0, 0, 81, 255, 128, 0, 0, 79, 255, 128, 0, 3, 83, 255, 128, 0, 2, 2, 255, 0, 0, 0, 78, 255, 0, 0, 1, 45, 140, 198, 62, 1, 64, 140, 198, 62, 2, 9, 252, 3, 248, 1, 33, 252, 3, 248, 1, 33, 252, 3, 248, 2, 8, 252, 3, 248, 1, 62, 0, 138, 198, 3, 11, 255, 255, 255, 1, 50, 255, 255, 255, 0, 15, 0, 0, 255, 0, 26, 0, 0, 255, 0, 41, 0, 0, 255, 0, 28, 0, 0, 255, 0, 14, 0, 0, 255, 0, 49, 0, 0, 255, 0, 49, 0, 0, 255, 0, 38, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {262, {0, 52, 1, 44, 255, 255, 255, 2, 50, 255, 255, 255, 2, 65, 255, 255, 255, 3, 20, 255, 255, 255, 2, 51, 255, 255, 255, 2, 66, 255, 255, 255, 3, 77, 255, 255, 255, 3, 53, 171, 140, 34, 3, 54, 171, 140, 34, 3, 0, 255, 0, 0, 3, 66, 255, 0, 0, 1, 10, 255, 0, 0, 3, 66, 255, 0, 0, 1, 32, 255, 0, 0, 0, 8, 255, 0, 0, 0, 10, 255, 0, 0, 1, 9, 255, 0, 0, 3, 19, 252, 3, 248, 2, 45, 252, 3, 248, 2, 44, 252, 3, 248, 2, 74, 252, 3, 248, 2, 58, 254, 199, 11, 2, 60, 254, 199, 11, 2, 29, 254, 199, 11, 2, 31, 254, 199, 11, 3, 29, 0, 152, 74, 2, 7, 0, 152, 74, 3, 31, 0, 152, 74, 3, 83, 255, 128, 0, 0, 52, 255, 128, 0, 0, 50, 255, 128, 0, 0, 79, 255, 128, 0, 0, 68, 255, 128, 0, 0, 81, 255, 128, 0, 3, 1, 255, 128, 0, 2, 2, 255, 0, 0, 0, 78, 255, 0, 0, 1, 33, 252, 3, 248, 1, 33, 252, 3, 248, 2, 8, 252, 3, 248, 1, 62, 0, 138, 198, 3, 11, 0, 138, 198, 3, 10, 255, 255, 255, 1, 50, 255, 255, 255, 0, 14, 0, 0, 255, 0, 38, 0, 0, 255, 0, 26, 0, 0, 255, 0, 15, 0, 0, 255, 0, 49, 0, 0, 255, 0, 29, 0, 0, 255, 0, 41, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {272, {0, 54, 3, 21, 255, 255, 255, 3, 77, 255, 255, 255, 2, 64, 255, 255, 255, 3, 67, 255, 255, 255, 2, 50, 255, 255, 255, 2, 66, 255, 255, 255, 2, 50, 255, 255, 255, 3, 54, 171, 140, 34, 3, 57, 171, 140, 34, 0, 10, 255, 0, 0, 3, 66, 255, 0, 0, 1, 32, 255, 0, 0, 0, 8, 255, 0, 0, 3, 66, 255, 0, 0, 1, 9, 255, 0, 0, 3, 0, 255, 0, 0, 2, 46, 252, 3, 248, 2, 44, 252, 3, 248, 2, 74, 252, 3, 248, 3, 19, 252, 3, 248, 2, 61, 254, 199, 11, 2, 32, 254, 199, 11, 2, 58, 254, 199, 11, 2, 29, 254, 199, 11, 3, 32, 0, 152, 74, 3, 29, 0, 152, 74, 2, 7, 0, 152, 74, 3, 82, 255, 128, 0, 3, 1, 255, 128, 0, 0, 53, 255, 128, 0, 0, 79, 255, 128, 0, 0, 81, 255, 128, 0, 3, 64, 255, 128, 0, 0, 66, 255, 128, 0, 0, 69, 255, 128, 0, 2, 1, 255, 0, 0, 2, 6, 255, 0, 0, 0, 77, 255, 0, 0, 0, 49, 140, 198, 62, 2, 10, 252, 3, 248, 2, 7, 252, 3, 248, 1, 34, 252, 3, 248, 1, 33, 252, 3, 248, 3, 11, 0, 138, 198, 1, 61, 0, 138, 198, 3, 10, 255, 255, 255, 1, 50, 255, 255, 255, 0, 42, 0, 0, 255, 0, 15, 0, 0, 255, 0, 30, 0, 0, 255, 0, 14, 0, 0, 255, 0, 25, 0, 0, 255, 0, 38, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {312, {0, 62, 3, 21, 255, 255, 255, 1, 43, 255, 255, 255, 2, 51, 255, 255, 255, 2, 64, 255, 255, 255, 3, 77, 255, 255, 255, 2, 50, 255, 255, 255, 2, 67, 255, 255, 255, 3, 67, 255, 255, 255, 3, 57, 171, 140, 34, 3, 54, 171, 140, 34, 3, 66, 255, 0, 0, 1, 11, 255, 0, 0, 3, 1, 255, 0, 0, 0, 11, 255, 0, 0, 1, 31, 255, 0, 0, 0, 7, 255, 0, 0, 1, 8, 255, 0, 0, 3, 66, 255, 0, 0, 2, 46, 252, 3, 248, 3, 18, 252, 3, 248, 2, 43, 252, 3, 248, 2, 74, 252, 3, 248, 2, 61, 254, 199, 11, 2, 32, 254, 199, 11, 2, 28, 254, 199, 11, 2, 57, 254, 199, 11, 3, 32, 0, 152, 74, 2, 7, 0, 152, 74, 3, 28, 0, 152, 74, 0, 69, 255, 128, 0, 1, 34, 255, 128, 0, 0, 58, 255, 128, 0, 3, 82, 255, 128, 0, 0, 4, 255, 128, 0, 0, 82, 255, 128, 0, 0, 53, 255, 128, 0, 3, 64, 255, 128, 0, 0, 78, 255, 128, 0, 0, 66, 255, 128, 0, 3, 11, 255, 128, 0, 3, 1, 255, 128, 0, 0, 77, 255, 0, 0, 2, 6, 255, 0, 0, 2, 1, 255, 0, 0, 1, 21, 140, 198, 62, 0, 49, 140, 198, 62, 2, 10, 252, 3, 248, 2, 7, 252, 3, 248, 1, 35, 252, 3, 248, 1, 34, 252, 3, 248, 1, 32, 252, 3, 248, 1, 61, 0, 138, 198, 3, 10, 0, 138, 198, 3, 10, 255, 255, 255, 1, 50, 255, 255, 255, 0, 37, 0, 0, 255, 0, 13, 0, 0, 255, 0, 15, 0, 0, 255, 0, 42, 0, 0, 255, 0, 30, 0, 0, 255, 0, 25, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {302, {0, 60, 3, 21, 255, 255, 255, 1, 43, 255, 255, 255, 2, 51, 255, 255, 255, 2, 64, 255, 255, 255, 3, 77, 255, 255, 255, 2, 50, 255, 255, 255, 2, 67, 255, 255, 255, 3, 67, 255, 255, 255, 3, 57, 171, 140, 34, 3, 54, 171, 140, 34, 3, 66, 255, 0, 0, 1, 11, 255, 0, 0, 3, 1, 255, 0, 0, 0, 11, 255, 0, 0, 1, 31, 255, 0, 0, 0, 7, 255, 0, 0, 1, 8, 255, 0, 0, 3, 66, 255, 0, 0, 2, 46, 252, 3, 248, 3, 18, 252, 3, 248, 2, 43, 252, 3, 248, 2, 73, 252, 3, 248, 2, 61, 254, 199, 11, 2, 28, 254, 199, 11, 2, 57, 254, 199, 11, 3, 33, 0, 152, 74, 2, 8, 0, 152, 74, 3, 28, 0, 152, 74, 0, 70, 255, 128, 0, 1, 34, 255, 128, 0, 0, 58, 255, 128, 0, 3, 82, 255, 128, 0, 0, 4, 255, 128, 0, 0, 82, 255, 128, 0, 0, 54, 255, 128, 0, 3, 64, 255, 128, 0, 0, 78, 255, 128, 0, 0, 65, 255, 128, 0, 3, 11, 255, 128, 0, 3, 2, 255, 128, 0, 0, 76, 255, 0, 0, 2, 6, 255, 0, 0, 2, 1, 255, 0, 0, 1, 21, 140, 198, 62, 0, 49, 140, 198, 62, 1, 51, 140, 198, 62, 2, 10, 252, 3, 248, 2, 7, 252, 3, 248, 1, 35, 252, 3, 248, 1, 32, 252, 3, 248, 1, 60, 0, 138, 198, 3, 64, 0, 138, 198, 3, 10, 0, 138, 198, 3, 9, 255, 255, 255, 0, 37, 0, 0, 255, 0, 13, 0, 0, 255, 0, 16, 0, 0, 255, 0, 43, 0, 0, 255, 0, 31, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {302, {0, 60, 3, 77, 255, 255, 255, 2, 50, 255, 255, 255, 3, 22, 255, 255, 255, 2, 67, 255, 255, 255, 3, 78, 255, 255, 255, 2, 64, 255, 255, 255, 1, 42, 255, 255, 255, 2, 51, 255, 255, 255, 3, 55, 171, 140, 34, 3, 57, 171, 140, 34, 1, 12, 255, 0, 0, 0, 12, 255, 0, 0, 0, 6, 255, 0, 0, 1, 31, 255, 0, 0, 3, 2, 255, 0, 0, 1, 8, 255, 0, 0, 2, 43, 252, 3, 248, 2, 46, 252, 3, 248, 2, 73, 252, 3, 248, 3, 18, 252, 3, 248, 2, 28, 254, 199, 11, 2, 57, 254, 199, 11, 2, 61, 254, 199, 11, 3, 27, 0, 152, 74, 2, 8, 0, 152, 74, 3, 33, 0, 152, 74, 0, 70, 255, 128, 0, 3, 82, 255, 128, 0, 0, 59, 255, 128, 0, 1, 33, 255, 128, 0, 0, 4, 255, 128, 0, 3, 2, 255, 128, 0, 0, 55, 255, 128, 0, 3, 64, 255, 128, 0, 0, 77, 255, 128, 0, 0, 82, 255, 128, 0, 3, 10, 255, 128, 0, 0, 65, 255, 128, 0, 2, 1, 255, 0, 0, 0, 76, 255, 0, 0, 2, 6, 255, 0, 0, 1, 22, 140, 198, 62, 1, 51, 140, 198, 62, 0, 49, 140, 198, 62, 2, 11, 252, 3, 248, 1, 36, 252, 3, 248, 1, 31, 252, 3, 248, 2, 18, 252, 3, 248, 3, 9, 0, 138, 198, 1, 60, 0, 138, 198, 3, 64, 0, 138, 198, 3, 9, 255, 255, 255, 0, 43, 0, 0, 255, 0, 12, 0, 0, 255, 0, 36, 0, 0, 255, 0, 32, 0, 0, 255, 0, 48, 0, 0, 255, 0, 24, 0, 0, 255, 0, 16, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {302, {0, 60, 3, 78, 255, 255, 255, 3, 22, 255, 255, 255, 2, 52, 255, 255, 255, 2, 63, 255, 255, 255, 2, 67, 255, 255, 255, 3, 77, 255, 255, 255, 2, 49, 255, 255, 255, 1, 42, 255, 255, 255, 3, 55, 171, 140, 34, 3, 58, 171, 140, 34, 0, 6, 255, 0, 0, 0, 12, 255, 0, 0, 1, 12, 255, 0, 0, 1, 30, 255, 0, 0, 3, 2, 255, 0, 0, 1, 7, 255, 0, 0, 2, 43, 252, 3, 248, 2, 73, 252, 3, 248, 2, 47, 252, 3, 248, 3, 17, 252, 3, 248, 2, 62, 254, 199, 11, 2, 27, 254, 199, 11, 2, 57, 254, 199, 11, 3, 34, 0, 152, 74, 2, 8, 0, 152, 74, 3, 27, 0, 152, 74, 3, 65, 255, 128, 0, 0, 55, 255, 128, 0, 3, 81, 255, 128, 0, 1, 33, 255, 128, 0, 3, 2, 255, 128, 0, 0, 71, 255, 128, 0, 0, 77, 255, 128, 0, 0, 64, 255, 128, 0, 3, 10, 255, 128, 0, 0, 83, 255, 128, 0, 0, 59, 255, 128, 0, 0, 4, 255, 128, 0, 2, 6, 255, 0, 0, 0, 76, 255, 0, 0, 1, 22, 140, 198, 62, 1, 52, 140, 198, 62, 0, 49, 140, 198, 62, 2, 11, 252, 3, 248, 1, 36, 252, 3, 248, 1, 30, 252, 3, 248, 2, 18, 252, 3, 248, 3, 9, 0, 138, 198, 3, 64, 0, 138, 198, 1, 59, 0, 138, 198, 3, 12, 255, 255, 255, 3, 8, 255, 255, 255, 1, 49, 255, 255, 255, 0, 36, 0, 0, 255, 0, 16, 0, 0, 255, 0, 48, 0, 0, 255, 0, 12, 0, 0, 255, 0, 33, 0, 0, 255, 0, 24, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {332, {0, 66, 3, 22, 255, 255, 255, 3, 77, 255, 255, 255, 2, 52, 255, 255, 255, 3, 78, 255, 255, 255, 2, 63, 255, 255, 255, 2, 49, 255, 255, 255, 1, 41, 255, 255, 255, 2, 68, 255, 255, 255, 3, 55, 171, 140, 34, 3, 58, 171, 140, 34, 3, 65, 255, 0, 0, 1, 13, 255, 0, 0, 0, 13, 255, 0, 0, 0, 5, 255, 0, 0, 3, 83, 255, 0, 0, 3, 2, 255, 0, 0, 1, 7, 255, 0, 0, 3, 67, 255, 0, 0, 1, 30, 255, 0, 0, 2, 72, 252, 3, 248, 3, 17, 252, 3, 248, 2, 42, 252, 3, 248, 2, 47, 252, 3, 248, 2, 62, 254, 199, 11, 2, 27, 254, 199, 11, 2, 56, 254, 199, 11, 3, 26, 0, 152, 74, 2, 9, 0, 152, 74, 3, 52, 0, 152, 74, 3, 34, 0, 152, 74, 3, 3, 255, 128, 0, 0, 4, 255, 128, 0, 0, 56, 255, 128, 0, 3, 65, 255, 128, 0, 3, 81, 255, 128, 0, 0, 76, 255, 128, 0, 0, 83, 255, 128, 0, 1, 32, 255, 128, 0, 3, 10, 255, 128, 0, 0, 60, 255, 128, 0, 0, 64, 255, 128, 0, 0, 71, 255, 128, 0, 0, 75, 255, 0, 0, 2, 0, 255, 0, 0, 2, 6, 255, 0, 0, 0, 49, 140, 198, 62, 1, 23, 140, 198, 62, 1, 52, 140, 198, 62, 1, 37, 252, 3, 248, 2, 18, 252, 3, 248, 2, 11, 252, 3, 248, 1, 30, 252, 3, 248, 3, 8, 0, 138, 198, 1, 58, 0, 138, 198, 3, 64, 0, 138, 198, 3, 12, 255, 255, 255, 3, 8, 255, 255, 255, 1, 49, 255, 255, 255, 0, 44, 0, 0, 255, 0, 16, 0, 0, 255, 0, 11, 0, 0, 255, 0, 33, 0, 0, 255, 0, 36, 0, 0, 255, 0, 48, 0, 0, 255, 0, 24, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {327, {0, 65, 2, 38, 255, 255, 255, 3, 78, 255, 255, 255, 2, 52, 255, 255, 255, 3, 78, 255, 255, 255, 2, 63, 255, 255, 255, 2, 49, 255, 255, 255, 1, 41, 255, 255, 255, 2, 68, 255, 255, 255, 3, 56, 171, 140, 34, 3, 58, 171, 140, 34, 3, 65, 255, 0, 0, 1, 13, 255, 0, 0, 0, 13, 255, 0, 0, 0, 5, 255, 0, 0, 3, 83, 255, 0, 0, 3, 3, 255, 0, 0, 1, 7, 255, 0, 0, 3, 67, 255, 0, 0, 1, 29, 255, 0, 0, 2, 72, 252, 3, 248, 3, 17, 252, 3, 248, 2, 42, 252, 3, 248, 2, 47, 252, 3, 248, 2, 62, 254, 199, 11, 2, 26, 254, 199, 11, 2, 56, 254, 199, 11, 3, 26, 0, 152, 74, 2, 9, 0, 152, 74, 3, 52, 0, 152, 74, 3, 35, 0, 152, 74, 3, 3, 255, 128, 0, 0, 4, 255, 128, 0, 0, 56, 255, 128, 0, 3, 65, 255, 128, 0, 3, 81, 255, 128, 0, 0, 76, 255, 128, 0, 1, 32, 255, 128, 0, 1, 32, 255, 128, 0, 3, 9, 255, 128, 0, 0, 60, 255, 128, 0, 0, 63, 255, 128, 0, 0, 72, 255, 128, 0, 0, 75, 255, 0, 0, 2, 0, 255, 0, 0, 2, 6, 255, 0, 0, 0, 49, 140, 198, 62, 1, 24, 140, 198, 62, 1, 53, 140, 198, 62, 1, 37, 252, 3, 248, 2, 17, 252, 3, 248, 2, 11, 252, 3, 248, 1, 29, 252, 3, 248, 3, 8, 0, 138, 198, 1, 58, 0, 138, 198, 3, 65, 0, 138, 198, 3, 13, 255, 255, 255, 3, 8, 255, 255, 255, 1, 49, 255, 255, 255, 0, 44, 0, 0, 255, 0, 16, 0, 0, 255, 0, 11, 0, 0, 255, 0, 35, 0, 0, 255, 0, 47, 0, 0, 255, 0, 24, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {327, {0, 65, 2, 38, 255, 255, 255, 3, 78, 255, 255, 255, 2, 52, 255, 255, 255, 3, 79, 255, 255, 255, 2, 63, 255, 255, 255, 2, 48, 255, 255, 255, 1, 41, 255, 255, 255, 2, 68, 255, 255, 255, 3, 56, 171, 140, 34, 3, 59, 171, 140, 34, 3, 65, 255, 0, 0, 1, 14, 255, 0, 0, 0, 14, 255, 0, 0, 0, 0, 255, 0, 0, 3, 83, 255, 0, 0, 3, 3, 255, 0, 0, 1, 6, 255, 0, 0, 3, 67, 255, 0, 0, 1, 29, 255, 0, 0, 2, 71, 252, 3, 248, 3, 17, 252, 3, 248, 2, 42, 252, 3, 248, 2, 47, 252, 3, 248, 2, 63, 254, 199, 11, 2, 26, 254, 199, 11, 2, 56, 254, 199, 11, 3, 25, 0, 152, 74, 2, 9, 0, 152, 74, 3, 52, 0, 152, 74, 3, 35, 0, 152, 74, 1, 32, 255, 128, 0, 3, 9, 255, 128, 0, 0, 4, 255, 128, 0, 0, 60, 255, 128, 0, 0, 57, 255, 128, 0, 3, 65, 255, 128, 0, 0, 63, 255, 128, 0, 0, 72, 255, 128, 0, 3, 81, 255, 128, 0, 1, 32, 255, 128, 0, 0, 75, 255, 128, 0, 3, 3, 255, 128, 0, 2, 6, 255, 0, 0, 2, 0, 255, 0, 0, 0, 49, 140, 198, 62, 1, 24, 140, 198, 62, 1, 54, 140, 198, 62, 1, 38, 252, 3, 248, 1, 29, 252, 3, 248, 2, 12, 252, 3, 248, 2, 17, 252, 3, 248, 3, 7, 0, 138, 198, 1, 57, 0, 138, 198, 3, 65, 0, 138, 198, 3, 13, 255, 255, 255, 3, 7, 255, 255, 255, 1, 49, 255, 255, 255, 0, 44, 0, 0, 255, 0, 47, 0, 0, 255, 0, 34, 0, 0, 255, 0, 35, 0, 0, 255, 0, 10, 0, 0, 255, 0, 16, 0, 0, 255, 0, 24, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {307, {0, 61, 3, 79, 255, 255, 255, 1, 40, 255, 255, 255, 2, 53, 255, 255, 255, 2, 62, 255, 255, 255, 2, 68, 255, 255, 255, 2, 48, 255, 255, 255, 2, 38, 255, 255, 255, 3, 78, 255, 255, 255, 3, 59, 171, 140, 34, 3, 56, 171, 140, 34, 3, 65, 255, 0, 0, 1, 14, 255, 0, 0, 0, 14, 255, 0, 0, 0, 0, 255, 0, 0, 3, 4, 255, 0, 0, 1, 6, 255, 0, 0, 3, 67, 255, 0, 0, 1, 28, 255, 0, 0, 3, 83, 255, 0, 0, 2, 71, 252, 3, 248, 3, 16, 252, 3, 248, 2, 41, 252, 3, 248, 2, 63, 254, 199, 11, 2, 25, 254, 199, 11, 2, 56, 254, 199, 11, 3, 25, 0, 152, 74, 2, 10, 0, 152, 74, 3, 52, 0, 152, 74, 3, 36, 0, 152, 74, 3, 4, 255, 128, 0, 0, 57, 255, 128, 0, 3, 65, 255, 128, 0, 3, 80, 255, 128, 0, 0, 75, 255, 128, 0, 1, 32, 255, 128, 0, 0, 83, 255, 128, 0, 0, 62, 255, 128, 0, 3, 8, 255, 128, 0, 0, 73, 255, 128, 0, 0, 61, 255, 128, 0, 2, 6, 255, 0, 0, 2, 0, 255, 0, 0, 1, 25, 140, 198, 62, 1, 54, 140, 198, 62, 1, 28, 252, 3, 248, 2, 12, 252, 3, 248, 1, 38, 252, 3, 248, 2, 17, 252, 3, 248, 3, 7, 0, 138, 198, 1, 57, 0, 138, 198, 3, 65, 0, 138, 198, 3, 14, 255, 255, 255, 3, 7, 255, 255, 255, 1, 48, 255, 255, 255, 0, 10, 0, 0, 255, 0, 34, 0, 0, 255, 0, 47, 0, 0, 255, 0, 45, 0, 0, 255, 0, 23, 0, 0, 255, 0, 34, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {297, {0, 59, 3, 79, 255, 255, 255, 1, 40, 255, 255, 255, 2, 53, 255, 255, 255, 2, 62, 255, 255, 255, 2, 48, 255, 255, 255, 2, 38, 255, 255, 255, 3, 79, 255, 255, 255, 3, 59, 171, 140, 34, 3, 56, 171, 140, 34, 3, 65, 255, 0, 0, 1, 14, 255, 0, 0, 0, 15, 255, 0, 0, 0, 1, 255, 0, 0, 3, 4, 255, 0, 0, 1, 6, 255, 0, 0, 3, 77, 255, 0, 0, 1, 28, 255, 0, 0, 3, 83, 255, 0, 0, 2, 70, 252, 3, 248, 3, 16, 252, 3, 248, 2, 41, 252, 3, 248, 2, 63, 254, 199, 11, 2, 25, 254, 199, 11, 2, 55, 254, 199, 11, 3, 24, 0, 152, 74, 2, 10, 0, 152, 74, 3, 51, 0, 152, 74, 3, 37, 0, 152, 74, 3, 4, 255, 128, 0, 0, 16, 255, 128, 0, 3, 80, 255, 128, 0, 0, 75, 255, 128, 0, 1, 33, 255, 128, 0, 0, 83, 255, 128, 0, 0, 62, 255, 128, 0, 3, 8, 255, 128, 0, 0, 73, 255, 128, 0, 0, 61, 255, 128, 0, 2, 5, 255, 0, 0, 2, 0, 255, 0, 0, 1, 25, 140, 198, 62, 1, 55, 140, 198, 62, 1, 28, 252, 3, 248, 2, 12, 252, 3, 248, 1, 39, 252, 3, 248, 2, 13, 252, 3, 248, 3, 7, 0, 138, 198, 1, 56, 0, 138, 198, 3, 65, 0, 138, 198, 3, 14, 255, 255, 255, 3, 7, 255, 255, 255, 1, 48, 255, 255, 255, 0, 10, 0, 0, 255, 0, 34, 0, 0, 255, 0, 46, 0, 0, 255, 0, 45, 0, 0, 255, 0, 23, 0, 0, 255, 0, 34, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {282, {0, 56, 3, 79, 255, 255, 255, 2, 62, 255, 255, 255, 1, 39, 255, 255, 255, 2, 53, 255, 255, 255, 2, 39, 255, 255, 255, 2, 40, 255, 255, 255, 3, 79, 255, 255, 255, 3, 60, 171, 140, 34, 0, 15, 255, 0, 0, 1, 15, 255, 0, 0, 0, 1, 255, 0, 0, 3, 77, 255, 0, 0, 3, 83, 255, 0, 0, 1, 27, 255, 0, 0, 3, 5, 255, 0, 0, 1, 5, 255, 0, 0, 3, 16, 252, 3, 248, 2, 41, 252, 3, 248, 2, 70, 252, 3, 248, 2, 63, 254, 199, 11, 2, 25, 254, 199, 11, 2, 55, 254, 199, 11, 2, 11, 0, 152, 74, 3, 37, 0, 152, 74, 3, 24, 0, 152, 74, 3, 51, 0, 152, 74, 0, 74, 255, 128, 0, 3, 80, 255, 128, 0, 3, 7, 255, 128, 0, 3, 5, 255, 128, 0, 1, 33, 255, 128, 0, 0, 62, 255, 128, 0, 0, 61, 255, 128, 0, 0, 16, 255, 128, 0, 3, 66, 255, 128, 0, 2, 5, 255, 0, 0, 2, 0, 255, 0, 0, 1, 26, 140, 198, 62, 1, 55, 140, 198, 62, 1, 27, 252, 3, 248, 1, 39, 252, 3, 248, 2, 13, 252, 3, 248, 2, 13, 252, 3, 248, 3, 6, 0, 138, 198, 3, 65, 0, 138, 198, 1, 56, 0, 138, 198, 3, 6, 255, 255, 255, 1, 48, 255, 255, 255, 3, 23, 255, 255, 255, 0, 35, 0, 0, 255, 0, 9, 0, 0, 255, 0, 45, 0, 0, 255, 0, 34, 0, 0, 255, 0, 46, 0, 0, 255, 0, 23, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {282, {0, 56, 3, 80, 255, 255, 255, 3, 79, 255, 255, 255, 1, 39, 255, 255, 255, 2, 61, 255, 255, 255, 2, 53, 255, 255, 255, 2, 69, 255, 255, 255, 2, 40, 255, 255, 255, 2, 39, 255, 255, 255, 3, 60, 171, 140, 34, 3, 64, 255, 0, 0, 1, 15, 255, 0, 0, 0, 15, 255, 0, 0, 1, 27, 255, 0, 0, 0, 2, 255, 0, 0, 3, 77, 255, 0, 0, 3, 5, 255, 0, 0, 1, 5, 255, 0, 0, 2, 41, 252, 3, 248, 2, 69, 252, 3, 248, 3, 15, 252, 3, 248, 2, 24, 254, 199, 11, 2, 64, 254, 199, 11, 2, 55, 254, 199, 11, 2, 11, 0, 152, 74, 3, 23, 0, 152, 74, 3, 38, 0, 152, 74, 3, 51, 0, 152, 74, 0, 74, 255, 128, 0, 0, 82, 255, 128, 0, 3, 80, 255, 128, 0, 3, 7, 255, 128, 0, 0, 15, 255, 128, 0, 1, 33, 255, 128, 0, 3, 66, 255, 128, 0, 0, 62, 255, 128, 0, 3, 5, 255, 128, 0, 0, 61, 255, 128, 0, 2, 0, 255, 0, 0, 2, 5, 255, 0, 0, 1, 26, 140, 198, 62, 1, 56, 140, 198, 62, 2, 13, 252, 3, 248, 2, 13, 252, 3, 248, 1, 27, 252, 3, 248, 1, 40, 252, 3, 248, 3, 6, 0, 138, 198, 1, 55, 0, 138, 198, 3, 6, 255, 255, 255, 1, 48, 255, 255, 255, 3, 23, 255, 255, 255, 0, 35, 0, 0, 255, 0, 9, 0, 0, 255, 0, 46, 0, 0, 255, 0, 46, 0, 0, 255, 0, 23, 0, 0, 255, 3, 56, 245, 110, 27, }},
-    {},
-};
-// clang-format off
-
-// Doing a const cast here should be ok as long as we do not push, pop, or overwrite the circular buffer.
-// This should hold as the fake data circular buffer is defined with the `const` keyword.
-const RealDataCircularBuffer g_fake_data{const_cast<void*>(static_cast<const void*>(&_fake_frames[0])), kNumberOfHistoryFrames};
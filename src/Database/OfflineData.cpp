@@ -0,0 +1,119 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "OfflineData.h"
+
+#include "FrameFormat.h"
+#include "FwConfig.h"
+#include "Logging.h"
+
+bool OfflineDataReader::Init(const uint8_t* const blob, uint32_t size)
+{
+    blob_ = nullptr;
+    size_ = 0U;
+    palette_size_ = 0U;
+    number_of_frames_ = 0U;
+    Reset();
+
+    const auto is_header_valid = (nullptr != blob) && (size >= kHeaderSize) && (blob[0] == 'T') && (blob[1] == 'B') && (blob[2] == 'O') && (blob[3] == 'D') && (1U == blob[4]) && (blob[5] <= kMaxPaletteSize);
+    if (is_header_valid && (size >= (kHeaderSize + (3U * blob[5]))))
+    {
+        blob_ = blob;
+        size_ = size;
+        palette_size_ = blob[5];
+        number_of_frames_ = blob[6] | (blob[7] << 8);
+        Reset();
+    }
+    else
+    {
+        LOG_ERROR("Invalid offline dataset");
+    }
+    return nullptr != blob_;
+}
+
+uint32_t OfflineDataReader::ReadData(uint8_t* const data, const uint32_t max_length)
+{
+    uint32_t frame_length = 0U;
+    if ((nullptr == data) || (0U == max_length) || (0U == number_of_frames_) || ((frame_offset_ + kBytesInHeader) > size_))
+    {
+        // Nothing to read
+    }
+    else
+    {
+        // The frames of the dataset have no train section, a flag set by mistake must not count as LEDs
+        const auto n_leds = FrameFormat_GetNumberOfLeds(&blob_[frame_offset_]);
+        const auto encoded_length = kBytesInHeader + (2U * n_leds);
+        const auto decoded_length = kBytesInHeader + (kBytesPerLed * n_leds);
+        if ((n_leds > kMaxLedsOn) || (decoded_length > max_length) || ((frame_offset_ + encoded_length) > size_))
+        {
+            // Frame would not fit or the dataset is truncated
+        }
+        else
+        {
+            data[0] = static_cast<uint8_t>(n_leds >> 8U);
+            data[1] = static_cast<uint8_t>(n_leds);
+            bool is_frame_valid = true;
+            for (uint32_t i = 0U; is_frame_valid && (i < n_leds); i++)
+            {
+                const auto encoded_led = (blob_[frame_offset_ + kBytesInHeader + (2U * i)] << 8) | blob_[frame_offset_ + kBytesInHeader + (2U * i) + 1U];
+                const auto color_index = static_cast<uint32_t>(encoded_led & 0x3F);
+                if (color_index < palette_size_)
+                {
+                    const auto color = &blob_[kHeaderSize + (3U * color_index)];
+                    auto led = &data[kBytesInHeader + (kBytesPerLed * i)];
+                    led[0] = static_cast<uint8_t>(encoded_led >> 14);
+                    led[1] = static_cast<uint8_t>((encoded_led >> 6) & 0xFF);
+                    led[2] = color[0];
+                    led[3] = color[1];
+                    led[4] = color[2];
+                }
+                else
+                {
+                    is_frame_valid = false;
+                }
+            }
+
+            if (is_frame_valid)
+            {
+                frame_length = decoded_length;
+            }
+            else
+            {
+                // Skip the corrupt frame, reading it again would never succeed
+                LOG_WARN("Offline frame %u has a color out of the palette", frame_index_);
+            }
+            NextFrame(encoded_length);
+        }
+    }
+    return frame_length;
+}
+
+void OfflineDataReader::NextFrame(uint32_t encoded_length)
+{
+    frame_offset_ += encoded_length;
+    frame_index_++;
+    if (frame_index_ >= number_of_frames_)
+    {
+        Reset();
+    }
+}
+
+void OfflineDataReader::Reset()
+{
+    frame_index_ = 0U;
+    frame_offset_ = GetFramesOffset();
+}
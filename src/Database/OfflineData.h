@@ -0,0 +1,70 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef OFFLINE_DATA_H_
+#define OFFLINE_DATA_H_
+
+#include "DataManager.h"
+
+#include <cstdint>
+
+/// @brief Reads the frames shown while offline from a compressed dataset, decoding one frame per read
+/// @details The dataset is created by create_fake_dataset.py and embedded in the firmware, see `OfflineData_GetBlob`.
+/// Format, multi-byte values are little-endian unless noted:
+/// - Header: "TBOD", version (1 byte), palette size (1 byte, at most 64), number of frames (2 bytes)
+/// - Palette: 3 bytes per color (red, green, blue)
+/// - Frames: number of LEDs (2 bytes, big-endian as in the frame header), then 2 bytes per LED (big-endian):
+///   strip id (2 bits), position on the strip (8 bits), palette index (6 bits)
+///
+/// A LED takes 2 bytes instead of 5 in a frame, and the frames take no padding.
+class OfflineDataReader : public DataReader
+{
+  public:
+    OfflineDataReader() = default;
+
+    /// @brief Set the dataset, it must stay in memory
+    /// @return `false` if the dataset is not valid, the reader then reads nothing
+    bool Init(const uint8_t* const blob, uint32_t size);
+
+    uint32_t ReadData(uint8_t* const data, const uint32_t max_length) override;
+
+    /// @brief Restart reading from the first frame
+    void Reset();
+
+    uint32_t GetNumberOfFrames() const { return number_of_frames_; }
+
+  private:
+    static constexpr uint32_t kHeaderSize = 8U;
+    static constexpr uint32_t kMaxPaletteSize = 64U;
+
+    const uint8_t* blob_{nullptr};
+    uint32_t size_{0U};
+    uint32_t palette_size_{0U};
+    uint32_t number_of_frames_{0U};
+    uint32_t frame_index_{0U};
+    uint32_t frame_offset_{0U};
+
+    uint32_t GetFramesOffset() const { return kHeaderSize + (3U * palette_size_); }
+    void NextFrame(uint32_t encoded_length);  // Wraps around after the last frame
+};
+
+/// @brief Get the offline dataset embedded in the firmware
+/// @param size [out] Size of the dataset in bytes
+/// @return Pointer to the dataset, see `OfflineDataReader` for the format
+const uint8_t* OfflineData_GetBlob(uint32_t& size);
+
+#endif  // OFFLINE_DATA_H_
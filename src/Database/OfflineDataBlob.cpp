@@ -14,11 +14,15 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
-#ifndef FAKE_DATA_H_
-#define FAKE_DATA_H_
 
-#include "DataManagerTypes.h"
+#include "OfflineData.h"
 
-extern const RealDataCircularBuffer g_fake_data;
+// Embedded at build time, see board_build.embed_files in platformio.ini
+extern const uint8_t kOfflineDatasetStart[] asm("_binary_src_Database_OfflineDataset_bin_start");
+extern const uint8_t kOfflineDatasetEnd[] asm("_binary_src_Database_OfflineDataset_bin_end");
 
-#endif  // FAKE_DATA_H_
+const uint8_t* OfflineData_GetBlob(uint32_t& size)
+{
+    size = static_cast<uint32_t>(kOfflineDatasetEnd - kOfflineDatasetStart);
+    return kOfflineDatasetStart;
+}
@@ -14,95 +14,113 @@
 # You should have received a copy of the GNU General Public License
 # along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
-from pickle import FRAME
+# Creates the dataset shown while the board is offline (OfflineDataset.bin), in the format read by OfflineDataReader.
+# The history is taken from the server, or from a file saved before with --save.
+#
+#   python3 create_fake_dataset.py [--input history.bin] [--save history.bin] [--output OfflineDataset.bin]
+#
+# The dataset is embedded in the firmware at build time (board_build.embed_files in platformio.ini).
+
+import argparse
+import struct
 from urllib.request import Request, urlopen
-import sys
 
 NUMBER_OF_FRAMES = 45
+BYTES_PER_LED = 5
+HEADER_BYTES = 2
+HAS_TRAINS_FLAG = 0x8000  # Frame header flags, see FrameFormat.h
+HAS_DELAYS_FLAG = 0x4000
+TRAIN_HEADER_BYTES = 2
+BYTES_PER_TRAIN = 5
+BYTES_PER_TRAIN_DELAY = 1
+MAX_PALETTE_SIZE = 64
+FAKE_LED = bytes([3, 56, 245, 110, 27])  # Additional orange led, tells that the board is offline
 
-# Poll server
-req = Request('https://api.trainboard.ch/tb1_1')
-req.add_header('com', 'history_' + str(NUMBER_OF_FRAMES))
-req.add_header('fwv', '0.2.3')
-req.add_header('hwv', 'v1.2')
-req.add_header('mac', '74:4D:BD:8B:6D:94') # MAC address of any existing board
-content = urlopen(req)
 
-# Get bytes
-data = list(content.read())
-data_length =len(data)
+def get_history_from_server():
+    req = Request('https://api.trainboard.ch/tb1_1')
+    req.add_header('com', 'history_' + str(NUMBER_OF_FRAMES))
+    req.add_header('fwv', '0.2.3')
+    req.add_header('hwv', 'v1.2')
+    req.add_header('mac', '74:4D:BD:8B:6D:94')  # MAC address of any existing board
+    return urlopen(req).read()
 
-# Extract LED information
-BYTES_PER_LED = 5
-HEADER_BYTES = 2
-print("Data Length: ")
-print(len(data))
-
-# Open file for writing
-
-code = """
-// Trainboard.ch
-// Copyright (C) 2024 Emile Décosterd
-//
-// This program is free software: you can redistribute it and/or modify
-// it under the terms of the GNU General Public License as published by
-// the Free Software Foundation, either version 3 of the License, or
-// (at your option) any later version.
-//
-// This program is distributed in the hope that it will be useful,
-// but WITHOUT ANY WARRANTY; without even the implied warranty of
-// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-// GNU General Public License for more details.
-//
-// You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
-
-#include "FakeData.h"
-#include "DataManagerTypes.h"
-
-#include <etl/array.h>
-#include <etl/circular_buffer.h>
-
-// clang-format off
-static const Frame _fake_frames[kNumberOfHistoryFrames + 1] = {
-"""
-
-success = True
-frame_cnt = 0
-frame_start_index = 0
-byte_cnt = 0
-is_frame_length_info_in_valid_memory = lambda: frame_start_index + HEADER_BYTES < data_length
-while frame_cnt < NUMBER_OF_FRAMES and is_frame_length_info_in_valid_memory() :
-    n_leds = data[frame_start_index + 1]
-    frame_length = HEADER_BYTES + n_leds*BYTES_PER_LED
-    data[frame_start_index + 1] = n_leds + 1 # add fake LED
-    print("Frame #{}:  length = {}, number of LEDs = {}".format(frame_cnt, frame_length, n_leds))
-    if (frame_start_index + frame_length > data_length):
-        print("Frame parsing error")
-        success = False
-        break
-    code += "    {{{}, {{".format(frame_length + BYTES_PER_LED)
-    for i in range(frame_length - 1):
-        byte_cnt += 1
-        code += "{}, ".format(data[frame_start_index + i])
-    code += "{}, ".format(data[frame_start_index + frame_length - 1])
-    code += "3, 56, 245, 110, 27, }},\n" # Additional orange led
-    byte_cnt += 1
-    frame_cnt += 1
-    frame_start_index += frame_length
-code += "    {},\n};\n"
-code += "// clang-format off\n"
-
-code += """
-// Doing a const cast here should be ok as long as we do not push, pop, or overwrite the circular buffer.
-// This should hold as the fake data circular buffer is defined with the `const` keyword.
-const RealDataCircularBuffer g_fake_data{const_cast<void*>(static_cast<const void*>(&_fake_frames[0])), kNumberOfHistoryFrames};
-"""
-
-print("Data length with fake LEDs : ")
-print(len(data) + BYTES_PER_LED*frame_cnt )
-
-# Write fake data
-if success:
-    with open("FakeData.cpp", "w") as file:
-        file.write(code)
\ No newline at end of file
+
+def get_frame_length(data, start):
+    """Length of the frame starting at `start`, with its optional train and delay sections, see FrameFormat.h"""
+    header = (data[start] << 8) | data[start + 1]
+    n_leds = header & ~(HAS_TRAINS_FLAG | HAS_DELAYS_FLAG)
+    length = HEADER_BYTES + n_leds * BYTES_PER_LED
+    if header & HAS_TRAINS_FLAG:
+        if start + length + TRAIN_HEADER_BYTES > len(data):
+            raise ValueError("Frame parsing error")
+        n_trains = (data[start + length] << 8) | data[start + length + 1]
+        length += TRAIN_HEADER_BYTES + n_trains * BYTES_PER_TRAIN
+        if header & HAS_DELAYS_FLAG:
+            length += n_trains * BYTES_PER_TRAIN_DELAY
+    return n_leds, length
+
+
+def split_frames(data):
+    """Frames of the history, without their train and delay sections that the offline dataset does not keep"""
+    frames = []
+    frame_start_index = 0
+    while len(frames) < NUMBER_OF_FRAMES and frame_start_index + HEADER_BYTES < len(data):
+        n_leds, frame_length = get_frame_length(data, frame_start_index)
+        print("Frame #{}:  length = {}, number of LEDs = {}".format(len(frames), frame_length, n_leds))
+        if frame_start_index + frame_length > len(data):
+            raise ValueError("Frame parsing error")
+        leds_start_index = frame_start_index + HEADER_BYTES
+        leds = data[leds_start_index:leds_start_index + n_leds * BYTES_PER_LED]
+        frames.append(bytes([n_leds >> 8, n_leds & 0xFF]) + leds)
+        frame_start_index += frame_length
+    return frames
+
+
+def add_fake_led(frame):
+    n_leds = ((frame[0] << 8) | frame[1]) + 1
+    return bytes([n_leds >> 8, n_leds & 0xFF]) + frame[HEADER_BYTES:] + FAKE_LED
+
+
+def encode(frames):
+    palette = []
+    encoded_frames = b""
+    for frame in frames:
+        encoded_frames += frame[:HEADER_BYTES]
+        for i in range(HEADER_BYTES, len(frame), BYTES_PER_LED):
+            strip, position, color = frame[i], frame[i + 1], frame[i + 2:i + 5]
+            if color not in palette:
+                palette.append(color)
+            if strip > 3 or len(palette) > MAX_PALETTE_SIZE:
+                raise ValueError("LED cannot be encoded: strip {}, {} colors".format(strip, len(palette)))
+            encoded_frames += struct.pack(">H", (strip << 14) | (position << 6) | palette.index(color))
+    header = b"TBOD" + struct.pack("<BBH", 1, len(palette), len(frames))
+    return header + b"".join(palette) + encoded_frames
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Create the offline dataset")
+    parser.add_argument("--input", help="History data saved before, instead of asking the server")
+    parser.add_argument("--save", help="Save the history data received from the server")
+    parser.add_argument("--output", default="OfflineDataset.bin")
+    args = parser.parse_args()
+
+    if args.input:
+        with open(args.input, "rb") as file:
+            data = file.read()
+    else:
+        data = get_history_from_server()
+        if args.save:
+            with open(args.save, "wb") as file:
+                file.write(data)
+    print("Data Length: {}".format(len(data)))
+
+    frames = [add_fake_led(frame) for frame in split_frames(data)]
+    blob = encode(frames)
+    with open(args.output, "wb") as file:
+        file.write(blob)
+    print("Frames: {} bytes, dataset: {} bytes".format(sum(len(frame) for frame in frames), len(blob)))
+
+
+if __name__ == "__main__":
+    main()
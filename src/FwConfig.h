@@ -26,14 +26,58 @@ constexpr uint32_t kHwVersionPin = 8;
 // Scheduling
 constexpr uint32_t kEventQueueSize = 16U;
 constexpr uint32_t kTickPeriodMilliSeconds = 20;
+constexpr uint32_t kStackLowWaterMarkBytes = 256U;  // Flagged in the memory report if a task has less stack left
+
+// Logging
+constexpr uint32_t kLogBufferLength = 64U;  // Records, a power of two
+constexpr uint32_t kLogTextLength = 24U;    // String argument of a message, longer ones are truncated
+constexpr uint32_t kLogTaskStackSize = 3072U;
+constexpr uint32_t kLogTaskPriority = 0U;  // Below the main loop
+constexpr uint32_t kLogDrainPeriodMilliSeconds = 10U;
 
 // Data
 constexpr uint32_t kMaxLedsOn = 312U;
 constexpr uint32_t kBytesPerLed = 5U;
 constexpr uint32_t kBytesInHeader = 2U;
-constexpr uint32_t kBufferSizeInBytes = (kMaxLedsOn * kBytesPerLed) + kBytesInHeader;
+constexpr uint32_t kMaxTrains = 64U;  // Optional train section of a frame, see FrameFormat.h
+constexpr uint32_t kBytesPerTrain = 5U;
+constexpr uint32_t kBytesInTrainHeader = 2U;
+constexpr uint32_t kBytesPerTrainDelay = 1U;
+constexpr uint32_t kBufferSizeInBytes = (kMaxLedsOn * kBytesPerLed) + kBytesInHeader + (kMaxTrains * (kBytesPerTrain + kBytesPerTrainDelay)) + kBytesInTrainHeader;
 constexpr uint32_t kNumberOfHistoryFrames = 45U;
-constexpr uint32_t kNumberOfFakeFrames = kNumberOfHistoryFrames;
+constexpr uint32_t kStagingArenaSizeInBytes = kNumberOfHistoryFrames * kBufferSizeInBytes;  // Holds a whole history response
+constexpr uint32_t kDataReadAttempts = 3U;  // Copies of a frame that the writer task changed meanwhile before giving up, see SeqLock.h
+
+// Server, override with build flags to use e.g. the local stand-in server (test/local_server.py)
+#ifndef SERVER_URL
+#define SERVER_URL "https://api.trainboard.ch"
+#endif
+
+// Poll scheduler
+constexpr uint32_t kPollIntervalSeconds = 60;
+constexpr uint32_t kPollJitterPercent = 10;         // Random spread of the poll interval, so that the boards do not poll in lockstep
+constexpr uint32_t kPollRetryMinSeconds = 2;        // Retry delay after the first failed poll, doubled on every further failure
+constexpr uint32_t kPollRetryMaxSeconds = 5 * 60;   // Cap of the retry delay
+constexpr uint32_t kPollHintMaxSeconds = 15 * 60;  // Cap of the delays asked by the server
+
+// Server push channel, the live frames are polled if it is disabled or not available
+constexpr bool kIsServerPushEnabled = true;
+constexpr uint32_t kPushFallbackPollSeconds = 3 * 60;  // Poll anyway if nothing was pushed for this long
+constexpr uint32_t kPushRetryPolls = 15;               // Number of polls before retrying to open the push channel
+
+// OTA update, downloaded in the background while the board stays live
+constexpr uint32_t kOtaCheckIntervalMinutes = 15;
+constexpr uint32_t kOtaChunkSizeInBytes = 1024U;
+constexpr uint32_t kOtaChunkPauseMilliSeconds = 20U;  // Throttles the download to about 50 kB/s
+// The OTA TLS session comes on top of the poll and push sessions, about 40 kB of internal RAM each: the free and
+// minimum free internal RAM are logged once the OTA session is open, they must leave room for the next handshake.
+constexpr uint32_t kOtaThreadStackSize = 12288U;      // TLS handshake and the patcher, the high-water mark is logged
+constexpr uint32_t kOtaThreadPriority = 1U;           // As the main loop, so that neither starves the other
+constexpr uint32_t kOtaRebootMaxWaitChecks = 4 * 12;  // Restart anyway if it did not get dark within 12 hours
+
+// Connection listener
+constexpr uint32_t kServerRetryIntervalSeconds = 30;           // Ping interval while the server is not reachable
+constexpr uint32_t kServerSilenceBeforePingSeconds = 5 * 60;  // Ping only if no request reached the server for this long
 
 // Provisioning configuration
 constexpr uint32_t kConnectTimeout = 20;           // s
@@ -44,11 +88,22 @@ constexpr const char* kAccessPointName = "Trainboard_AP";
 // Button
 constexpr uint32_t kDebounceDurationMilliSeconds = 50U;
 constexpr uint32_t kShortPushMinDurationMilliSeconds = 100U;
+constexpr uint32_t kLongPushMinDurationMilliSeconds = 1000U;
+constexpr uint32_t kDoublePushMaxGapMilliSeconds = 250U;   // Between the release and the next push
+constexpr uint32_t kRepeatPushPeriodMilliSeconds = 500U;  // While the button is held after a long push
+constexpr bool kIsDoublePushEnabled = false;  // No state reacts to DOUBLE_PUSH, the short pushes are posted on release
 
 // Light sensor
 constexpr uint8_t kDefaultBrightness = 15;
 constexpr uint8_t kMinimumBrightness = 7;
-constexpr uint32_t kBrigthnessUpdateRateMilliSec = 100;
+constexpr uint32_t kBrigthnessUpdateRateMilliSec = 100;  // Measurement rate of the sensor
+constexpr uint32_t kBrightnessFilterShift = 5U;          // Each measurement weighs 1/32 in the filtered light
+constexpr uint16_t kDarkLightCounts = 0U;                // Sensor output mapped to brightness 0
+constexpr uint16_t kBrightLightCounts = UINT16_MAX;      // Sensor output mapped to brightness 255, and above
+constexpr uint32_t kLightSensorRetryMilliSec = 5000U;    // While the sensor is not detected
+constexpr uint32_t kLightSensorTaskStackSize = 3072U;
+constexpr uint32_t kLightSensorTaskPriority = 1U;
+constexpr uint32_t kLightSensorTaskCore = 0U;  // Away from the main loop, the I2C transfers block the task
 
 // Pins
 constexpr uint8_t kButtonPinNr = 7;
@@ -58,7 +113,15 @@ constexpr uint8_t kLightSensorSclPin = 6;
 
 // Led
 constexpr uint32_t kNumberOfStrips = 4U;
+constexpr uint32_t kMaxLedsPerStrip = 256U;  // The frames address a LED of a strip on 8 bits
 constexpr uint32_t kTransitionDurationInTicks = 2000 / kTickPeriodMilliSeconds;
+constexpr uint32_t kTrainMotionDurationInTicks = ((kPollIntervalSeconds * 1000) / kTickPeriodMilliSeconds) - kTransitionDurationInTicks;
+constexpr uint32_t kTrainMaxStepLeds = 8U;  // Trains moving further between two frames jump instead
+constexpr uint32_t kLedUpdateBatchSize = 64U;  // LEDs set on a strip with one call, one batch per strip in the LED manager
+constexpr uint32_t kBrightnessFramePeriodInTicks = 500 / kTickPeriodMilliSeconds;  // Brightness changes outside transitions
+constexpr uint32_t kRenderTaskStackSize = 4096U;
+constexpr uint32_t kRenderTaskPriority = 2U;  // Above the main loop, the task mostly waits for the LED driver
+constexpr uint32_t kRenderTaskCore = 1U;      // Shares the core with the main loop and preempts it, the WiFi stack keeps core 0; the longest show is logged
 
 constexpr uint32_t kV1Strip1NLeds = 145;
 constexpr uint32_t kV1Strip2NLeds = 54;
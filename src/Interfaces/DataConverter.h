@@ -27,6 +27,7 @@
 #include <optional>
 
 class Led;
+struct Train;
 
 /// @brief
 /// Checks that data containing one frame is valid.
@@ -41,6 +42,7 @@ class Led;
 ///      - The provided buffer is valid
 ///      - The length of the data fits in the maximum frame size
 ///      - The length of the data corresponds to the length specified in the data
+///      - The trains, if any, refer to LEDs of the frame
 bool DataConv_IsDataValid(const uint8_t* const data, uint32_t data_length);
 
 /// @brief
@@ -59,6 +61,19 @@ bool DataConv_IsDataValid(const uint8_t* const data, uint32_t data_length);
 ///      - The data stream contains the right amount of frames
 bool DataConv_IsHistoryDataValid(const uint8_t* const data, uint32_t data_length);
 
+/// @brief
+/// Checks that data containing the history frames missing on the device is valid.
+///
+/// @param data Buffer containing the data received from the server
+/// @param data_length Number of bytes in the data buffer
+///
+/// @return `true` if the data is valid, `false` otherwise.
+///
+/// @details
+/// The same conditions as for `DataConv_IsHistoryDataValid` are checked, except
+/// that the data stream may contain between one frame and the history length.
+bool DataConv_IsHistoryUpdateValid(const uint8_t* const data, uint32_t data_length);
+
 /// @brief
 /// Converts a data stream containing one frame to an array of LEDs.
 ///
@@ -75,4 +90,20 @@ std::optional<uint32_t> DataConv_DataToLeds(const uint8_t* const data_in,
                                             Led* const leds_out,
                                             const uint32_t max_leds_out);
 
+/// @brief
+/// Extracts the trains of a data stream containing one frame.
+///
+/// @param data_in Buffer containing the data received from the server
+/// @param data_length Number of bytes in the data buffer
+/// @param trains_out [out] Buffer in which the trains will be written
+/// @param max_trains_out Maximum number of expected trains
+///
+/// @return
+///  `std::nullopt` when an input parameter pointer is invalid, 0 if the data
+/// is invalid or has no trains, or the number of extracted trains otherwise.
+std::optional<uint32_t> DataConv_DataToTrains(const uint8_t* const data_in,
+                                              const uint32_t data_length,
+                                              Train* const trains_out,
+                                              const uint32_t max_trains_out);
+
 #endif  // DATA_CONVERTER_H_
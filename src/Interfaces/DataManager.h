@@ -18,18 +18,21 @@
 #define DATA_MANAGER_H_
 
 #include <cstdint>
+#include <optional>
 
 enum class DataReaderMode
 {
     kLive,     /// Read last written framehistory frame
     kHistory,  /// Read next history frametory frames
-    kOffline   /// Read next offline frame
+    kOffline,  /// Read next offline frame
+    kDelay     /// Read the delays over the history frames
 };
 
 enum class DataWriterMode
 {
-    kSingle,   /// Overwrite oldest history frame
-    kMultiple  /// Overwrite all history frames
+    kSingle,    /// Overwrite oldest history frame
+    kMultiple,  /// Overwrite all history frames
+    kAppend     /// Append missing frames, overwriting the oldest history frames
 };
 
 /// @brief Abstract class representing an object to write one or multiple frames to memory
@@ -55,9 +58,19 @@ class DataReader
     /// 0 if input parameters are invalid or data does not fit into provided buffer
     /// number of written bytes otherwise
     virtual uint32_t ReadData(uint8_t* const data, const uint32_t max_length) = 0;
+
+    /// @brief Check if the last read gave up because the writer kept changing the data, see kDataReadAttempts
+    /// @return `true` if nothing was read for that reason, the same data can be read again later
+    virtual bool WasBusy() const
+    {
+        return false;
+    }
     virtual ~DataReader() = default;
 };
 
+/// @brief Allocate the frame store in the external RAM, call it once before any other function
+void DataMgr_Init();
+
 /// @brief Reset the data mode to `kLive`, clear history data, and reset history
 /// frame pointer to the first history frame.
 void DataMgr_Reset();
@@ -74,6 +87,26 @@ void DataMgr_SetWriterMode(DataWriterMode mode);
 /// @brief Get actual data mode for writing to store
 DataWriterMode DataMgr_GetWriterMode();
 
+/// @brief Set the sequence number of the newest frame written to the store
+/// @param sequence Sequence number given by the server, `std::nullopt` if unknown
+/// @details
+/// In `kSingle` mode, the sequence number is only kept if it directly follows the
+/// previous one. Otherwise, the history has a gap and is considered unknown.
+void DataMgr_SetNewestSequence(std::optional<uint32_t> sequence);
+
+/// @brief Get the sequence number of the newest frame in the store
+/// @return `std::nullopt` if unknown
+std::optional<uint32_t> DataMgr_GetNewestSequence();
+
+/// @brief Check if a frame received from the server is newer than the newest frame in the store
+/// @param sequence Sequence number of the received frame, `std::nullopt` if unknown
+/// @return `false` if both sequence numbers are known and the frame is not newer, e.g. pushed again
+bool DataMgr_IsNewerSequence(std::optional<uint32_t> sequence);
+
+/// @brief Check if the history can be completed by appending the missing frames only
+/// @return `true` if the history is full and the sequence number of its newest frame is known
+bool DataMgr_CanAppendHistory();
+
 /// @brief Get a writer object
 /// @return
 /// `nullptr` if writer not available for the actual data mode
@@ -81,6 +114,7 @@ DataWriterMode DataMgr_GetWriterMode();
 DataWriter* DataMgr_GetWriter();
 
 /// @brief Get a reader object
+/// @details The readers can run in another task than the writer, they never see a frame being written
 /// @return
 /// Pointer to a data reader object for the actual data mode
 DataReader* DataMgr_GetReader();
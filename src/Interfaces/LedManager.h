@@ -25,7 +25,9 @@
 #include <cstdint>
 
 enum class LedColor : uint32_t;
+enum class TransitionEffect : uint8_t;
 class Led;
+struct Train;
 
 /// @brief Abstract class representing an object through which the
 /// application interacts with the LEDs on the board
@@ -50,7 +52,16 @@ class LedManager
     /// No return value is provided to indicate if the data is valid or not.
     virtual void SetLeds(const Led* const leds, uint32_t leds_length) = 0;
 
-    /// @brief Immediately clears all LEDs on the board, interrupting any
+    /// @brief
+    /// Set the trains shown by the next LEDs, must be called before `SetLeds`.
+    ///
+    /// @details
+    /// A train that was in the previous LEDs and moved a few LEDs in its direction
+    /// stays where it was during the transition, then moves to its new position
+    /// with `RefreshMotion`. The other trains jump as any other LED.
+    virtual void SetTrains(const Train* const trains, uint32_t trains_length) = 0;
+
+    /// @brief Clears all LEDs on the board at the next frame, interrupting any
     /// on-going transition.
     virtual void ClearAllLeds() = 0;
 
@@ -60,10 +71,30 @@ class LedManager
     /// @return `true` if transition is finished, `false` otherwise.
     virtual bool RefreshTransition() = 0;
 
-    /// @brief Update the brightness of the LEDs.
+    /// @brief Update routine for the train motion. Must be called continuously
+    /// at a fixed rate between the transitions.
+    virtual void RefreshMotion() = 0;
+
+    /// @brief Select the effect of the next transitions, the on-going transition keeps its effect.
+    virtual void SetTransitionEffect(TransitionEffect effect) = 0;
+
+    /// @brief Update the brightness of the LEDs, applied by `ShowFrame`.
     /// @param `brightness` : 0 (off) to 255 (full scale)
     virtual void SetBrightness(uint8_t brightness) = 0;
 
+    /// @brief Shows the changes made to the LEDs since the last frame. Must be
+    /// called once per tick, after all the updates of the tick.
+    ///
+    /// @details
+    /// Nothing is shifted out to the LEDs when nothing changed. A brightness
+    /// change alone is shown at most once every `kBrightnessFramePeriodInTicks`.
+    /// While the previous frame is still being shown, the changes wait for the
+    /// next call, this never blocks.
+    virtual void ShowFrame() = 0;
+
+    /// @brief Check if all the changes made to the LEDs were shifted out, e.g. before a restart
+    virtual bool IsShowDone() = 0;
+
     virtual ~LedManager() = default;
 };
 
@@ -27,8 +27,13 @@ class LedPresenter
     ///@param brightness 0 (off) to 255 (full scale)
     virtual void SetBrightness(uint8_t brightness) = 0;
 
-    /// @brief Shifts out the data to the LEDs.
+    /// @brief Shifts out the data committed by the strips to the LEDs. May
+    /// return before the data is shifted out, see `IsShowDone`.
     virtual void Show() = 0;
+
+    /// @brief Tells if the previous `Show` completed. The strips must not be
+    /// committed and `Show` not be called again before.
+    virtual bool IsShowDone() = 0;
     virtual ~LedPresenter() = default;
 };
 
@@ -19,6 +19,14 @@
 
 #include <cstdint>
 
+/// @brief One LED to set, see LedStrip::SetMany
+struct LedUpdate
+{
+    uint32_t html_color;
+    uint16_t position;
+    uint8_t scaling;
+};
+
 /// @brief Represents an LED strip
 class LedStrip
 {
@@ -32,6 +40,21 @@ class LedStrip
     /// @param scaling 0-255 use this for fading effects
     virtual void Set(uint32_t position, uint32_t html_color, uint8_t scaling) = 0;
 
+    /// @brief Set several LEDs of the strip with a single call
+    /// @param updates Position, color and scaling of each LED, as in Set
+    /// @param number_of_updates Number of elements in `updates`
+    virtual void SetMany(const LedUpdate* updates, uint32_t number_of_updates) = 0;
+
+    /// @brief Save the LEDs set so far as the start of a blend, see Blend
+    virtual void SaveBlendStart() = 0;
+
+    /// @brief Save the LEDs set so far as the target of a blend, see Blend
+    virtual void SaveBlendTarget() = 0;
+
+    /// @brief Set all LEDs between the saved start and target, the time does not depend on the LEDs that change
+    /// @param progress 0 (start) to 255 (target)
+    virtual void Blend(uint8_t progress) = 0;
+
     /// @brief Get the length of the strip
     /// @return Number of LEDs on the strip
     virtual uint32_t GetSize() const = 0;
@@ -42,6 +65,9 @@ class LedStrip
     /// @brief Test the LEDs (e.g. all LEDs white)
     virtual void Test() = 0;
 
+    /// @brief Copy the LEDs set so far to the buffer shown by the presenter
+    virtual void Commit() = 0;
+
     virtual ~LedStrip() = default;
 };
 
@@ -20,6 +20,25 @@
 #include <cstdint>
 #include <optional>
 
+#include "RequestMetrics.h"
+
+/// @brief Outcome of the requests sent to the server
+struct ServerComStatus
+{
+    uint32_t request_cnt;  /// Number of completed requests, wraps around
+    bool was_reachable;    /// `true` if the server answered the last request
+};
+
+/// @brief Initialise the server communication, call it before any request
+void ServerCom_Init();
+
+/// @brief Get the outcome of the last request sent to the server, whatever module sent it
+ServerComStatus ServerCom_GetStatus();
+
+/// @brief Get the timings, sizes and errors of the data requests
+/// @details Only the frame requests are measured, the ping, push channel and OTA requests are not.
+const RequestMetrics& ServerCom_GetDataRequestMetrics();
+
 /// @brief Get the data for one frame from the server
 /// @param buffer [out] Pointer to the memory where the data from the server will be written to
 /// @param max_length Size of the provided buffer
@@ -38,9 +57,68 @@ std::optional<uint32_t> ServerCom_GetData(uint8_t* const buffer, const uint32_t
 /// - the length of the data read from the server if the communication was successful
 std::optional<uint32_t> ServerCom_GetHistoryData(uint8_t* const buffer, const uint32_t max_length);
 
-/// @brief Check if there is a firmware update available and if so, update.
-/// @return `false` if no update is available, `true` otherwise. The device may be reset in this function.
-bool ServerCom_UpdateOta();
+/// @brief Get the history frames newer than the given sequence number from the server
+/// @param buffer [out] Pointer to the memory where the data from the server will be written to
+/// @param max_length Size of the provided buffer
+/// @param sequence Sequence number of the newest frame already stored on the device
+/// @return
+/// - `std::nullopt` if the communication with the server is still on-going
+/// - 0 if the communication with the server failed or if there is no newer frame
+/// - the length of the data read from the server if the communication was successful
+/// @note Use `ServerCom_GetLastSequence` to tell whether a zero length means that the history is up to date.
+std::optional<uint32_t> ServerCom_GetHistoryDataSince(uint8_t* const buffer, const uint32_t max_length, const uint32_t sequence);
+
+/// @brief Get the sequence number of the newest frame sent by the server in the last data request
+/// @return `std::nullopt` if the last request failed or if the server did not send it
+std::optional<uint32_t> ServerCom_GetLastSequence();
+
+/// @brief Get the delay before the next poll asked by the server in the last data request
+/// @return `std::nullopt` if the server did not ask for one, the delay in seconds otherwise
+/// @details The server sends it in the "next-poll" header with the data, or in the "Retry-After" header when it is overloaded.
+std::optional<uint32_t> ServerCom_GetPollHint();
+
+/// @brief Open the push channel over which the server streams the live frames as soon as they are computed
+/// @return `false` if the server could not be reached or does not support the push channel, `true` otherwise
+/// @details The channel is a long-lived connection carrying server-sent events, see `SseParser`.
+bool ServerCom_OpenPushChannel();
+
+/// @brief Check if the push channel is open
+bool ServerCom_IsPushChannelOpen();
+
+/// @brief Close the push channel
+void ServerCom_ClosePushChannel();
+
+/// @brief Get the newest frame pushed by the server since the last call, without blocking
+/// @param buffer [out] Pointer to the memory where the frame will be written to
+/// @param max_length Size of the provided buffer
+/// @return
+/// - `std::nullopt` if no complete frame was received since the last call
+/// - 0 if the push channel is closed or was lost
+/// - the length of the frame otherwise
+/// @note `ServerCom_GetLastSequence` then gives the sequence number of this frame.
+/// @note At most `kBufferSizeInBytes` bytes are read per call, a frame may take several calls.
+std::optional<uint32_t> ServerCom_GetPushedData(uint8_t* const buffer, const uint32_t max_length);
+
+/// @brief Progress of the firmware update
+enum class OtaStatus
+{
+    kIdle,         /// No update is being downloaded
+    kDownloading,  /// The update check or download runs in the background
+    kReady,        /// The new firmware is written to the inactive partition, it starts at the next restart
+};
+
+/// @brief Check for a firmware update and download it, in a low-priority background task
+/// @return `false` if a check or a download is already running or if an update is ready, `true` otherwise
+/// @details The check is a conditional request, the server answers 304 if the running firmware is up to date.
+/// A delta patch against the running firmware is preferred, the full image is downloaded if the server has none.
+/// The download is throttled so that the live display keeps running.
+bool ServerCom_StartOtaUpdate();
+
+/// @brief Get the progress of the firmware update
+OtaStatus ServerCom_GetOtaStatus();
+
+/// @brief Restart into the downloaded firmware, only call it if the status is `OtaStatus::kReady`
+void ServerCom_ApplyOtaUpdate();
 
 /// @brief Ping the server to check if it responds
 /// @return
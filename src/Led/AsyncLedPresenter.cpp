@@ -0,0 +1,83 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "AsyncLedPresenter.h"
+
+#include "Logging.h"
+#include "OsWrapper.h"
+
+void AsyncLedPresenter::Init(uint32_t stack_size, uint32_t priority, uint32_t core)
+{
+    ASSERT(nullptr == frame_queue_);  // Only one render task per presenter
+    frame_queue_ = OswQueueCreate(1U, sizeof(FrameRequest));
+    done_queue_ = OswQueueCreate(1U, sizeof(uint8_t));
+    OswTaskCreate(RenderTask, "Render Task", this, stack_size, priority, core);
+}
+
+void AsyncLedPresenter::SetBrightness(uint8_t brightness)
+{
+    brightness_ = brightness;
+}
+
+void AsyncLedPresenter::Show()
+{
+    ASSERT(!is_showing_);  // The front buffers are being shown, nothing may be committed
+    const FrameRequest request{brightness_};
+    is_showing_ = true;
+    OswQueuePut(frame_queue_, &request);
+}
+
+bool AsyncLedPresenter::IsShowDone()
+{
+    uint8_t done = 0U;
+    if (is_showing_ && OswQueueGet(done_queue_, &done, 0U))
+    {
+        is_showing_ = false;
+    }
+    else
+    {
+        // Idle or still showing
+    }
+    return !is_showing_;
+}
+
+void AsyncLedPresenter::RenderTask(void* context)
+{
+    auto* self = static_cast<AsyncLedPresenter*>(context);
+    ASSERT(nullptr != self);
+    while (true)
+    {
+        FrameRequest request{};
+        if (OswQueueGet(self->frame_queue_, &request))
+        {
+            const auto start_us = OswGetMicroSeconds();
+            self->presenter_.SetBrightness(request.brightness);
+            self->presenter_.Show();
+            const auto show_us = OswGetMicroSeconds() - start_us;
+            if (show_us > self->max_show_us_)
+            {
+                self->max_show_us_ = show_us;
+                LOG_INFO("Render task - Longest show so far: %u us", show_us);
+            }
+            const uint8_t done = 1U;
+            OswQueuePut(self->done_queue_, &done);
+        }
+        else
+        {
+            // Timeout, no frame to show yet
+        }
+    }
+}
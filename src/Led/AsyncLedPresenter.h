@@ -0,0 +1,65 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef ASYNC_LED_PRESENTER_H_
+#define ASYNC_LED_PRESENTER_H_
+
+#include "LedPresenter.h"
+
+#include <atomic>
+#include <cstdint>
+
+/// @brief Presents the LEDs from a dedicated render task, so that shifting the
+/// data out does not hold the main loop.
+///
+/// @details
+/// The render task waits for a frame, sets the brightness and shows the LEDs
+/// with the wrapped presenter, then notifies the completion. Meanwhile, the LED
+/// manager composes the next frame in the back buffers of the strips, it
+/// commits them to the front buffers only once `IsShowDone`.
+/// The longest show is logged whenever it grows, it tells whether the frames
+/// keep up with the tick period.
+class AsyncLedPresenter : public LedPresenter
+{
+  public:
+    /// @param presenter Blocking presenter, only called from the render task after `Init`
+    explicit AsyncLedPresenter(LedPresenter& presenter) : presenter_(presenter) {}
+    void Init(uint32_t stack_size, uint32_t priority, uint32_t core);
+
+    void SetBrightness(uint8_t brightness) override;  // Applied with the next frame
+    void Show() override;
+    bool IsShowDone() override;
+
+    /// @brief Get the longest time the render task took to show a frame
+    uint32_t GetMaxShowMicroSeconds() const { return max_show_us_; }
+
+  private:
+    struct FrameRequest
+    {
+        uint8_t brightness;
+    };
+
+    LedPresenter& presenter_;
+    void* frame_queue_{nullptr};  // Main loop -> render task
+    void* done_queue_{nullptr};   // Render task -> main loop
+    uint8_t brightness_{UINT8_MAX};
+    bool is_showing_{false};
+    std::atomic<uint32_t> max_show_us_{0U};  // Written by the render task only
+
+    static void RenderTask(void* context);
+};
+
+#endif  // ASYNC_LED_PRESENTER_H_
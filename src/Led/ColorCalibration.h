@@ -0,0 +1,124 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef COLOR_CALIBRATION_H_
+#define COLOR_CALIBRATION_H_
+
+#include <cstdint>
+
+/// @brief Color response of the LEDs of a hardware version
+struct ColorCalibration
+{
+    double gamma;   // Exponent from the HTML color to the LED duty cycle
+    uint8_t red;    // Duty cycle of a full channel, sets the white point
+    uint8_t green;
+    uint8_t blue;
+};
+
+// Calibration of each hardware version. Starting values for WS2812B LEDs, whose green and blue
+// are brighter than their red: tune them by comparing the boards side by side.
+constexpr ColorCalibration kV1ColorCalibration{2.2, 255U, 200U, 220U};
+constexpr ColorCalibration kV11ColorCalibration{2.2, 255U, 200U, 220U};
+constexpr ColorCalibration kV12ColorCalibration{2.2, 255U, 200U, 220U};
+
+/// @brief Lookup tables from the HTML color channels to the LED duty cycles, computed at compile time
+class ColorLut
+{
+  public:
+    constexpr explicit ColorLut(const ColorCalibration& calibration) : red_{}, green_{}, blue_{}
+    {
+        for (auto i = 0U; i < kSize; i++)
+        {
+            const auto level = Power(static_cast<double>(i) / (kSize - 1U), calibration.gamma);
+            red_[i] = static_cast<uint8_t>((level * calibration.red) + 0.5);
+            green_[i] = static_cast<uint8_t>((level * calibration.green) + 0.5);
+            blue_[i] = static_cast<uint8_t>((level * calibration.blue) + 0.5);
+        }
+    }
+
+    /// @brief Write a color, scaled, gamma corrected and calibrated, into a RGB pixel (e.g. `CRGB`)
+    /// @param scaling 0-255, applied before the gamma correction so that the fades look linear
+    template<typename TPixel>
+    void Apply(uint32_t html_color, uint8_t scaling, TPixel& pixel) const
+    {
+        pixel.r = red_[Scale(html_color >> 16U, scaling)];
+        pixel.g = green_[Scale(html_color >> 8U, scaling)];
+        pixel.b = blue_[Scale(html_color, scaling)];
+    }
+
+    uint8_t GetRed(uint8_t value) const { return red_[value]; }
+    uint8_t GetGreen(uint8_t value) const { return green_[value]; }
+    uint8_t GetBlue(uint8_t value) const { return blue_[value]; }
+
+  private:
+    static constexpr uint32_t kSize = 256U;
+    uint8_t red_[kSize];
+    uint8_t green_[kSize];
+    uint8_t blue_[kSize];
+
+    static uint8_t Scale(uint32_t value, uint8_t scaling)
+    {
+        return static_cast<uint8_t>(((value & 0xFFU) * (scaling + 1U)) >> 8U);
+    }
+
+    // std::pow is not constexpr, x^y = exp(y * ln(x)) for 0 <= x <= 1
+    static constexpr double Power(double x, double y)
+    {
+        return (x <= 0.0) ? 0.0 : Exp(y * Ln(x));
+    }
+
+    static constexpr double Ln(double x)
+    {
+        // x = m * 2^e with 0.5 <= m < 1, ln(m) = 2 * atanh((m - 1) / (m + 1))
+        constexpr double kLn2 = 0.69314718055994530942;
+        int32_t exponent = 0;
+        while (x < 0.5)
+        {
+            x *= 2.0;
+            exponent--;
+        }
+        const double z = (x - 1.0) / (x + 1.0);
+        double term = z;
+        double sum = 0.0;
+        for (auto k = 1U; k < 40U; k += 2U)
+        {
+            sum += term / k;
+            term *= z * z;
+        }
+        return (2.0 * sum) + (exponent * kLn2);
+    }
+
+    static constexpr double Exp(double x)
+    {
+        // exp(x) = exp(x / 2^8)^(2^8), the Taylor series converges fast close to 0
+        constexpr uint32_t kHalvings = 8U;
+        const double reduced = x / (1U << kHalvings);
+        double term = 1.0;
+        double sum = 1.0;
+        for (auto k = 1U; k < 12U; k++)
+        {
+            term *= reduced / k;
+            sum += term;
+        }
+        for (auto i = 0U; i < kHalvings; i++)
+        {
+            sum *= sum;
+        }
+        return sum;
+    }
+};
+
+#endif  // COLOR_CALIBRATION_H_
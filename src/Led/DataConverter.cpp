@@ -16,16 +16,18 @@
 
 #include "DataConverter.h"
 
+#include "FrameFormat.h"
 #include "FwConfig.h"
 #include "Led.h"
 #include "Logging.h"
-#include "etl/string.h"
-#include "etl/to_string.h"
+#include "etl/algorithm.h"
 
 static inline Led ExtractLed(const uint8_t* const data_in, uint32_t pos);
 static inline bool IsInputValid(const uint8_t* const data_in, const uint32_t data_length, const Led* const leds_out, const uint32_t max_leds_out);
 static inline void WriteLedsToArray(const uint8_t* const data_in, Led* const leds_out, uint32_t nr_of_leds);
 static inline bool IsDataNullEmptyOrTooLong(const uint8_t* const data, uint32_t data_length, uint32_t max_length);
+static inline bool AreFramesValid(const uint8_t* const data, uint32_t data_length, uint32_t min_frames);
+static inline bool AreTrainsValid(const uint8_t* const data);
 
 bool DataConv_IsDataValid(const uint8_t* const data, uint32_t data_length)
 {
@@ -37,18 +39,31 @@ bool DataConv_IsDataValid(const uint8_t* const data, uint32_t data_length)
     }
     else
     {
-        const auto number_of_leds = (data[0] << 8) | data[1];
-        const auto number_of_leds_bytes_expected = kBytesPerLed * number_of_leds;
-        const auto expected_buffer_length = kBytesInHeader + number_of_leds_bytes_expected;
+        const auto expected_buffer_length = FrameFormat_GetLength(data, data_length);
         is_data_valid = (data_length == expected_buffer_length);
 
         if (!is_data_valid)
         {
-            etl::string<64> msg("DataConverter - Wrong data length: ");
-            etl::to_string(data_length, msg, true);
-            msg.append(" != ");
-            etl::to_string(expected_buffer_length, msg, true);
-            LOG_ERROR(msg.c_str());
+            LOG_ERROR("DataConverter - Wrong data length: %u != %u", data_length, expected_buffer_length);
+        }
+        else if (FrameFormat_GetNumberOfLeds(data) > kMaxLedsOn)
+        {
+            LOG_ERROR("DataConverter - Too many LEDs");
+            is_data_valid = false;
+        }
+        else if (FrameFormat_HasDelays(data) && !FrameFormat_HasTrains(data))
+        {
+            LOG_ERROR("DataConverter - Delays without trains");
+            is_data_valid = false;
+        }
+        else if (FrameFormat_HasTrains(data) && !AreTrainsValid(data))
+        {
+            LOG_ERROR("DataConverter - Invalid trains");
+            is_data_valid = false;
+        }
+        else
+        {
+            // Valid frame
         }
     }
 
@@ -57,31 +72,12 @@ bool DataConv_IsDataValid(const uint8_t* const data, uint32_t data_length)
 
 bool DataConv_IsHistoryDataValid(const uint8_t* const data, uint32_t data_length)
 {
-    bool is_data_valid = true;
-
-    if (IsDataNullEmptyOrTooLong(data, data_length, kNumberOfHistoryFrames * kBufferSizeInBytes))
-    {
-        is_data_valid = false;
-    }
-    else
-    {
-        size_t frame_start_index = 0U;
-        size_t frame_cnt = 0U;
-        while ((frame_cnt < kNumberOfHistoryFrames) && (frame_start_index + kBytesInHeader < data_length) && is_data_valid)
-        {
-            const auto second_byte_in_frame = frame_start_index + 1;
-            const auto n_leds_in_frame = (data[frame_start_index] << 8) + data[second_byte_in_frame];
-            const auto frame_length = kBytesInHeader + n_leds_in_frame * kBytesPerLed;
-            is_data_valid = DataConv_IsDataValid(&data[frame_start_index], frame_length);
-            frame_cnt++;
-            frame_start_index += frame_length;
-        }
-
-        is_data_valid = is_data_valid && (kNumberOfHistoryFrames == frame_cnt);
-        is_data_valid = is_data_valid && (frame_start_index == data_length);
-    }
+    return AreFramesValid(data, data_length, kNumberOfHistoryFrames);
+}
 
-    return is_data_valid;
+bool DataConv_IsHistoryUpdateValid(const uint8_t* const data, uint32_t data_length)
+{
+    return AreFramesValid(data, data_length, 1U);
 }
 
 std::optional<uint32_t> DataConv_DataToLeds(const uint8_t* const data_in,
@@ -98,8 +94,8 @@ std::optional<uint32_t> DataConv_DataToLeds(const uint8_t* const data_in,
     }
     else
     {
-        const auto nr_of_leds = (data_in[0] << 8) | data_in[1];
-        const auto expected_data_size = kBytesInHeader + kBytesPerLed * nr_of_leds;
+        const auto nr_of_leds = FrameFormat_GetNumberOfLeds(data_in);
+        const auto expected_data_size = FrameFormat_GetLength(data_in, data_length);
 
         if ((expected_data_size != data_length) || (nr_of_leds > max_leds_out))
         {
@@ -116,6 +112,43 @@ std::optional<uint32_t> DataConv_DataToLeds(const uint8_t* const data_in,
     return result;
 }
 
+std::optional<uint32_t> DataConv_DataToTrains(const uint8_t* const data_in,
+                                              const uint32_t data_length,
+                                              Train* const trains_out,
+                                              const uint32_t max_trains_out)
+{
+    std::optional<uint32_t> result;
+
+    if ((nullptr == data_in) || (0U == data_length) || (nullptr == trains_out) || (0U == max_trains_out))
+    {
+        LOG_DEBUG("DataConv - Data invalid");
+        result = std::nullopt;
+    }
+    else if (!FrameFormat_HasTrains(data_in) || (FrameFormat_GetLength(data_in, data_length) != data_length) || !AreTrainsValid(data_in))
+    {
+        result = 0U;
+    }
+    else
+    {
+        const auto trains_offset = FrameFormat_GetTrainsOffset(data_in);
+        const auto nr_of_trains = static_cast<uint32_t>((data_in[trains_offset] << 8) | data_in[trains_offset + 1U]);
+        const auto nr_of_trains_out = etl::min(nr_of_trains, max_trains_out);
+        for (auto i = 0U; i < nr_of_trains_out; i++)
+        {
+            const auto pos = trains_offset + kBytesInTrainHeader + (i * kBytesPerTrain);
+            const auto led_index = static_cast<uint32_t>((data_in[pos + 2U] << 8) | data_in[pos + 3U]);
+            const auto led = ExtractLed(data_in, kBytesInHeader + (led_index * kBytesPerLed));
+            trains_out[i].id = static_cast<uint16_t>((data_in[pos] << 8) | data_in[pos + 1U]);
+            trains_out[i].led_id = static_cast<uint16_t>(led.GetId());
+            trains_out[i].is_forward = (0U == data_in[pos + 4U]);
+            trains_out[i].color = led.GetColor();
+        }
+        result = nr_of_trains_out;
+    }
+
+    return result;
+}
+
 static inline Led ExtractLed(const uint8_t* const data_in, uint32_t pos)
 {
     ASSERT(nullptr != data_in);
@@ -168,12 +201,53 @@ static inline bool IsDataNullEmptyOrTooLong(const uint8_t* const data, uint32_t
 
     if (is_data_too_long)
     {
-        etl::string<64> msg("DataConverter - Data too long: ");
-        etl::to_string(data_length, msg, true);
-        msg.append(" > ");
-        etl::to_string(max_length, msg, true);
-        LOG_ERROR(msg.c_str());
+        LOG_ERROR("DataConverter - Data too long: %u > %u", data_length, max_length);
     }
 
     return (is_data_null || is_data_empty || is_data_too_long);
 }
+
+static inline bool AreFramesValid(const uint8_t* const data, uint32_t data_length, uint32_t min_frames)
+{
+    bool is_data_valid = true;
+
+    if (IsDataNullEmptyOrTooLong(data, data_length, kNumberOfHistoryFrames * kBufferSizeInBytes))
+    {
+        is_data_valid = false;
+    }
+    else
+    {
+        size_t frame_start_index = 0U;
+        size_t frame_cnt = 0U;
+        while ((frame_cnt < kNumberOfHistoryFrames) && (frame_start_index + kBytesInHeader < data_length) && is_data_valid)
+        {
+            const auto frame_length = FrameFormat_GetLength(&data[frame_start_index], data_length - frame_start_index);
+            is_data_valid = DataConv_IsDataValid(&data[frame_start_index], frame_length);
+            frame_cnt++;
+            frame_start_index += frame_length;
+        }
+
+        is_data_valid = is_data_valid && (min_frames <= frame_cnt);
+        is_data_valid = is_data_valid && (frame_start_index == data_length);
+    }
+
+    return is_data_valid;
+}
+
+static inline bool AreTrainsValid(const uint8_t* const data)
+{
+    const auto nr_of_leds = FrameFormat_GetNumberOfLeds(data);
+    const auto trains_offset = FrameFormat_GetTrainsOffset(data);
+    const auto nr_of_trains = static_cast<uint32_t>((data[trains_offset] << 8) | data[trains_offset + 1U]);
+
+    bool are_trains_valid = (nr_of_trains <= kMaxTrains);
+    for (auto i = 0U; (i < nr_of_trains) && are_trains_valid; i++)
+    {
+        const auto pos = trains_offset + kBytesInTrainHeader + (i * kBytesPerTrain);
+        const auto led_index = static_cast<uint32_t>((data[pos + 2U] << 8) | data[pos + 3U]);
+        const auto direction = data[pos + 4U];
+        are_trains_valid = (led_index < nr_of_leds) && (direction <= 1U);
+    }
+
+    return are_trains_valid;
+}
@@ -23,25 +23,24 @@
 #include "FwConfig.h"
 #include "Logging.h"
 
-#include "etl/to_string.h"
-
 class FastLedPresenter : public LedPresenter
 {
     void Show() override
     {
         FastLED.show();
     }
+    bool IsShowDone() override
+    {
+        return true;  // Blocks until the data is shifted out
+    }
     void SetBrightness(uint8_t brightness) override
     {
         if (FastLED.getBrightness() != brightness)
         {
 #if 0  // For debug only
-            etl::string<64> msg{"Setting brightness : "};
-            etl::to_string(brightness, msg, true);
-            LOG_DEBUG(msg.c_str());
+            LOG_DEBUG("Setting brightness : %u", brightness);
 #endif
             FastLED.setBrightness(brightness);
-            FastLED.show();
         }
     }
 
@@ -50,6 +49,8 @@ class FastLedPresenter : public LedPresenter
     {
         pinMode(kLedLevelShiftEnPin, OUTPUT);
         digitalWrite(kLedLevelShiftEnPin, HIGH);
+        // The temporal dithering needs a show() at every tick, the LEDs are only shown when they change
+        FastLED.setDither(DISABLE_DITHER);
         SetBrightness(kDefaultBrightness);
     }
 };
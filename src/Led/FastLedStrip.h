@@ -17,47 +17,97 @@
 #ifndef FAST_LED_STRIP_H_
 #define FAST_LED_STRIP_H_
 
+#include "ColorCalibration.h"
+#include "FrameBlend.h"
 #include "LedStrip.h"
 #include "Logging.h"
 
 // Lib
 #include "FastLED.h"
 #include "etl/algorithm.h"
-#include "etl/array.h"
 
-template<template<uint8_t DATA_PIN, EOrder RGB_ORDER> class CHIPSET, size_t N_LED, uint32_t PIN>
+/// Buffers of a FastLedStrip, each one CRGB per LED
+constexpr uint32_t kFastLedStripBuffers = 4U;
+
+/// @brief Strip driven by FastLED, its length and color calibration come from the layout of the detected board
+/// @details The buffers are a slice of the storage shared by the strips, `kFastLedStripBuffers` CRGB per LED
+template<template<uint8_t DATA_PIN, EOrder RGB_ORDER> class CHIPSET, uint32_t PIN>
 class FastLedStrip : public LedStrip
 {
+  public:
+    FastLedStrip(uint32_t number_of_leds, const ColorLut& color_lut, CRGB* const storage)
+        : number_of_leds_(number_of_leds),
+          color_lut_(color_lut),
+          led_data_(storage),
+          shown_led_data_(storage + number_of_leds),
+          blend_start_(storage + (2U * number_of_leds)),
+          blend_target_(storage + (3U * number_of_leds)) {}
+
     void Init() override
     {
-        FastLED.addLeds<CHIPSET, PIN, GRB>(led_data_.data(), N_LED);
+        FastLED.addLeds<CHIPSET, PIN, GRB>(shown_led_data_, number_of_leds_);
     }
 
-    uint32_t GetSize() const override { return N_LED; }
+    uint32_t GetSize() const override { return number_of_leds_; }
 
     void ClearAll() override
     {
-        etl::array<CRGB, N_LED> all_off{};
-        all_off.fill(CRGB::Black);
-        led_data_.swap(all_off);
+        etl::fill_n(led_data_, number_of_leds_, CRGB(CRGB::Black));
     }
 
     void Set(uint32_t position, uint32_t html_color, uint8_t scaling) override
     {
-        ASSERT(position < N_LED);
+        ASSERT(position < number_of_leds_);
 
-        led_data_.at(position) = CRGB(html_color).nscale8(scaling);
+        color_lut_.Apply(html_color, scaling, led_data_[position]);
+    }
+
+    void SetMany(const LedUpdate* updates, uint32_t number_of_updates) override
+    {
+        for (auto i = 0U; i < number_of_updates; i++)
+        {
+            const auto& update = updates[i];
+            ASSERT(update.position < number_of_leds_);
+            color_lut_.Apply(update.html_color, update.scaling, led_data_[update.position]);
+        }
+    }
+
+    void SaveBlendStart() override
+    {
+        etl::copy_n(led_data_, number_of_leds_, blend_start_);
+    }
+
+    void SaveBlendTarget() override
+    {
+        etl::copy_n(led_data_, number_of_leds_, blend_target_);
+    }
+
+    void Blend(uint8_t progress) override
+    {
+        // Blends the duty cycles, after the gamma correction, so that the light of the two frames adds up linearly
+        FrameBlend_Blend(reinterpret_cast<const uint8_t*>(blend_start_), reinterpret_cast<const uint8_t*>(blend_target_),
+                         reinterpret_cast<uint8_t*>(led_data_), number_of_leds_ * sizeof(CRGB), progress);
     }
 
     void Test() override
     {
-        etl::array<CRGB, N_LED> all_on{};
-        all_on.fill(CRGB::White);
-        led_data_.swap(all_on);
+        CRGB white{};
+        color_lut_.Apply(CRGB::White, UINT8_MAX, white);
+        etl::fill_n(led_data_, number_of_leds_, white);
+    }
+
+    void Commit() override
+    {
+        etl::copy_n(led_data_, number_of_leds_, shown_led_data_);
     }
 
   private:
-    etl::array<CRGB, N_LED> led_data_;
+    const uint32_t number_of_leds_;
+    const ColorLut& color_lut_;
+    CRGB* const led_data_;        // Back buffer, set by the LED manager
+    CRGB* const shown_led_data_;  // Front buffer, internal RAM, the LED driver reads it while showing
+    CRGB* const blend_start_;     // Frames of the blend transition, see Blend
+    CRGB* const blend_target_;
 };
 
 #endif  // FAST_LED_STRIP_H_
\ No newline at end of file
@@ -0,0 +1,77 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef FRAME_BLEND_H_
+#define FRAME_BLEND_H_
+
+// Blend of two frames of 8-bit channels, see TransitionEffect::kBlend.
+// The channels are blended two by two in 32-bit words (SWAR): the even and the odd bytes of a word are
+// spread over 16-bit lanes, the product of a channel by a weight (at most 255 * 256) never carries into
+// the next lane. The loop over the words has no branch and no dependency between the words, so that the
+// host compilers vectorise it.
+
+#include <cstdint>
+#include <cstring>
+
+/// @brief Weight of the target frame, 0 to 256 so that the progress 255 gives exactly the target frame
+inline uint32_t FrameBlend_GetWeight(uint8_t progress)
+{
+    return static_cast<uint32_t>(progress) + (progress >> 7U);
+}
+
+/// @brief Blend one channel, `(start * (256 - weight) + target * weight) / 256`
+inline uint8_t FrameBlend_BlendChannel(uint8_t start, uint8_t target, uint32_t weight)
+{
+    return static_cast<uint8_t>(((start * (256U - weight)) + (target * weight)) >> 8U);
+}
+
+/// @brief Blend the four channels of a word, same result as FrameBlend_BlendChannel on each byte
+inline uint32_t FrameBlend_BlendWord(uint32_t start, uint32_t target, uint32_t weight)
+{
+    constexpr uint32_t kEvenChannels = 0x00FF00FFU;
+    const auto start_weight = 256U - weight;
+    const auto even = ((start & kEvenChannels) * start_weight) + ((target & kEvenChannels) * weight);
+    const auto odd = (((start >> 8U) & kEvenChannels) * start_weight) + (((target >> 8U) & kEvenChannels) * weight);
+    return ((even >> 8U) & kEvenChannels) | (odd & ~kEvenChannels);
+}
+
+/// @brief Set a frame between two others, in a time that only depends on the length of the frames
+/// @param start Frame at the progress 0
+/// @param target Frame at the progress 255
+/// @param frame Blended frame, can be the same buffer as `start` or `target`
+/// @param length Number of bytes of each frame, any alignment
+/// @param progress 0 (start) to 255 (target)
+inline void FrameBlend_Blend(const uint8_t* start, const uint8_t* target, uint8_t* frame, uint32_t length, uint8_t progress)
+{
+    const auto weight = FrameBlend_GetWeight(progress);
+    const auto number_of_words = length / sizeof(uint32_t);
+    for (auto i = 0U; i < number_of_words; i++)
+    {
+        // memcpy compiles to plain loads and stores, without assumptions on the alignment and the type of the frames
+        uint32_t start_word = 0U;
+        uint32_t target_word = 0U;
+        std::memcpy(&start_word, &start[i * sizeof(uint32_t)], sizeof(uint32_t));
+        std::memcpy(&target_word, &target[i * sizeof(uint32_t)], sizeof(uint32_t));
+        const auto word = FrameBlend_BlendWord(start_word, target_word, weight);
+        std::memcpy(&frame[i * sizeof(uint32_t)], &word, sizeof(uint32_t));
+    }
+    for (auto i = number_of_words * sizeof(uint32_t); i < length; i++)
+    {
+        frame[i] = FrameBlend_BlendChannel(start[i], target[i], weight);
+    }
+}
+
+#endif  // FRAME_BLEND_H_
@@ -30,11 +30,37 @@ enum class LedColor : uint32_t
     kPurple = 0x8E44ADU,
 };
 
+/// @brief 24-bit color stored on three bytes, without the padding byte of an `uint32_t`
+class PackedColor
+{
+  public:
+    PackedColor() : red_(0), green_(0), blue_(0) {}
+    explicit PackedColor(uint32_t color)
+        : red_(static_cast<uint8_t>(color >> 16U)), green_(static_cast<uint8_t>(color >> 8U)), blue_(static_cast<uint8_t>(color)) {}
+
+    uint32_t Get() const
+    {
+        return (static_cast<uint32_t>(red_) << 16U) | (static_cast<uint32_t>(green_) << 8U) | blue_;
+    }
+
+    bool operator==(const PackedColor& other_color) const
+    {
+        return (other_color.red_ == red_) && (other_color.green_ == green_) && (other_color.blue_ == blue_);
+    }
+    bool operator!=(const PackedColor& other_color) const { return !(other_color == *this); }
+
+  private:
+    uint8_t red_;
+    uint8_t green_;
+    uint8_t blue_;
+};
+
 class Led
 {
   public:
-    Led() : id_(0), color_(0), scale_(0) {}
-    Led(uint16_t id, uint32_t color, uint8_t scale = UINT8_MAX - 1) : id_(id), color_(color), scale_(scale) {}
+    Led() : id_(0), color_() {}
+    Led(uint16_t id, uint32_t color) : id_(id), color_(color) {}
+    Led(uint16_t id, PackedColor color) : id_(id), color_(color) {}
 
     uint32_t GetId() const
     {
@@ -43,35 +69,49 @@ class Led
 
     uint32_t GetStripId() const
     {
-        return ((id_ & kLedStripMask) >> kLedStripShift);
+        return GetStripId(id_);
     }
 
     uint32_t GetPosition() const
     {
-        return (id_ & kLedPositionMask);
+        return GetPosition(id_);
     }
 
     uint32_t GetColor() const
     {
-        // Return the color 1:1 (hex format, only the 24 last bits should be set
-        return (color_ & kLedColorMask);
+        // Return the color 1:1 (hex format, only the 24 last bits are set)
+        return color_.Get();
     }
 
-    uint8_t GetScale() const { return scale_; }
+    PackedColor GetPackedColor() const { return color_; }
 
     bool operator==(const Led& other_led) const { return (other_led.id_ == id_) && (other_led.color_ == color_); }
     bool operator!=(const Led& other_led) const { return !(other_led == *this); }
 
+    static uint16_t GetId(uint32_t strip_id, uint32_t position) { return static_cast<uint16_t>((strip_id << kLedStripShift) | (position & kLedPositionMask)); }
+    static uint32_t GetStripId(uint16_t id) { return ((id & kLedStripMask) >> kLedStripShift); }
+    static uint32_t GetPosition(uint16_t id) { return (id & kLedPositionMask); }
+
   private:
     // clang-format off
     static constexpr uint32_t kLedStripShift    = 8U;
     static constexpr uint32_t kLedStripMask     = 0xFF00U;
     static constexpr uint32_t kLedPositionMask  = 0x00FFU;
-    static constexpr uint32_t kLedColorMask     = 0xFFFFFFU;  // HTML Format, 24 bits
     // clang-format on
     uint16_t id_;
-    uint32_t color_;
-    uint8_t scale_;
+    PackedColor color_;  // HTML Format, 24 bits
 };
 
+/// @brief Train shown by one of the LEDs of a frame
+struct Train
+{
+    uint16_t id;      // Identity of the train, the same from one frame to the next
+    uint16_t led_id;  // Id of the LED showing the train
+    bool is_forward;  // `true` if the train moves towards the higher positions of the strip
+    uint32_t color;   // Color of the LED showing the train, other LEDs can have the same id
+};
+
+static_assert(sizeof(PackedColor) == 3U, "PackedColor must not be padded");
+static_assert(sizeof(Led) <= 6U, "Led must stay packed, there are hundreds of them in the LED buffers");
+
 #endif  // LED_H_
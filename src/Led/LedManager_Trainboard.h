@@ -16,11 +16,14 @@
 #ifndef LED_MANAGER_TRAINBOARD_H_
 #define LED_MANAGER_TRAINBOARD_H_
 
+#include "FwConfig.h"
 #include "Led.h"
 #include "LedManager.h"
 #include "LedPresenter.h"
 #include "LedStrip.h"
+#include "LedVector.h"
 #include "Logging.h"
+#include "TransitionEffects.h"
 
 #include <functional>
 #include "etl/algorithm.h"
@@ -33,8 +36,13 @@ class TrainboardLedManager : public LedManager
   public:
     using Strip = std::reference_wrapper<LedStrip>;
 
-    TrainboardLedManager(const etl::array<Strip, N>& strips, LedPresenter& presenter, uint32_t transition_duration)
-        : transition_duration_(transition_duration), half_transition_duration_(transition_duration / 2), strips_(strips), presenter_(presenter) {}
+    /// @param motion_duration Number of ticks over which the trains move to their new position, 0 to let them jump
+    TrainboardLedManager(const etl::array<Strip, N>& strips, LedPresenter& presenter, uint32_t transition_duration, uint32_t motion_duration = 0U)
+        : transition_duration_(transition_duration),
+          half_transition_duration_(transition_duration / 2),
+          motion_duration_(motion_duration),
+          strips_(strips),
+          presenter_(presenter) {}
 
     void Init()
     {
@@ -54,7 +62,7 @@ class TrainboardLedManager : public LedManager
             {
                 strip.get().Set(0U, static_cast<uint32_t>(color), UINT8_MAX);
             }
-            presenter_.Show();
+            is_frame_dirty_ = true;
         }
         return !is_transitioning_;
     }
@@ -67,6 +75,7 @@ class TrainboardLedManager : public LedManager
             {
                 strip.get().Test();
             }
+            is_frame_dirty_ = true;
         }
         return !is_transitioning_;
     }
@@ -78,7 +87,9 @@ class TrainboardLedManager : public LedManager
         ClearStatusLeds();
         ResetTransition();
         is_transitioning_ = true;
+        effect_ = next_effect_;
         GetNewActiveLeds(leds, leds_length);
+        StartTrainMotions();
         AssignLedsToSwapOrFadeIn(leds_new_);
         AssignLedsToFadeOut(leds_new_);
         AssignNewActiveLeds(leds_new_);
@@ -90,9 +101,11 @@ class TrainboardLedManager : public LedManager
         {
             strip.get().ClearAll();
         }
-        presenter_.Show();
+        is_frame_dirty_ = true;
         ResetTransition();
-        leds_active_.clear();
+        leds_active_.Clear();
+        trains_.clear();
+        trains_new_.clear();
     }
 
     bool RefreshTransition() override
@@ -101,30 +114,122 @@ class TrainboardLedManager : public LedManager
         transition_cnt_++;
         if (transition_cnt_ >= transition_duration_)
         {
-            FadeLedsInOut(UINT8_MAX);
             is_finished = true;
             is_transitioning_ = false;
         }
+
+        // Dispatched once per tick, the effect is then inlined in the loops over the LEDs
+        switch (effect_)
+        {
+            case TransitionEffect::kCrossfade:
+                RenderTransition<CrossfadeEffect>();
+                break;
+            case TransitionEffect::kWipe:
+                RenderTransition<WipeEffect>();
+                break;
+            case TransitionEffect::kSparkle:
+                RenderTransition<SparkleEffect>();
+                break;
+            case TransitionEffect::kInstant:
+                RenderTransition<InstantEffect>();
+                break;
+            case TransitionEffect::kBlend:
+                RenderBlend();
+                break;
+        }
+        is_frame_dirty_ = true;
+        return is_finished;
+    }
+
+    void SetTrains(const Train* const trains, uint32_t trains_length) override
+    {
+        trains_new_.clear();
+        for (auto i = 0U; (nullptr != trains) && (i < trains_length) && !trains_new_.full(); i++)
+        {
+            trains_new_.push_back(trains[i]);
+        }
+    }
+
+    void RefreshMotion() override
+    {
+        if (!is_transitioning_ && (motion_cnt_ < motion_duration_))
+        {
+            motion_cnt_++;
+            bool did_move = false;
+            for (auto& train : trains_)
+            {
+                if (train.start_led_id != train.target_led_id)
+                {
+                    const auto start = static_cast<int32_t>(Led::GetPosition(train.start_led_id));
+                    const auto target = static_cast<int32_t>(Led::GetPosition(train.target_led_id));
+                    const auto position = start + (((target - start) * static_cast<int32_t>(motion_cnt_)) / static_cast<int32_t>(motion_duration_));
+                    const auto led_id = Led::GetId(Led::GetStripId(train.target_led_id), static_cast<uint32_t>(position));
+                    if (led_id != train.led_id)
+                    {
+                        MoveTrain(train, led_id);
+                        did_move = true;
+                    }
+                }
+            }
+            is_frame_dirty_ = is_frame_dirty_ || did_move;
+        }
         else
         {
-            if (transition_cnt_ < half_transition_duration_)
+            // Transition on-going or all trains arrived
+        }
+    }
+
+    void SetTransitionEffect(TransitionEffect effect) override
+    {
+        next_effect_ = effect;
+    }
+
+    void SetBrightness(uint8_t brightness) override
+    {
+        brightness_pending_ = brightness;
+    }
+
+    void ShowFrame() override
+    {
+        ticks_since_show_ = etl::min(ticks_since_show_ + 1U, kBrightnessFramePeriodInTicks);
+        if (presenter_.IsShowDone())
+        {
+            // A brightness change is shown with the next frame, or alone when no frame was shown for a while
+            if ((brightness_pending_ != brightness_) && (is_frame_dirty_ || (ticks_since_show_ >= kBrightnessFramePeriodInTicks)))
+            {
+                brightness_ = brightness_pending_;
+                presenter_.SetBrightness(brightness_);
+                is_frame_dirty_ = true;
+            }
+            else
+            {
+                // Brightness unchanged or batched into a later frame
+            }
+
+            if (is_frame_dirty_)
             {
-                FadeOutLedsToSwap();
+                for (auto& strip : strips_)
+                {
+                    strip.get().Commit();
+                }
+                presenter_.Show();
+                is_frame_dirty_ = false;
+                ticks_since_show_ = 0U;
             }
             else
             {
-                const auto scaling_in_u32 = (static_cast<uint32_t>(UINT8_MAX) * (transition_cnt_ - half_transition_duration_)) / half_transition_duration_;
-                const auto scaling_in = static_cast<uint8_t>(etl::clamp(scaling_in_u32, 0U, static_cast<uint32_t>(UINT8_MAX)));
-                FadeLedsInOut(scaling_in);
+                // Nothing changed on the LEDs, no need to shift the data out again
             }
         }
-        presenter_.Show();
-        return is_finished;
+        else
+        {
+            // The previous frame is still being shifted out, the changes are shown at the next tick
+        }
     }
 
-    void SetBrightness(uint8_t brightness) override
+    bool IsShowDone() override
     {
-        presenter_.SetBrightness(brightness);
+        return !is_frame_dirty_ && presenter_.IsShowDone();
     }
 
   private:
@@ -133,17 +238,37 @@ class TrainboardLedManager : public LedManager
     uint32_t transition_cnt_{0};
     bool is_transitioning_{false};
     LedColor status_led_color_{LedColor::kBlack};
+    TransitionEffect effect_{TransitionEffect::kCrossfade};
+    TransitionEffect next_effect_{TransitionEffect::kCrossfade};
+    const uint32_t motion_duration_;
+    uint32_t motion_cnt_{0};
+    bool is_frame_dirty_{false};
+    uint32_t ticks_since_show_{kBrightnessFramePeriodInTicks};
+    uint8_t brightness_{UINT8_MAX};
+    uint8_t brightness_pending_{UINT8_MAX};
 
     const etl::array<Strip, N>& strips_;
     LedPresenter& presenter_;
 
     static constexpr uint32_t kMaxLeds = 512U;
-    using LedVector = etl::vector<Led, kMaxLeds>;
-    LedVector leds_new_ = LedVector();
-    LedVector leds_active_ = LedVector();
-    LedVector leds_in_ = LedVector();    // fade in on second half of transition
-    LedVector leds_out_ = LedVector();   // fade out on second half of transition
-    LedVector leds_swap_ = LedVector();  // fade out on first half of transition
+    using Leds = LedVector<kMaxLeds>;
+    Leds leds_new_ = Leds();
+    Leds leds_active_ = Leds();
+    Leds leds_in_ = Leds();    // fade in on second half of transition
+    Leds leds_out_ = Leds();   // fade out on second half of transition
+    Leds leds_swap_ = Leds();  // fade out on first half of transition
+
+    struct TrainMotion
+    {
+        uint16_t id;
+        uint16_t led_id;         // Where the train is shown
+        uint16_t start_led_id;   // Where the train was in the previous frame
+        uint16_t target_led_id;  // Where the train is in the current frame
+        uint16_t led_index;      // Index of the LED of the train in the active LEDs
+    };
+    etl::vector<Train, kMaxTrains> trains_new_{};
+    etl::vector<TrainMotion, kMaxTrains> trains_{};
+    etl::array<etl::vector<LedUpdate, kLedUpdateBatchSize>, N> led_updates_{};  // Batches of SetLedsOnStrips
 
     void ClearStatusLeds()
     {
@@ -166,14 +291,14 @@ class TrainboardLedManager : public LedManager
     {
         transition_cnt_ = 0U;
         is_transitioning_ = false;
-        leds_out_.clear();
-        leds_swap_.clear();
-        leds_in_.clear();
+        leds_out_.Clear();
+        leds_swap_.Clear();
+        leds_in_.Clear();
     }
 
     void GetNewActiveLeds(const Led* const leds, const uint32_t leds_length)
     {
-        leds_new_.clear();
+        leds_new_.Clear();
         for (auto i = 0U; i < leds_length; i++)
         {
             const auto led = leds[i];
@@ -183,7 +308,7 @@ class TrainboardLedManager : public LedManager
                 const auto position = led.GetPosition();
                 if (position < strips_[strip_id].get().GetSize())
                 {
-                    leds_new_.push_back(led);
+                    leds_new_.PushBack(led);
                 }
                 else
                 {
@@ -197,70 +322,219 @@ class TrainboardLedManager : public LedManager
         }
     }
 
-    void AssignLedsToSwapOrFadeIn(const LedVector& new_active_leds)
+    void StartTrainMotions()
     {
-        for (const auto& led : new_active_leds)
+        // The trains that moved start from where they are shown, the transition leaves them there
+        etl::vector<TrainMotion, kMaxTrains> trains{};
+        for (const auto& train : trains_new_)
         {
-            const auto changes_color = [led](const Led& active_led) {
-                const auto has_same_id = led.GetId() == active_led.GetId();
-                const auto has_different_color = led.GetColor() != active_led.GetColor();
-                return has_same_id && has_different_color;
-            };
-            auto it = etl::find_if(leds_active_.begin(), leds_active_.end(), changes_color);
-            if (it != leds_active_.end())
+            const auto led_index = leds_new_.Find(Led{train.led_id, train.color});
+            auto start_led_id = train.led_id;
+            const auto previous = etl::find_if(trains_.begin(), trains_.end(), [&train](const TrainMotion& motion) { return motion.id == train.id; });
+            if ((previous != trains_.end()) && (led_index != leds_new_.GetSize()) && IsMotionPlausible(train, previous->led_id) &&
+                (leds_new_.FindId(previous->led_id) == leds_new_.GetSize()))
+            {
+                start_led_id = previous->led_id;
+                leds_new_.Set(led_index, Led{start_led_id, leds_new_.GetColor(led_index)});
+            }
+            else
+            {
+                // New train, the train jumps
+            }
+            trains.push_back(TrainMotion{train.id, start_led_id, start_led_id, train.led_id, static_cast<uint16_t>(led_index)});
+        }
+        trains_ = trains;
+        trains_new_.clear();
+        motion_cnt_ = 0U;
+    }
+
+    bool IsMotionPlausible(const Train& train, uint16_t previous_led_id) const
+    {
+        const auto position = Led::GetPosition(train.led_id);
+        const auto previous_position = Led::GetPosition(previous_led_id);
+        const auto is_same_strip = Led::GetStripId(train.led_id) == Led::GetStripId(previous_led_id);
+        const auto is_right_direction = train.is_forward ? (position > previous_position) : (position < previous_position);
+        const auto step = train.is_forward ? (position - previous_position) : (previous_position - position);
+        return (0U != motion_duration_) && is_same_strip && is_right_direction && (step <= kTrainMaxStepLeds);
+    }
+
+    void MoveTrain(TrainMotion& train, uint16_t led_id)
+    {
+        const auto color = leds_active_.GetColor(train.led_index);
+        leds_active_.Set(train.led_index, Led{led_id, color});
+
+        // Show again what the train passed over
+        const auto index_left = leds_active_.FindId(train.led_id);
+        auto& strip_left = strips_[Led::GetStripId(train.led_id)].get();
+        if (index_left != leds_active_.GetSize())
+        {
+            strip_left.Set(Led::GetPosition(train.led_id), leds_active_.GetColor(index_left), UINT8_MAX);
+        }
+        else
+        {
+            strip_left.Set(Led::GetPosition(train.led_id), 0U, 0U);
+        }
+
+        strips_[Led::GetStripId(led_id)].get().Set(Led::GetPosition(led_id), color, UINT8_MAX);
+        train.led_id = led_id;
+    }
+
+    void AssignLedsToSwapOrFadeIn(const Leds& new_active_leds)
+    {
+        for (auto i = 0U; i < new_active_leds.GetSize(); i++)
+        {
+            const auto led = new_active_leds.Get(i);
+            const auto swap_index = leds_active_.FindColorChange(led);
+            if (swap_index != leds_active_.GetSize())
             {
                 // New led on same position but different color
-                leds_swap_.push_back(*it);  // old led to fade out
-                leds_in_.push_back(led);    // new led to fade in
+                leds_swap_.PushBack(leds_active_.Get(swap_index));  // old led to fade out
+                leds_in_.PushBack(led);                              // new led to fade in
             }
             else
             {
-                if (etl::find(leds_active_.begin(), leds_active_.end(), led) == leds_active_.end())
+                if (leds_active_.Find(led) == leds_active_.GetSize())
                 {
                     // New led to fade in
-                    leds_in_.push_back(led);
+                    leds_in_.PushBack(led);
                 }
             }
         }
     }
 
-    void AssignLedsToFadeOut(const LedVector& new_active_leds)
+    void AssignLedsToFadeOut(const Leds& new_active_leds)
     {
-        for (const auto& active_led : leds_active_)
+        for (auto i = 0U; i < leds_active_.GetSize(); i++)
         {
-            if (etl::find(new_active_leds.begin(), new_active_leds.end(), active_led) == new_active_leds.end())
+            const auto active_led = leds_active_.Get(i);
+            if (new_active_leds.Find(active_led) == new_active_leds.GetSize())
             {
-                leds_out_.push_back(active_led);
+                leds_out_.PushBack(active_led);
             }
         }
     }
 
-    void AssignNewActiveLeds(const LedVector& new_active_leds)
+    void AssignNewActiveLeds(const Leds& new_active_leds)
     {
         leds_active_ = new_active_leds;
     }
 
-    void FadeOutLedsToSwap()
+    template<typename TEffect>
+    void RenderTransition()
     {
-        const auto scaling_u32 = 2 * transition_cnt_ * static_cast<uint32_t>(UINT8_MAX) / transition_duration_;
-        const auto scaling = static_cast<uint8_t>(etl::clamp(scaling_u32, 0U, static_cast<uint32_t>(UINT8_MAX)));
-        const uint8_t scaling_out = UINT8_MAX - scaling;
-        for (const auto& led : leds_swap_)
+        if (transition_cnt_ >= transition_duration_)
+        {
+            FadeLedsInOut<TEffect>(UINT8_MAX);
+        }
+        else if (TEffect::kFadesOutBeforeFadeIn)
+        {
+            if (transition_cnt_ < half_transition_duration_)
+            {
+                FadeOutLedsToSwap<TEffect>();
+            }
+            else
+            {
+                FadeLedsInOut<TEffect>(GetProgress(transition_cnt_ - half_transition_duration_, half_transition_duration_));
+            }
+        }
+        else
         {
-            strips_[led.GetStripId()].get().Set(led.GetPosition(), led.GetColor(), scaling_out);
+            // The swapped LEDs are also in the LEDs to fade out
+            FadeLedsInOut<TEffect>(GetProgress(transition_cnt_, transition_duration_));
         }
     }
 
-    void FadeLedsInOut(uint8_t scaling_in)
+    void RenderBlend()
     {
-        for (const auto& led : leds_out_)
+        if (1U == transition_cnt_)
+        {
+            // The frame shown so far is the start, the end of any effect is the target
+            for (auto& strip : strips_)
+            {
+                strip.get().SaveBlendStart();
+            }
+            FadeLedsInOut<InstantEffect>(UINT8_MAX);
+            for (auto& strip : strips_)
+            {
+                strip.get().SaveBlendTarget();
+            }
+        }
+        else
         {
-            const uint8_t scaling_out = UINT8_MAX - scaling_in;
-            strips_[led.GetStripId()].get().Set(led.GetPosition(), led.GetColor(), scaling_out);
+            // Start and target saved on the first tick
         }
-        for (const auto& led : leds_in_)
+
+        const auto progress = (transition_cnt_ >= transition_duration_) ? static_cast<uint8_t>(UINT8_MAX) : GetProgress(transition_cnt_, transition_duration_);
+        for (auto& strip : strips_)
         {
-            strips_[led.GetStripId()].get().Set(led.GetPosition(), led.GetColor(), scaling_in);
+            strip.get().Blend(progress);
+        }
+    }
+
+    static uint8_t GetProgress(uint32_t count, uint32_t duration)
+    {
+        const auto progress_u32 = (static_cast<uint32_t>(UINT8_MAX) * count) / duration;
+        return static_cast<uint8_t>(etl::clamp(progress_u32, 0U, static_cast<uint32_t>(UINT8_MAX)));
+    }
+
+    template<typename TEffect>
+    void FadeOutLedsToSwap()
+    {
+        SetLedsOnStrips<TEffect, false>(leds_swap_, GetProgress(2 * transition_cnt_, transition_duration_));
+    }
+
+    template<typename TEffect>
+    void FadeLedsInOut(uint8_t progress)
+    {
+        SetLedsOnStrips<TEffect, false>(leds_out_, progress);
+        SetLedsOnStrips<TEffect, true>(leds_in_, progress);
+    }
+
+    template<typename TEffect, bool kIsFadingIn>
+    void SetLedsOnStrips(const Leds& leds, uint8_t progress)
+    {
+        // The LEDs are bucketed per strip in one pass, one call per batch of LEDs of a strip instead of one per LED
+        for (auto i = 0U; i < leds.GetSize(); i++)
+        {
+            const auto id = leds.GetId(i);
+            const auto strip_id = Led::GetStripId(id);
+            if (strip_id < N)
+            {
+                auto& strip = strips_[strip_id].get();
+                auto& updates = led_updates_[strip_id];
+                const auto position = Led::GetPosition(id);
+                const auto scaling_in = TEffect::GetScaling(progress, position, strip.GetSize());
+                if (!kIsFadingIn)
+                {
+                    updates.push_back({leds.GetColor(i), static_cast<uint16_t>(position), static_cast<uint8_t>(UINT8_MAX - scaling_in)});
+                }
+                else if (TEffect::kFadesOutBeforeFadeIn || (0U != scaling_in))
+                {
+                    updates.push_back({leds.GetColor(i), static_cast<uint16_t>(position), scaling_in});
+                }
+                else
+                {
+                    // Keep the old LED that was just set on this position until the new one is reached
+                }
+                if (updates.full())
+                {
+                    strip.SetMany(updates.data(), updates.size());
+                    updates.clear();
+                }
+            }
+            else
+            {
+                // Not on a strip of this board
+            }
+        }
+        for (auto strip_id = 0U; strip_id < N; strip_id++)
+        {
+            auto& updates = led_updates_[strip_id];
+            if (!updates.empty())
+            {
+                strips_[strip_id].get().SetMany(updates.data(), updates.size());
+                updates.clear();
+            }
         }
     }
 };
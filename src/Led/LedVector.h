@@ -0,0 +1,98 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef LED_VECTOR_H_
+#define LED_VECTOR_H_
+
+#include "Led.h"
+
+#include <cstddef>
+#include <cstdint>
+#include "etl/algorithm.h"
+#include "etl/vector.h"
+
+/// @brief Vector of LEDs stored as a structure of arrays
+/// @details The ids and the colors are kept in two separate arrays, so that the searches by id only
+/// walk through contiguous ids (2 bytes per LED) and the colors are only read for the matching LEDs.
+template<size_t N>
+class LedVector
+{
+  public:
+    void Clear()
+    {
+        ids_.clear();
+        colors_.clear();
+    }
+
+    void PushBack(const Led& led)
+    {
+        ids_.push_back(static_cast<uint16_t>(led.GetId()));
+        colors_.push_back(led.GetPackedColor());
+    }
+
+    size_t GetSize() const { return ids_.size(); }
+    bool IsEmpty() const { return ids_.empty(); }
+
+    uint16_t GetId(size_t index) const { return ids_[index]; }
+    uint32_t GetColor(size_t index) const { return colors_[index].Get(); }
+    Led Get(size_t index) const { return Led{ids_[index], colors_[index]}; }
+
+    void Set(size_t index, const Led& led)
+    {
+        ids_[index] = static_cast<uint16_t>(led.GetId());
+        colors_[index] = led.GetPackedColor();
+    }
+
+    /// @brief Find a LED with the given id, whatever its color
+    /// @return The index of the LED, or the size of the vector if it is not found
+    size_t FindId(uint16_t id) const
+    {
+        return static_cast<size_t>(etl::find(ids_.begin(), ids_.end(), id) - ids_.begin());
+    }
+
+    /// @brief Find a LED with the same id and color
+    /// @return The index of the LED, or the size of the vector if it is not found
+    size_t Find(const Led& led) const
+    {
+        return FindMatch(led, [](PackedColor color, PackedColor other_color) { return color == other_color; });
+    }
+
+    /// @brief Find a LED with the same id but another color
+    /// @return The index of the LED, or the size of the vector if it is not found
+    size_t FindColorChange(const Led& led) const
+    {
+        return FindMatch(led, [](PackedColor color, PackedColor other_color) { return color != other_color; });
+    }
+
+  private:
+    etl::vector<uint16_t, N> ids_{};
+    etl::vector<PackedColor, N> colors_{};
+
+    template<typename TColorMatch>
+    size_t FindMatch(const Led& led, TColorMatch color_match) const
+    {
+        const auto id = static_cast<uint16_t>(led.GetId());
+        const auto color = led.GetPackedColor();
+        auto it = etl::find(ids_.begin(), ids_.end(), id);
+        while ((it != ids_.end()) && !color_match(colors_[it - ids_.begin()], color))
+        {
+            it = etl::find(it + 1, ids_.end(), id);
+        }
+        return static_cast<size_t>(it - ids_.begin());
+    }
+};
+
+#endif  // LED_VECTOR_H_
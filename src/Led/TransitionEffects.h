@@ -0,0 +1,89 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef TRANSITION_EFFECTS_H_
+#define TRANSITION_EFFECTS_H_
+
+#include <cstdint>
+
+/// @brief Transition effects of the LED manager
+enum class TransitionEffect : uint8_t
+{
+    kCrossfade,  // Swapped LEDs fade out, then the old LEDs fade out while the new ones fade in
+    kWipe,       // The new LEDs replace the old ones along the strip direction
+    kSparkle,    // The new LEDs replace the old ones one by one, in a scattered order
+    kInstant,    // The new LEDs replace the old ones on the first tick
+    kBlend,      // The whole frame blends from the old LEDs to the new ones, see FrameBlend.h
+};
+
+// An effect policy is a type with:
+//  - `kFadesOutBeforeFadeIn`: `true` if the LEDs that change color fade out on the first half of the
+//    transition, before the new LEDs fade in on the second half. `false` if all LEDs change together.
+//  - `GetScaling(progress, position, strip_size)`: scaling of a new LED, 0 (still off) to 255 (fully on),
+//    for the given progress of the transition, 0 (start) to 255 (end). The old LED on the same position
+//    gets the opposite scaling. Must return 255 when the progress is 255.
+// The policies are only used as template arguments, so their functions are inlined in the render loop.
+// The blend is not a policy: it works on the frames of the strips, whatever the number of LEDs that change.
+
+struct CrossfadeEffect
+{
+    static constexpr bool kFadesOutBeforeFadeIn = true;
+
+    static uint8_t GetScaling(uint8_t progress, uint32_t /*position*/, uint32_t /*strip_size*/)
+    {
+        return progress;
+    }
+};
+
+struct WipeEffect
+{
+    static constexpr bool kFadesOutBeforeFadeIn = false;
+
+    static uint8_t GetScaling(uint8_t progress, uint32_t position, uint32_t strip_size)
+    {
+        const bool is_reached = (static_cast<uint32_t>(progress) * strip_size) > (position * UINT8_MAX);
+        return is_reached ? UINT8_MAX : 0U;
+    }
+};
+
+struct SparkleEffect
+{
+    static constexpr bool kFadesOutBeforeFadeIn = false;
+
+    static uint8_t GetScaling(uint8_t progress, uint32_t position, uint32_t /*strip_size*/)
+    {
+        // Scatter the positions over the transition, multiplying by an odd number is a permutation modulo 256:
+        // every 256 consecutive positions are reached at a progress of their own, the last one at the end
+        const auto threshold = ((position * kScatterFactor) + kScatterOffset) & 0xFFU;
+        return (progress >= threshold) ? UINT8_MAX : 0U;
+    }
+
+  private:
+    static constexpr uint32_t kScatterFactor = 151U;
+    static constexpr uint32_t kScatterOffset = 67U;
+};
+
+struct InstantEffect
+{
+    static constexpr bool kFadesOutBeforeFadeIn = false;
+
+    static uint8_t GetScaling(uint8_t /*progress*/, uint32_t /*position*/, uint32_t /*strip_size*/)
+    {
+        return UINT8_MAX;
+    }
+};
+
+#endif  // TRANSITION_EFFECTS_H_
@@ -0,0 +1,42 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "BrightnessFilter.h"
+
+#include "etl/algorithm.h"
+
+BrightnessFilter::BrightnessFilter(const uint16_t dark_counts, const uint16_t bright_counts, const uint32_t filter_shift, const uint8_t initial_brightness)
+    : dark_counts_(dark_counts),
+      bright_counts_(bright_counts),
+      filter_shift_(filter_shift),
+      filtered_light_((dark_counts + ((initial_brightness * static_cast<uint32_t>(bright_counts - dark_counts)) / UINT8_MAX)) << kFractionalBits),
+      brightness_(initial_brightness) {}
+
+uint8_t BrightnessFilter::Update(const uint16_t light)
+{
+    const uint32_t new_light = static_cast<uint32_t>(light) << kFractionalBits;
+    filtered_light_ = ((((1U << filter_shift_) - 1U) * filtered_light_) + new_light) >> filter_shift_;
+
+    // Rounded to the nearest count, the truncations of the filter leave it slightly below a steady light
+    brightness_ = LightToBrightness((filtered_light_ + (1U << (kFractionalBits - 1U))) >> kFractionalBits);
+    return brightness_;
+}
+
+uint8_t BrightnessFilter::LightToBrightness(const uint32_t light) const
+{
+    const uint32_t counts = etl::clamp<uint32_t>(light, dark_counts_, bright_counts_) - dark_counts_;
+    return static_cast<uint8_t>((counts * UINT8_MAX) / (bright_counts_ - dark_counts_));
+}
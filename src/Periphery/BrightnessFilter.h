@@ -0,0 +1,58 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef BRIGHTNESS_FILTER_H_
+#define BRIGHTNESS_FILTER_H_
+
+#include <cstdint>
+
+/// @brief Turns the light measured by the sensor into the brightness of the LEDs
+///
+/// No hardware access, the light sensor task feeds it with the measurements. They are smoothed by a
+/// first-order low-pass filter in fixed point, each one weighing 1/2^filter_shift, then the filtered
+/// light is mapped linearly from [dark_counts, bright_counts] to [0, 255] and clamped outside. The
+/// linear map keeps the LED output proportional to the ambient light, the two counts set its range.
+class BrightnessFilter
+{
+  public:
+    /// @param dark_counts Sensor output mapped to brightness 0, and below
+    /// @param bright_counts Sensor output mapped to brightness 255, and above, must be above `dark_counts`
+    /// @param filter_shift 0 (no filtering) to 8
+    /// @param initial_brightness Brightness until the measurements move the filter
+    BrightnessFilter(const uint16_t dark_counts, const uint16_t bright_counts, const uint32_t filter_shift, const uint8_t initial_brightness);
+
+    /// @brief Filter a new measurement
+    /// @return The new brightness
+    uint8_t Update(const uint16_t light);
+
+    uint8_t GetBrightness() const
+    {
+        return brightness_;
+    }
+
+  private:
+    static constexpr uint32_t kFractionalBits = 8U;
+
+    const uint16_t dark_counts_;
+    const uint16_t bright_counts_;
+    const uint32_t filter_shift_;
+    uint32_t filtered_light_;  // kFractionalBits fractional bits
+    uint8_t brightness_;
+
+    uint8_t LightToBrightness(const uint32_t light) const;
+};
+
+#endif  // BRIGHTNESS_FILTER_H_
@@ -0,0 +1,128 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "ButtonGestures.h"
+
+#include "FwConfig.h"
+#include "Signals.h"
+
+// The durations are computed on 31 bits, as the edge times, they stay correct when the clock wraps around
+static uint32_t GetEdgeTime(const uint32_t edge)
+{
+    return edge >> 1U;
+}
+
+static uint32_t GetDuration(const uint32_t from, const uint32_t to)
+{
+    return ((to << 1U) - (from << 1U)) >> 1U;
+}
+
+void ButtonGestures::Update(const uint32_t edge, const uint32_t now, Signals& signals)
+{
+    // The level is taken once the pin did not change during the debounce duration, at the time of its last edge
+    const bool is_low = (0U == (edge & 1U));
+    const bool is_stable = GetDuration(GetEdgeTime(edge), now) >= kDebounceDurationMilliSeconds;
+    if (is_stable && (is_low != is_pushed_))
+    {
+        if (is_low)
+        {
+            OnPush(GetEdgeTime(edge), signals);
+        }
+        else
+        {
+            OnRelease(GetEdgeTime(edge), signals);
+        }
+    }
+    else
+    {
+        // Bouncing or no change
+    }
+    RecogniseTimedGestures(now, signals);
+}
+
+void ButtonGestures::OnPush(const uint32_t time, Signals& signals)
+{
+    if (is_short_push_pending_ && (GetDuration(release_time_, time) > kDoublePushMaxGapMilliSeconds))
+    {
+        // Missed by the updates, the previous push was alone
+        signals.push_back(SHORT_PUSH);
+        is_short_push_pending_ = false;
+    }
+    is_pushed_ = true;
+    is_long_push_ = false;
+    push_time_ = time;
+}
+
+void ButtonGestures::OnRelease(const uint32_t time, Signals& signals)
+{
+    is_pushed_ = false;
+    const bool is_short_push = !is_long_push_ && (GetDuration(push_time_, time) >= kShortPushMinDurationMilliSeconds);
+    if (is_short_push && !is_double_push_enabled_)
+    {
+        signals.push_back(SHORT_PUSH);
+    }
+    else if (is_short_push && is_short_push_pending_)
+    {
+        signals.push_back(DOUBLE_PUSH);
+        is_short_push_pending_ = false;
+    }
+    else if (is_short_push)
+    {
+        is_short_push_pending_ = true;
+        release_time_ = time;
+    }
+    else
+    {
+        // Too short, or the end of a long push
+    }
+}
+
+void ButtonGestures::RecogniseTimedGestures(const uint32_t now, Signals& signals)
+{
+    if (is_pushed_)
+    {
+        const uint32_t push_duration = GetDuration(push_time_, now);
+        if (!is_long_push_ && (push_duration >= kLongPushMinDurationMilliSeconds))
+        {
+            if (is_short_push_pending_)
+            {
+                signals.push_back(SHORT_PUSH);
+                is_short_push_pending_ = false;
+            }
+            signals.push_back(LONG_PUSH);
+            is_long_push_ = true;
+            next_repeat_duration_ = kLongPushMinDurationMilliSeconds + kRepeatPushPeriodMilliSeconds;
+        }
+        else if (is_long_push_ && (push_duration >= next_repeat_duration_))
+        {
+            signals.push_back(REPEAT_PUSH);
+            next_repeat_duration_ += kRepeatPushPeriodMilliSeconds;
+        }
+        else
+        {
+            // Wait for the release or the next repetition
+        }
+    }
+    else if (is_short_push_pending_ && (GetDuration(release_time_, now) > kDoublePushMaxGapMilliSeconds))
+    {
+        signals.push_back(SHORT_PUSH);
+        is_short_push_pending_ = false;
+    }
+    else
+    {
+        // Idle
+    }
+}
@@ -0,0 +1,70 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef BUTTON_GESTURES_H_
+#define BUTTON_GESTURES_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "etl/vector.h"
+
+/// @brief Recognises the gestures of a push button from the time and level of the last edge of its pin
+///
+/// No hardware access, PushButton feeds it with the edges timestamped by its interrupt. A short push is
+/// posted on its release. With the double push enabled, it is only posted once no second push followed it,
+/// see kDoublePushMaxGapMilliSeconds: enable it only if a state reacts to DOUBLE_PUSH.
+class ButtonGestures
+{
+  public:
+    static constexpr size_t kMaxSignalsPerUpdate = 2U;
+    using Signals = etl::vector<uint16_t, kMaxSignalsPerUpdate>;
+
+    explicit ButtonGestures(const bool is_double_push_enabled) : is_double_push_enabled_(is_double_push_enabled) {}
+
+    /// @brief Time and level of an edge packed in one word, the time keeps 31 bits
+    /// @param is_released Level of the pin, high when released (pull-up)
+    static constexpr uint32_t PackEdge(const uint32_t time, const bool is_released)
+    {
+        return (time << 1U) | (is_released ? 1U : 0U);
+    }
+
+    /// @brief Debounce the last edge and recognise the gestures, call it periodically
+    /// @param edge Last edge of the pin, see PackEdge
+    /// @param now Time in ms, same clock as the edges
+    /// @param signals Recognised gestures, in order
+    void Update(const uint32_t edge, const uint32_t now, Signals& signals);
+
+    bool IsPushed() const
+    {
+        return is_pushed_;
+    }
+
+  private:
+    const bool is_double_push_enabled_;
+    bool is_pushed_{false};  // Debounced
+    bool is_long_push_{false};
+    bool is_short_push_pending_{false};  // Released, waiting for a second push
+    uint32_t push_time_{0};
+    uint32_t release_time_{0};
+    uint32_t next_repeat_duration_{0};
+
+    void OnPush(const uint32_t time, Signals& signals);
+    void OnRelease(const uint32_t time, Signals& signals);
+    void RecogniseTimedGestures(const uint32_t now, Signals& signals);
+};
+
+#endif  // BUTTON_GESTURES_H_
@@ -16,28 +16,38 @@
 
 #include "LightSensorLtr303.h"
 
+#include "BrightnessFilter.h"
+#include "FwConfig.h"
 #include "Logging.h"
-#include "Signals.h"
+#include "OsWrapper.h"
 
 #include "Adafruit_LTR329_LTR303.h"
 #include "etl/utility.h"
 
+#include <atomic>
+
+// The sensor is only accessed from the light sensor task, the main loop reads the published brightness.
+
+static_assert(kBrightLightCounts > kDarkLightCounts);
+static_assert(kBrightnessFilterShift <= 8U);  // The filtered light has 8 fractional bits and must fit 32 bits
+
+constexpr uint32_t kMaxDetectionAttempts = 5U;
+constexpr uint32_t kDetectionRetryMilliSec = 50U;
+
 static Adafruit_LTR303 ltr = Adafruit_LTR303();
-static uint8_t brightness = kDefaultBrightness;
-static uint32_t filtered_brightness = kDefaultBrightness << 8;
-static bool is_sensor_available = false;
+static std::atomic<uint8_t> brightness{kDefaultBrightness};
 
-void LightSensorLtr303_Init()
+static bool DetectSensor()
 {
-    Wire.setPins(kLightSensorSdaPin, kLightSensorSclPin);
+    bool is_detected = false;
     uint32_t cnt = 0;
-    while (cnt < 5 && !is_sensor_available)
+    while (cnt < kMaxDetectionAttempts && !is_detected)
     {
-        is_sensor_available = ltr.begin();
+        is_detected = ltr.begin();
         cnt++;
-        delay(50);
+        OswTaskDelay(kDetectionRetryMilliSec);
     }
-    if (is_sensor_available)
+    if (is_detected)
     {
         ltr.setGain(LTR3XX_GAIN_48);
         ltr.setIntegrationTime(LTR3XX_INTEGTIME_50);
@@ -46,46 +56,48 @@ void LightSensorLtr303_Init()
     }
     else
     {
-        LOG_ERROR("Could not detect light sensor");
+        // Try again later
     }
+    return is_detected;
 }
-void LightSensorLtr393_Dispatch(const uint16_t event)
-{
-    if (!is_sensor_available)
-    {
-        return;
-    }
 
-    if (TICK == event)
+static void LightSensorTask(void*)
+{
+    bool is_sensor_available = false;
+    bool is_error_logged = false;
+    BrightnessFilter filter{kDarkLightCounts, kBrightLightCounts, kBrightnessFilterShift, kDefaultBrightness};
+    while (true)
     {
-        constexpr uint32_t kMaxCnt = kBrigthnessUpdateRateMilliSec / kTickPeriodMilliSeconds;
-        static uint32_t cnt = 0;
-        if (cnt < kMaxCnt)
+        if (!is_sensor_available)
         {
-            cnt++;
+            is_sensor_available = DetectSensor();
+            if (!is_sensor_available && !is_error_logged)
+            {
+                LOG_ERROR("Could not detect light sensor");
+                is_error_logged = true;
+            }
+            OswTaskDelay(is_sensor_available ? kBrigthnessUpdateRateMilliSec : kLightSensorRetryMilliSec);
         }
         else
         {
-            cnt = 0;
             if (ltr.newDataAvailable())
             {
                 uint16_t visible_and_ir_light = 0;
                 uint16_t ir_light = 0;
                 [[maybe_unused]] auto _ = ltr.readBothChannels(visible_and_ir_light, ir_light);
-                uint32_t new_brightness = static_cast<uint32_t>(visible_and_ir_light);
-                filtered_brightness = ((31 * filtered_brightness) + new_brightness) / 32;  // Filter with fixed point arithmetics
-                brightness = static_cast<uint8_t>((filtered_brightness & 0x0000FFFF) >> 8);
-#if 0  // debugging light sensor
-                Serial.print(" => Filtered brightness : ");
-                Serial.print(filtered_brightness);
-                Serial.print(" => Brightness : ");
-                Serial.println(brightness);
-#endif
+                brightness = filter.Update(visible_and_ir_light);
             }
+            OswTaskDelay(kBrigthnessUpdateRateMilliSec);
         }
     }
 }
 
+void LightSensorLtr303_Init()
+{
+    Wire.setPins(kLightSensorSdaPin, kLightSensorSclPin);
+    OswTaskCreate(LightSensorTask, "Light Sensor", nullptr, kLightSensorTaskStackSize, kLightSensorTaskPriority, kLightSensorTaskCore);
+}
+
 uint8_t LightSensor_GetBrightness()
 {
     return etl::clamp<uint8_t>(brightness, kMinimumBrightness, UINT8_MAX);
@@ -16,5 +16,5 @@
 
 #include "LightSensor.h"
 
-void LightSensorLtr303_Init();
-void LightSensorLtr393_Dispatch(const uint16_t event);
\ No newline at end of file
+/// @brief Start sampling the light sensor in its own task, the I2C transfers never block the caller
+void LightSensorLtr303_Init();
\ No newline at end of file
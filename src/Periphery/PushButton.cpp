@@ -22,35 +22,47 @@
 
 #include "Arduino.h"
 
+PushButton::PushButton(const uint8_t pin_nr, EventQueue& event_queue)
+    : pin_nr_(pin_nr), event_queue_(event_queue), gestures_(kIsDoublePushEnabled)
+{
+}
+
+void IRAM_ATTR PushButton::OnEdge(void* arg)
+{
+    auto* const button = static_cast<PushButton*>(arg);
+    const bool is_released = (digitalRead(button->pin_nr_) == HIGH);
+    button->last_edge_.store(ButtonGestures::PackEdge(millis(), is_released), std::memory_order_relaxed);
+}
+
 void PushButton::Init()
 {
     pinMode(pin_nr_, INPUT_PULLUP);
+    last_edge_ = ButtonGestures::PackEdge(millis(), digitalRead(pin_nr_) == HIGH);
+    attachInterruptArg(digitalPinToInterrupt(pin_nr_), OnEdge, this, CHANGE);
 }
+
 void PushButton::Dispatch(const uint16_t event)
 {
     if (TICK == event)
     {
-        if (digitalRead(pin_nr_) == LOW)
-        {
-            debounce_cnt_++;
-            if (debounce_cnt_ > kDebounceDurationMilliSeconds / kTickPeriodMilliSeconds)
-            {
-                is_pushed_ = true;
-            }
-        }
-        else
+        ButtonGestures::Signals signals;
+        gestures_.Update(last_edge_.load(std::memory_order_relaxed), millis(), signals);
+        for (const uint16_t signal : signals)
         {
-            if (debounce_cnt_ > kShortPushMinDurationMilliSeconds / kTickPeriodMilliSeconds)
-            {
-                event_queue_.push(SHORT_PUSH);
-                LOG_DEBUG("PushButton - Short push");
-            }
-            else
-            {
-                // No push detected
-            }
-            debounce_cnt_ = 0;
-            is_pushed_ = false;
+            Post(signal);
         }
     }
-}
\ No newline at end of file
+}
+
+void PushButton::Post(const uint16_t signal)
+{
+    if (event_queue_.full())
+    {
+        LOG_ERROR("PushButton - Event queue full, gesture lost");
+    }
+    else
+    {
+        event_queue_.push(signal);
+        LOG_DEBUG("PushButton - Gesture posted");
+    }
+}
@@ -17,26 +17,36 @@
 #ifndef PUSH_BUTTON_H_
 #define PUSH_BUTTON_H_
 
+#include <atomic>
 #include <cstdint>
 
+#include "ButtonGestures.h"
+
 class EventQueue;
 
+/// @brief Button driver, the edges are timestamped by the pin interrupt and recognised as gestures on the ticks
+///
+/// Each gesture is posted as its own signal: SHORT_PUSH, DOUBLE_PUSH, LONG_PUSH and then REPEAT_PUSH while held,
+/// see ButtonGestures.
 class PushButton
 {
   public:
-    PushButton(const uint8_t pin_nr, EventQueue& event_queue) : pin_nr_(pin_nr), event_queue_(event_queue) {}
+    PushButton(const uint8_t pin_nr, EventQueue& event_queue);
     void Init();
     void Dispatch(const uint16_t event);
     bool IsPushed() const
     {
-        return is_pushed_;
+        return gestures_.IsPushed();
     }
 
   private:
     const uint8_t pin_nr_;
     EventQueue& event_queue_;
-    uint32_t debounce_cnt_{0};
-    bool is_pushed_{false};
+    std::atomic<uint32_t> last_edge_{1U};  // Written by the interrupt, see ButtonGestures::PackEdge
+    ButtonGestures gestures_;
+
+    static void OnEdge(void* arg);
+    void Post(const uint16_t signal);
 };
 
-#endif  // PUSH_BUTTON_H_
\ No newline at end of file
+#endif  // PUSH_BUTTON_H_
@@ -31,6 +31,9 @@ enum TrainboardSignal : uint16_t
     POLL_SERVER,
     LOAD_HISTORY,
     SHORT_PUSH,
+    LONG_PUSH,
+    DOUBLE_PUSH,
+    REPEAT_PUSH,
     RECONNECT,
     DATA_OK,
     RETRY,
@@ -16,46 +16,65 @@
 
 #include "StateLive.h"
 
+#include "DataConverter.h"
 #include "DataManager.h"
 #include "LedManager.h"
+#include "LightSensor.h"
 #include "Logging.h"
+#include "PollScheduler.h"
+#include "ServerCommunication.h"
 #include "Signals.h"
+#include "StagingArena.h"
 #include "TimerTicker.h"
 #include "WifiProvisioning.h"
 
-StateLive::StateLive(LedManager& led_manager, Transitions transitions)
+StateLive::StateLive(LedManager& led_manager, PollScheduler& poll_scheduler, StagingArena& staging_arena, Transitions transitions)
     : led_manager_(led_manager),
+      poll_scheduler_(poll_scheduler),
+      staging_arena_(staging_arena),
       load_hist_transition_(transitions.hist),
       fake_transition_(transitions.fake),
       poll_transition_(transitions.poll),
       update_transition_(transitions.update),
-      timer_1min_(kTickPeriodMilliSeconds),
-      timer_15min_(kTickPeriodMilliSeconds)
+      pushed_transition_(transitions.pushed),
+      timer_poll_(kTickPeriodMilliSeconds),
+      timer_ota_check_(kTickPeriodMilliSeconds)
 {}
 
 void StateLive::InitTimers()
 {
-    timer_1min_.Init();
-    timer_15min_.Init();
-    (void)TimerTicker_RegisterTimer(&timer_1min_);
-    (void)TimerTicker_RegisterTimer(&timer_15min_);
+    timer_poll_.Init();
+    timer_ota_check_.Init();
+    (void)TimerTicker_RegisterTimer(&timer_poll_);
+    (void)TimerTicker_RegisterTimer(&timer_ota_check_);
 }
 
 void StateLive::Enter()
 {
     LOG_DEBUG("TBSM - /e Live ");
-    (void)timer_1min_.StartOneShot(60 * 1000);
-    if (!timer_15min_.IsRunning())
+    buffer_ = staging_arena_.Acquire(this);
+    ASSERT(nullptr != buffer_);
+    // While the server pushes the frames, polling is only the fallback
+    const uint32_t poll_delay_ms = ServerCom_IsPushChannelOpen() ? (kPushFallbackPollSeconds * 1000) : poll_scheduler_.GetDelayMilliSeconds();
+    if (!timer_poll_.StartOneShot(poll_delay_ms))
     {
-        (void)timer_15min_.StartOneShot(15 * 60 * 1000);
+        // Without the poll timer the board would never update again
+        LOG_INFO("TBSM(Live) - Could not start poll timer with %u ms, retrying later", poll_delay_ms);
+        (void)timer_poll_.StartOneShot(kPollRetryMinSeconds * 1000);
+    }
+    if (!timer_ota_check_.IsRunning())
+    {
+        (void)timer_ota_check_.StartOneShot(kOtaCheckIntervalMinutes * 60 * 1000);
     }
 }
 
 void StateLive::Exit()
 {
     LOG_DEBUG("TBSM - /x Live ");
-    timer_1min_.Stop();
-    timer_1min_.Reset();
+    timer_poll_.Stop();
+    timer_poll_.Reset();
+    staging_arena_.Release(this);
+    buffer_ = nullptr;
 }
 
 FsmTransition* StateLive::ProcessEvent(uint16_t event)
@@ -63,13 +82,24 @@ FsmTransition* StateLive::ProcessEvent(uint16_t event)
     FsmTransition* transition = nullptr;
     if (TICK == event)
     {
-        if (timer_1min_.HasExpired())
+        led_manager_.RefreshMotion();
+        if (ReceivePushedFrame())
+        {
+            transition = &pushed_transition_;
+        }
+        else if (timer_poll_.HasExpired())
         {
+            UpdatePushChannel();
             transition = &poll_transition_;
         }
-        else if (timer_15min_.HasExpired())
+        else if (timer_ota_check_.HasExpired())
+        {
+            timer_ota_check_.Reset();
+            (void)timer_ota_check_.StartOneShot(kOtaCheckIntervalMinutes * 60 * 1000);
+            CheckForUpdate();
+        }
+        else if (IsQuietMomentForRestart())
         {
-            timer_15min_.Reset();
             transition = &update_transition_;
         }
         else
@@ -79,9 +109,16 @@ FsmTransition* StateLive::ProcessEvent(uint16_t event)
     }
     else if ((DISCONNECTED == event) || (NETWORK_DOWN == event))
     {
+        ServerCom_ClosePushChannel();
         led_manager_.ClearAllLeds();
         transition = &fake_transition_;
     }
+    else if ((SHORT_PUSH == event) && (DataReaderMode::kDelay == DataMgr_GetReaderMode()))
+    {
+        led_manager_.ClearAllLeds();
+        DataMgr_SetReaderMode(DataReaderMode::kLive);
+        transition = &pushed_transition_;  // Shows the newest frame
+    }
     else if (SHORT_PUSH == event)
     {
         led_manager_.ClearAllLeds();
@@ -94,3 +131,91 @@ FsmTransition* StateLive::ProcessEvent(uint16_t event)
     }
     return transition;
 }
+
+bool StateLive::ReceivePushedFrame()
+{
+    bool is_frame_saved = false;
+    if (ServerCom_IsPushChannelOpen())
+    {
+        const auto data_length = ServerCom_GetPushedData(buffer_, kBufferSizeInBytes);
+        if (data_length.has_value() && (0U != data_length.value()))
+        {
+            if (!DataMgr_IsNewerSequence(ServerCom_GetLastSequence()))
+            {
+                // The server pushes its newest frame when the channel opens, it may have been polled already
+                LOG_DEBUG("TBSM(Live) - Pushed frame already saved");
+            }
+            else if (DataConv_IsDataValid(buffer_, data_length.value()))
+            {
+                LOG_DEBUG("TBSM(Live) - Saving pushed data");
+                DataMgr_SetWriterMode(DataWriterMode::kSingle);
+                auto writer = DataMgr_GetWriter();
+                ASSERT(nullptr != writer);
+                writer->SaveData(buffer_, data_length.value());
+                DataMgr_SetNewestSequence(ServerCom_GetLastSequence());
+                (void)poll_scheduler_.OnSuccess(std::nullopt);
+                is_frame_saved = true;
+            }
+            else
+            {
+                LOG_WARN("TBSM(Live) - Invalid pushed data");
+            }
+        }
+        else
+        {
+            // Nothing new
+        }
+    }
+    return is_frame_saved;
+}
+
+void StateLive::UpdatePushChannel()
+{
+    if (!kIsServerPushEnabled)
+    {
+        // Polling only
+    }
+    else if (ServerCom_IsPushChannelOpen())
+    {
+        // The poll timer only expires if nothing was pushed for too long
+        LOG_WARN("TBSM(Live) - Push channel silent, falling back to polling");
+        ServerCom_ClosePushChannel();
+        push_retry_cnt_ = kPushRetryPolls;
+    }
+    else if (0U == push_retry_cnt_)
+    {
+        if (!ServerCom_OpenPushChannel())
+        {
+            push_retry_cnt_ = kPushRetryPolls;
+        }
+    }
+    else
+    {
+        push_retry_cnt_--;
+    }
+}
+
+void StateLive::CheckForUpdate()
+{
+    // The update is downloaded in the background, the board stays live meanwhile
+    if (OtaStatus::kReady == ServerCom_GetOtaStatus())
+    {
+        ota_wait_cnt_++;
+    }
+    else if (ServerCom_StartOtaUpdate())
+    {
+        ota_wait_cnt_ = 0U;
+    }
+    else
+    {
+        // Still downloading
+    }
+}
+
+bool StateLive::IsQuietMomentForRestart()
+{
+    // Nobody watches the board in the dark, otherwise restart after waiting long enough
+    const auto is_dark = (LightSensor_GetBrightness() <= kMinimumBrightness);
+    const auto has_waited_long_enough = (ota_wait_cnt_ >= kOtaRebootMaxWaitChecks);
+    return (OtaStatus::kReady == ServerCom_GetOtaStatus()) && (is_dark || has_waited_long_enough);
+}
@@ -18,9 +18,12 @@
 #define STATE_LIVE_H_
 
 #include "Fsm.h"
+#include "FwConfig.h"
 #include "Timer.h"
 
 class LedManager;
+class PollScheduler;
+class StagingArena;
 
 class StateLive : public FsmState
 {
@@ -31,8 +34,9 @@ class StateLive : public FsmState
         FsmTransition& fake;
         FsmTransition& poll;
         FsmTransition& update;
+        FsmTransition& pushed;
     };
-    StateLive(LedManager& led_manager, Transitions transitions);
+    StateLive(LedManager& led_manager, PollScheduler& poll_scheduler, StagingArena& staging_arena, Transitions transitions);
 
     void InitTimers();
     void Enter() override;
@@ -42,16 +46,26 @@ class StateLive : public FsmState
   private:
     // Infrastructure
     LedManager& led_manager_;
+    PollScheduler& poll_scheduler_;
+    StagingArena& staging_arena_;
 
     // Transitions
     FsmTransition& load_hist_transition_;
     FsmTransition& fake_transition_;
     FsmTransition& poll_transition_;
     FsmTransition& update_transition_;
+    FsmTransition& pushed_transition_;
 
     // Household
-    Timer timer_1min_;
-    Timer timer_15min_;
+    Timer timer_poll_;
+    Timer timer_ota_check_;
+    uint32_t push_retry_cnt_{0U};
+    uint32_t ota_wait_cnt_{0U};
+    uint8_t* buffer_{nullptr};  // From the staging arena, while the state is active
+    bool ReceivePushedFrame();
+    void UpdatePushChannel();
+    void CheckForUpdate();
+    bool IsQuietMomentForRestart();
 };
 
 #endif  // STATE_LIVE_H_
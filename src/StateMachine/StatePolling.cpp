@@ -21,20 +21,42 @@
 #include "FwConfig.h"
 #include "LedManager.h"
 #include "Logging.h"
+#include "PollScheduler.h"
 #include "ServerCommunication.h"
 #include "Signals.h"
+#include "StagingArena.h"
+#include "TimerTicker.h"
 #include "WifiProvisioning.h"
 
+static std::optional<uint32_t> GetMissingHistoryData(uint8_t* const buffer, const uint32_t max_length)
+{
+    const auto newest_sequence = DataMgr_GetNewestSequence();
+    ASSERT(newest_sequence.has_value());
+    return ServerCom_GetHistoryDataSince(buffer, max_length, newest_sequence.value_or(0U));
+}
+
+void StatePolling::InitTimers()
+{
+    retry_timer_.Init();
+    (void)TimerTicker_RegisterTimer(&retry_timer_);
+}
+
 void StatePolling::Enter()
 {
     LOG_DEBUG("TBSM - /e Polling ");
     fail_cnt_ = 0U;
+    buffer_ = staging_arena_.Acquire(this);
+    ASSERT(nullptr != buffer_);
     AssignDelegates();
 }
 
 void StatePolling::Exit()
 {
     LOG_DEBUG("TBSM - /x Polling ");
+    retry_timer_.Stop();
+    retry_timer_.Reset();
+    staging_arena_.Release(this);
+    buffer_ = nullptr;
 }
 
 FsmTransition* StatePolling::ProcessEvent(uint16_t event)
@@ -76,6 +98,10 @@ void StatePolling::AssignDelegates()
             get_data_delegate_ = ServerCom_GetHistoryData;
             is_data_valid_delegate_ = DataConv_IsHistoryDataValid;
             break;
+        case DataWriterMode::kAppend:
+            get_data_delegate_ = GetMissingHistoryData;
+            is_data_valid_delegate_ = DataConv_IsHistoryUpdateValid;
+            break;
     }
     ASSERT(nullptr != get_data_delegate_);
     ASSERT(nullptr != is_data_valid_delegate_);
@@ -83,17 +109,24 @@ void StatePolling::AssignDelegates()
 
 void StatePolling::HandleTickEvent()
 {
-    LOG_DEBUG("TBSM(Polling) - Poll server...");
-    const auto server_response = get_data_delegate_(buffer_.data(), static_cast<uint32_t>(buffer_.size()));
-    if (server_response.has_value())
+    if (retry_timer_.IsRunning())
     {
-        LOG_DEBUG("TBSM(Polling) - Got server response");
-        const auto data_length = server_response.value();
-        EvaluateData(data_length, buffer_.data());
+        // Waiting before retrying, the poll scheduler backs off
     }
     else
     {
-        LOG_DEBUG("TBSM(Polling) - Could not get server response");
+        LOG_DEBUG("TBSM(Polling) - Poll server...");
+        const auto server_response = get_data_delegate_(buffer_, staging_arena_.GetSize());
+        if (server_response.has_value())
+        {
+            LOG_DEBUG("TBSM(Polling) - Got server response");
+            const auto data_length = server_response.value();
+            EvaluateData(data_length, buffer_);
+        }
+        else
+        {
+            LOG_DEBUG("TBSM(Polling) - Could not get server response");
+        }
     }
 }
 
@@ -102,8 +135,17 @@ void StatePolling::EvaluateData(const uint32_t data_length, const uint8_t* const
     LOG_DEBUG("TBSM(Polling) - Evaluating data");
     if (0U == data_length)
     {
-        LOG_DEBUG("TBSM(Polling) - Zero length data");
-        HandlePollFail();
+        if (IsHistoryUpToDate())
+        {
+            LOG_DEBUG("TBSM(Polling) - History already up to date");
+            (void)poll_scheduler_.OnSuccess(ServerCom_GetPollHint());
+            event_queue_.push(DATA_OK);
+        }
+        else
+        {
+            LOG_DEBUG("TBSM(Polling) - Zero length data");
+            HandlePollFail();
+        }
     }
     else
     {
@@ -118,18 +160,38 @@ void StatePolling::EvaluateData(const uint32_t data_length, const uint8_t* const
             LOG_DEBUG("TBSM(Polling) - Saving data");
             auto writer = DataMgr_GetWriter();
             ASSERT(nullptr != writer);
-            writer->SaveData(buffer_data, data_length);
+            if (writer->SaveData(buffer_data, data_length))
+            {
+                DataMgr_SetNewestSequence(ServerCom_GetLastSequence());
+            }
+            else
+            {
+                // Not all frames were stored or they do not fill the history, the next history load must be complete
+                LOG_DEBUG("TBSM(Polling) - Data not completely saved, sequence forgotten");
+                DataMgr_SetNewestSequence(std::nullopt);
+            }
+            (void)poll_scheduler_.OnSuccess(ServerCom_GetPollHint());
             event_queue_.push(DATA_OK);
         }
     }
 }
 
+bool StatePolling::IsHistoryUpToDate() const
+{
+    // When nothing is missing, the server answers with no data but still sends the newest sequence number
+    const auto last_sequence = ServerCom_GetLastSequence();
+    return (DataWriterMode::kAppend == DataMgr_GetWriterMode()) && last_sequence.has_value() && (last_sequence == DataMgr_GetNewestSequence());
+}
+
 void StatePolling::HandlePollFail()
 {
     LOG_DEBUG("TBSM(Polling) - Handling poll fail");
 
     constexpr uint16_t kMaxFails = 5U;
 
+    // The backoff goes on counting in the following polls, until one succeeds
+    const auto retry_delay_ms = poll_scheduler_.OnFailure(ServerCom_GetPollHint());
+
     fail_cnt_++;
     if (fail_cnt_ >= kMaxFails)
     {
@@ -138,6 +200,7 @@ void StatePolling::HandlePollFail()
     }
     else
     {
-        // Nothing to do yet
+        (void)retry_timer_.Reset();
+        (void)retry_timer_.StartOneShot(retry_delay_ms);
     }
 }
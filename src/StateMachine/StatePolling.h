@@ -19,12 +19,14 @@
 
 #include "Fsm.h"
 #include "FwConfig.h"
+#include "Timer.h"
 
 #include <optional>
-#include "etl/array.h"
 
 class EventQueue;
 class LedManager;
+class PollScheduler;
+class StagingArena;
 
 class StatePolling : public FsmState
 {
@@ -34,12 +36,16 @@ class StatePolling : public FsmState
         FsmTransition& fake;
         FsmTransition& data_ok;
     };
-    StatePolling(LedManager& led_manager, EventQueue& event_queue, Transitions transitions)
+    StatePolling(LedManager& led_manager, EventQueue& event_queue, PollScheduler& poll_scheduler, StagingArena& staging_arena, Transitions transitions)
         : led_manager_(led_manager),
           event_queue_(event_queue),
+          poll_scheduler_(poll_scheduler),
+          staging_arena_(staging_arena),
           fake_transition_(transitions.fake),
-          data_ok_transition_(transitions.data_ok) {}
+          data_ok_transition_(transitions.data_ok),
+          retry_timer_(kTickPeriodMilliSeconds) {}
 
+    void InitTimers();
     void Enter() override;
     void Exit() override;
     FsmTransition* ProcessEvent(uint16_t event) override;
@@ -48,6 +54,8 @@ class StatePolling : public FsmState
     // Infrastructure
     LedManager& led_manager_;
     EventQueue& event_queue_;
+    PollScheduler& poll_scheduler_;
+    StagingArena& staging_arena_;
 
     // Transition
     FsmTransition& fake_transition_;
@@ -55,12 +63,14 @@ class StatePolling : public FsmState
 
     // Household
     uint16_t fail_cnt_{0};
-    etl::array<uint8_t, kNumberOfHistoryFrames * kBufferSizeInBytes> buffer_{};
+    Timer retry_timer_;
+    uint8_t* buffer_{nullptr};  // From the staging arena, while the state is active
     std::optional<uint32_t> (*get_data_delegate_)(uint8_t* const, const uint32_t){nullptr};
     bool (*is_data_valid_delegate_)(const uint8_t* const, const uint32_t){nullptr};
     void AssignDelegates();
     void HandleTickEvent();
     void EvaluateData(const uint32_t data_length, const uint8_t* const buffer_data);
+    bool IsHistoryUpToDate() const;
     void HandlePollFail();
 };
 
@@ -22,23 +22,50 @@
 #include "LedManager.h"
 #include "Logging.h"
 #include "Signals.h"
+#include "StagingArena.h"
+#include "TransitionEffects.h"
 #include "WifiProvisioning.h"
 
+static TransitionEffect GetTransitionEffect(DataReaderMode mode);
+
 void StateTransitioning::Enter()
 {
     LOG_DEBUG("TBSM - /e Transitioning ");
 
-    auto data_length = ReadDataToBeDisplayed(buffer_.data(), kBufferSizeInBytes);
-    auto conversion_result = DataConv_DataToLeds(buffer_.data(), data_length, leds_.data(), kMaxLedsOn);
+    auto buffer = staging_arena_.Acquire(this);
+    ASSERT(nullptr != buffer);
+    auto reader = DataMgr_GetReader();
+    ASSERT(nullptr != reader);
+    auto data_length = reader->ReadData(buffer, kBufferSizeInBytes);
+    if (reader->WasBusy())
+    {
+        // Not a conversion failure: the frame was being written, the LEDs are kept and the frame is read next time
+        LOG_DEBUG("Data busy, frame skipped");
+    }
+    else
+    {
+        auto conversion_result = DataConv_DataToLeds(buffer, data_length, leds_.data(), kMaxLedsOn);
+        if (DataReaderMode::kLive == DataMgr_GetReaderMode())
+        {
+            const auto nr_of_trains = DataConv_DataToTrains(buffer, data_length, trains_.data(), kMaxTrains);
+            led_manager_.SetTrains(trains_.data(), nr_of_trains.value_or(0U));
+        }
+        else
+        {
+            // The trains only move in the live state (RefreshMotion), they jump from frame to frame in the replays
+            led_manager_.SetTrains(nullptr, 0U);
+        }
 
-    LOG_DEBUG("Converted Leds");
+        LOG_DEBUG("Converted Leds");
 
-    SetNewLedsToLedManager(leds_.data(), conversion_result);
+        SetNewLedsToLedManager(leds_.data(), conversion_result);
+    }
 }
 
 void StateTransitioning::Exit()
 {
     LOG_DEBUG("TBSM - /x Transitioning ");
+    staging_arena_.Release(this);
 }
 
 FsmTransition* StateTransitioning::ProcessEvent(uint16_t event)
@@ -67,20 +94,13 @@ FsmTransition* StateTransitioning::ProcessEvent(uint16_t event)
     return transition;
 }
 
-uint32_t StateTransitioning::ReadDataToBeDisplayed(uint8_t* const data, uint32_t size) const
-{
-    auto reader = DataMgr_GetReader();
-    ASSERT(nullptr != reader);
-    auto data_length = reader->ReadData(data, size);
-    return data_length;
-}
-
 void StateTransitioning::SetNewLedsToLedManager(const Led* const leds, std::optional<uint32_t> nr_of_leds)
 {
     if (nr_of_leds.has_value())
     {
         conversion_fail_cnt_ = 0U;
         auto leds_size = nr_of_leds.value();
+        led_manager_.SetTransitionEffect(GetTransitionEffect(DataMgr_GetReaderMode()));
         led_manager_.SetLeds(leds, leds_size);
     }
     else
@@ -117,6 +137,11 @@ FsmTransition* StateTransitioning::HandleShortPush() const
             LOG_INFO("TBSM - Setting history mode");
             DataMgr_SetReaderMode(DataReaderMode::kHistory);
         }
+        else if (read_mode == DataReaderMode::kHistory)
+        {
+            LOG_INFO("TBSM - Setting delay mode");
+            DataMgr_SetReaderMode(DataReaderMode::kDelay);
+        }
         else
         {
             LOG_INFO("TBSM - Setting live mode");
@@ -146,7 +171,31 @@ FsmTransition* StateTransitioning::HandleTick() const
             case DataReaderMode::kOffline:
                 transition = &fake_done_transition_;
                 break;
+            case DataReaderMode::kDelay:
+                transition = &live_done_transition_;  // Updated with the live frames
+                break;
         }
     }
     return transition;
 }
+
+static TransitionEffect GetTransitionEffect(DataReaderMode mode)
+{
+    TransitionEffect effect = TransitionEffect::kCrossfade;
+    switch (mode)
+    {
+        case DataReaderMode::kLive:
+            effect = TransitionEffect::kBlend;
+            break;
+        case DataReaderMode::kHistory:
+            effect = TransitionEffect::kWipe;  // Rewinding through the past frames
+            break;
+        case DataReaderMode::kOffline:
+            effect = TransitionEffect::kSparkle;
+            break;
+        case DataReaderMode::kDelay:
+            effect = TransitionEffect::kBlend;
+            break;
+    }
+    return effect;
+}
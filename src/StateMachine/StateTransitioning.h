@@ -26,6 +26,7 @@
 
 class EventQueue;
 class LedManager;
+class StagingArena;
 
 class StateTransitioning : public FsmState
 {
@@ -38,9 +39,10 @@ class StateTransitioning : public FsmState
         FsmTransition& hist_done;
         FsmTransition& fake_done;
     };
-    StateTransitioning(LedManager& led_manager, EventQueue& event_queue, Transitions transitions)
+    StateTransitioning(LedManager& led_manager, EventQueue& event_queue, StagingArena& staging_arena, Transitions transitions)
         : event_queue_(event_queue),
           led_manager_(led_manager),
+          staging_arena_(staging_arena),
           load_hist_transition_(transitions.load_history),
           fake_transition_(transitions.fake),
           live_done_transition_(transitions.live_done),
@@ -56,6 +58,7 @@ class StateTransitioning : public FsmState
     // Infrastructure
     EventQueue& event_queue_;
     LedManager& led_manager_;
+    StagingArena& staging_arena_;
 
     // Transitions
     FsmTransition& load_hist_transition_;
@@ -66,9 +69,8 @@ class StateTransitioning : public FsmState
 
     // Housekeeping
     uint8_t conversion_fail_cnt_{0U};
-    etl::array<uint8_t, kBufferSizeInBytes> buffer_{};
-    etl::array<Led, kMaxLedsOn> leds_{};
-    uint32_t ReadDataToBeDisplayed(uint8_t* const data, uint32_t size) const;
+    etl::array<Led, kMaxLedsOn> leds_{};  // Render buffer, stays in the internal RAM
+    etl::array<Train, kMaxTrains> trains_{};
     void SetNewLedsToLedManager(const Led* const leds, std::optional<uint32_t> nr_of_leds);
     FsmTransition* HandleShortPush() const;
     FsmTransition* HandleTick() const;
@@ -16,14 +16,15 @@
 
 #include "StateUpdating.h"
 
+#include "LedManager.h"
 #include "Logging.h"
 #include "ServerCommunication.h"
 #include "Signals.h"
-#include "WifiProvisioning.h"
 
 void StateUpdating::Enter()
 {
     LOG_DEBUG("TBSM - /e Updating ");
+    is_restart_pending_ = false;
 }
 
 void StateUpdating::Exit()
@@ -51,26 +52,21 @@ FsmTransition* StateUpdating::ProcessEvent(uint16_t event)
 
 void StateUpdating::HandleTickEvent()
 {
-    const auto is_connected_to_wifi = WifiProv_IsConnectedToWifi();
-    if (!is_connected_to_wifi)
+    if ((OtaStatus::kReady == ServerCom_GetOtaStatus()) && !is_restart_pending_)
     {
-        event_queue_.push(NO_UPDATE);
+        led_manager_.ClearAllLeds();  // Shown at the end of this tick, or later if a frame is still being shown
+        is_restart_pending_ = true;
     }
-    else
+    else if (is_restart_pending_ && led_manager_.IsShowDone())
     {
-        UpdateOta();
+        ServerCom_ApplyOtaUpdate();  // Restarts the device
     }
-}
-
-void StateUpdating::UpdateOta()
-{
-    const auto could_update = ServerCom_UpdateOta();
-    if (!could_update)
+    else if (is_restart_pending_)
     {
-        event_queue_.push(NO_UPDATE);
+        // Waiting for the LEDs to be dark
     }
     else
     {
-        // Nothing to do
+        event_queue_.push(NO_UPDATE);
     }
 }
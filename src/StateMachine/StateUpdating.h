@@ -20,12 +20,14 @@
 #include "Fsm.h"
 
 class EventQueue;
+class LedManager;
 
 class StateUpdating : public FsmState
 {
   public:
-    StateUpdating(EventQueue& event_queue, FsmTransition& no_update_transition)
-        : event_queue_(event_queue),
+    StateUpdating(LedManager& led_manager, EventQueue& event_queue, FsmTransition& no_update_transition)
+        : led_manager_(led_manager),
+          event_queue_(event_queue),
           no_update_transition_(no_update_transition) {}
 
     void Enter() override;
@@ -34,14 +36,15 @@ class StateUpdating : public FsmState
 
   private:
     // Infrastructure
+    LedManager& led_manager_;
     EventQueue& event_queue_;
 
     // Transition
     FsmTransition& no_update_transition_;
 
     // Household
+    bool is_restart_pending_{false};
     void HandleTickEvent();
-    void UpdateOta();
 };
 
 #endif  // STATE_UPDATING_H_
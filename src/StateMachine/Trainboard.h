@@ -20,7 +20,9 @@
 #include "Fsm.h"
 
 #include "LightSensor.h"
+#include "PollScheduler.h"
 #include "Signals.h"
+#include "StagingArena.h"
 #include "StateConnecting.h"
 #include "StateLive.h"
 #include "StateOffline.h"
@@ -38,13 +40,17 @@ class Trainboard
 {
   public:
     Trainboard(EventQueue& event_queue, LedManager& led_manager) : event_queue_(event_queue), led_manager_(led_manager) {}
-    void Init()
+    void Init(uint32_t random_seed)
     {
+        poll_scheduler_.Seed(random_seed);
+        staging_arena_.Init();
         tb_fsm_.Init();
         resetting_.InitTimers();
+        polling_.InitTimers();
         live_.InitTimers();
         offline_.InitTimers();
         led_manager_.SetBrightness(kDefaultBrightness);
+        led_manager_.ShowFrame();
     }
     void DispatchEvent(const uint16_t event)
     {
@@ -54,23 +60,26 @@ class Trainboard
         if (TICK == event)
         {
             led_manager_.SetBrightness(LightSensor_GetBrightness());
+            led_manager_.ShowFrame();  // One frame per tick at most, the changes made by other events wait for it
         }
     }
 
   private:
     EventQueue& event_queue_;
     LedManager& led_manager_;
+    PollScheduler poll_scheduler_{};
+    StagingArena staging_arena_{kStagingArenaSizeInBytes};
 
     // State machine states
     StateStarting starting_{led_manager_, event_queue_, {tran_connect_, tran_reset_}};
     StateResetting resetting_{led_manager_, event_queue_, tran_connect_};
     StateConnecting connecting_{led_manager_, event_queue_, {tran_ping_, tran_fake_}};
     StatePinging pinging_{led_manager_, event_queue_, {tran_load_history_, tran_fake_}};
-    StatePolling polling_{led_manager_, event_queue_, {tran_fake_, tran_data_ok_}};
-    StateTransitioning transitioning_{led_manager_, event_queue_, {tran_fake_, tran_load_history_, tran_live_animation_done_, tran_hist_animation_done_, tran_fake_animation_done_}};
-    StateLive live_{led_manager_, {tran_load_history_, tran_fake_, tran_poll_server_, tran_update_}};
+    StatePolling polling_{led_manager_, event_queue_, poll_scheduler_, staging_arena_, {tran_fake_, tran_data_ok_}};
+    StateTransitioning transitioning_{led_manager_, event_queue_, staging_arena_, {tran_fake_, tran_load_history_, tran_live_animation_done_, tran_hist_animation_done_, tran_fake_animation_done_}};
+    StateLive live_{led_manager_, poll_scheduler_, staging_arena_, {tran_load_history_, tran_fake_, tran_poll_server_, tran_update_, tran_data_ok_}};
     StateOffline offline_{led_manager_, {tran_load_history_, tran_refresh_, tran_connect_}};
-    StateUpdating updating_{event_queue_, tran_no_update_};
+    StateUpdating updating_{led_manager_, event_queue_, tran_no_update_};
 
     // State machine transitions
     FsmTransition tran_reset_{&resetting_};
@@ -28,7 +28,9 @@ class TransitionLoadHistory : public FsmTransition
 
     void Execute() override
     {
-        DataMgr_SetWriterMode(DataWriterMode::kMultiple);
+        // Only download the frames we do not have yet if possible
+        const auto mode = DataMgr_CanAppendHistory() ? DataWriterMode::kAppend : DataWriterMode::kMultiple;
+        DataMgr_SetWriterMode(mode);
     }
 };
 
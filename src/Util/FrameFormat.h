@@ -0,0 +1,97 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef FRAME_FORMAT_H_
+#define FRAME_FORMAT_H_
+
+// Layout of a frame received from the server, all numbers are big endian:
+//      - Header: number of LEDs (14 bits), the highest bit is set if the frame has a train section,
+//        the next one if the train section has delays
+//      - LEDs: strip id, position on the strip, red, green, blue
+//      - Optional train section header: number of trains
+//      - Trains: train id (2 bytes), index of the LED of the train in the frame (2 bytes), direction
+//        (0 towards the higher positions of the strip, 1 towards the lower positions)
+//      - Optional delays: delay of each train in minutes, in the order of the trains, 255 for 255 and more
+// The train section lets the board move the trains between two frames. Frames without it are shown as they are.
+// The delays feed the delay mode, see DelayStats.h.
+
+#include <cstdint>
+
+#include "FwConfig.h"
+
+constexpr uint32_t kFrameHasTrainsFlag = 0x8000U;
+constexpr uint32_t kFrameHasDelaysFlag = 0x4000U;
+
+inline uint32_t FrameFormat_GetNumberOfLeds(const uint8_t* const frame)
+{
+    return ((frame[0] << 8) | frame[1]) & ~(kFrameHasTrainsFlag | kFrameHasDelaysFlag);
+}
+
+inline bool FrameFormat_HasTrains(const uint8_t* const frame)
+{
+    return 0U != (((frame[0] << 8) | frame[1]) & kFrameHasTrainsFlag);
+}
+
+/// @brief Tells if the frame has delays, only valid with a train section
+inline bool FrameFormat_HasDelays(const uint8_t* const frame)
+{
+    return 0U != (((frame[0] << 8) | frame[1]) & kFrameHasDelaysFlag);
+}
+
+/// @brief Get the offset of the train section header in a frame that has one
+inline uint32_t FrameFormat_GetTrainsOffset(const uint8_t* const frame)
+{
+    return kBytesInHeader + (FrameFormat_GetNumberOfLeds(frame) * kBytesPerLed);
+}
+
+/// @brief Get the number of trains of a frame that has a train section
+inline uint32_t FrameFormat_GetNumberOfTrains(const uint8_t* const frame)
+{
+    const auto trains_offset = FrameFormat_GetTrainsOffset(frame);
+    return (frame[trains_offset] << 8) | frame[trains_offset + 1U];
+}
+
+/// @brief Get the offset of the delays in a frame that has some
+inline uint32_t FrameFormat_GetDelaysOffset(const uint8_t* const frame)
+{
+    return FrameFormat_GetTrainsOffset(frame) + kBytesInTrainHeader + (FrameFormat_GetNumberOfTrains(frame) * kBytesPerTrain);
+}
+
+/// @brief Get the length of the frame starting at the given address
+/// @param available_length Number of bytes that can be read from the frame, at least the header
+/// @return Length of the frame, more than `available_length` if the frame is truncated
+inline uint32_t FrameFormat_GetLength(const uint8_t* const frame, uint32_t available_length)
+{
+    auto length = FrameFormat_GetTrainsOffset(frame);
+    if (FrameFormat_HasTrains(frame))
+    {
+        const auto trains_offset = length;
+        length += kBytesInTrainHeader;
+        if (length <= available_length)
+        {
+            const auto nr_of_trains = static_cast<uint32_t>((frame[trains_offset] << 8) | frame[trains_offset + 1U]);
+            length += nr_of_trains * kBytesPerTrain;
+            length += FrameFormat_HasDelays(frame) ? (nr_of_trains * kBytesPerTrainDelay) : 0U;
+        }
+        else
+        {
+            // Truncated before the number of trains
+        }
+    }
+    return length;
+}
+
+#endif  // FRAME_FORMAT_H_
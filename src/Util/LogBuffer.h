@@ -0,0 +1,194 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef LOG_BUFFER_H_
+#define LOG_BUFFER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "etl/array.h"
+
+enum class LogLevel : uint8_t
+{
+    kError,
+    kWarn,
+    kInfo,
+    kDebug,
+};
+
+constexpr size_t kLogMaxArguments = 4U;
+
+/// @brief Token of a log message: FNV-1a hash of its format string, build/log_decoder.py computes the same from the sources
+constexpr uint32_t LogToken(const char* const format)
+{
+    uint32_t token = 2166136261U;
+    for (size_t i = 0U; '\0' != format[i]; i++)
+    {
+        token = (token ^ static_cast<uint8_t>(format[i])) * 16777619U;
+    }
+    return token;
+}
+
+/// @brief Log message sent as its token, the arguments of the format are sent in binary
+template <size_t kTextLength>
+struct LogRecord
+{
+    uint32_t time_ms;
+    uint32_t token;
+    LogLevel level;
+    uint8_t number_of_arguments;
+    uint32_t arguments[kLogMaxArguments];
+    char text[kTextLength];  // The string argument of the format, null terminated and truncated
+
+    template <typename T>
+    void AddArgument(const T argument)
+    {
+        if constexpr (std::is_convertible_v<T, const char*>)
+        {
+            SetText(argument);
+        }
+        else
+        {
+            static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "Only integers and one string can be logged");
+            if (number_of_arguments < kLogMaxArguments)
+            {
+                arguments[number_of_arguments] = static_cast<uint32_t>(argument);
+                number_of_arguments++;
+            }
+        }
+    }
+
+    void SetText(const char* const argument)
+    {
+        size_t i = 0U;
+        while ((nullptr != argument) && (i < (kTextLength - 1U)) && ('\0' != argument[i]))
+        {
+            text[i] = argument[i];
+            i++;
+        }
+        text[i] = '\0';
+    }
+};
+
+/// @brief Bounded lock-free queue of log records, any task can push, a single task pops
+///
+/// The writers reserve a slot by incrementing the write position, each slot has a sequence number telling whether it
+/// is free, written or read, see https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+template <size_t kLength, size_t kTextLength>
+class LogBuffer
+{
+    static_assert((kLength > 1U) && (0U == (kLength & (kLength - 1U))), "The positions wrap around, the length must be a power of two");
+    static_assert(kTextLength > 0U);
+
+  public:
+    using Record = LogRecord<kTextLength>;
+
+    LogBuffer()
+    {
+        for (size_t i = 0U; i < kLength; i++)
+        {
+            slots_[i].sequence.store(static_cast<uint32_t>(i), std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief Copy the record in a free slot, never waits for the reader
+    /// @return false if the buffer is full, the record is lost and counted
+    bool Push(const Record& record)
+    {
+        uint32_t position = write_position_.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        bool is_full = false;
+        while ((nullptr == slot) && !is_full)
+        {
+            Slot& candidate = slots_[position & (kLength - 1U)];
+            const auto distance = static_cast<int32_t>(candidate.sequence.load(std::memory_order_acquire) - position);
+            if (0 == distance)
+            {
+                if (write_position_.compare_exchange_weak(position, position + 1U, std::memory_order_relaxed))
+                {
+                    slot = &candidate;
+                }
+                else
+                {
+                    // Another writer took the slot, position was updated
+                }
+            }
+            else if (distance < 0)
+            {
+                // The reader did not free the slot yet
+                is_full = true;
+            }
+            else
+            {
+                position = write_position_.load(std::memory_order_relaxed);
+            }
+        }
+
+        if (is_full)
+        {
+            lost_records_.fetch_add(1U, std::memory_order_relaxed);
+        }
+        else
+        {
+            slot->record = record;
+            slot->sequence.store(position + 1U, std::memory_order_release);
+        }
+        return !is_full;
+    }
+
+    /// @brief Take the oldest record, only call this from one task
+    /// @return false if there is no record to read
+    bool Pop(Record& record)
+    {
+        Slot& slot = slots_[read_position_ & (kLength - 1U)];
+        const auto distance = static_cast<int32_t>(slot.sequence.load(std::memory_order_acquire) - (read_position_ + 1U));
+        const bool is_written = (distance >= 0);
+        if (is_written)
+        {
+            record = slot.record;
+            slot.sequence.store(read_position_ + kLength, std::memory_order_release);
+            read_position_++;
+        }
+        else
+        {
+            // Empty, or the writer that reserved the slot is still copying
+        }
+        return is_written;
+    }
+
+    /// @brief Number of records lost because the buffer was full, since the start
+    uint32_t GetLostRecords() const
+    {
+        return lost_records_.load(std::memory_order_relaxed);
+    }
+
+  private:
+    struct Slot
+    {
+        std::atomic<uint32_t> sequence{0U};
+        Record record{};
+    };
+
+    etl::array<Slot, kLength> slots_{};
+    std::atomic<uint32_t> write_position_{0U};
+    uint32_t read_position_{0U};  // Only used by the reader
+    std::atomic<uint32_t> lost_records_{0U};
+};
+
+#endif  // LOG_BUFFER_H_
@@ -0,0 +1,107 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Logging.h"
+
+#include "FwConfig.h"
+#include "LogBuffer.h"
+#include "OsWrapper.h"
+
+#include <Arduino.h>
+#include <cstring>
+
+// Frame of a record on the serial port, little endian:
+// marker, level, number of arguments, text length, time in ms (4 bytes), token (4 bytes), arguments (4 bytes each), text
+// The marker is not valid in text, so the frames can be mixed with the text printed on the serial port.
+constexpr uint8_t kFrameMarker = 0xFEU;
+constexpr size_t kFrameHeaderSize = 12U;
+constexpr size_t kMaxFrameSize = kFrameHeaderSize + (kLogMaxArguments * sizeof(uint32_t)) + kLogTextLength;
+
+static LogBuffer<kLogBufferLength, kLogTextLength> _log_buffer{};
+
+static size_t AppendWord(uint8_t* const frame, size_t index, const uint32_t word)
+{
+    for (size_t i = 0U; i < sizeof(uint32_t); i++)
+    {
+        frame[index] = static_cast<uint8_t>(word >> (8U * i));
+        index++;
+    }
+    return index;
+}
+
+static void SendRecord(const LoggingRecord& record)
+{
+    uint8_t frame[kMaxFrameSize];
+    const auto text_length = strnlen(record.text, kLogTextLength);
+    size_t index = 0U;
+    frame[index++] = kFrameMarker;
+    frame[index++] = static_cast<uint8_t>(record.level);
+    frame[index++] = record.number_of_arguments;
+    frame[index++] = static_cast<uint8_t>(text_length);
+    index = AppendWord(frame, index, record.time_ms);
+    index = AppendWord(frame, index, record.token);
+    for (size_t i = 0U; i < record.number_of_arguments; i++)
+    {
+        index = AppendWord(frame, index, record.arguments[i]);
+    }
+    for (size_t i = 0U; i < text_length; i++)
+    {
+        frame[index++] = static_cast<uint8_t>(record.text[i]);
+    }
+    Serial.write(frame, index);
+}
+
+static void LogTask(void*)
+{
+    uint32_t reported_lost_records = 0U;
+    LoggingRecord record{};
+    while (true)
+    {
+        while (_log_buffer.Pop(record))
+        {
+            SendRecord(record);
+        }
+
+        const auto lost_records = _log_buffer.GetLostRecords();
+        if (lost_records != reported_lost_records)
+        {
+            LOG_WARN("%u log records lost", lost_records - reported_lost_records);
+            reported_lost_records = lost_records;
+        }
+        OswTaskDelay(kLogDrainPeriodMilliSeconds);
+    }
+}
+
+void Logging_Init()
+{
+    static bool is_started = false;
+    if (!is_started)
+    {
+        is_started = true;
+        OswTaskCreate(LogTask, "Log Task", nullptr, kLogTaskStackSize, kLogTaskPriority);
+    }
+}
+
+void Logging_Write(LoggingRecord& record)
+{
+    record.time_ms = millis();
+    (void)_log_buffer.Push(record);
+}
+
+uint32_t Logging_GetLostRecords()
+{
+    return _log_buffer.GetLostRecords();
+}
@@ -17,8 +17,11 @@
 #ifndef LOGGING_H_
 #define LOGGING_H_
 
+// The log messages take a printf format string literal, followed by up to four integers and one string.
+
 #ifdef _WIN32
 #include <assert.h>
+#include <cstdio>
 #include <iostream>
 #include <source_location>
 static inline void ASSERT(bool condition, std::source_location location = std::source_location::current())
@@ -30,28 +33,109 @@ static inline void ASSERT(bool condition, std::source_location location = std::s
     }
     assert(condition);
 }
-static inline void LOG_ERROR(const char* msg, std::source_location location = std::source_location::current())
-{
-    std::cout << "[ERROR] : " << msg << " in file " << location.file_name() << ", line " << location.line() << std::endl;
-}
-static inline void LOG_WARN(const char* msg, std::source_location location = std::source_location::current())
-{
-    std::cout << "\033[93m"
-              << "[WARNING] : " << msg << " in file " << location.file_name() << ", line " << location.line() << "\033[0m" << std::endl;
-}
-static inline void LOG_INFO(const char* msg, std::source_location location = std::source_location::current())
+template <typename... Args>
+static inline void Logging_Print(const char* prefix, const char* suffix, const char* file, const int line, const char* format, Args... args)
 {
-    std::cout << "[INFO]    : " << msg << " in file " << location.file_name() << ", line " << location.line() << std::endl;
+    std::cout << std::flush;
+    std::printf("%s", prefix);
+    std::printf(format, args...);
+    std::printf(" in file %s, line %d%s\n", file, line, suffix);
+    std::fflush(stdout);
 }
-static inline void LOG_DEBUG(const char* msg)
+#define LOG_ERROR(...) Logging_Print("[ERROR] : ", "", __FILE__, __LINE__, __VA_ARGS__)
+#define LOG_WARN(...) Logging_Print("\033[93m[WARNING] : ", "\033[0m", __FILE__, __LINE__, __VA_ARGS__)
+#define LOG_INFO(...) Logging_Print("[INFO]    : ", "", __FILE__, __LINE__, __VA_ARGS__)
+#define LOG_DEBUG(...) Logging_Print("[DEBUG]   : ", "", __FILE__, __LINE__, __VA_ARGS__)
+#else
+#include <Arduino.h>
+
+#include "FwConfig.h"
+#include "LogBuffer.h"
+
+// The messages above the level of the module are not compiled, their arguments are not evaluated.
+// A module sets its level by defining LOGGING_MODULE_LEVEL before its first include, the build sets the default one.
+// The format strings are not in the firmware: the messages are sent as tokens, build/log_decoder.py prints them.
+#define LOGGING_LEVEL_NONE 0
+#define LOGGING_LEVEL_ERROR 1
+#define LOGGING_LEVEL_WARN 2
+#define LOGGING_LEVEL_INFO 3
+#define LOGGING_LEVEL_DEBUG 4
+
+#ifndef LOGGING_DEFAULT_LEVEL
+#define LOGGING_DEFAULT_LEVEL LOGGING_LEVEL_DEBUG
+#endif
+#ifndef LOGGING_MODULE_LEVEL
+#define LOGGING_MODULE_LEVEL LOGGING_DEFAULT_LEVEL
+#endif
+
+using LoggingRecord = LogRecord<kLogTextLength>;
+
+/// @brief Start the task sending the log records on the serial port, the records logged before are kept
+void Logging_Init();
+
+/// @brief Copy the record in the log buffer, it is sent later by the log task
+/// @note Never blocks: the record is lost and counted if the buffer is full
+void Logging_Write(LoggingRecord& record);
+
+/// @brief Number of messages lost because the log buffer was full
+uint32_t Logging_GetLostRecords();
+
+template <typename... Args>
+static inline void Logging_WriteToken(const LogLevel level, const uint32_t token, const Args... args)
 {
-    std::cout << "[DEBUG]   : " << msg << std::endl;
+    static_assert(sizeof...(Args) <= kLogMaxArguments, "Too many log arguments");
+    LoggingRecord record{};
+    record.level = level;
+    record.token = token;
+    (record.AddArgument(args), ...);
+    Logging_Write(record);
 }
+
+// The token is computed by the compiler, the "" only accepts string literals
+#define LOGGING_WRITE(level, format, ...)                             \
+    do                                                                \
+    {                                                                 \
+        constexpr uint32_t kLoggingToken = LogToken("" format);       \
+        Logging_WriteToken(level, kLoggingToken, ##__VA_ARGS__);      \
+    } while (0)
+
+#if LOGGING_MODULE_LEVEL >= LOGGING_LEVEL_ERROR
+#define LOG_ERROR(format, ...) LOGGING_WRITE(LogLevel::kError, format, ##__VA_ARGS__)
 #else
-#include <Arduino.h>
+#define LOG_ERROR(...) \
+    do                 \
+    {                  \
+    } while (0)
+#endif
+#if LOGGING_MODULE_LEVEL >= LOGGING_LEVEL_WARN
+#define LOG_WARN(format, ...) LOGGING_WRITE(LogLevel::kWarn, format, ##__VA_ARGS__)
+#else
+#define LOG_WARN(...) \
+    do                \
+    {                 \
+    } while (0)
+#endif
+#if LOGGING_MODULE_LEVEL >= LOGGING_LEVEL_INFO
+#define LOG_INFO(format, ...) LOGGING_WRITE(LogLevel::kInfo, format, ##__VA_ARGS__)
+#else
+#define LOG_INFO(...) \
+    do                \
+    {                 \
+    } while (0)
+#endif
+#if LOGGING_MODULE_LEVEL >= LOGGING_LEVEL_DEBUG
+#define LOG_DEBUG(format, ...) LOGGING_WRITE(LogLevel::kDebug, format, ##__VA_ARGS__)
+#else
+#define LOG_DEBUG(...) \
+    do                 \
+    {                  \
+    } while (0)
+#endif
+
 #define ASSERT(x) assert_func((x), __FILENAME__, __LINE__)
 static inline void assert_func(bool condition, const char* filename, const int line)
 {
+    // Printed right away as text, the log task may never run again
     if (!condition)
     {
         Serial.print("[ASSERT]  : File ");
@@ -60,26 +144,6 @@ static inline void assert_func(bool condition, const char* filename, const int l
         Serial.println(line);
     }
 }
-static inline void LOG_ERROR(const char* msg)
-{
-    Serial.print("[ERROR]   : ");
-    Serial.println(msg);
-}
-static inline void LOG_WARN(const char* msg)
-{
-    Serial.print("[WARN]    : ");
-    Serial.println(msg);
-}
-static inline void LOG_INFO(const char* msg)
-{
-    Serial.print("[INFO]    : ");
-    Serial.println(msg);
-}
-static inline void LOG_DEBUG(const char* msg)
-{
-    Serial.print("[DEBUG]   : ");
-    Serial.println(msg);
-}
 #endif
 
 #endif  // LOGGING_H_
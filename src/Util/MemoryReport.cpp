@@ -0,0 +1,77 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "MemoryReport.h"
+
+#include "FwConfig.h"
+#include "OsWrapper.h"
+
+#include "etl/string.h"
+#include "etl/to_string.h"
+
+using Line = etl::string<128>;
+
+static void PrintRegion(void (*print)(const char*), const char* const name, OswMemoryRegion region)
+{
+    const auto stats = OswMemoryGetStats(region);
+    Line line{name};
+    line.append(": total ");
+    etl::to_string(stats.total, line, true);
+    line.append(", free ");
+    etl::to_string(stats.free, line, true);
+    line.append(", min free ");
+    etl::to_string(stats.minimum_free, line, true);
+    line.append(", largest block ");
+    etl::to_string(stats.largest_block, line, true);
+    print(line.c_str());
+}
+
+static void PrintStack(void (*print)(const char*), const char* const name, uint32_t stack_size, uint32_t high_water_mark)
+{
+    Line line{"Stack "};
+    line.append(name);
+    line.append(": size ");
+    if (0U == stack_size)
+    {
+        line.append("?");
+    }
+    else
+    {
+        etl::to_string(stack_size, line, true);
+    }
+    line.append(", never used ");
+    etl::to_string(high_water_mark, line, true);
+    if (high_water_mark < kStackLowWaterMarkBytes)
+    {
+        line.append(" LOW");
+    }
+    print(line.c_str());
+}
+
+void MemoryReport_Print(void (*print)(const char*))
+{
+    PrintRegion(print, "Internal RAM", OswMemoryRegion::kInternal);
+    PrintRegion(print, "PSRAM", OswMemoryRegion::kExternal);
+
+    // The report is printed from the main loop, its stack size is set by the Arduino core
+    PrintStack(print, "Main loop", 0U, OswTaskGetHighWaterMark());
+    for (uint32_t i = 0U; i < OswTaskGetNumber(); i++)
+    {
+        const auto task = OswTaskGetInfo(i);
+        PrintStack(print, task.name, task.stack_size, task.stack_high_water_mark);
+    }
+}
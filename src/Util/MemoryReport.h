@@ -0,0 +1,30 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef MEMORY_REPORT_H_
+#define MEMORY_REPORT_H_
+
+#include <cstdint>
+
+/// @brief Print the memory usage at runtime, line by line
+/// @details Free size, smallest free size ever and largest free block of the internal RAM and of the PSRAM,
+/// and the stack high-water mark of the main loop and of every task created through the OS wrapper.
+/// The tasks with less than `kStackLowWaterMarkBytes` of stack left are flagged.
+/// The static usage of each module is reported at build time, see build/memory_report.py.
+void MemoryReport_Print(void (*print)(const char*));
+
+#endif  // MEMORY_REPORT_H_
@@ -17,25 +17,46 @@
 #include "OsWrapper.h"
 
 #include "Logging.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
 #include "semphr.h"
 
+#include "etl/vector.h"
+
 // OS wrapper port for ESP32 based on RTOS
 
-void OswTaskCreate(TaskFunc func, const char* const name, void* context, uint32_t stack_size, uint32_t priority)
+// clang-format off
+constexpr uint32_t kMaxTasks = 8U;
+// clang-format on
+
+struct TaskRecord
+{
+    TaskHandle_t handle;
+    const char* name;
+    uint32_t stack_size;
+};
+static etl::vector<TaskRecord, kMaxTasks> _tasks{};
+
+void OswTaskCreate(TaskFunc func, const char* const name, void* context, uint32_t stack_size, uint32_t priority, uint32_t core)
 {
     // Stack size, see https://www.freertos.org/a00125.html
 
-    BaseType_t result = xTaskCreate(func, name, stack_size, context, priority, nullptr);
+    TaskHandle_t handle = nullptr;
+    const BaseType_t core_id = (kOswNoAffinity == core) ? tskNO_AFFINITY : static_cast<BaseType_t>(core);
+    BaseType_t result = xTaskCreatePinnedToCore(func, name, stack_size, context, priority, &handle, core_id);
+    if ((pdPASS == result) && !_tasks.full())
+    {
+        _tasks.push_back({handle, name, stack_size});
+    }
 
     if (result != pdPASS)
     {
-        LOG_ERROR("Could not create task: ");
+        LOG_ERROR("Could not create task: %s", name);
     }
     else
     {
-        LOG_INFO("Task successfullly created: ");
+        LOG_INFO("Task successfullly created: %s", name);
     }
-    LOG_INFO(name);
 
     ASSERT(pdPASS == result);  // No point continuing if we could not create the task...
 }
@@ -48,6 +69,20 @@ void OswTaskDelay(uint32_t delay_ms)
 
 uint32_t OswTaskGetHighWaterMark() { return uxTaskGetStackHighWaterMark(NULL); }
 
+uint32_t OswGetMicroSeconds() { return static_cast<uint32_t>(esp_timer_get_time()); }
+
+uint32_t OswTaskGetNumber()
+{
+    return static_cast<uint32_t>(_tasks.size());
+}
+
+OswTaskInfo OswTaskGetInfo(uint32_t index)
+{
+    ASSERT(index < _tasks.size());
+    const auto& task = _tasks[index];
+    return {task.name, task.stack_size, uxTaskGetStackHighWaterMark(task.handle)};
+}
+
 void* OswMutexCreate()
 {
     auto mutex = xSemaphoreCreateMutex();
@@ -74,6 +109,31 @@ void OswMutexDelete(void* mutex)
     }
 }
 
+void* OswMemoryAllocate(uint32_t size, OswMemoryRegion region)
+{
+    void* memory = nullptr;
+    if (OswMemoryRegion::kExternal == region)
+    {
+        memory = heap_caps_calloc(1U, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (nullptr == memory)
+        {
+            LOG_WARN("No PSRAM available, using the internal RAM");
+        }
+    }
+    if (nullptr == memory)
+    {
+        memory = heap_caps_calloc(1U, size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+    ASSERT(nullptr != memory);  // No point continuing without the memory...
+    return memory;
+}
+
+OswMemoryStats OswMemoryGetStats(OswMemoryRegion region)
+{
+    const uint32_t caps = (OswMemoryRegion::kExternal == region) ? MALLOC_CAP_SPIRAM : (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    return {heap_caps_get_total_size(caps), heap_caps_get_free_size(caps), heap_caps_get_minimum_free_size(caps), heap_caps_get_largest_free_block(caps)};
+}
+
 void* OswQueueCreate(uint32_t length, uint32_t item_size)
 {
     auto handle = xQueueCreate(length, item_size);
@@ -22,16 +22,45 @@ using TaskFunc = void (*)(void*);
 
 constexpr uint32_t kOsMaxDelayQueuePut = 20U;
 constexpr uint32_t kOsMaxDelayQueueGet = 0x7FFFFFFFU;
+constexpr uint32_t kOswNoAffinity = 0xFFFFFFFFU;  // The task runs on any core
 
-void OswTaskCreate(TaskFunc func, const char* const name, void* context, uint32_t stack_size, uint32_t priority = 1U);
+void OswTaskCreate(TaskFunc func, const char* const name, void* context, uint32_t stack_size, uint32_t priority = 1U, uint32_t core = kOswNoAffinity);
 void OswTaskDelay(uint32_t delay_ms);
-uint32_t OswTaskGetHighWaterMark();
+uint32_t OswTaskGetHighWaterMark();  // Of the calling task
+uint32_t OswGetMicroSeconds();       // Since start-up, wraps around after about 71 minutes
+
+// Tasks created with OswTaskCreate, for the memory report
+struct OswTaskInfo
+{
+    const char* name;
+    uint32_t stack_size;
+    uint32_t stack_high_water_mark;  // Smallest free stack space ever
+};
+uint32_t OswTaskGetNumber();
+OswTaskInfo OswTaskGetInfo(uint32_t index);
 
 void* OswMutexCreate();
 bool OswMutexGet(void* mutex, uint32_t ticks_to_wait);
 void OswMutexRelease(void* mutex);
 void OswMutexDelete(void* mutex);
 
+// Memory placement, the allocations are never freed
+enum class OswMemoryRegion
+{
+    kInternal,  // Internal SRAM, fast, for the buffers used on every frame
+    kExternal   // PSRAM if available, for the bulk storage. Falls back to the internal SRAM
+};
+void* OswMemoryAllocate(uint32_t size, OswMemoryRegion region);
+
+struct OswMemoryStats
+{
+    uint32_t total;
+    uint32_t free;
+    uint32_t minimum_free;   // Smallest free size ever
+    uint32_t largest_block;  // Largest block that can be allocated, tells the fragmentation
+};
+OswMemoryStats OswMemoryGetStats(OswMemoryRegion region);  // All zero if the region does not exist
+
 // Never call these function from an ISR!!
 void* OswQueueCreate(uint32_t length, uint32_t item_size);
 void OswQueuePut(void* handle, const void* item, uint32_t timeout = kOsMaxDelayQueuePut);
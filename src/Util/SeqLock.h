@@ -0,0 +1,123 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef SEQ_LOCK_H_
+#define SEQ_LOCK_H_
+
+#include <atomic>
+#include <cstdint>
+
+// Publication of data from one writer task to any number of reader tasks, without lock on the read path.
+// The readers copy the data between two loads of a sequence number, and copy it again if the writer
+// changed it in the meantime. The copy may be torn, it is only used once validated: a reader must not
+// follow a pointer or an index read from the data without checking its range first.
+
+/// @brief Sequence number of data changed in place, odd while the writer changes it
+class SeqLock
+{
+  public:
+    void BeginWrite()
+    {
+        sequence_.store(sequence_.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    void EndWrite()
+    {
+        sequence_.store(sequence_.load(std::memory_order_relaxed) + 1U, std::memory_order_release);
+    }
+
+    /// @brief Call `copy` until it copied data that no write changed
+    /// @return `false` if the data was changed during each of the `max_attempts` copies
+    template<typename TCopy>
+    bool Read(uint32_t max_attempts, TCopy&& copy) const
+    {
+        bool is_consistent = false;
+        for (auto attempt = 0U; (attempt < max_attempts) && !is_consistent; attempt++)
+        {
+            const auto sequence = sequence_.load(std::memory_order_acquire);
+            if (0U == (sequence & 1U))
+            {
+                copy();
+                std::atomic_thread_fence(std::memory_order_acquire);
+                is_consistent = (sequence_.load(std::memory_order_relaxed) == sequence);
+            }
+            else
+            {
+                // Being written, try again
+            }
+        }
+        return is_consistent;
+    }
+
+  private:
+    std::atomic<uint32_t> sequence_{0U};
+};
+
+/// @brief Data published as a whole: the writer fills the bank that is not published, then publishes it
+/// @details The sequence number is odd while the writer fills the next bank, the readers keep reading
+/// the published bank meanwhile. A copy is only retried if the writer published twice during the copy.
+template<typename T>
+class SeqLockBuffer
+{
+  public:
+    /// @param banks Two elements, e.g. allocated in the external RAM
+    void Init(T* banks)
+    {
+        banks_ = banks;
+    }
+
+    /// @brief Start filling the bank that is not published, EndWrite publishes it
+    T& BeginWrite()
+    {
+        const auto sequence = sequence_.load(std::memory_order_relaxed) + 1U;
+        sequence_.store(sequence, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        return banks_[GetBank(sequence + 1U)];
+    }
+
+    void EndWrite()
+    {
+        sequence_.store(sequence_.load(std::memory_order_relaxed) + 1U, std::memory_order_release);
+    }
+
+    /// @brief Call `copy` with the published bank until it copied a bank that no write changed
+    /// @return `false` if the bank was changed during each of the `max_attempts` copies
+    template<typename TCopy>
+    bool Read(uint32_t max_attempts, TCopy&& copy) const
+    {
+        bool is_consistent = false;
+        for (auto attempt = 0U; (attempt < max_attempts) && !is_consistent; attempt++)
+        {
+            const auto sequence = sequence_.load(std::memory_order_acquire);
+            copy(static_cast<const T&>(banks_[GetBank(sequence)]));
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            // The bank read is written again from the sequence number of its next publication plus one
+            const auto published_sequence = sequence & ~1U;
+            is_consistent = ((sequence_.load(std::memory_order_relaxed) - published_sequence) < 3U);
+        }
+        return is_consistent;
+    }
+
+  private:
+    std::atomic<uint32_t> sequence_{0U};
+    T* banks_{nullptr};
+
+    static uint32_t GetBank(uint32_t sequence) { return (sequence >> 1U) & 1U; }
+};
+
+#endif  // SEQ_LOCK_H_
@@ -0,0 +1,144 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "Sha256.h"
+
+static constexpr uint32_t kRoundConstants[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+static inline uint32_t RotateRight(uint32_t value, uint32_t n)
+{
+    return (value >> n) | (value << (32U - n));
+}
+
+void Sha256::Init()
+{
+    state_ = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+    block_length_ = 0U;
+    total_length_ = 0U;
+}
+
+void Sha256::Update(const uint8_t* data, uint32_t length)
+{
+    total_length_ += length;
+    for (uint32_t i = 0U; i < length; i++)
+    {
+        block_[block_length_] = data[i];
+        block_length_++;
+        if (block_length_ == block_.size())
+        {
+            ProcessBlock(block_.data());
+            block_length_ = 0U;
+        }
+    }
+}
+
+Sha256::Digest Sha256::Finish()
+{
+    const uint64_t length_in_bits = total_length_ * 8U;
+
+    // Padding: a single 1 bit, zeros, and the message length on the last 8 bytes
+    block_[block_length_] = 0x80;
+    block_length_++;
+    if (block_length_ > (block_.size() - 8U))
+    {
+        while (block_length_ < block_.size())
+        {
+            block_[block_length_] = 0U;
+            block_length_++;
+        }
+        ProcessBlock(block_.data());
+        block_length_ = 0U;
+    }
+    while (block_length_ < (block_.size() - 8U))
+    {
+        block_[block_length_] = 0U;
+        block_length_++;
+    }
+    for (uint32_t i = 0U; i < 8U; i++)
+    {
+        block_[block_.size() - 1U - i] = static_cast<uint8_t>(length_in_bits >> (8U * i));
+    }
+    ProcessBlock(block_.data());
+
+    Digest digest{};
+    for (uint32_t i = 0U; i < state_.size(); i++)
+    {
+        digest[(4U * i) + 0U] = static_cast<uint8_t>(state_[i] >> 24);
+        digest[(4U * i) + 1U] = static_cast<uint8_t>(state_[i] >> 16);
+        digest[(4U * i) + 2U] = static_cast<uint8_t>(state_[i] >> 8);
+        digest[(4U * i) + 3U] = static_cast<uint8_t>(state_[i]);
+    }
+    return digest;
+}
+
+void Sha256::ProcessBlock(const uint8_t* block)
+{
+    uint32_t w[64];
+    for (uint32_t i = 0U; i < 16U; i++)
+    {
+        w[i] = (static_cast<uint32_t>(block[4U * i]) << 24) | (static_cast<uint32_t>(block[(4U * i) + 1U]) << 16) |
+               (static_cast<uint32_t>(block[(4U * i) + 2U]) << 8) | static_cast<uint32_t>(block[(4U * i) + 3U]);
+    }
+    for (uint32_t i = 16U; i < 64U; i++)
+    {
+        const uint32_t s0 = RotateRight(w[i - 15U], 7) ^ RotateRight(w[i - 15U], 18) ^ (w[i - 15U] >> 3);
+        const uint32_t s1 = RotateRight(w[i - 2U], 17) ^ RotateRight(w[i - 2U], 19) ^ (w[i - 2U] >> 10);
+        w[i] = w[i - 16U] + s0 + w[i - 7U] + s1;
+    }
+
+    uint32_t a = state_[0];
+    uint32_t b = state_[1];
+    uint32_t c = state_[2];
+    uint32_t d = state_[3];
+    uint32_t e = state_[4];
+    uint32_t f = state_[5];
+    uint32_t g = state_[6];
+    uint32_t h = state_[7];
+    for (uint32_t i = 0U; i < 64U; i++)
+    {
+        const uint32_t s1 = RotateRight(e, 6) ^ RotateRight(e, 11) ^ RotateRight(e, 25);
+        const uint32_t choice = (e & f) ^ (~e & g);
+        const uint32_t temp1 = h + s1 + choice + kRoundConstants[i] + w[i];
+        const uint32_t s0 = RotateRight(a, 2) ^ RotateRight(a, 13) ^ RotateRight(a, 22);
+        const uint32_t majority = (a & b) ^ (a & c) ^ (b & c);
+        const uint32_t temp2 = s0 + majority;
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + temp2;
+    }
+    state_[0] += a;
+    state_[1] += b;
+    state_[2] += c;
+    state_[3] += d;
+    state_[4] += e;
+    state_[5] += f;
+    state_[6] += g;
+    state_[7] += h;
+}
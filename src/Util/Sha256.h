@@ -0,0 +1,52 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef SHA256_H_
+#define SHA256_H_
+
+#include <cstdint>
+
+#include "etl/array.h"
+
+/// @brief Incremental SHA-256 (FIPS 180-4), to hash data that does not fit in memory
+class Sha256
+{
+  public:
+    static constexpr uint32_t kDigestSize = 32U;
+    using Digest = etl::array<uint8_t, kDigestSize>;
+
+    Sha256() { Init(); }
+
+    /// @brief Start a new hash
+    void Init();
+
+    /// @brief Hash the next chunk of data
+    void Update(const uint8_t* data, uint32_t length);
+
+    /// @brief Get the hash of all data passed since `Init`, the object must be initialized again afterwards
+    Digest Finish();
+
+  private:
+    void ProcessBlock(const uint8_t* block);
+
+    etl::array<uint32_t, 8> state_{};
+    etl::array<uint8_t, 64> block_{};
+    uint32_t block_length_{0U};
+    uint64_t total_length_{0U};
+};
+
+#endif  // SHA256_H_
@@ -0,0 +1,54 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "StagingArena.h"
+
+#include "Logging.h"
+#include "OsWrapper.h"
+
+void StagingArena::Init()
+{
+    if (nullptr == memory_)
+    {
+        memory_ = static_cast<uint8_t*>(OswMemoryAllocate(size_, OswMemoryRegion::kExternal));
+    }
+}
+
+uint8_t* StagingArena::Acquire(const void* const owner)
+{
+    ASSERT(nullptr != memory_);
+
+    uint8_t* memory = nullptr;
+    if ((nullptr == owner_) || (owner == owner_))
+    {
+        owner_ = owner;
+        memory = memory_;
+    }
+    else
+    {
+        LOG_ERROR("Staging arena already held by another owner");
+    }
+    return memory;
+}
+
+void StagingArena::Release(const void* const owner)
+{
+    if (owner == owner_)
+    {
+        owner_ = nullptr;
+    }
+}
@@ -0,0 +1,50 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef STAGING_ARENA_H_
+#define STAGING_ARENA_H_
+
+#include <cstdint>
+
+/// @brief Buffer shared by the states to stage the frames received from the server before they are stored or shown
+/// @details Only one owner can hold the buffer at a time, the states acquire it when entered and release it when exited.
+/// It lives in the external RAM, so that the internal RAM is left for the TLS connections and the render buffers.
+class StagingArena
+{
+  public:
+    explicit StagingArena(uint32_t size) : size_(size) {}
+
+    /// @brief Allocate the buffer, only call this after the kernel was initialized
+    void Init();
+
+    /// @brief Get the buffer for the given owner
+    /// @return `nullptr` if another owner holds the buffer
+    uint8_t* Acquire(const void* const owner);
+
+    /// @brief Give the buffer back, nothing happens if the owner does not hold it
+    void Release(const void* const owner);
+
+    uint32_t GetSize() const { return size_; }
+    bool IsHeld() const { return nullptr != owner_; }
+
+  private:
+    const uint32_t size_;
+    uint8_t* memory_{nullptr};
+    const void* owner_{nullptr};
+};
+
+#endif  // STAGING_ARENA_H_
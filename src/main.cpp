@@ -25,6 +25,7 @@ void setup()
     static uint32_t restart_cnt = 0;
 
     Serial.begin(115200);
+    Logging_Init();
     delay(500);
 
     const auto is_app_initialized = Application_Init();
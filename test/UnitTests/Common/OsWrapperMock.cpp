@@ -1,8 +1,11 @@
 #include "OsWrapper.h"
 
-void OswTaskCreate(TaskFunc, const char* const, void*, uint32_t, uint32_t) {}
+void OswTaskCreate(TaskFunc, const char* const, void*, uint32_t, uint32_t, uint32_t) {}
 void OswTaskDelay(uint32_t) {}
 uint32_t OswTaskGetHighWaterMark() { return 0; }
+uint32_t OswGetMicroSeconds() { return 0; }
+uint32_t OswTaskGetNumber() { return 0; }
+OswTaskInfo OswTaskGetInfo(uint32_t) { return {"", 0, 0}; }
 
 struct MockMutex
 {
@@ -26,6 +29,13 @@ void OswMutexDelete(void* mutex)
     }
 }
 
+void* OswMemoryAllocate(uint32_t size, OswMemoryRegion)
+{
+    return static_cast<void*>(new uint8_t[size]{});  // Never freed, as on the target
+}
+
+OswMemoryStats OswMemoryGetStats(OswMemoryRegion) { return {0, 0, 0, 0}; }
+
 // Never call these function from an ISR!!
 void* OswQueueCreate(uint32_t, uint32_t) { return nullptr; }
 void OswQueuePut(void*, const void*, uint32_t) {}
@@ -0,0 +1,97 @@
+#include "OsWrapper.h"
+
+#include "Logging.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// OS wrapper port for the host based on the standard threads, to run the tasks for real in the tests.
+// The tasks are never deleted, as on the target. The ticks are milliseconds.
+
+static std::chrono::milliseconds ToDuration(uint32_t ticks)
+{
+    return std::chrono::milliseconds(ticks);
+}
+
+void OswTaskCreate(TaskFunc func, const char* const, void* context, uint32_t, uint32_t, uint32_t)
+{
+    std::thread(func, context).detach();
+}
+void OswTaskDelay(uint32_t delay_ms)
+{
+    std::this_thread::sleep_for(ToDuration(delay_ms));
+}
+uint32_t OswTaskGetHighWaterMark() { return 0; }
+uint32_t OswGetMicroSeconds()
+{
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(now).count());
+}
+uint32_t OswTaskGetNumber() { return 0; }
+OswTaskInfo OswTaskGetInfo(uint32_t) { return {"", 0, 0}; }
+
+void* OswMutexCreate()
+{
+    return static_cast<void*>(new std::timed_mutex());
+}
+bool OswMutexGet(void* mutex, uint32_t ticks_to_wait)
+{
+    return static_cast<std::timed_mutex*>(mutex)->try_lock_for(ToDuration(ticks_to_wait));
+}
+void OswMutexRelease(void* mutex)
+{
+    static_cast<std::timed_mutex*>(mutex)->unlock();
+}
+void OswMutexDelete(void* mutex)
+{
+    delete static_cast<std::timed_mutex*>(mutex);
+}
+
+void* OswMemoryAllocate(uint32_t size, OswMemoryRegion)
+{
+    return static_cast<void*>(new uint8_t[size]{});  // Never freed, as on the target
+}
+
+OswMemoryStats OswMemoryGetStats(OswMemoryRegion) { return {0, 0, 0, 0}; }
+
+struct ThreadQueue
+{
+    uint32_t length;
+    uint32_t item_size;
+    std::deque<std::vector<uint8_t>> items;
+    std::mutex mutex;
+    std::condition_variable changed;
+};
+
+void* OswQueueCreate(uint32_t length, uint32_t item_size)
+{
+    return static_cast<void*>(new ThreadQueue{length, item_size, {}, {}, {}});
+}
+void OswQueuePut(void* handle, const void* item, uint32_t timeout)
+{
+    auto& queue = *static_cast<ThreadQueue*>(handle);
+    std::unique_lock<std::mutex> lock(queue.mutex);
+    const auto has_room = queue.changed.wait_for(lock, ToDuration(timeout), [&queue] { return queue.items.size() < queue.length; });
+    ASSERT(has_room);
+    const auto* bytes = static_cast<const uint8_t*>(item);
+    queue.items.emplace_back(bytes, bytes + queue.item_size);
+    queue.changed.notify_all();
+}
+bool OswQueueGet(void* handle, void* item, uint32_t timeout)
+{
+    auto& queue = *static_cast<ThreadQueue*>(handle);
+    std::unique_lock<std::mutex> lock(queue.mutex);
+    const auto has_item = queue.changed.wait_for(lock, ToDuration(timeout), [&queue] { return !queue.items.empty(); });
+    if (has_item)
+    {
+        std::memcpy(item, queue.items.front().data(), queue.item_size);
+        queue.items.pop_front();
+        queue.changed.notify_all();
+    }
+    return has_item;
+}
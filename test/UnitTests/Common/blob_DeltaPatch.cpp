@@ -0,0 +1,1595 @@
+#include "blob_DeltaPatch.hpp"
+
+// clang-format off
+const std::array<uint8_t, 1613> delta_source = {
+    0x48, 0xB8, 0x67, 0xE6, 0x09, 0x6A, 0x85, 0xAE, 0x67, 0xBB, 0x31, 0xD2, 0x48, 0x89, 0x07, 0x48,
+    0xB8, 0x72, 0xF3, 0x6E, 0x3C, 0x3A, 0xF5, 0x4F, 0xA5, 0x48, 0x89, 0x47, 0x08, 0x48, 0xB8, 0x7F,
+    0x52, 0x0E, 0x51, 0x8C, 0x68, 0x05, 0x9B, 0x48, 0x89, 0x47, 0x10, 0x48, 0xB8, 0xAB, 0xD9, 0x83,
+    0x1F, 0x19, 0xCD, 0xE0, 0x5B, 0x48, 0x89, 0x47, 0x18, 0x31, 0xC0, 0x89, 0x47, 0x60, 0x48, 0x89,
+    0x57, 0x68, 0xC3, 0x90, 0x41, 0x57, 0x48, 0x89, 0xF8, 0x31, 0xFF, 0x41, 0x56, 0x41, 0x55, 0x41,
+    0x54, 0x55, 0x53, 0x48, 0x81, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x0C, 0x3E, 0x44, 0x0F,
+    0xB6, 0x44, 0x3E, 0x01, 0x48, 0x8D, 0x54, 0x24, 0xA8, 0x41, 0xC1, 0xE0, 0x10, 0xC1, 0xE1, 0x18,
+    0x44, 0x09, 0xC1, 0x44, 0x0F, 0xB6, 0x44, 0x3E, 0x03, 0x44, 0x09, 0xC1, 0x44, 0x0F, 0xB6, 0x44,
+    0x3E, 0x02, 0x41, 0xC1, 0xE0, 0x08, 0x44, 0x09, 0xC1, 0x89, 0x4C, 0x3C, 0xA8, 0x48, 0x83, 0xC7,
+    0x04, 0x48, 0x83, 0xFF, 0x40, 0x75, 0xC3, 0x4C, 0x8D, 0x44, 0x24, 0x68, 0x8B, 0x72, 0x04, 0x8B,
+    0x7A, 0x38, 0x48, 0x83, 0xC2, 0x04, 0x89, 0xF1, 0x41, 0x89, 0xF1, 0xC1, 0xEE, 0x03, 0x41, 0xC1,
+    0xC1, 0x0E, 0xC1, 0xC9, 0x07, 0x44, 0x31, 0xC9, 0x41, 0x89, 0xF9, 0x31, 0xF1, 0x8B, 0x72, 0x20,
+    0x03, 0x72, 0xFC, 0x41, 0xC1, 0xC1, 0x0D, 0x01, 0xF1, 0x89, 0xFE, 0xC1, 0xEF, 0x0A, 0xC1, 0xC6,
+    0x0F, 0x44, 0x31, 0xCE, 0x31, 0xFE, 0x01, 0xF1, 0x89, 0x4A, 0x3C, 0x49, 0x39, 0xD0, 0x75, 0xBC,
+    0x8B, 0x58, 0x04, 0x44, 0x8B, 0x20, 0x45, 0x31, 0xD2, 0x4C, 0x8D, 0x35, 0x00, 0x00, 0x00, 0x00,
+    0x89, 0x5C, 0x24, 0x8C, 0x8B, 0x58, 0x08, 0x44, 0x89, 0xE7, 0x44, 0x8B, 0x4C, 0x24, 0x8C, 0x89,
+    0x5C, 0x24, 0x90, 0x8B, 0x58, 0x0C, 0x44, 0x8B, 0x44, 0x24, 0x90, 0x89, 0x5C, 0x24, 0x94, 0x8B,
+    0x58, 0x10, 0x44, 0x8B, 0x6C, 0x24, 0x94, 0x89, 0x5C, 0x24, 0x98, 0x8B, 0x58, 0x14, 0x8B, 0x74,
+    0x24, 0x98, 0x89, 0x5C, 0x24, 0x9C, 0x8B, 0x58, 0x18, 0x8B, 0x6C, 0x24, 0x9C, 0x89, 0x5C, 0x24,
+    0xA0, 0x8B, 0x58, 0x1C, 0x89, 0x5C, 0x24, 0xA4, 0x41, 0x89, 0xDB, 0x8B, 0x5C, 0x24, 0xA0, 0x89,
+    0xF1, 0x89, 0xF2, 0x41, 0x89, 0xF7, 0xC1, 0xC9, 0x06, 0xC1, 0xCA, 0x0B, 0x41, 0x21, 0xEF, 0x31,
+    0xCA, 0x89, 0xF1, 0xC1, 0xC1, 0x07, 0x31, 0xCA, 0x42, 0x8B, 0x4C, 0x14, 0xA8, 0x43, 0x03, 0x0C,
+    0x16, 0x49, 0x83, 0xC2, 0x04, 0x01, 0xCA, 0x89, 0xF1, 0xF7, 0xD1, 0x21, 0xD9, 0x44, 0x31, 0xF9,
+    0x45, 0x89, 0xCF, 0x01, 0xCA, 0x89, 0xF9, 0x45, 0x21, 0xC7, 0x44, 0x01, 0xDA, 0x41, 0x89, 0xFB,
+    0xC1, 0xC9, 0x02, 0x41, 0xC1, 0xCB, 0x0D, 0x41, 0x31, 0xCB, 0x89, 0xF9, 0xC1, 0xC1, 0x0A, 0x41,
+    0x31, 0xCB, 0x44, 0x89, 0xC9, 0x44, 0x31, 0xC1, 0x21, 0xF9, 0x44, 0x31, 0xF9, 0x46, 0x8D, 0x3C,
+    0x2A, 0x45, 0x89, 0xC5, 0x44, 0x01, 0xD9, 0x41, 0x89, 0xDB, 0x01, 0xD1, 0x49, 0x81, 0xFA, 0x00,
+    0x01, 0x00, 0x00, 0x74, 0x14, 0x89, 0xEB, 0x45, 0x89, 0xC8, 0x89, 0xF5, 0x41, 0x89, 0xF9, 0x44,
+    0x89, 0xFE, 0x89, 0xCF, 0xE9, 0x76, 0xFF, 0xFF, 0xFF, 0x8B, 0x54, 0x24, 0x8C, 0x41, 0x01, 0xCC,
+    0x44, 0x89, 0x20, 0x01, 0xFA, 0x89, 0x50, 0x04, 0x8B, 0x54, 0x24, 0x90, 0x44, 0x01, 0xCA, 0x89,
+    0x50, 0x08, 0x8B, 0x54, 0x24, 0x94, 0x44, 0x01, 0xC2, 0x89, 0x50, 0x0C, 0x8B, 0x54, 0x24, 0x98,
+    0x44, 0x01, 0xFA, 0x89, 0x50, 0x10, 0x8B, 0x54, 0x24, 0x9C, 0x01, 0xF2, 0x89, 0x50, 0x14, 0x8B,
+    0x54, 0x24, 0xA0, 0x01, 0xEA, 0x89, 0x50, 0x18, 0x8B, 0x54, 0x24, 0xA4, 0x01, 0xDA, 0x89, 0x50,
+    0x1C, 0x48, 0x81, 0xC4, 0xA8, 0x00, 0x00, 0x00, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0x41, 0x5E,
+    0x41, 0x5F, 0xC3, 0x90, 0x41, 0x55, 0x89, 0xD2, 0x4C, 0x8D, 0x6F, 0x20, 0x41, 0x54, 0x4C, 0x8D,
+    0x24, 0x16, 0x55, 0x48, 0x89, 0xF5, 0x53, 0x48, 0x89, 0xFB, 0x48, 0x01, 0x57, 0x68, 0x4C, 0x39,
+    0xE5, 0x74, 0x2C, 0x8B, 0x43, 0x60, 0x8A, 0x55, 0x00, 0x88, 0x54, 0x03, 0x20, 0x8B, 0x43, 0x60,
+    0xFF, 0xC0, 0x89, 0x43, 0x60, 0x83, 0xF8, 0x40, 0x75, 0x10, 0x4C, 0x89, 0xEE, 0x48, 0x89, 0xDF,
+    0xE8, 0x00, 0x00, 0x00, 0x00, 0x31, 0xC0, 0x89, 0x43, 0x60, 0x48, 0xFF, 0xC5, 0xEB, 0xCF, 0x5B,
+    0x5D, 0x41, 0x5C, 0x41, 0x5D, 0xC3, 0x41, 0x54, 0x55, 0x48, 0x89, 0xFD, 0x53, 0x48, 0x8B, 0x46,
+    0x68, 0x48, 0x89, 0xF3, 0x4C, 0x8D, 0x24, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x46, 0x60, 0xC6,
+    0x44, 0x06, 0x20, 0x80, 0x8B, 0x46, 0x60, 0xFF, 0xC0, 0x89, 0x46, 0x60, 0x83, 0xF8, 0x38, 0x76,
+    0x23, 0x8B, 0x53, 0x60, 0x83, 0xFA, 0x3F, 0x77, 0x0A, 0xC6, 0x44, 0x13, 0x20, 0x00, 0xFF, 0x43,
+    0x60, 0xEB, 0xEE, 0x48, 0x8D, 0x73, 0x20, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x31,
+    0xC0, 0x89, 0x43, 0x60, 0x8B, 0x53, 0x60, 0x83, 0xFA, 0x37, 0x77, 0x0A, 0xC6, 0x44, 0x13, 0x20,
+    0x00, 0xFF, 0x43, 0x60, 0xEB, 0xEE, 0x31, 0xC0, 0x6B, 0xC8, 0xF8, 0x4C, 0x89, 0xE2, 0x48, 0xD3,
+    0xEA, 0x88, 0x54, 0x03, 0x5F, 0x48, 0xFF, 0xC8, 0x48, 0x83, 0xF8, 0xF8, 0x75, 0xEA, 0x48, 0x89,
+    0xDF, 0x48, 0x8D, 0x73, 0x20, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x31, 0xC0, 0xB9, 0x08, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0xEF, 0xF3, 0xAB, 0x48, 0x89, 0xE8, 0x31, 0xFF, 0x8B, 0x0C, 0x3B, 0x48, 0x83,
+    0xC7, 0x04, 0x48, 0x83, 0xC0, 0x04, 0x89, 0xCE, 0x88, 0x68, 0xFE, 0xC1, 0xEE, 0x18, 0x88, 0x48,
+    0xFF, 0x40, 0x88, 0x70, 0xFC, 0x89, 0xCE, 0xC1, 0xEE, 0x10, 0x40, 0x88, 0x70, 0xFD, 0x48, 0x83,
+    0xFF, 0x20, 0x75, 0xD7, 0x48, 0x89, 0xE8, 0x5B, 0x5D, 0x41, 0x5C, 0xC3, 0x48, 0x8B, 0x47, 0x30,
+    0x31, 0xD2, 0x48, 0x89, 0x57, 0x38, 0xC6, 0x00, 0x00, 0x80, 0x7F, 0x54, 0x00, 0x74, 0x04, 0xC6,
+    0x47, 0x54, 0x00, 0x31, 0xC0, 0x66, 0xC7, 0x47, 0x60, 0x00, 0x01, 0x48, 0x89, 0x47, 0x58, 0xC3,
+    0x48, 0x8B, 0x47, 0x08, 0x31, 0xD2, 0x31, 0xC9, 0x89, 0x17, 0x48, 0x89, 0x4F, 0x10, 0xC6, 0x00,
+    0x00, 0x83, 0x7F, 0x58, 0x00, 0x74, 0x08, 0x31, 0xC0, 0x89, 0x87, 0x00, 0x08, 0x00, 0x00, 0xEB,
+    0xBB, 0x90, 0x55, 0x53, 0x48, 0x89, 0xFB, 0x51, 0x40, 0x8A, 0x6F, 0x61, 0x40, 0x84, 0xED, 0x75,
+    0x04, 0x31, 0xED, 0xEB, 0x2C, 0x48, 0x8D, 0x7F, 0x30, 0x48, 0x8D, 0x35, 0x00, 0x00, 0x00, 0x00,
+    0xE8, 0x00, 0x00, 0x00, 0x00, 0x85, 0xC0, 0x75, 0xE8, 0x8B, 0x43, 0x58, 0x85, 0xC0, 0x74, 0xE1,
+    0x89, 0x83, 0x00, 0x08, 0x00, 0x00, 0x48, 0x8B, 0x43, 0x50, 0x48, 0x89, 0x83, 0x04, 0x08, 0x00,
+    0x00, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x89, 0xE8, 0x5A, 0x5B, 0x5D, 0xC3, 0x90,
+    0x55, 0x48, 0x8D, 0x6F, 0x08, 0x53, 0x48, 0x89, 0xFB, 0x56, 0x48, 0x8D, 0x35, 0x00, 0x00, 0x00,
+    0x00, 0xC6, 0x47, 0x28, 0x01, 0x48, 0x89, 0xEF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x85, 0xC0, 0x75,
+    0x14, 0x48, 0x8B, 0x43, 0x30, 0x31, 0xC9, 0x48, 0x89, 0x4B, 0x38, 0xC6, 0x00, 0x00, 0xB8, 0x02,
+    0x00, 0x00, 0x00, 0xEB, 0x3C, 0x48, 0x8D, 0x35, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xEF, 0xE8,
+    0x00, 0x00, 0x00, 0x00, 0x85, 0xC0, 0x75, 0x10, 0x31, 0xD2, 0xC6, 0x43, 0x54, 0x01, 0xB8, 0x03,
+    0x00, 0x00, 0x00, 0x89, 0x53, 0x50, 0xEB, 0x19, 0x48, 0x8D, 0x35, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0xEF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x83, 0xF8, 0x01, 0x19, 0xC0, 0x83, 0xE0, 0x03, 0xFF,
+    0xC0, 0x89, 0x03, 0x58, 0x5B, 0x5D, 0xC3, 0x90, 0x53, 0x8D, 0x56, 0xBF, 0x48, 0x89, 0xFB, 0x0F,
+    0xB6, 0xC2, 0x48, 0x83, 0xEC, 0x40, 0x80, 0xFA, 0x19, 0x76, 0x43, 0x8D, 0x46, 0x9F, 0x8D, 0x4E,
+    0xB9, 0x3C, 0x19, 0x76, 0x0A, 0x8D, 0x46, 0xD0, 0x3C, 0x09, 0x77, 0x07, 0x8D, 0x4E, 0x04, 0xB2,
+    0x01, 0xEB, 0x1A, 0xB8, 0x3E, 0x00, 0x00, 0x00, 0x40, 0x80, 0xFE, 0x2B, 0x74, 0x20, 0xB8, 0x3F,
+    0x00, 0x00, 0x00, 0x40, 0x80, 0xFE, 0x2F, 0x74, 0x15, 0x31, 0xD2, 0x31, 0xC9, 0x0F, 0xB6, 0xC1,
+    0x88, 0xD4, 0x89, 0xC7, 0x66, 0xC1, 0xEF, 0x08, 0x0F, 0x84, 0x89, 0x00, 0x00, 0x00, 0x8B, 0x73,
+    0x58, 0x85, 0xF6, 0x75, 0x08, 0x31, 0xD2, 0x89, 0x93, 0x00, 0x08, 0x00, 0x00, 0x8B, 0x53, 0x5C,
+    0x8A, 0x4B, 0x60, 0x0F, 0xB6, 0xC0, 0xC1, 0xE2, 0x06, 0x09, 0xD0, 0x8D, 0x51, 0x06, 0x89, 0x43,
+    0x5C, 0x80, 0xFA, 0x07, 0x77, 0x05, 0x88, 0x53, 0x60, 0xEB, 0x66, 0x83, 0xE9, 0x02, 0x88, 0x4B,
+    0x60, 0x81, 0xFE, 0x9B, 0x07, 0x00, 0x00, 0x77, 0x0F, 0x89, 0xF2, 0xD3, 0xE8, 0xFF, 0xC6, 0x88,
+    0x44, 0x13, 0x62, 0x89, 0x73, 0x58, 0xEB, 0x2F, 0x80, 0x7B, 0x61, 0x00, 0x74, 0x29, 0x31, 0xC0,
+    0x48, 0x8D, 0x7C, 0x24, 0x0C, 0xB9, 0x0D, 0x00, 0x00, 0x00, 0xF3, 0xAB, 0xB8, 0x71, 0x55, 0xB2,
+    0xAB, 0x48, 0x8D, 0x7C, 0x24, 0x0C, 0x48, 0x01, 0xC0, 0x48, 0x89, 0x44, 0x24, 0x10, 0xE8, 0x00,
+    0x00, 0x00, 0x00, 0xC6, 0x43, 0x61, 0x00, 0x0F, 0xB6, 0x4B, 0x60, 0x83, 0xC8, 0xFF, 0xD3, 0xE0,
+    0xF7, 0xD0, 0x21, 0x43, 0x5C, 0xEB, 0x0A, 0x40, 0x80, 0xFE, 0x3D, 0x74, 0x04, 0xC6, 0x43, 0x61,
+    0x00, 0x48, 0x83, 0xC4, 0x40, 0x5B, 0xC3, 0x90, 0x53, 0x80, 0x7F, 0x28, 0x00, 0x48, 0x89, 0xFB,
+    0x74, 0x06, 0x40, 0x80, 0xFE, 0x20, 0x74, 0x65, 0x8B, 0x03, 0x83, 0xF8, 0x02, 0x75, 0x16, 0x48,
+    0x83, 0x7B, 0x38, 0x07, 0x77, 0x57, 0x40, 0x0F, 0xBE, 0xF6, 0x48, 0x8D, 0x7B, 0x30, 0xE8, 0x00,
+    0x00, 0x00, 0x00, 0xEB, 0x48, 0x83, 0xF8, 0x03, 0x75, 0x37, 0x8D, 0x46, 0xD0, 0x8A, 0x53, 0x54,
+    0x3C, 0x09, 0x77, 0x1D, 0x31, 0xC0, 0x84, 0xD2, 0x74, 0x03, 0x8B, 0x43, 0x50, 0x6B, 0xC0, 0x0A,
+    0x40, 0x0F, 0xBE, 0xF6, 0xC6, 0x43, 0x54, 0x01, 0x8D, 0x44, 0x30, 0xD0, 0x89, 0x43, 0x50, 0xEB,
+    0x1C, 0x84, 0xD2, 0x74, 0x04, 0xC6, 0x43, 0x54, 0x00, 0xC7, 0x03, 0x01, 0x00, 0x00, 0x00, 0xEB,
+    0x0C, 0x40, 0x0F, 0xBE, 0xF6, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x43, 0x28,
+    0x00, 0x5B, 0xC3, 0x90, 0x40, 0x80, 0xFE, 0x0D, 0x0F, 0x84, 0x8C, 0x00, 0x00, 0x00, 0x48, 0x83,
+    0xEC, 0x18, 0x8B, 0x07, 0x40, 0x80, 0xFE, 0x0A, 0x75, 0x3B, 0x85, 0xC0, 0x75, 0x22, 0x48, 0x83,
+    0x7F, 0x10, 0x00, 0x48, 0x89, 0x7C, 0x24, 0x08, 0x75, 0x0C, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x8B, 0x7C, 0x24, 0x08, 0xEB, 0x0C, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x7C, 0x24, 0x08,
+    0x31, 0xC0, 0x31, 0xD2, 0x31, 0xC9, 0x89, 0x17, 0x48, 0x8B, 0x57, 0x08, 0x48, 0x89, 0x4F, 0x10,
+    0xC6, 0x02, 0x00, 0xEB, 0x40, 0x85, 0xC0, 0x75, 0x2D, 0x40, 0x80, 0xFE, 0x3A, 0x75, 0x07, 0xE8,
+    0x00, 0x00, 0x00, 0x00, 0xEB, 0x0D, 0x48, 0x83, 0x7F, 0x10, 0x07, 0x76, 0x0A, 0xC7, 0x07, 0x01,
+    0x00, 0x00, 0x00, 0x31, 0xC0, 0xEB, 0x1E, 0x40, 0x0F, 0xBE, 0xF6, 0x48, 0x83, 0xC7, 0x08, 0xE8,
+    0x00, 0x00, 0x00, 0x00, 0xEB, 0xED, 0xFF, 0xC8, 0x74, 0xE9, 0x40, 0x0F, 0xBE, 0xF6, 0xE8, 0x00,
+    0x00, 0x00, 0x00, 0xEB, 0xDE, 0x48, 0x83, 0xC4, 0x18, 0xC3, 0x31, 0xC0, 0xC3,
+};
+
+const std::array<uint8_t, 1879> delta_target = {
+    0x48, 0xB8, 0x67, 0xE6, 0x09, 0x6A, 0x85, 0xAE, 0x67, 0xBB, 0x31, 0xD2, 0x48, 0x89, 0x07, 0x48,
+    0xB8, 0x72, 0xF3, 0x6E, 0x3C, 0x3A, 0xF5, 0x4F, 0xA5, 0x48, 0x89, 0x47, 0x08, 0x48, 0xB8, 0x7F,
+    0x52, 0x0E, 0x51, 0x8C, 0x68, 0x05, 0x9B, 0x48, 0x89, 0x47, 0x10, 0x48, 0xB8, 0xAB, 0xD9, 0x83,
+    0x1F, 0x19, 0xCD, 0xE0, 0x5B, 0x48, 0x89, 0x47, 0x18, 0x31, 0xC0, 0x89, 0x47, 0x60, 0x48, 0x89,
+    0x57, 0x68, 0xC3, 0x90, 0x41, 0x57, 0x48, 0x89, 0xF8, 0x31, 0xFF, 0x41, 0x56, 0x41, 0x55, 0x41,
+    0x54, 0x55, 0x53, 0x48, 0x81, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x0C, 0x3E, 0x44, 0x0F,
+    0xB6, 0x44, 0x3E, 0x01, 0x48, 0x8D, 0x54, 0x24, 0xA8, 0x41, 0xC1, 0xE0, 0x10, 0xC1, 0xE1, 0x18,
+    0x44, 0x09, 0xC1, 0x44, 0x0F, 0xB6, 0x44, 0x3E, 0x03, 0x44, 0x09, 0xC1, 0x44, 0x0F, 0xB6, 0x44,
+    0x3E, 0x02, 0x41, 0xC1, 0xE0, 0x08, 0x44, 0x09, 0xC1, 0x89, 0x4C, 0x3C, 0xA8, 0x48, 0x83, 0xC7,
+    0x04, 0x48, 0x83, 0xFF, 0x40, 0x75, 0xC3, 0x4C, 0x8D, 0x44, 0x24, 0x68, 0x8B, 0x72, 0x04, 0x8B,
+    0x7A, 0x38, 0x48, 0x83, 0xC2, 0x04, 0x89, 0xF1, 0x41, 0x89, 0xF1, 0xC1, 0xEE, 0x03, 0x41, 0xC1,
+    0xC1, 0x0E, 0xC1, 0xC9, 0x07, 0x44, 0x31, 0xC9, 0x41, 0x89, 0xF9, 0x31, 0xF1, 0x8B, 0x72, 0x20,
+    0x03, 0x72, 0xFC, 0x41, 0xC1, 0xC1, 0x0D, 0x01, 0xF1, 0x89, 0xFE, 0xC1, 0xEF, 0x0A, 0xC1, 0xC6,
+    0x0F, 0x44, 0x31, 0xCE, 0x31, 0xFE, 0x01, 0xF1, 0x89, 0x4A, 0x3C, 0x49, 0x39, 0xD0, 0x75, 0xBC,
+    0x8B, 0x58, 0x04, 0x44, 0x8B, 0x20, 0x45, 0x31, 0xD2, 0x4C, 0x8D, 0x35, 0x00, 0x00, 0x00, 0x00,
+    0x89, 0x5C, 0x24, 0x8C, 0x8B, 0x58, 0x08, 0x44, 0x89, 0xE7, 0x44, 0x8B, 0x4C, 0x24, 0x8C, 0x89,
+    0x5C, 0x24, 0x90, 0x8B, 0x58, 0x0C, 0x44, 0x8B, 0x44, 0x24, 0x90, 0x89, 0x5C, 0x24, 0x94, 0x8B,
+    0x58, 0x10, 0x44, 0x8B, 0x6C, 0x24, 0x94, 0x89, 0x5C, 0x24, 0x98, 0x8B, 0x58, 0x14, 0x8B, 0x74,
+    0x24, 0x98, 0x89, 0x5C, 0x24, 0x9C, 0x8B, 0x58, 0x18, 0x8B, 0x6C, 0x24, 0x9C, 0x89, 0x5C, 0x24,
+    0xA0, 0x8B, 0x58, 0x1C, 0x89, 0x5C, 0x24, 0xA4, 0x41, 0x89, 0xDB, 0x8B, 0x5C, 0x24, 0xA0, 0x89,
+    0xF1, 0x89, 0xF2, 0x41, 0x89, 0xF7, 0xC1, 0xC9, 0x06, 0xC1, 0xCA, 0x0B, 0x41, 0x21, 0xEF, 0x31,
+    0xCA, 0x89, 0xF1, 0xC1, 0xC1, 0x07, 0x31, 0xCA, 0x42, 0x8B, 0x4C, 0x14, 0xA8, 0x43, 0x03, 0x0C,
+    0x16, 0x49, 0x83, 0xC2, 0x04, 0x01, 0xCA, 0x89, 0xF1, 0xF7, 0xD1, 0x21, 0xD9, 0x44, 0x31, 0xF9,
+    0x45, 0x89, 0xCF, 0x01, 0xCA, 0x89, 0xF9, 0x45, 0x21, 0xC7, 0x44, 0x01, 0xDA, 0x41, 0x89, 0xFB,
+    0xC1, 0xC9, 0x02, 0x41, 0xC1, 0xCB, 0x0D, 0x41, 0x31, 0xCB, 0x89, 0xF9, 0xC1, 0xC1, 0x0A, 0x41,
+    0x31, 0xCB, 0x44, 0x89, 0xC9, 0x44, 0x31, 0xC1, 0x21, 0xF9, 0x44, 0x31, 0xF9, 0x46, 0x8D, 0x3C,
+    0x2A, 0x45, 0x89, 0xC5, 0x44, 0x01, 0xD9, 0x41, 0x89, 0xDB, 0x01, 0xD1, 0x49, 0x81, 0xFA, 0x00,
+    0x01, 0x00, 0x00, 0x74, 0x14, 0x89, 0xEB, 0x45, 0x89, 0xC8, 0x89, 0xF5, 0x41, 0x89, 0xF9, 0x44,
+    0x89, 0xFE, 0x89, 0xCF, 0xE9, 0x76, 0xFF, 0xFF, 0xFF, 0x8B, 0x54, 0x24, 0x8C, 0x41, 0x01, 0xCC,
+    0x44, 0x89, 0x20, 0x01, 0xFA, 0x89, 0x50, 0x04, 0x8B, 0x54, 0x24, 0x90, 0x44, 0x01, 0xCA, 0x89,
+    0x50, 0x08, 0x8B, 0x54, 0x24, 0x94, 0x44, 0x01, 0xC2, 0x89, 0x50, 0x0C, 0x8B, 0x54, 0x24, 0x98,
+    0x44, 0x01, 0xFA, 0x89, 0x50, 0x10, 0x8B, 0x54, 0x24, 0x9C, 0x01, 0xF2, 0x89, 0x50, 0x14, 0x8B,
+    0x54, 0x24, 0xA0, 0x01, 0xEA, 0x89, 0x50, 0x18, 0x8B, 0x54, 0x24, 0xA4, 0x01, 0xDA, 0x89, 0x50,
+    0x1C, 0x48, 0x81, 0xC4, 0xA8, 0x00, 0x00, 0x00, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0x41, 0x5E,
+    0x41, 0x5F, 0xC3, 0x90, 0x41, 0x55, 0x89, 0xD2, 0x4C, 0x8D, 0x6F, 0x20, 0x41, 0x54, 0x4C, 0x8D,
+    0x24, 0x16, 0x55, 0x48, 0x89, 0xF5, 0x53, 0x48, 0x89, 0xFB, 0x48, 0x01, 0x57, 0x68, 0x4C, 0x39,
+    0xE5, 0x74, 0x2C, 0x8B, 0x43, 0x60, 0x8A, 0x55, 0x00, 0x88, 0x54, 0x03, 0x20, 0x8B, 0x43, 0x60,
+    0xFF, 0xC0, 0x89, 0x43, 0x60, 0x83, 0xF8, 0x40, 0x75, 0x10, 0x4C, 0x89, 0xEE, 0x48, 0x89, 0xDF,
+    0xE8, 0x00, 0x00, 0x00, 0x00, 0x31, 0xC0, 0x89, 0x43, 0x60, 0x48, 0xFF, 0xC5, 0xEB, 0xCF, 0x5B,
+    0x5D, 0x41, 0x5C, 0x41, 0x5D, 0xC3, 0x41, 0x54, 0x55, 0x48, 0x89, 0xFD, 0x53, 0x48, 0x8B, 0x46,
+    0x68, 0x48, 0x89, 0xF3, 0x4C, 0x8D, 0x24, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x46, 0x60, 0xC6,
+    0x44, 0x06, 0x20, 0x80, 0x8B, 0x46, 0x60, 0xFF, 0xC0, 0x89, 0x46, 0x60, 0x83, 0xF8, 0x38, 0x76,
+    0x23, 0x8B, 0x53, 0x60, 0x83, 0xFA, 0x3F, 0x77, 0x0A, 0xC6, 0x44, 0x13, 0x20, 0x00, 0xFF, 0x43,
+    0x60, 0xEB, 0xEE, 0x48, 0x8D, 0x73, 0x20, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x31,
+    0xC0, 0x89, 0x43, 0x60, 0x8B, 0x53, 0x60, 0x83, 0xFA, 0x37, 0x77, 0x0A, 0xC6, 0x44, 0x13, 0x20,
+    0x00, 0xFF, 0x43, 0x60, 0xEB, 0xEE, 0x31, 0xC0, 0x6B, 0xC8, 0xF8, 0x4C, 0x89, 0xE2, 0x48, 0xD3,
+    0xEA, 0x88, 0x54, 0x03, 0x5F, 0x48, 0xFF, 0xC8, 0x48, 0x83, 0xF8, 0xF8, 0x75, 0xEA, 0x48, 0x89,
+    0xDF, 0x48, 0x8D, 0x73, 0x20, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x31, 0xC0, 0xB9, 0x08, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0xEF, 0xF3, 0xAB, 0x48, 0x89, 0xE8, 0x31, 0xFF, 0x8B, 0x0C, 0x3B, 0x48, 0x83,
+    0xC7, 0x04, 0x48, 0x83, 0xC0, 0x04, 0x89, 0xCE, 0x88, 0x68, 0xFE, 0xC1, 0xEE, 0x18, 0x88, 0x48,
+    0xFF, 0x40, 0x88, 0x70, 0xFC, 0x89, 0xCE, 0xC1, 0xEE, 0x10, 0x40, 0x88, 0x70, 0xFD, 0x48, 0x83,
+    0xFF, 0x20, 0x75, 0xD7, 0x48, 0x89, 0xE8, 0x5B, 0x5D, 0x41, 0x5C, 0xC3, 0x85, 0xF6, 0x75, 0x05,
+    0xBE, 0xB9, 0x79, 0x37, 0x9E, 0x89, 0x77, 0x08, 0xC3, 0x90, 0x66, 0x0F, 0x6E, 0x4F, 0x08, 0xFF,
+    0xC6, 0x31, 0xD2, 0x0F, 0x28, 0xD1, 0x66, 0x0F, 0x72, 0xF2, 0x0D, 0x0F, 0x28, 0xC2, 0x0F, 0x57,
+    0xC1, 0x0F, 0x28, 0xD8, 0x66, 0x0F, 0x72, 0xD3, 0x11, 0x0F, 0x28, 0xCB, 0x0F, 0x57, 0xC8, 0x0F,
+    0x28, 0xE1, 0x66, 0x0F, 0x72, 0xF4, 0x05, 0x0F, 0x28, 0xC4, 0x0F, 0x57, 0xC1, 0x66, 0x0F, 0x7E,
+    0xC0, 0x66, 0x0F, 0x7E, 0x47, 0x08, 0xF7, 0xF6, 0x89, 0xD0, 0xC3, 0x90, 0x48, 0x83, 0xEC, 0x18,
+    0x31, 0xC0, 0x48, 0x89, 0x74, 0x24, 0x08, 0x80, 0x7C, 0x24, 0x0C, 0x00, 0x89, 0x47, 0x04, 0x74,
+    0x22, 0x8B, 0x44, 0x24, 0x08, 0xBA, 0x84, 0x03, 0x00, 0x00, 0xBE, 0x70, 0x17, 0x00, 0x00, 0x39,
+    0xD0, 0x0F, 0x47, 0xC2, 0x69, 0xC8, 0xE8, 0x03, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xC8, 0xEB, 0x0F, 0xBE, 0xE0, 0x2E, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF0, 0xD2,
+    0x00, 0x00, 0x89, 0x07, 0x48, 0x83, 0xC4, 0x18, 0xC3, 0x90, 0x48, 0x83, 0xEC, 0x18, 0x8B, 0x4F,
+    0x04, 0x48, 0x89, 0x74, 0x24, 0x08, 0x8D, 0x41, 0x01, 0x89, 0x47, 0x04, 0xB8, 0x2C, 0x01, 0x00,
+    0x00, 0x83, 0xF9, 0x10, 0x77, 0x11, 0xB8, 0x02, 0x00, 0x00, 0x00, 0xBA, 0x2C, 0x01, 0x00, 0x00,
+    0xD3, 0xE0, 0x39, 0xD0, 0x0F, 0x47, 0xC2, 0x69, 0xC0, 0xE8, 0x03, 0x00, 0x00, 0xD1, 0xE8, 0x89,
+    0xC6, 0x89, 0xC1, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC8, 0x80, 0x7C, 0x24, 0x0C, 0x00, 0x89,
+    0x07, 0x74, 0x1B, 0x8B, 0x54, 0x24, 0x08, 0xB9, 0x84, 0x03, 0x00, 0x00, 0x39, 0xCA, 0x0F, 0x47,
+    0xD1, 0x69, 0xD2, 0xE8, 0x03, 0x00, 0x00, 0x39, 0xC2, 0x0F, 0x42, 0xD0, 0x89, 0x17, 0x8B, 0x07,
+    0x48, 0x83, 0xC4, 0x18, 0xC3, 0x90, 0x48, 0x8B, 0x47, 0x30, 0x31, 0xD2, 0x48, 0x89, 0x57, 0x38,
+    0xC6, 0x00, 0x00, 0x80, 0x7F, 0x54, 0x00, 0x74, 0x04, 0xC6, 0x47, 0x54, 0x00, 0x31, 0xC0, 0x66,
+    0xC7, 0x47, 0x60, 0x00, 0x01, 0x48, 0x89, 0x47, 0x58, 0xC3, 0x48, 0x8B, 0x47, 0x08, 0x31, 0xD2,
+    0x31, 0xC9, 0x89, 0x17, 0x48, 0x89, 0x4F, 0x10, 0xC6, 0x00, 0x00, 0x83, 0x7F, 0x58, 0x00, 0x74,
+    0x08, 0x31, 0xC0, 0x89, 0x87, 0x00, 0x08, 0x00, 0x00, 0xEB, 0xBB, 0x90, 0x55, 0x53, 0x48, 0x89,
+    0xFB, 0x51, 0x40, 0x8A, 0x6F, 0x61, 0x40, 0x84, 0xED, 0x75, 0x04, 0x31, 0xED, 0xEB, 0x2C, 0x48,
+    0x8D, 0x7F, 0x30, 0x48, 0x8D, 0x35, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x85,
+    0xC0, 0x75, 0xE8, 0x8B, 0x43, 0x58, 0x85, 0xC0, 0x74, 0xE1, 0x89, 0x83, 0x00, 0x08, 0x00, 0x00,
+    0x48, 0x8B, 0x43, 0x50, 0x48, 0x89, 0x83, 0x04, 0x08, 0x00, 0x00, 0x48, 0x89, 0xDF, 0xE8, 0x00,
+    0x00, 0x00, 0x00, 0x89, 0xE8, 0x5A, 0x5B, 0x5D, 0xC3, 0x90, 0x55, 0x48, 0x8D, 0x6F, 0x08, 0x53,
+    0x48, 0x89, 0xFB, 0x56, 0x48, 0x8D, 0x35, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x47, 0x28, 0x01, 0x48,
+    0x89, 0xEF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x85, 0xC0, 0x75, 0x14, 0x48, 0x8B, 0x43, 0x30, 0x31,
+    0xC9, 0x48, 0x89, 0x4B, 0x38, 0xC6, 0x00, 0x00, 0xB8, 0x02, 0x00, 0x00, 0x00, 0xEB, 0x3C, 0x48,
+    0x8D, 0x35, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xEF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x85, 0xC0,
+    0x75, 0x10, 0x31, 0xD2, 0xC6, 0x43, 0x54, 0x01, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0x53, 0x50,
+    0xEB, 0x19, 0x48, 0x8D, 0x35, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xEF, 0xE8, 0x00, 0x00, 0x00,
+    0x00, 0x83, 0xF8, 0x01, 0x19, 0xC0, 0x83, 0xE0, 0x03, 0xFF, 0xC0, 0x89, 0x03, 0x58, 0x5B, 0x5D,
+    0xC3, 0x90, 0x53, 0x8D, 0x56, 0xBF, 0x48, 0x89, 0xFB, 0x0F, 0xB6, 0xC2, 0x48, 0x83, 0xEC, 0x40,
+    0x80, 0xFA, 0x19, 0x76, 0x43, 0x8D, 0x46, 0x9F, 0x8D, 0x4E, 0xB9, 0x3C, 0x19, 0x76, 0x0A, 0x8D,
+    0x46, 0xD0, 0x3C, 0x09, 0x77, 0x07, 0x8D, 0x4E, 0x04, 0xB2, 0x01, 0xEB, 0x1A, 0xB8, 0x3E, 0x00,
+    0x00, 0x00, 0x40, 0x80, 0xFE, 0x2B, 0x74, 0x20, 0xB8, 0x3F, 0x00, 0x00, 0x00, 0x40, 0x80, 0xFE,
+    0x2F, 0x74, 0x15, 0x31, 0xD2, 0x31, 0xC9, 0x0F, 0xB6, 0xC1, 0x88, 0xD4, 0x89, 0xC7, 0x66, 0xC1,
+    0xEF, 0x08, 0x0F, 0x84, 0x89, 0x00, 0x00, 0x00, 0x8B, 0x73, 0x58, 0x85, 0xF6, 0x75, 0x08, 0x31,
+    0xD2, 0x89, 0x93, 0x00, 0x08, 0x00, 0x00, 0x8B, 0x53, 0x5C, 0x8A, 0x4B, 0x60, 0x0F, 0xB6, 0xC0,
+    0xC1, 0xE2, 0x06, 0x09, 0xD0, 0x8D, 0x51, 0x06, 0x89, 0x43, 0x5C, 0x80, 0xFA, 0x07, 0x77, 0x05,
+    0x88, 0x53, 0x60, 0xEB, 0x66, 0x83, 0xE9, 0x02, 0x88, 0x4B, 0x60, 0x81, 0xFE, 0x9B, 0x07, 0x00,
+    0x00, 0x77, 0x0F, 0x89, 0xF2, 0xD3, 0xE8, 0xFF, 0xC6, 0x88, 0x44, 0x13, 0x62, 0x89, 0x73, 0x58,
+    0xEB, 0x2F, 0x80, 0x7B, 0x61, 0x00, 0x74, 0x29, 0x31, 0xC0, 0x48, 0x8D, 0x7C, 0x24, 0x0C, 0xB9,
+    0x0D, 0x00, 0x00, 0x00, 0xF3, 0xAB, 0xB8, 0x71, 0x55, 0xB2, 0xAB, 0x48, 0x8D, 0x7C, 0x24, 0x0C,
+    0x48, 0x01, 0xC0, 0x48, 0x89, 0x44, 0x24, 0x10, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x43, 0x61,
+    0x00, 0x0F, 0xB6, 0x4B, 0x60, 0x83, 0xC8, 0xFF, 0xD3, 0xE0, 0xF7, 0xD0, 0x21, 0x43, 0x5C, 0xEB,
+    0x0A, 0x40, 0x80, 0xFE, 0x3D, 0x74, 0x04, 0xC6, 0x43, 0x61, 0x00, 0x48, 0x83, 0xC4, 0x40, 0x5B,
+    0xC3, 0x90, 0x53, 0x80, 0x7F, 0x28, 0x00, 0x48, 0x89, 0xFB, 0x74, 0x06, 0x40, 0x80, 0xFE, 0x20,
+    0x74, 0x65, 0x8B, 0x03, 0x83, 0xF8, 0x02, 0x75, 0x16, 0x48, 0x83, 0x7B, 0x38, 0x07, 0x77, 0x57,
+    0x40, 0x0F, 0xBE, 0xF6, 0x48, 0x8D, 0x7B, 0x30, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x48, 0x83,
+    0xF8, 0x03, 0x75, 0x37, 0x8D, 0x46, 0xD0, 0x8A, 0x53, 0x54, 0x3C, 0x09, 0x77, 0x1D, 0x31, 0xC0,
+    0x84, 0xD2, 0x74, 0x03, 0x8B, 0x43, 0x50, 0x6B, 0xC0, 0x0A, 0x40, 0x0F, 0xBE, 0xF6, 0xC6, 0x43,
+    0x54, 0x01, 0x8D, 0x44, 0x30, 0xD0, 0x89, 0x43, 0x50, 0xEB, 0x1C, 0x84, 0xD2, 0x74, 0x04, 0xC6,
+    0x43, 0x54, 0x00, 0xC7, 0x03, 0x01, 0x00, 0x00, 0x00, 0xEB, 0x0C, 0x40, 0x0F, 0xBE, 0xF6, 0x48,
+    0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x43, 0x28, 0x00, 0x5B, 0xC3, 0x90, 0x40, 0x80,
+    0xFE, 0x0D, 0x0F, 0x84, 0x8C, 0x00, 0x00, 0x00, 0x48, 0x83, 0xEC, 0x18, 0x8B, 0x07, 0x40, 0x80,
+    0xFE, 0x0A, 0x75, 0x3B, 0x85, 0xC0, 0x75, 0x22, 0x48, 0x83, 0x7F, 0x10, 0x00, 0x48, 0x89, 0x7C,
+    0x24, 0x08, 0x75, 0x0C, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x7C, 0x24, 0x08, 0xEB, 0x0C,
+    0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x7C, 0x24, 0x08, 0x31, 0xC0, 0x31, 0xD2, 0x31, 0xC9,
+    0x89, 0x17, 0x48, 0x8B, 0x57, 0x08, 0x48, 0x89, 0x4F, 0x10, 0xC6, 0x02, 0x00, 0xEB, 0x40, 0x85,
+    0xC0, 0x75, 0x2D, 0x40, 0x80, 0xFE, 0x3A, 0x75, 0x07, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x0D,
+    0x48, 0x83, 0x7F, 0x10, 0x07, 0x76, 0x0A, 0xC7, 0x07, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC0, 0xEB,
+    0x1E, 0x40, 0x0F, 0xBE, 0xF6, 0x48, 0x83, 0xC7, 0x08, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xED,
+    0xFF, 0xC8, 0x74, 0xE9, 0x40, 0x0F, 0xBE, 0xF6, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xDE, 0x48,
+    0x83, 0xC4, 0x18, 0xC3, 0x31, 0xC0, 0xC3,
+};
+
+const std::array<uint8_t, 374> delta_patch = {
+    0x54, 0x42, 0x44, 0x50, 0x01, 0x00, 0x00, 0x00, 0x4D, 0x06, 0x00, 0x00, 0x57, 0x07, 0x00, 0x00,
+    0x39, 0x7B, 0x41, 0x5C, 0x53, 0xD4, 0x0D, 0x0A, 0x59, 0xDD, 0x6E, 0xDC, 0x5B, 0x78, 0x08, 0xEE,
+    0xFA, 0xD9, 0x4E, 0x11, 0xA8, 0x30, 0x1B, 0x40, 0x96, 0x4B, 0xE3, 0x88, 0x5B, 0x80, 0x50, 0xFA,
+    0x2B, 0xAF, 0xAE, 0x16, 0xD2, 0x93, 0x31, 0x44, 0x7C, 0xDF, 0xCF, 0x07, 0x6C, 0x3C, 0x1B, 0xD7,
+    0x78, 0xED, 0xC5, 0x10, 0x10, 0xC5, 0xCD, 0x5F, 0xC5, 0x9F, 0x08, 0x33, 0xD1, 0x49, 0x43, 0x1F,
+    0x01, 0x3C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0A, 0x01, 0x00, 0x00, 0x85, 0xF6,
+    0x75, 0x05, 0xBE, 0xB9, 0x79, 0x37, 0x9E, 0x89, 0x77, 0x08, 0xC3, 0x90, 0x66, 0x0F, 0x6E, 0x4F,
+    0x08, 0xFF, 0xC6, 0x31, 0xD2, 0x0F, 0x28, 0xD1, 0x66, 0x0F, 0x72, 0xF2, 0x0D, 0x0F, 0x28, 0xC2,
+    0x0F, 0x57, 0xC1, 0x0F, 0x28, 0xD8, 0x66, 0x0F, 0x72, 0xD3, 0x11, 0x0F, 0x28, 0xCB, 0x0F, 0x57,
+    0xC8, 0x0F, 0x28, 0xE1, 0x66, 0x0F, 0x72, 0xF4, 0x05, 0x0F, 0x28, 0xC4, 0x0F, 0x57, 0xC1, 0x66,
+    0x0F, 0x7E, 0xC0, 0x66, 0x0F, 0x7E, 0x47, 0x08, 0xF7, 0xF6, 0x89, 0xD0, 0xC3, 0x90, 0x48, 0x83,
+    0xEC, 0x18, 0x31, 0xC0, 0x48, 0x89, 0x74, 0x24, 0x08, 0x80, 0x7C, 0x24, 0x0C, 0x00, 0x89, 0x47,
+    0x04, 0x74, 0x22, 0x8B, 0x44, 0x24, 0x08, 0xBA, 0x84, 0x03, 0x00, 0x00, 0xBE, 0x70, 0x17, 0x00,
+    0x00, 0x39, 0xD0, 0x0F, 0x47, 0xC2, 0x69, 0xC8, 0xE8, 0x03, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xC8, 0xEB, 0x0F, 0xBE, 0xE0, 0x2E, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0xF0, 0xD2, 0x00, 0x00, 0x89, 0x07, 0x48, 0x83, 0xC4, 0x18, 0xC3, 0x90, 0x48, 0x83, 0xEC, 0x18,
+    0x8B, 0x4F, 0x04, 0x48, 0x89, 0x74, 0x24, 0x08, 0x8D, 0x41, 0x01, 0x89, 0x47, 0x04, 0xB8, 0x2C,
+    0x01, 0x00, 0x00, 0x83, 0xF9, 0x10, 0x77, 0x11, 0xB8, 0x02, 0x00, 0x00, 0x00, 0xBA, 0x2C, 0x01,
+    0x00, 0x00, 0xD3, 0xE0, 0x39, 0xD0, 0x0F, 0x47, 0xC2, 0x69, 0xC0, 0xE8, 0x03, 0x00, 0x00, 0xD1,
+    0xE8, 0x89, 0xC6, 0x89, 0xC1, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC8, 0x80, 0x7C, 0x24, 0x0C,
+    0x00, 0x89, 0x07, 0x74, 0x1B, 0x8B, 0x54, 0x24, 0x08, 0xB9, 0x84, 0x03, 0x00, 0x00, 0x39, 0xCA,
+    0x0F, 0x47, 0xD1, 0x69, 0xD2, 0xE8, 0x03, 0x00, 0x00, 0x39, 0xC2, 0x0F, 0x42, 0xD0, 0x89, 0x17,
+    0x8B, 0x07, 0x48, 0x83, 0xC4, 0x18, 0xC3, 0x90, 0x01, 0x11, 0x03, 0x00, 0x00, 0x3C, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const std::array<uint8_t, 10496> firmware_source = {
+    0xE9, 0x02, 0x02, 0x0F, 0x1C, 0x5A, 0x37, 0x40, 0xEE, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x3C, 0x00, 0x03, 0x00, 0x00,
+    0x32, 0x54, 0xCD, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x2E, 0x31, 0x31, 0x2E, 0x30, 0x2D, 0x34, 0x31, 0x2D, 0x67, 0x37, 0x30, 0x30, 0x66, 0x64,
+    0x63, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x54, 0x72, 0x61, 0x69, 0x6E, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x30, 0x3A, 0x34, 0x31, 0x3A, 0x31, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0x63, 0x74, 0x20, 0x31, 0x39, 0x20, 0x32, 0x30, 0x32, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x76, 0x34, 0x2E, 0x34, 0x2E, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x94, 0x70, 0xAB, 0x7D, 0xA1, 0x10, 0x86, 0x95, 0x8B, 0x2A, 0x5E, 0x9F, 0xE2, 0xDF, 0x5F, 0x56,
+    0x28, 0x5B, 0xFB, 0x92, 0x3D, 0x9F, 0x79, 0x4A, 0xE1, 0x0F, 0xD5, 0xC9, 0x4C, 0x1D, 0xBD, 0xB1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x76, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x3A, 0x3A, 0x5F, 0x4D, 0x5F, 0x72, 0x65, 0x61, 0x6C, 0x6C,
+    0x6F, 0x63, 0x5F, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x32, 0x34, 0x32, 0x35, 0x32, 0x36, 0x32, 0x37, 0x32, 0x38, 0x32, 0x39, 0x33, 0x30, 0x33, 0x31,
+    0x33, 0x32, 0x33, 0x33, 0x33, 0x34, 0x33, 0x35, 0x33, 0x36, 0x33, 0x37, 0x33, 0x38, 0x33, 0x39,
+    0x34, 0x30, 0x34, 0x31, 0x34, 0x32, 0x34, 0x33, 0x34, 0x34, 0x34, 0x35, 0x34, 0x36, 0x34, 0x37,
+    0x34, 0x38, 0x34, 0x39, 0x35, 0x30, 0x35, 0x31, 0x35, 0x32, 0x35, 0x33, 0x35, 0x34, 0x35, 0x35,
+    0x35, 0x36, 0x35, 0x37, 0x35, 0x38, 0x35, 0x39, 0x36, 0x30, 0x36, 0x31, 0x36, 0x32, 0x36, 0x33,
+    0x36, 0x34, 0x36, 0x35, 0x36, 0x36, 0x36, 0x37, 0x36, 0x38, 0x36, 0x39, 0x37, 0x30, 0x37, 0x31,
+    0x37, 0x32, 0x37, 0x33, 0x37, 0x34, 0x37, 0x35, 0x37, 0x36, 0x37, 0x37, 0x37, 0x38, 0x37, 0x39,
+    0x38, 0x30, 0x38, 0x31, 0x38, 0x32, 0x38, 0x33, 0x38, 0x34, 0x38, 0x35, 0x38, 0x36, 0x38, 0x37,
+    0x38, 0x38, 0x38, 0x39, 0x39, 0x30, 0x39, 0x31, 0x39, 0x32, 0x39, 0x33, 0x39, 0x34, 0x39, 0x35,
+    0x39, 0x36, 0x39, 0x37, 0x39, 0x38, 0x39, 0x39, 0x00, 0x6F, 0x6E, 0x67, 0x20, 0x74, 0x61, 0x72,
+    0x67, 0x65, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x00, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20,
+    0x6C, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x61, 0x6E, 0x6E, 0x6F,
+    0x75, 0x6E, 0x63, 0x65, 0x64, 0x00, 0x55, 0x6E, 0x6B, 0x6E, 0x6F, 0x77, 0x6E, 0x20, 0x6F, 0x70,
+    0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x3A, 0x3A, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x00, 0x52, 0x65, 0x71,
+    0x75, 0x65, 0x73, 0x74, 0x73, 0x3A, 0x20, 0x00, 0x2C, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x3A,
+    0x20, 0x00, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x3A, 0x00, 0x20, 0x00, 0x3A, 0x20, 0x6E, 0x20,
+    0x00, 0x2C, 0x20, 0x70, 0x35, 0x30, 0x20, 0x00, 0x2C, 0x20, 0x70, 0x39, 0x30, 0x20, 0x00, 0x2C,
+    0x20, 0x6D, 0x61, 0x78, 0x20, 0x00, 0x2C, 0x20, 0x6C, 0x6F, 0x67, 0x32, 0x20, 0x68, 0x69, 0x73,
+    0x74, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x00, 0x6E, 0x6F, 0x6E, 0x65, 0x00, 0x64, 0x6E, 0x73, 0x00,
+    0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x00, 0x74, 0x6C, 0x73, 0x00, 0x74, 0x69, 0x6D, 0x65,
+    0x6F, 0x75, 0x74, 0x00, 0x6C, 0x6F, 0x73, 0x74, 0x00, 0x34, 0x78, 0x78, 0x00, 0x35, 0x78, 0x78,
+    0x00, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x65, 0x72, 0x00, 0x64, 0x6E, 0x73, 0x20, 0x6D, 0x73,
+    0x00, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x20, 0x6D, 0x73, 0x00, 0x66, 0x69, 0x72, 0x73,
+    0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x6D, 0x73, 0x00, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66,
+    0x65, 0x72, 0x20, 0x6D, 0x73, 0x00, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20, 0x6D, 0x73, 0x00, 0x70,
+    0x61, 0x79, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x00, 0x66, 0x72, 0x61,
+    0x6D, 0x65, 0x00, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x00, 0x69, 0x64, 0x00, 0x64, 0x61, 0x74, 0x61,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x42, 0xB0, 0x25, 0x00, 0x00, 0x48, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x3F, 0x41, 0x57, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x55, 0x53, 0x48, 0x83, 0xEC, 0x18,
+    0x48, 0x8B, 0x47, 0x08, 0x4C, 0x8B, 0x27, 0x48, 0x89, 0xC3, 0x48, 0x89, 0x04, 0x24, 0x4C, 0x29,
+    0xE3, 0x48, 0xD1, 0xFB, 0x48, 0x39, 0xCB, 0x75, 0x0A, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00,
+    0x00, 0x00, 0x00, 0x4C, 0x39, 0x24, 0x24, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x49, 0x89, 0xD6, 0x48,
+    0x89, 0xF2, 0x48, 0x0F, 0x45, 0xC3, 0x49, 0x89, 0xFF, 0x49, 0x89, 0xF5, 0x48, 0x01, 0xC3, 0x0F,
+    0x92, 0xC0, 0x4C, 0x29, 0xE2, 0x0F, 0xB6, 0xC0, 0x48, 0x85, 0xC0, 0x75, 0x1A, 0x31, 0xED, 0x48,
+    0x85, 0xDB, 0x74, 0x2C, 0x48, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x48, 0x39,
+    0xC3, 0x48, 0x0F, 0x47, 0xD8, 0xEB, 0x03, 0x48, 0x89, 0xCB, 0x48, 0x8D, 0x3C, 0x1B, 0x48, 0x89,
+    0x54, 0x24, 0x08, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x54, 0x24, 0x08, 0x48, 0x89, 0xC5,
+    0x66, 0x41, 0x8B, 0x06, 0x48, 0x85, 0xD2, 0x4C, 0x8D, 0x72, 0x02, 0x66, 0x89, 0x44, 0x15, 0x00,
+    0x7E, 0x2A, 0x4C, 0x89, 0xE6, 0x48, 0x89, 0xEF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x0C,
+    0x24, 0x4A, 0x8D, 0x44, 0x35, 0x00, 0x4C, 0x29, 0xE9, 0x4C, 0x8D, 0x34, 0x08, 0x48, 0x85, 0xC9,
+    0x7E, 0x2E, 0x48, 0x89, 0xC7, 0x4C, 0x89, 0xEE, 0xF3, 0xA4, 0xEB, 0x24, 0x4A, 0x8D, 0x54, 0x35,
+    0x00, 0x4C, 0x8B, 0x34, 0x24, 0x4D, 0x29, 0xEE, 0x4D, 0x85, 0xF6, 0x7E, 0x0B, 0x48, 0x89, 0xD7,
+    0x4C, 0x89, 0xEE, 0x4C, 0x89, 0xF1, 0xF3, 0xA4, 0x49, 0x01, 0xD6, 0x4D, 0x85, 0xE4, 0x74, 0x0F,
+    0x49, 0x8B, 0x77, 0x10, 0x4C, 0x89, 0xE7, 0x4C, 0x29, 0xE6, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x01, 0xDB, 0x49, 0x89, 0x2F, 0x48, 0x01, 0xDD, 0x4D, 0x89, 0x77, 0x08, 0x49, 0x89, 0x6F, 0x10,
+    0x48, 0x83, 0xC4, 0x18, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0x41, 0x5E, 0x41, 0x5F, 0xC3, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xC7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0xC7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xC7,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00,
+    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00,
+    0xBA, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0xC7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xC7, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0xBE,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0xC7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0xC7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0xC7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x41, 0x58, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xDF, 0x88, 0x44, 0x24, 0x08, 0xE8,
+    0x00, 0x00, 0x00, 0x00, 0x8A, 0x44, 0x24, 0x08, 0x01, 0xAB, 0x84, 0x00, 0x00, 0x00, 0x48, 0x83,
+    0xC4, 0x18, 0x5B, 0x5D, 0xC3, 0x90, 0x41, 0x57, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x55, 0x53,
+    0x48, 0x89, 0xFB, 0x48, 0x83, 0xEC, 0x18, 0x8B, 0x47, 0x7C, 0x39, 0xF0, 0x72, 0x0C, 0x29, 0xF0,
+    0x41, 0x89, 0xF4, 0x41, 0x89, 0xD5, 0x39, 0xD0, 0x73, 0x11, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x31, 0xC0, 0xEB, 0x6A, 0x31, 0xED, 0xB0, 0x01, 0x4C,
+    0x8D, 0xB7, 0x00, 0x01, 0x00, 0x00, 0x44, 0x39, 0xED, 0x73, 0x5A, 0x84, 0xC0, 0x74, 0x56, 0x45,
+    0x89, 0xEF, 0xB8, 0x00, 0x01, 0x00, 0x00, 0x48, 0x8B, 0x3B, 0x42, 0x8D, 0x74, 0x25, 0x00, 0x41,
+    0x29, 0xEF, 0x4C, 0x89, 0xF2, 0x41, 0x39, 0xC7, 0x44, 0x0F, 0x47, 0xF8, 0x48, 0x8B, 0x07, 0x44,
+    0x89, 0xF9, 0xFF, 0x10, 0x84, 0xC0, 0x88, 0x44, 0x24, 0x0F, 0x75, 0x13, 0xBE, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x44, 0x24, 0x0F, 0xEB, 0x0E, 0x44,
+    0x89, 0xFA, 0x4C, 0x89, 0xF6, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x81, 0xC5, 0x00,
+    0x01, 0x00, 0x00, 0xEB, 0xA1, 0x48, 0x83, 0xC4, 0x18, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0x41,
+    0x5E, 0x41, 0x5F, 0xC3, 0x53, 0x48, 0x8D, 0x77, 0x14, 0x48, 0x89, 0xFB, 0xBA, 0x04, 0x00, 0x00,
+    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xEC, 0x10, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x85,
+    0xC0, 0x75, 0x06, 0x80, 0x7B, 0x18, 0x01, 0x74, 0x07, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x2C,
+    0x48, 0x8D, 0x7B, 0x1C, 0xE8, 0x2F, 0xFD, 0xFF, 0xFF, 0x48, 0x8D, 0x7B, 0x20, 0x89, 0x43, 0x7C,
+    0xE8, 0x23, 0xFD, 0xFF, 0xFF, 0x48, 0x89, 0xDF, 0x89, 0x83, 0x80, 0x00, 0x00, 0x00, 0xE8, 0x00,
+    0x00, 0x00, 0x00, 0x84, 0xC0, 0x75, 0x11, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xDF, 0xE8,
+    0x00, 0x00, 0x00, 0x00, 0x31, 0xC0, 0xEB, 0x3A, 0x48, 0x8B, 0x7B, 0x08, 0x8B, 0xB3, 0x80, 0x00,
+    0x00, 0x00, 0x48, 0x8B, 0x07, 0xFF, 0x10, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x84, 0xC0, 0x74, 0xDC,
+    0xC6, 0x83, 0x88, 0x00, 0x00, 0x00, 0x01, 0x48, 0x8D, 0xBB, 0x90, 0x00, 0x00, 0x00, 0x88, 0x44,
+    0x24, 0x0F, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x43, 0x10, 0x01, 0x00, 0x00, 0x00, 0x8A, 0x44,
+    0x24, 0x0F, 0x48, 0x83, 0xC4, 0x10, 0x5B, 0xC3, 0x55, 0x48, 0x8D, 0xB7, 0x90, 0x00, 0x00, 0x00,
+    0x53, 0x48, 0x89, 0xFB, 0x48, 0x83, 0xEC, 0x68, 0x48, 0x8D, 0x7C, 0x24, 0x0C, 0xE8, 0x00, 0x00,
+    0x00, 0x00, 0x8B, 0x83, 0x80, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x39, 0x83, 0x84,
+    0x00, 0x00, 0x00, 0x75, 0x1E, 0x48, 0x8D, 0x73, 0x44, 0xBA, 0x20, 0x00, 0x00, 0x00, 0x48, 0x8D,
+    0x7C, 0x24, 0x0C, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x89, 0xC5, 0x85, 0xC0, 0x74, 0x11, 0xBE, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x31, 0xC0, 0xEB, 0x4A, 0x48,
+    0x8B, 0x7B, 0x08, 0xBE, 0x01, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x07, 0xFF, 0x50, 0x10, 0x84, 0xC0,
+    0x75, 0x30, 0x89, 0xE8, 0x48, 0x8D, 0x7C, 0x24, 0x2C, 0xB9, 0x0D, 0x00, 0x00, 0x00, 0xF3, 0xAB,
+    0x48, 0x8D, 0x7C, 0x24, 0x2C, 0x48, 0xB8, 0xF3, 0x98, 0xA6, 0xDE, 0x01, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x44, 0x24, 0x30, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x43, 0x10, 0x04, 0x00, 0x00, 0x00,
+    0xEB, 0xB9, 0xC7, 0x43, 0x10, 0x03, 0x00, 0x00, 0x00, 0x48, 0x83, 0xC4, 0x68, 0x5B, 0x5D, 0xC3,
+    0x41, 0x50, 0x48, 0x89, 0xF9, 0x40, 0x8A, 0x77, 0x68, 0x48, 0x83, 0xC7, 0x69, 0xE8, 0x06, 0xFC,
+    0xFF, 0xFF, 0x89, 0xC2, 0x8B, 0x81, 0x80, 0x00, 0x00, 0x00, 0x2B, 0x81, 0x84, 0x00, 0x00, 0x00,
+    0x39, 0xD0, 0x73, 0x07, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x49, 0x40, 0x84, 0xF6, 0x75, 0x0D,
+    0x85, 0xD2, 0x75, 0x09, 0x48, 0x89, 0xCF, 0x5E, 0xE9, 0x1B, 0xFF, 0xFF, 0xFF, 0x40, 0x80, 0xFE,
+    0x01, 0x75, 0x14, 0x48, 0x8D, 0x79, 0x6D, 0xE8, 0xCC, 0xFB, 0xFF, 0xFF, 0x48, 0x89, 0xCF, 0x59,
+    0x89, 0xC6, 0xE9, 0xAF, 0xFD, 0xFF, 0xFF, 0x40, 0x80, 0xFE, 0x02, 0x75, 0x12, 0x83, 0xFA, 0x01,
+    0x89, 0x51, 0x78, 0x19, 0xC0, 0x83, 0xC0, 0x02, 0x89, 0x41, 0x10, 0xB0, 0x01, 0xEB, 0x0F, 0xBE,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xCF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x31, 0xC0, 0x5A, 0xC3,
+    0x41, 0x57, 0x41, 0xBF, 0x50, 0x00, 0x00, 0x00, 0x41, 0x56, 0x49, 0x89, 0xF6, 0x41, 0x55, 0x41,
+    0x89, 0xD5, 0x41, 0x54, 0x55, 0x31, 0xED, 0x53, 0x48, 0x89, 0xFB, 0x41, 0x50, 0x8B, 0x43, 0x10,
+    0x44, 0x39, 0xED, 0x0F, 0x83, 0x0F, 0x01, 0x00, 0x00, 0x8D, 0x50, 0xFD, 0x83, 0xFA, 0x01, 0x0F,
+    0x86, 0x03, 0x01, 0x00, 0x00, 0x44, 0x89, 0xEA, 0x89, 0xEE, 0x29, 0xEA, 0x4C, 0x01, 0xF6, 0x85,
+    0xC0, 0x75, 0x46, 0x8B, 0x43, 0x64, 0x45, 0x89, 0xFC, 0x41, 0x29, 0xC4, 0x41, 0x39, 0xD4, 0x72,
+    0x07, 0x89, 0xD1, 0x41, 0x89, 0xD4, 0xEB, 0x08, 0x45, 0x85, 0xE4, 0x74, 0x10, 0x44, 0x89, 0xE1,
+    0x48, 0x8D, 0x7C, 0x03, 0x14, 0x48, 0x89, 0xCA, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x43, 0x64,
+    0x44, 0x01, 0xE0, 0x89, 0x43, 0x64, 0x83, 0xF8, 0x50, 0x0F, 0x85, 0xB1, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x50, 0xFF, 0xC8, 0x75, 0x59, 0x48, 0x89, 0xDF,
+    0xE8, 0x00, 0x00, 0x00, 0x00, 0x41, 0x89, 0xC4, 0x8B, 0x43, 0x74, 0x41, 0x29, 0xC4, 0x41, 0x39,
+    0xD4, 0x73, 0x07, 0x45, 0x85, 0xE4, 0x74, 0x12, 0xEB, 0x03, 0x41, 0x89, 0xD4, 0x44, 0x89, 0xE2,
+    0x48, 0x8D, 0x7C, 0x03, 0x68, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x53, 0x74, 0x48, 0x89, 0xDF,
+    0x44, 0x01, 0xE2, 0x89, 0x53, 0x74, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x39, 0xC2, 0x75, 0x61, 0x31,
+    0xC9, 0x89, 0x4B, 0x74, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x84, 0xC0, 0x75, 0x53, 0xC7, 0x43, 0x10,
+    0x04, 0x00, 0x00, 0x00, 0xEB, 0x4A, 0x8B, 0x43, 0x78, 0x48, 0x89, 0xDF, 0x39, 0xC2, 0x0F, 0x46,
+    0xC2, 0x89, 0xC2, 0x41, 0x89, 0xC4, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x84, 0xC0, 0x75, 0x07, 0xC7,
+    0x43, 0x10, 0x04, 0x00, 0x00, 0x00, 0x8B, 0x43, 0x78, 0x44, 0x01, 0xE5, 0x44, 0x29, 0xE0, 0x83,
+    0x7B, 0x10, 0x02, 0x89, 0x43, 0x78, 0x0F, 0x85, 0x01, 0xFF, 0xFF, 0xFF, 0x85, 0xC0, 0x0F, 0x85,
+    0xF9, 0xFE, 0xFF, 0xFF, 0xC7, 0x43, 0x10, 0x01, 0x00, 0x00, 0x00, 0xE9, 0xED, 0xFE, 0xFF, 0xFF,
+    0x44, 0x01, 0xE5, 0xE9, 0xE5, 0xFE, 0xFF, 0xFF, 0x83, 0xF8, 0x03, 0x74, 0x0A, 0x83, 0xF8, 0x04,
+    0x0F, 0x94, 0xC2, 0x31, 0xC9, 0xEB, 0x04, 0xB2, 0x01, 0xB1, 0x01, 0x0F, 0xB6, 0xC1, 0x88, 0xD4,
+    0x5A, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0x41, 0x5E, 0x41, 0x5F, 0xC3, 0x85, 0xF6, 0x75, 0x05,
+    0xBE, 0xB9, 0x79, 0x37, 0x9E, 0x89, 0x77, 0x08, 0xC3, 0x90, 0x66, 0x0F, 0x6E, 0x4F, 0x08, 0xFF,
+    0xC6, 0x31, 0xD2, 0x0F, 0x28, 0xD1, 0x66, 0x0F, 0x72, 0xF2, 0x0D, 0x0F, 0x28, 0xC2, 0x0F, 0x57,
+    0xC1, 0x0F, 0x28, 0xD8, 0x66, 0x0F, 0x72, 0xD3, 0x11, 0x0F, 0x28, 0xCB, 0x0F, 0x57, 0xC8, 0x0F,
+    0x28, 0xE1, 0x66, 0x0F, 0x72, 0xF4, 0x05, 0x0F, 0x28, 0xC4, 0x0F, 0x57, 0xC1, 0x66, 0x0F, 0x7E,
+    0xC0, 0x66, 0x0F, 0x7E, 0x47, 0x08, 0xF7, 0xF6, 0x89, 0xD0, 0xC3, 0x90, 0x48, 0x83, 0xEC, 0x18,
+    0x31, 0xC0, 0x48, 0x89, 0x74, 0x24, 0x08, 0x80, 0x7C, 0x24, 0x0C, 0x00, 0x89, 0x47, 0x04, 0x74,
+    0x22, 0x8B, 0x44, 0x24, 0x08, 0xBA, 0x84, 0x03, 0x00, 0x00, 0xBE, 0x70, 0x17, 0x00, 0x00, 0x39,
+    0xD0, 0x0F, 0x47, 0xC2, 0x69, 0xC8, 0xE8, 0x03, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xC8, 0xEB, 0x0F, 0xBE, 0xE0, 0x2E, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF0, 0xD2,
+    0x00, 0x00, 0x89, 0x07, 0x48, 0x83, 0xC4, 0x18, 0xC3, 0x90, 0x48, 0x83, 0xEC, 0x18, 0x8B, 0x4F,
+    0x04, 0x48, 0x89, 0x74, 0x24, 0x08, 0x8D, 0x41, 0x01, 0x89, 0x47, 0x04, 0xB8, 0x2C, 0x01, 0x00,
+    0x00, 0x83, 0xF9, 0x10, 0x77, 0x11, 0xB8, 0x02, 0x00, 0x00, 0x00, 0xBA, 0x2C, 0x01, 0x00, 0x00,
+    0xD3, 0xE0, 0x39, 0xD0, 0x0F, 0x47, 0xC2, 0x69, 0xC0, 0xE8, 0x03, 0x00, 0x00, 0xD1, 0xE8, 0x89,
+    0xC6, 0x89, 0xC1, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC8, 0x80, 0x7C, 0x24, 0x0C, 0x00, 0x89,
+    0x07, 0x74, 0x1B, 0x8B, 0x54, 0x24, 0x08, 0xB9, 0x84, 0x03, 0x00, 0x00, 0x39, 0xCA, 0x0F, 0x47,
+    0xD1, 0x69, 0xD2, 0xE8, 0x03, 0x00, 0x00, 0x39, 0xC2, 0x0F, 0x42, 0xD0, 0x89, 0x17, 0x8B, 0x07,
+    0x48, 0x83, 0xC4, 0x18, 0xC3, 0x90, 0x48, 0x8D, 0x42, 0xFF, 0x49, 0x89, 0xF1, 0x41, 0x89, 0xC8,
+    0x48, 0x89, 0xD6, 0xB9, 0x02, 0x00, 0x00, 0x00, 0x48, 0x99, 0x48, 0xF7, 0xF9, 0x4C, 0x89, 0xC9,
+    0x48, 0x39, 0xC1, 0x7D, 0x23, 0x4C, 0x8D, 0x51, 0x01, 0x46, 0x8B, 0x5C, 0xD7, 0xFC, 0x4B, 0x8D,
+    0x14, 0x12, 0x46, 0x39, 0x1C, 0xD7, 0x73, 0x03, 0x48, 0xFF, 0xCA, 0x44, 0x8B, 0x14, 0x97, 0x44,
+    0x89, 0x14, 0x8F, 0x48, 0x89, 0xD1, 0xEB, 0xD8, 0x40, 0xF6, 0xC6, 0x01, 0x75, 0x25, 0x48, 0x8D,
+    0x46, 0xFE, 0xBE, 0x02, 0x00, 0x00, 0x00, 0x48, 0x99, 0x48, 0xF7, 0xFE, 0x48, 0x39, 0xC1, 0x75,
+    0x12, 0x48, 0x8D, 0x41, 0x01, 0x48, 0x01, 0xC0, 0x8B, 0x54, 0x87, 0xFC, 0x89, 0x14, 0x8F, 0x48,
+    0x8D, 0x48, 0xFF, 0x48, 0x8D, 0x41, 0xFF, 0xBE, 0x02, 0x00, 0x00, 0x00, 0x48, 0x99, 0x48, 0xF7,
+    0xFE, 0x48, 0x8D, 0x14, 0x8F, 0x49, 0x39, 0xC9, 0x7D, 0x16, 0x8B, 0x0C, 0x87, 0x44, 0x39, 0xC1,
+    0x73, 0x0E, 0x89, 0x0A, 0x48, 0x8D, 0x50, 0xFF, 0x48, 0x89, 0xC1, 0x48, 0x89, 0xD0, 0xEB, 0xDC,
+    0x44, 0x89, 0x02, 0xC3, 0x55, 0x48, 0x89, 0xF5, 0x53, 0x48, 0x89, 0xFB, 0x48, 0x89, 0xF7, 0x50,
+    0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x53, 0x08, 0x48, 0x89, 0xE9, 0x41, 0x59, 0x48, 0x89,
+    0xDF, 0x49, 0x89, 0xC0, 0x5B, 0x31, 0xF6, 0x5D, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x90, 0x53, 0x48,
+    0x89, 0xFB, 0x48, 0x89, 0xF7, 0x48, 0x83, 0xEC, 0x10, 0x48, 0x89, 0x74, 0x24, 0x08, 0xE8, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x8B, 0x74, 0x24, 0x08, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x48, 0x2B, 0x43, 0x08, 0x48, 0x39, 0xD0, 0x73, 0x0A, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xC4, 0x10, 0x48, 0x89, 0xDF, 0x5B,
+    0xE9, 0x00, 0x00, 0x00, 0x00, 0x48, 0x39, 0xF7, 0x75, 0x01, 0xC3, 0x41, 0x56, 0x41, 0xBE, 0x04,
+    0x00, 0x00, 0x00, 0x41, 0x55, 0x41, 0x54, 0x49, 0x89, 0xF4, 0x55, 0x48, 0x8D, 0x6F, 0x04, 0x53,
+    0x48, 0x89, 0xFB, 0x49, 0x39, 0xEC, 0x74, 0x41, 0x44, 0x8B, 0x6D, 0x00, 0x44, 0x3B, 0x2B, 0x73,
+    0x1C, 0x48, 0x39, 0xEB, 0x74, 0x12, 0x48, 0x89, 0xEA, 0x4A, 0x8D, 0x3C, 0x33, 0x48, 0x89, 0xDE,
+    0x48, 0x29, 0xDA, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x44, 0x89, 0x2B, 0xEB, 0x16, 0x48, 0x89, 0xE8,
+    0x8B, 0x50, 0xFC, 0x41, 0x39, 0xD5, 0x73, 0x08, 0x89, 0x10, 0x48, 0x83, 0xE8, 0x04, 0xEB, 0xF0,
+    0x44, 0x89, 0x28, 0x48, 0x83, 0xC5, 0x04, 0xEB, 0xBA, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0x41,
+    0x5E, 0xC3, 0x41, 0x56, 0x41, 0x55, 0x49, 0x89, 0xD5, 0x41, 0x54, 0x55, 0x48, 0x89, 0xF5, 0x53,
+    0x48, 0x89, 0xFB, 0x48, 0x89, 0xE8, 0x48, 0x29, 0xD8, 0x48, 0x83, 0xF8, 0x40, 0x0F, 0x8E, 0xE7,
+    0x00, 0x00, 0x00, 0x49, 0x89, 0xC6, 0x49, 0xC1, 0xFE, 0x02, 0x4D, 0x85, 0xED, 0x75, 0x55, 0x4D,
+    0x8D, 0x66, 0xFE, 0x49, 0xD1, 0xFC, 0x42, 0x8B, 0x0C, 0xA3, 0x4C, 0x89, 0xF2, 0x4C, 0x89, 0xE6,
+    0x48, 0x89, 0xDF, 0xE8, 0x3E, 0xFE, 0xFF, 0xFF, 0x4D, 0x85, 0xE4, 0x74, 0x05, 0x49, 0xFF, 0xCC,
+    0xEB, 0xE4, 0x48, 0x89, 0xE8, 0x48, 0x29, 0xD8, 0x48, 0x83, 0xF8, 0x04, 0x0F, 0x8E, 0xA8, 0x00,
+    0x00, 0x00, 0x8B, 0x03, 0x48, 0x83, 0xED, 0x04, 0x8B, 0x4D, 0x00, 0x31, 0xF6, 0x48, 0x89, 0xEA,
+    0x48, 0x89, 0xDF, 0x89, 0x45, 0x00, 0x48, 0x29, 0xDA, 0x48, 0xC1, 0xFA, 0x02, 0xE8, 0x04, 0xFE,
+    0xFF, 0xFF, 0xEB, 0xCE, 0x48, 0xC1, 0xF8, 0x03, 0x8B, 0x73, 0x04, 0x8B, 0x55, 0xFC, 0x4C, 0x8D,
+    0x63, 0x04, 0x48, 0x8D, 0x3C, 0x83, 0x8B, 0x03, 0x8B, 0x0F, 0x39, 0xCE, 0x73, 0x13, 0x39, 0xD1,
+    0x73, 0x09, 0x89, 0x0B, 0x89, 0x07, 0x48, 0x89, 0xE8, 0xEB, 0x26, 0x39, 0xD6, 0x73, 0x06, 0xEB,
+    0x0F, 0x39, 0xD6, 0x73, 0x07, 0x89, 0x33, 0x89, 0x43, 0x04, 0xEB, 0xEA, 0x39, 0xD1, 0x73, 0xE2,
+    0x89, 0x13, 0x89, 0x45, 0xFC, 0xEB, 0xDF, 0x41, 0x89, 0x0C, 0x24, 0x49, 0x83, 0xC4, 0x04, 0x89,
+    0x10, 0x8B, 0x33, 0x41, 0x8B, 0x14, 0x24, 0x39, 0xF2, 0x73, 0x06, 0x49, 0x83, 0xC4, 0x04, 0xEB,
+    0xF2, 0x8B, 0x48, 0xFC, 0x48, 0x83, 0xE8, 0x04, 0x39, 0xCE, 0x72, 0xF5, 0x49, 0x39, 0xC4, 0x72,
+    0xD6, 0x49, 0xFF, 0xCD, 0x48, 0x89, 0xEE, 0x4C, 0x89, 0xE7, 0x4C, 0x89, 0xE5, 0x4C, 0x89, 0xEA,
+    0xE8, 0xFD, 0xFE, 0xFF, 0xFF, 0xE9, 0x09, 0xFF, 0xFF, 0xFF, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D,
+    0x41, 0x5E, 0xC3, 0x90, 0x48, 0x89, 0xF8, 0x31, 0xD2, 0x80, 0x7C, 0x16, 0x04, 0x00, 0x74, 0x3E,
+    0x44, 0x8B, 0x04, 0x16, 0x8B, 0x88, 0x80, 0x00, 0x00, 0x00, 0x44, 0x89, 0x04, 0x88, 0x8B, 0x88,
+    0x80, 0x00, 0x00, 0x00, 0x41, 0xB8, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x84, 0x00, 0x00, 0x00,
+    0xFF, 0xC1, 0x83, 0xE1, 0x1F, 0x89, 0x88, 0x80, 0x00, 0x00, 0x00, 0x8B, 0x88, 0x84, 0x00, 0x00,
+    0x00, 0x44, 0x39, 0xC1, 0x41, 0x0F, 0x47, 0xC8, 0x89, 0x88, 0x84, 0x00, 0x00, 0x00, 0x48, 0x83,
+    0xC2, 0x08, 0x48, 0x05, 0x88, 0x00, 0x00, 0x00, 0x48, 0x83, 0xFA, 0x30, 0x75, 0xAB, 0x0F, 0xB6,
+    0x46, 0x30, 0xFF, 0x87, 0x54, 0x03, 0x00, 0x00, 0xFF, 0x84, 0x87, 0x30, 0x03, 0x00, 0x00, 0x31,
+    0xC0, 0x80, 0x7E, 0x2C, 0x00, 0x74, 0x03, 0x8B, 0x46, 0x28, 0x01, 0x87, 0x58, 0x03, 0x00, 0x00,
+    0xC3, 0x90, 0x48, 0x89, 0xFA, 0x31, 0xC0, 0xB9, 0xCC, 0x00, 0x00, 0x00, 0xF3, 0xAB, 0x48, 0x8D,
+    0xBA, 0x30, 0x03, 0x00, 0x00, 0xB9, 0x09, 0x00, 0x00, 0x00, 0xF3, 0xAB, 0x31, 0xC0, 0x48, 0x89,
+    0x82, 0x54, 0x03, 0x00, 0x00, 0xC3, 0x41, 0x56, 0x31, 0xC0, 0x41, 0x55, 0x44, 0x0F, 0xB6, 0xEE,
+    0x41, 0x54, 0x49, 0x69, 0xF5, 0x88, 0x00, 0x00, 0x00, 0x55, 0x53, 0x89, 0xD3, 0x31, 0xD2, 0x48,
+    0x01, 0xFE, 0x48, 0x81, 0xEC, 0x90, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0x8B, 0x86,
+    0x84, 0x00, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x84, 0xBB, 0x00, 0x00, 0x00, 0x8D, 0x4B, 0xFF, 0x80,
+    0xF9, 0x63, 0x0F, 0x87, 0xAD, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x2C, 0x85, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x89, 0xFC, 0xB9, 0x20, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x10, 0x48, 0x89, 0xEA,
+    0x48, 0x8D, 0x44, 0x24, 0x10, 0xF3, 0xA5, 0x48, 0xC1, 0xFA, 0x02, 0x4C, 0x8D, 0x34, 0x28, 0x48,
+    0x89, 0xC7, 0x48, 0x0F, 0xBD, 0xD2, 0x4C, 0x89, 0xF6, 0x48, 0x63, 0xD2, 0x48, 0x01, 0xD2, 0xE8,
+    0xCE, 0xFD, 0xFF, 0xFF, 0x48, 0x83, 0xFD, 0x40, 0x76, 0x35, 0x48, 0x8D, 0x74, 0x24, 0x50, 0x48,
+    0x8D, 0x7C, 0x24, 0x10, 0xE8, 0x4C, 0xFD, 0xFF, 0xFF, 0x48, 0x8D, 0x44, 0x24, 0x50, 0x49, 0x39,
+    0xC6, 0x74, 0x29, 0x8B, 0x08, 0x48, 0x89, 0xC2, 0x8B, 0x72, 0xFC, 0x39, 0xF1, 0x73, 0x08, 0x89,
+    0x32, 0x48, 0x83, 0xEA, 0x04, 0xEB, 0xF1, 0x89, 0x0A, 0x48, 0x83, 0xC0, 0x04, 0xEB, 0xDF, 0x4C,
+    0x89, 0xF6, 0x48, 0x8D, 0x7C, 0x24, 0x10, 0xE8, 0x19, 0xFD, 0xFF, 0xFF, 0x4D, 0x69, 0xED, 0x88,
+    0x00, 0x00, 0x00, 0x0F, 0xB6, 0xC3, 0xB9, 0x64, 0x00, 0x00, 0x00, 0x31, 0xD2, 0x43, 0x0F, 0xAF,
+    0x84, 0x2C, 0x84, 0x00, 0x00, 0x00, 0x8D, 0x40, 0x63, 0xF7, 0xF1, 0xB2, 0x01, 0xFF, 0xC8, 0x8B,
+    0x44, 0x84, 0x10, 0xEB, 0x02, 0x31, 0xC0, 0x89, 0x44, 0x24, 0x08, 0x88, 0x54, 0x24, 0x0C, 0x48,
+    0x8B, 0x44, 0x24, 0x08, 0x48, 0x81, 0xC4, 0x90, 0x00, 0x00, 0x00, 0x5B, 0x5D, 0x41, 0x5C, 0x41,
+    0x5D, 0x41, 0x5E, 0xC3, 0x40, 0x0F, 0xB6, 0xF6, 0x48, 0x69, 0xF6, 0x88, 0x00, 0x00, 0x00, 0x8B,
+    0x84, 0x3E, 0x84, 0x00, 0x00, 0x00, 0xC3, 0x90, 0x31, 0xC0, 0x85, 0xFF, 0x74, 0x0B, 0x83, 0xF8,
+    0x12, 0x77, 0x06, 0xD1, 0xEF, 0xFF, 0xC0, 0xEB, 0xF1, 0xC3, 0x0F, 0xB6, 0xD2, 0x31, 0xC0, 0xB9,
+    0x0A, 0x00, 0x00, 0x00, 0x49, 0x89, 0xF8, 0xF3, 0xAB, 0x48, 0x69, 0xD2, 0x88, 0x00, 0x00, 0x00,
+    0x48, 0x01, 0xD6, 0x8B, 0x86, 0x84, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x14, 0x86, 0x48, 0x39, 0xD6,
+    0x74, 0x14, 0x8B, 0x3E, 0x48, 0x83, 0xC6, 0x04, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x89, 0xC0, 0x66,
+    0x41, 0xFF, 0x04, 0x40, 0xEB, 0xE7, 0x4C, 0x89, 0xC0, 0xC3, 0x55, 0x53, 0x48, 0x89, 0xF3, 0x48,
+    0x83, 0xEC, 0x28, 0x84, 0xD2, 0x75, 0x0C, 0x31, 0xC0, 0x48, 0x89, 0x46, 0x08, 0x48, 0x8B, 0x06,
+    0xC6, 0x00, 0x00, 0x8B, 0x2F, 0xBE, 0x0A, 0x00, 0x00, 0x00, 0x89, 0xEF, 0xE8, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x8D, 0x54, 0x24, 0x10, 0x48, 0x89, 0xE7, 0x89, 0xC6, 0x48, 0x89, 0x14, 0x24, 0x31,
+    0xD2, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x74, 0x24, 0x08, 0x48, 0x8B, 0x3C, 0x24, 0x89, 0xEA,
+    0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x54, 0x24, 0x08, 0x48, 0x8B, 0x34, 0x24, 0x48, 0xB8,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x48, 0x2B, 0x43, 0x08, 0x48, 0x39, 0xD0, 0x73,
+    0x0A, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xDF, 0xE8, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x89, 0xE7, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xC4, 0x28, 0x5B,
+    0x5D, 0xC3, 0x41, 0x57, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x49,
+    0x89, 0xF4, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x55, 0x31, 0xED, 0x53, 0x48, 0x89, 0xFB, 0x4C, 0x8D,
+    0xAB, 0x34, 0x03, 0x00, 0x00, 0x48, 0x81, 0xEC, 0x88, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24,
+    0x28, 0x48, 0x89, 0x7C, 0x24, 0x18, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x44, 0x24, 0x18,
+    0xBA, 0x01, 0x00, 0x00, 0x00, 0x48, 0xC7, 0x44, 0x24, 0x20, 0x0A, 0x00, 0x00, 0x00, 0x48, 0x8D,
+    0xBB, 0x54, 0x03, 0x00, 0x00, 0x48, 0x8D, 0x74, 0x24, 0x18, 0xC6, 0x40, 0x0A, 0x00, 0xE8, 0x17,
+    0xFF, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x18, 0xE8, 0x2C, 0xFB,
+    0xFF, 0xFF, 0xBA, 0x01, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x74, 0x24, 0x18, 0x48, 0x8D, 0xBB, 0x58,
+    0x03, 0x00, 0x00, 0xE8, 0xF2, 0xFE, 0xFF, 0xFF, 0x48, 0x8B, 0x7C, 0x24, 0x18, 0x41, 0xFF, 0xD4,
+    0xBE, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x18, 0xE8, 0xD5, 0xFA, 0xFF, 0xFF, 0xBE,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x18, 0xE8, 0xF0, 0xFA, 0xFF, 0xFF, 0x48, 0x8B,
+    0xB4, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x18, 0xE8, 0xDE, 0xFA, 0xFF, 0xFF,
+    0xBE, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x18, 0xE8, 0xCF, 0xFA, 0xFF, 0xFF, 0x49,
+    0x8D, 0x7C, 0x2D, 0x00, 0xBA, 0x01, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x74, 0x24, 0x18, 0xE8, 0x97,
+    0xFE, 0xFF, 0xFF, 0x48, 0x83, 0xC5, 0x04, 0x48, 0x83, 0xFD, 0x20, 0x75, 0xB2, 0x48, 0x8B, 0x7C,
+    0x24, 0x18, 0x4C, 0x8D, 0xAB, 0x84, 0x00, 0x00, 0x00, 0x31, 0xED, 0x41, 0xFF, 0xD4, 0x48, 0x8B,
+    0x34, 0xED, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x18, 0xE8, 0x64, 0xFA, 0xFF, 0xFF,
+    0xBE, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x18, 0xE8, 0x7F, 0xFA, 0xFF, 0xFF, 0x41,
+    0x8B, 0x45, 0x00, 0xBA, 0x01, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x74, 0x24, 0x18, 0x48, 0x8D, 0x7C,
+    0x24, 0x58, 0x89, 0x44, 0x24, 0x58, 0xE8, 0x3F, 0xFE, 0xFF, 0xFF, 0x41, 0x83, 0x7D, 0x00, 0x00,
+    0x0F, 0x84, 0xB5, 0x01, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x18,
+    0x41, 0x89, 0xEE, 0xE8, 0x46, 0xFA, 0xFF, 0xFF, 0xBA, 0x32, 0x00, 0x00, 0x00, 0x89, 0xEE, 0x48,
+    0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x58, 0x31, 0xC0, 0x80, 0x7C,
+    0x24, 0x5C, 0x00, 0x74, 0x04, 0x8B, 0x44, 0x24, 0x58, 0xBA, 0x01, 0x00, 0x00, 0x00, 0x48, 0x8D,
+    0x74, 0x24, 0x18, 0x48, 0x8D, 0x7C, 0x24, 0x38, 0x89, 0x44, 0x24, 0x38, 0xE8, 0xE9, 0xFD, 0xFF,
+    0xFF, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x18, 0xE8, 0xFE, 0xF9, 0xFF, 0xFF,
+    0xBA, 0x5A, 0x00, 0x00, 0x00, 0x44, 0x89, 0xF6, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x44, 0x24, 0x58, 0x31, 0xC0, 0x80, 0x7C, 0x24, 0x5C, 0x00, 0x74, 0x04, 0x8B, 0x44,
+    0x24, 0x58, 0xBA, 0x01, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x74, 0x24, 0x18, 0x48, 0x8D, 0x7C, 0x24,
+    0x38, 0x89, 0x44, 0x24, 0x38, 0xE8, 0xA0, 0xFD, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x8D, 0x7C, 0x24, 0x18, 0xE8, 0xB5, 0xF9, 0xFF, 0xFF, 0xBA, 0x64, 0x00, 0x00, 0x00, 0x44, 0x89,
+    0xF6, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x58, 0x31, 0xC0,
+    0x80, 0x7C, 0x24, 0x5C, 0x00, 0x74, 0x04, 0x8B, 0x44, 0x24, 0x58, 0xBA, 0x01, 0x00, 0x00, 0x00,
+    0x48, 0x8D, 0x74, 0x24, 0x18, 0x48, 0x8D, 0x7C, 0x24, 0x38, 0x89, 0x44, 0x24, 0x38, 0xE8, 0x57,
+    0xFD, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x18, 0x49, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xE8, 0x62, 0xF9, 0xFF, 0xFF, 0x44, 0x89, 0xF2, 0x48,
+    0x89, 0xDE, 0x48, 0x8D, 0x7C, 0x24, 0x58, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x8D, 0x74, 0x24,
+    0x58, 0x66, 0x41, 0x8B, 0x06, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x18, 0x66,
+    0x89, 0x44, 0x24, 0x08, 0xE8, 0x35, 0xF9, 0xFF, 0xFF, 0x0F, 0xB7, 0x44, 0x24, 0x08, 0xBE, 0x0A,
+    0x00, 0x00, 0x00, 0x89, 0xC7, 0x89, 0x44, 0x24, 0x08, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x2D,
+    0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x38, 0x89, 0x44, 0x24, 0x0C, 0x8B, 0x74, 0x24, 0x0C,
+    0x48, 0x8D, 0x44, 0x24, 0x48, 0x48, 0x89, 0x44, 0x24, 0x38, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x8B,
+    0x54, 0x24, 0x08, 0x8B, 0x74, 0x24, 0x0C, 0x48, 0x8B, 0x7C, 0x24, 0x38, 0xE8, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x8B, 0x54, 0x24, 0x40, 0x4C, 0x89, 0xF8, 0x48, 0x2B, 0x44, 0x24, 0x20, 0x48, 0x8B,
+    0x74, 0x24, 0x38, 0x48, 0x39, 0xD0, 0x73, 0x0A, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x18, 0x49, 0x83, 0xC6, 0x02, 0xE8, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8D, 0x7C, 0x24, 0x38, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x84, 0x24, 0x80, 0x00,
+    0x00, 0x00, 0x49, 0x39, 0xC6, 0x0F, 0x85, 0x56, 0xFF, 0xFF, 0xFF, 0x48, 0xFF, 0xC5, 0x48, 0x8B,
+    0x7C, 0x24, 0x18, 0x49, 0x81, 0xC5, 0x88, 0x00, 0x00, 0x00, 0x41, 0xFF, 0xD4, 0x48, 0x83, 0xFD,
+    0x06, 0x0F, 0x85, 0xE7, 0xFD, 0xFF, 0xFF, 0x48, 0x8D, 0x7C, 0x24, 0x18, 0xE8, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x81, 0xC4, 0x88, 0x00, 0x00, 0x00, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0x41, 0x5E,
+    0x41, 0x5F, 0xC3, 0x90, 0x48, 0x8B, 0x47, 0x30, 0x31, 0xD2, 0x48, 0x89, 0x57, 0x38, 0xC6, 0x00,
+    0x00, 0x80, 0x7F, 0x54, 0x00, 0x74, 0x04, 0xC6, 0x47, 0x54, 0x00, 0x31, 0xC0, 0x66, 0xC7, 0x47,
+    0x60, 0x00, 0x01, 0x48, 0x89, 0x47, 0x58, 0xC3, 0x48, 0x8B, 0x47, 0x08, 0x31, 0xD2, 0x31, 0xC9,
+    0x89, 0x17, 0x48, 0x89, 0x4F, 0x10, 0xC6, 0x00, 0x00, 0x83, 0x7F, 0x58, 0x00, 0x74, 0x08, 0x31,
+    0xC0, 0x89, 0x87, 0x00, 0x08, 0x00, 0x00, 0xEB, 0xBB, 0x90, 0x55, 0x53, 0x48, 0x89, 0xFB, 0x51,
+    0x40, 0x8A, 0x6F, 0x61, 0x40, 0x84, 0xED, 0x75, 0x04, 0x31, 0xED, 0xEB, 0x2A, 0x48, 0x8D, 0x7F,
+    0x30, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x85, 0xC0, 0x75, 0xEA, 0x8B,
+    0x43, 0x58, 0x85, 0xC0, 0x74, 0xE3, 0x89, 0x83, 0x00, 0x08, 0x00, 0x00, 0x48, 0x8B, 0x43, 0x50,
+    0x48, 0x89, 0x83, 0x04, 0x08, 0x00, 0x00, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x89,
+    0xE8, 0x5A, 0x5B, 0x5D, 0xC3, 0x90, 0x55, 0x48, 0x8D, 0x6F, 0x08, 0x53, 0x48, 0x89, 0xFB, 0x56,
+    0xBE, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x47, 0x28, 0x01, 0x48, 0x89, 0xEF, 0xE8, 0x00, 0x00, 0x00,
+    0x00, 0x85, 0xC0, 0x75, 0x14, 0x48, 0x8B, 0x43, 0x30, 0x31, 0xC9, 0x48, 0x89, 0x4B, 0x38, 0xC6,
+    0x00, 0x00, 0xB8, 0x02, 0x00, 0x00, 0x00, 0xEB, 0x38, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0xEF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x85, 0xC0, 0x75, 0x10, 0x31, 0xD2, 0xC6, 0x43, 0x54, 0x01,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0x53, 0x50, 0xEB, 0x17, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0xEF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x83, 0xF8, 0x01, 0x19, 0xC0, 0x83, 0xE0, 0x03, 0xFF,
+    0xC0, 0x89, 0x03, 0x58, 0x5B, 0x5D, 0xC3, 0x90, 0x53, 0x8D, 0x56, 0xBF, 0x48, 0x89, 0xFB, 0x0F,
+    0xB6, 0xC2, 0x48, 0x83, 0xEC, 0x40, 0x80, 0xFA, 0x19, 0x76, 0x43, 0x8D, 0x46, 0x9F, 0x8D, 0x4E,
+    0xB9, 0x3C, 0x19, 0x76, 0x0A, 0x8D, 0x46, 0xD0, 0x3C, 0x09, 0x77, 0x07, 0x8D, 0x4E, 0x04, 0xB2,
+    0x01, 0xEB, 0x1A, 0xB8, 0x3E, 0x00, 0x00, 0x00, 0x40, 0x80, 0xFE, 0x2B, 0x74, 0x20, 0xB8, 0x3F,
+    0x00, 0x00, 0x00, 0x40, 0x80, 0xFE, 0x2F, 0x74, 0x15, 0x31, 0xD2, 0x31, 0xC9, 0x0F, 0xB6, 0xC1,
+    0x88, 0xD4, 0x89, 0xC7, 0x66, 0xC1, 0xEF, 0x08, 0x0F, 0x84, 0x89, 0x00, 0x00, 0x00, 0x8B, 0x73,
+    0x58, 0x85, 0xF6, 0x75, 0x08, 0x31, 0xD2, 0x89, 0x93, 0x00, 0x08, 0x00, 0x00, 0x8B, 0x53, 0x5C,
+    0x8A, 0x4B, 0x60, 0x0F, 0xB6, 0xC0, 0xC1, 0xE2, 0x06, 0x09, 0xD0, 0x8D, 0x51, 0x06, 0x89, 0x43,
+    0x5C, 0x80, 0xFA, 0x07, 0x77, 0x05, 0x88, 0x53, 0x60, 0xEB, 0x66, 0x83, 0xE9, 0x02, 0x88, 0x4B,
+    0x60, 0x81, 0xFE, 0x9B, 0x07, 0x00, 0x00, 0x77, 0x0F, 0x89, 0xF2, 0xD3, 0xE8, 0xFF, 0xC6, 0x88,
+    0x44, 0x13, 0x62, 0x89, 0x73, 0x58, 0xEB, 0x2F, 0x80, 0x7B, 0x61, 0x00, 0x74, 0x29, 0x31, 0xC0,
+    0x48, 0x8D, 0x7C, 0x24, 0x0C, 0xB9, 0x0D, 0x00, 0x00, 0x00, 0xF3, 0xAB, 0xB8, 0x71, 0x55, 0xB2,
+    0xAB, 0x48, 0x8D, 0x7C, 0x24, 0x0C, 0x48, 0x01, 0xC0, 0x48, 0x89, 0x44, 0x24, 0x10, 0xE8, 0x00,
+    0x00, 0x00, 0x00, 0xC6, 0x43, 0x61, 0x00, 0x0F, 0xB6, 0x4B, 0x60, 0x83, 0xC8, 0xFF, 0xD3, 0xE0,
+    0xF7, 0xD0, 0x21, 0x43, 0x5C, 0xEB, 0x0A, 0x40, 0x80, 0xFE, 0x3D, 0x74, 0x04, 0xC6, 0x43, 0x61,
+    0x00, 0x48, 0x83, 0xC4, 0x40, 0x5B, 0xC3, 0x90, 0x53, 0x80, 0x7F, 0x28, 0x00, 0x48, 0x89, 0xFB,
+    0x74, 0x06, 0x40, 0x80, 0xFE, 0x20, 0x74, 0x65, 0x8B, 0x03, 0x83, 0xF8, 0x02, 0x75, 0x16, 0x48,
+    0x83, 0x7B, 0x38, 0x07, 0x77, 0x57, 0x40, 0x0F, 0xBE, 0xF6, 0x48, 0x8D, 0x7B, 0x30, 0xE8, 0x00,
+    0x00, 0x00, 0x00, 0xEB, 0x48, 0x83, 0xF8, 0x03, 0x75, 0x37, 0x8D, 0x46, 0xD0, 0x8A, 0x53, 0x54,
+    0x3C, 0x09, 0x77, 0x1D, 0x31, 0xC0, 0x84, 0xD2, 0x74, 0x03, 0x8B, 0x43, 0x50, 0x6B, 0xC0, 0x0A,
+    0x40, 0x0F, 0xBE, 0xF6, 0xC6, 0x43, 0x54, 0x01, 0x8D, 0x44, 0x30, 0xD0, 0x89, 0x43, 0x50, 0xEB,
+    0x1C, 0x84, 0xD2, 0x74, 0x04, 0xC6, 0x43, 0x54, 0x00, 0xC7, 0x03, 0x01, 0x00, 0x00, 0x00, 0xEB,
+    0x0C, 0x40, 0x0F, 0xBE, 0xF6, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x43, 0x28,
+    0x00, 0x5B, 0xC3, 0x90, 0x40, 0x80, 0xFE, 0x0D, 0x0F, 0x84, 0x8C, 0x00, 0x00, 0x00, 0x48, 0x83,
+    0xEC, 0x18, 0x8B, 0x07, 0x40, 0x80, 0xFE, 0x0A, 0x75, 0x3B, 0x85, 0xC0, 0x75, 0x22, 0x48, 0x83,
+    0x7F, 0x10, 0x00, 0x48, 0x89, 0x7C, 0x24, 0x08, 0x75, 0x0C, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x8B, 0x7C, 0x24, 0x08, 0xEB, 0x0C, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x7C, 0x24, 0x08,
+    0x31, 0xC0, 0x31, 0xD2, 0x31, 0xC9, 0x89, 0x17, 0x48, 0x8B, 0x57, 0x08, 0x48, 0x89, 0x4F, 0x10,
+    0xC6, 0x02, 0x00, 0xEB, 0x40, 0x85, 0xC0, 0x75, 0x2D, 0x40, 0x80, 0xFE, 0x3A, 0x75, 0x07, 0xE8,
+    0x00, 0x00, 0x00, 0x00, 0xEB, 0x0D, 0x48, 0x83, 0x7F, 0x10, 0x07, 0x76, 0x0A, 0xC7, 0x07, 0x01,
+    0x00, 0x00, 0x00, 0x31, 0xC0, 0xEB, 0x1E, 0x40, 0x0F, 0xBE, 0xF6, 0x48, 0x83, 0xC7, 0x08, 0xE8,
+    0x00, 0x00, 0x00, 0x00, 0xEB, 0xED, 0xFF, 0xC8, 0x74, 0xE9, 0x40, 0x0F, 0xBE, 0xF6, 0xE8, 0x00,
+    0x00, 0x00, 0x00, 0xEB, 0xDE, 0x48, 0x83, 0xC4, 0x18, 0xC3, 0x31, 0xC0, 0xC3, 0x90, 0x48, 0xB8,
+    0x67, 0xE6, 0x09, 0x6A, 0x85, 0xAE, 0x67, 0xBB, 0x31, 0xD2, 0x48, 0x89, 0x07, 0x48, 0xB8, 0x72,
+    0xF3, 0x6E, 0x3C, 0x3A, 0xF5, 0x4F, 0xA5, 0x48, 0x89, 0x47, 0x08, 0x48, 0xB8, 0x7F, 0x52, 0x0E,
+    0x51, 0x8C, 0x68, 0x05, 0x9B, 0x48, 0x89, 0x47, 0x10, 0x48, 0xB8, 0xAB, 0xD9, 0x83, 0x1F, 0x19,
+    0xCD, 0xE0, 0x5B, 0x48, 0x89, 0x47, 0x18, 0x31, 0xC0, 0x89, 0x47, 0x60, 0x48, 0x89, 0x57, 0x68,
+    0xC3, 0x90, 0x41, 0x57, 0x48, 0x89, 0xF8, 0x31, 0xC9, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x55,
+    0x53, 0x48, 0x81, 0xEC, 0xA0, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x14, 0x0E, 0x0F, 0xB6, 0x7C, 0x0E,
+    0x01, 0xC1, 0xE2, 0x18, 0xC1, 0xE7, 0x10, 0x09, 0xFA, 0x0F, 0xB6, 0x7C, 0x0E, 0x03, 0x09, 0xFA,
+    0x0F, 0xB6, 0x7C, 0x0E, 0x02, 0xC1, 0xE7, 0x08, 0x09, 0xFA, 0x89, 0x54, 0x0C, 0xA0, 0x48, 0x83,
+    0xC1, 0x04, 0x48, 0x83, 0xF9, 0x40, 0x75, 0xD0, 0x48, 0x8D, 0x54, 0x24, 0xA0, 0x4C, 0x8D, 0x44,
+    0x24, 0x60, 0x8B, 0x72, 0x04, 0x8B, 0x7A, 0x38, 0x48, 0x83, 0xC2, 0x04, 0x89, 0xF1, 0x41, 0x89,
+    0xF1, 0xC1, 0xEE, 0x03, 0x41, 0xC1, 0xC1, 0x0E, 0xC1, 0xC9, 0x07, 0x44, 0x31, 0xC9, 0x41, 0x89,
+    0xF9, 0x31, 0xF1, 0x8B, 0x72, 0x20, 0x03, 0x72, 0xFC, 0x41, 0xC1, 0xC1, 0x0D, 0x01, 0xF1, 0x89,
+    0xFE, 0xC1, 0xEF, 0x0A, 0xC1, 0xC6, 0x0F, 0x44, 0x31, 0xCE, 0x31, 0xFE, 0x01, 0xF1, 0x89, 0x4A,
+    0x3C, 0x49, 0x39, 0xD0, 0x75, 0xBC, 0x8B, 0x58, 0x08, 0x44, 0x8B, 0x28, 0x45, 0x31, 0xD2, 0x44,
+    0x8B, 0x60, 0x04, 0x89, 0x5C, 0x24, 0x88, 0x8B, 0x58, 0x0C, 0x44, 0x89, 0xEF, 0x44, 0x8B, 0x44,
+    0x24, 0x88, 0x45, 0x89, 0xE1, 0x89, 0x5C, 0x24, 0x8C, 0x8B, 0x58, 0x10, 0x44, 0x8B, 0x74, 0x24,
+    0x8C, 0x89, 0x5C, 0x24, 0x90, 0x8B, 0x58, 0x14, 0x8B, 0x74, 0x24, 0x90, 0x89, 0x5C, 0x24, 0x94,
+    0x8B, 0x58, 0x18, 0x8B, 0x6C, 0x24, 0x94, 0x89, 0x5C, 0x24, 0x98, 0x8B, 0x58, 0x1C, 0x89, 0x5C,
+    0x24, 0x9C, 0x41, 0x89, 0xDB, 0x8B, 0x5C, 0x24, 0x98, 0x89, 0xF1, 0x89, 0xF2, 0x41, 0x89, 0xF7,
+    0xC1, 0xC9, 0x06, 0xC1, 0xCA, 0x0B, 0x41, 0x21, 0xEF, 0x31, 0xCA, 0x89, 0xF1, 0xC1, 0xC1, 0x07,
+    0x31, 0xCA, 0x42, 0x8B, 0x4C, 0x14, 0xA0, 0x41, 0x03, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x49, 0x83,
+    0xC2, 0x04, 0x01, 0xCA, 0x89, 0xF1, 0xF7, 0xD1, 0x21, 0xD9, 0x44, 0x31, 0xF9, 0x45, 0x89, 0xCF,
+    0x01, 0xCA, 0x89, 0xF9, 0x45, 0x21, 0xC7, 0x44, 0x01, 0xDA, 0x41, 0x89, 0xFB, 0xC1, 0xC9, 0x02,
+    0x41, 0xC1, 0xCB, 0x0D, 0x41, 0x31, 0xCB, 0x89, 0xF9, 0xC1, 0xC1, 0x0A, 0x41, 0x31, 0xCB, 0x44,
+    0x89, 0xC9, 0x44, 0x31, 0xC1, 0x21, 0xF9, 0x44, 0x31, 0xF9, 0x46, 0x8D, 0x3C, 0x32, 0x45, 0x89,
+    0xC6, 0x44, 0x01, 0xD9, 0x41, 0x89, 0xDB, 0x01, 0xD1, 0x49, 0x81, 0xFA, 0x00, 0x01, 0x00, 0x00,
+    0x74, 0x14, 0x89, 0xEB, 0x45, 0x89, 0xC8, 0x89, 0xF5, 0x41, 0x89, 0xF9, 0x44, 0x89, 0xFE, 0x89,
+    0xCF, 0xE9, 0x73, 0xFF, 0xFF, 0xFF, 0x8B, 0x54, 0x24, 0x88, 0x41, 0x01, 0xCD, 0x41, 0x01, 0xFC,
+    0x44, 0x89, 0x28, 0x44, 0x01, 0xCA, 0x44, 0x89, 0x60, 0x04, 0x89, 0x50, 0x08, 0x8B, 0x54, 0x24,
+    0x8C, 0x44, 0x01, 0xC2, 0x89, 0x50, 0x0C, 0x8B, 0x54, 0x24, 0x90, 0x44, 0x01, 0xFA, 0x89, 0x50,
+    0x10, 0x8B, 0x54, 0x24, 0x94, 0x01, 0xF2, 0x89, 0x50, 0x14, 0x8B, 0x54, 0x24, 0x98, 0x01, 0xEA,
+    0x89, 0x50, 0x18, 0x8B, 0x54, 0x24, 0x9C, 0x01, 0xDA, 0x89, 0x50, 0x1C, 0x48, 0x81, 0xC4, 0xA0,
+    0x00, 0x00, 0x00, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0x41, 0x5E, 0x41, 0x5F, 0xC3, 0x41, 0x55,
+    0x89, 0xD2, 0x4C, 0x8D, 0x6F, 0x20, 0x41, 0x54, 0x4C, 0x8D, 0x24, 0x16, 0x55, 0x48, 0x89, 0xF5,
+    0x53, 0x48, 0x89, 0xFB, 0x48, 0x01, 0x57, 0x68, 0x4C, 0x39, 0xE5, 0x74, 0x2C, 0x8B, 0x43, 0x60,
+    0x8A, 0x55, 0x00, 0x88, 0x54, 0x03, 0x20, 0x8B, 0x43, 0x60, 0xFF, 0xC0, 0x89, 0x43, 0x60, 0x83,
+    0xF8, 0x40, 0x75, 0x10, 0x4C, 0x89, 0xEE, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x31,
+    0xC0, 0x89, 0x43, 0x60, 0x48, 0xFF, 0xC5, 0xEB, 0xCF, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0xC3,
+    0x41, 0x54, 0x55, 0x48, 0x89, 0xFD, 0x53, 0x48, 0x8B, 0x46, 0x68, 0x48, 0x89, 0xF3, 0x4C, 0x8D,
+    0x24, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x46, 0x60, 0xC6, 0x44, 0x06, 0x20, 0x80, 0x8B, 0x46,
+    0x60, 0xFF, 0xC0, 0x89, 0x46, 0x60, 0x83, 0xF8, 0x38, 0x76, 0x23, 0x8B, 0x53, 0x60, 0x83, 0xFA,
+    0x3F, 0x77, 0x0A, 0xC6, 0x44, 0x13, 0x20, 0x00, 0xFF, 0x43, 0x60, 0xEB, 0xEE, 0x48, 0x8D, 0x73,
+    0x20, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x31, 0xC0, 0x89, 0x43, 0x60, 0x8B, 0x53,
+    0x60, 0x83, 0xFA, 0x37, 0x77, 0x0A, 0xC6, 0x44, 0x13, 0x20, 0x00, 0xFF, 0x43, 0x60, 0xEB, 0xEE,
+    0x31, 0xC0, 0x6B, 0xC8, 0xF8, 0x4C, 0x89, 0xE2, 0x48, 0xD3, 0xEA, 0x88, 0x54, 0x03, 0x5F, 0x48,
+    0xFF, 0xC8, 0x48, 0x83, 0xF8, 0xF8, 0x75, 0xEA, 0x48, 0x89, 0xDF, 0x48, 0x8D, 0x73, 0x20, 0xE8,
+    0x00, 0x00, 0x00, 0x00, 0x31, 0xC0, 0xB9, 0x08, 0x00, 0x00, 0x00, 0x48, 0x89, 0xEF, 0xF3, 0xAB,
+    0x48, 0x89, 0xE8, 0x31, 0xFF, 0x8B, 0x0C, 0x3B, 0x48, 0x83, 0xC7, 0x04, 0x48, 0x83, 0xC0, 0x04,
+    0x89, 0xCE, 0x88, 0x68, 0xFE, 0xC1, 0xEE, 0x18, 0x88, 0x48, 0xFF, 0x40, 0x88, 0x70, 0xFC, 0x89,
+    0xCE, 0xC1, 0xEE, 0x10, 0x40, 0x88, 0x70, 0xFD, 0x48, 0x83, 0xFF, 0x20, 0x75, 0xD7, 0x48, 0x89,
+    0xE8, 0x5B, 0x5D, 0x41, 0x5C, 0xC3, 0x48, 0x83, 0x7F, 0x08, 0x00, 0x75, 0x16, 0x53, 0x48, 0x89,
+    0xFB, 0x8B, 0x3F, 0xBE, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x43,
+    0x08, 0x5B, 0xC3, 0xC3, 0x48, 0x8B, 0x57, 0x10, 0x48, 0x8B, 0x47, 0x08, 0x48, 0x85, 0xD2, 0x74,
+    0x05, 0x48, 0x39, 0xF2, 0x75, 0x05, 0x48, 0x89, 0x77, 0x10, 0xC3, 0x48, 0x83, 0xEC, 0x48, 0x31,
+    0xC0, 0xB9, 0x0D, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x0C, 0xF3, 0xAB, 0x48, 0x8D, 0x7C,
+    0x24, 0x0C, 0xC7, 0x44, 0x24, 0x10, 0x39, 0xBB, 0x7B, 0x42, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x31,
+    0xC0, 0x48, 0x83, 0xC4, 0x48, 0xC3, 0x48, 0x39, 0x77, 0x10, 0x75, 0x06, 0x31, 0xC0, 0x48, 0x89,
+    0x47, 0x10, 0xC3, 0x90, 0x8B, 0x4F, 0x20, 0x31, 0xD2, 0x39, 0xCA, 0x73, 0x21, 0x48, 0x8B, 0x47,
+    0x18, 0x31, 0xF6, 0x45, 0x31, 0xC0, 0x0F, 0xB7, 0x04, 0x50, 0x48, 0xFF, 0xC2, 0x48, 0x6B, 0xC0,
+    0x0C, 0x48, 0x03, 0x47, 0x10, 0x48, 0x89, 0x30, 0x44, 0x89, 0x40, 0x08, 0xEB, 0xDB, 0x31, 0xC0,
+    0x31, 0xD2, 0x89, 0x47, 0x20, 0x48, 0x89, 0x57, 0x08, 0xC3, 0x53, 0x48, 0x83, 0x3F, 0x00, 0x48,
+    0x89, 0xFB, 0x75, 0x38, 0xBE, 0x01, 0x00, 0x00, 0x00, 0xBF, 0xB4, 0x2D, 0x00, 0x00, 0xE8, 0x00,
+    0x00, 0x00, 0x00, 0xBE, 0x01, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x30, 0x00, 0x00, 0x48, 0x89, 0x03,
+    0xE8, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x01, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x08, 0x00, 0x00, 0x48,
+    0x89, 0x43, 0x10, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x43, 0x18, 0x48, 0x89, 0xDF, 0x5B,
+    0xEB, 0x82, 0x66, 0x81, 0xFE, 0xFF, 0x03, 0x77, 0x3A, 0x48, 0x8B, 0x47, 0x10, 0x48, 0x85, 0xC0,
+    0x74, 0x31, 0x0F, 0xB7, 0xF6, 0x48, 0x6B, 0xF6, 0x0C, 0x48, 0x01, 0xF0, 0x8B, 0x50, 0x04, 0x8B,
+    0x08, 0x40, 0x8A, 0x70, 0x06, 0x40, 0x8A, 0x78, 0x07, 0x66, 0x85, 0xD2, 0x74, 0x15, 0x89, 0xD0,
+    0x66, 0xD1, 0xE8, 0x0F, 0xB7, 0xC0, 0x01, 0xC8, 0x0F, 0xB7, 0xCA, 0x31, 0xD2, 0xF7, 0xF1, 0xB2,
+    0x01, 0xEB, 0x08, 0x31, 0xD2, 0x31, 0xC0, 0x31, 0xF6, 0x31, 0xFF, 0x40, 0x88, 0x7C, 0x24, 0xFC,
+    0x40, 0x88, 0x74, 0x24, 0xFD, 0x88, 0x44, 0x24, 0xFE, 0x88, 0x54, 0x24, 0xFF, 0x8B, 0x44, 0x24,
+    0xFC, 0xC3, 0x48, 0x8B, 0x47, 0x18, 0x89, 0xF6, 0x66, 0x8B, 0x04, 0x70, 0xC3, 0x90, 0x0F, 0xB7,
+    0x06, 0x48, 0x89, 0xC1, 0x48, 0x6B, 0xC0, 0x0C, 0x48, 0x03, 0x47, 0x10, 0x66, 0x83, 0x78, 0x04,
+    0x00, 0x75, 0x1A, 0x44, 0x8B, 0x4F, 0x20, 0x4C, 0x8B, 0x47, 0x18, 0x4C, 0x89, 0xCA, 0x66, 0x44,
+    0x89, 0x48, 0x08, 0xFF, 0xC2, 0x66, 0x43, 0x89, 0x0C, 0x48, 0x89, 0x57, 0x20, 0x0F, 0xB6, 0x56,
+    0x02, 0x66, 0xFF, 0x40, 0x04, 0x01, 0x10, 0x8A, 0x50, 0x06, 0x8A, 0x4E, 0x02, 0x38, 0xCA, 0x0F,
+    0x42, 0xD1, 0x88, 0x50, 0x06, 0x8A, 0x50, 0x07, 0x8A, 0x4E, 0x02, 0x38, 0xCA, 0x0F, 0x42, 0xD1,
+    0x88, 0x50, 0x07, 0xC3, 0x44, 0x8B, 0x57, 0x0C, 0x48, 0x89, 0xF9, 0x31, 0xFF, 0x41, 0x89, 0xF0,
+    0x41, 0xB9, 0x2D, 0x00, 0x00, 0x00, 0x31, 0xF6, 0x41, 0x39, 0xFA, 0x75, 0x03, 0x89, 0xF0, 0xC3,
+    0x53, 0x8B, 0x41, 0x08, 0x31, 0xD2, 0x01, 0xF8, 0x41, 0xF7, 0xF1, 0x31, 0xC0, 0x89, 0xD2, 0x48,
+    0x69, 0xD2, 0x04, 0x01, 0x00, 0x00, 0x48, 0x03, 0x11, 0x8B, 0x1A, 0x39, 0xD8, 0x73, 0x19, 0x66,
+    0x44, 0x39, 0x44, 0x82, 0x04, 0x75, 0x0C, 0x44, 0x8A, 0x5C, 0x82, 0x06, 0x44, 0x38, 0xDE, 0x41,
+    0x0F, 0x42, 0xF3, 0x48, 0xFF, 0xC0, 0xEB, 0xE3, 0xFF, 0xC7, 0x41, 0x39, 0xFA, 0x75, 0xC2, 0x89,
+    0xF0, 0x5B, 0xC3, 0x90, 0x53, 0x0F, 0xB7, 0x1E, 0x4C, 0x8B, 0x47, 0x10, 0x0F, 0xB6, 0x56, 0x02,
+    0x48, 0x89, 0xD8, 0x48, 0x6B, 0xDB, 0x0C, 0x4C, 0x01, 0xC3, 0x29, 0x13, 0x66, 0xFF, 0x4B, 0x04,
+    0x75, 0x34, 0x8B, 0x47, 0x20, 0x48, 0x8B, 0x4F, 0x18, 0x0F, 0xB7, 0x73, 0x08, 0xFF, 0xC8, 0x48,
+    0x89, 0xC2, 0x0F, 0xB7, 0x04, 0x41, 0x66, 0x89, 0x04, 0x71, 0x48, 0x6B, 0xC0, 0x0C, 0x8B, 0x4B,
+    0x08, 0x66, 0x41, 0x89, 0x4C, 0x00, 0x08, 0x31, 0xC0, 0x89, 0x57, 0x20, 0x31, 0xD2, 0x48, 0x89,
+    0x03, 0x89, 0x53, 0x08, 0xEB, 0x10, 0x3A, 0x53, 0x06, 0x75, 0x0B, 0x0F, 0xB7, 0xF0, 0xE8, 0x00,
+    0x00, 0x00, 0x00, 0x88, 0x43, 0x06, 0x5B, 0xC3, 0x41, 0x54, 0xB9, 0x2D, 0x00, 0x00, 0x00, 0x31,
+    0xD2, 0x45, 0x31, 0xE4, 0x55, 0x53, 0x8B, 0x6F, 0x08, 0x48, 0x89, 0xFB, 0xFF, 0x4F, 0x0C, 0x48,
+    0x89, 0xE8, 0x48, 0x69, 0xED, 0x04, 0x01, 0x00, 0x00, 0x48, 0x03, 0x2F, 0xFF, 0xC0, 0xF7, 0xF1,
+    0x89, 0x57, 0x08, 0x44, 0x3B, 0x65, 0x00, 0x73, 0x15, 0x44, 0x89, 0xE0, 0x48, 0x89, 0xDF, 0x41,
+    0xFF, 0xC4, 0x48, 0x8D, 0x74, 0x85, 0x04, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xE5, 0x5B, 0x5D,
+    0x41, 0x5C, 0xC3, 0x90, 0x45, 0x31, 0xC0, 0x44, 0x89, 0x02, 0x48, 0x85, 0xFF, 0x0F, 0x84, 0xFF,
+    0x00, 0x00, 0x00, 0x41, 0x57, 0x41, 0x89, 0xF7, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x55, 0x53,
+    0x51, 0x83, 0xFE, 0x01, 0x0F, 0x86, 0xDC, 0x00, 0x00, 0x00, 0x66, 0x8B, 0x2F, 0x48, 0x89, 0xFB,
+    0x66, 0xC1, 0xC5, 0x08, 0x89, 0xE8, 0x66, 0x25, 0x00, 0xC0, 0x66, 0x3D, 0x00, 0xC0, 0x0F, 0x85,
+    0xC2, 0x00, 0x00, 0x00, 0x49, 0x89, 0xD5, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x44, 0x8D, 0x70, 0x02,
+    0x41, 0x89, 0xC4, 0x45, 0x39, 0xF7, 0x0F, 0x82, 0xAA, 0x00, 0x00, 0x00, 0x89, 0xC0, 0x41, 0x8D,
+    0x54, 0x24, 0x01, 0x0F, 0xB6, 0x04, 0x03, 0x0F, 0xB6, 0x14, 0x13, 0xC1, 0xE0, 0x08, 0x09, 0xD0,
+    0x6B, 0xC0, 0x06, 0x44, 0x01, 0xF0, 0x41, 0x39, 0xC7, 0x0F, 0x85, 0x87, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0xDF, 0x81, 0xE5, 0xFF, 0x3F, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x40, 0x00,
+    0x00, 0x00, 0x39, 0xC8, 0x0F, 0x46, 0xC8, 0x8D, 0x04, 0x80, 0x41, 0x83, 0xC4, 0x04, 0x31, 0xFF,
+    0x42, 0x8D, 0x14, 0x30, 0x39, 0xCF, 0x74, 0x5E, 0x44, 0x89, 0xE0, 0x41, 0x8D, 0x74, 0x24, 0x01,
+    0x0F, 0xB6, 0x04, 0x03, 0x0F, 0xB6, 0x34, 0x33, 0xC1, 0xE0, 0x08, 0x09, 0xF0, 0x39, 0xE8, 0x73,
+    0x3D, 0x8D, 0x04, 0x80, 0x8D, 0x70, 0x02, 0x83, 0xC0, 0x03, 0x0F, 0xB6, 0x34, 0x33, 0x0F, 0xB6,
+    0x04, 0x03, 0xC1, 0xE6, 0x08, 0x09, 0xF0, 0x3D, 0xFF, 0x03, 0x00, 0x00, 0x7F, 0x20, 0x41, 0x8B,
+    0x75, 0x00, 0x44, 0x8D, 0x04, 0x17, 0x46, 0x8A, 0x0C, 0x03, 0x41, 0x89, 0xF0, 0xFF, 0xC6, 0x66,
+    0x43, 0x89, 0x44, 0x85, 0x04, 0x47, 0x88, 0x4C, 0x85, 0x06, 0x41, 0x89, 0x75, 0x00, 0xFF, 0xC7,
+    0x41, 0x83, 0xC4, 0x05, 0xEB, 0x9E, 0x58, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0x41, 0x5E, 0x41,
+    0x5F, 0xC3, 0xC3, 0x90, 0x41, 0x56, 0x41, 0x55, 0x41, 0x89, 0xD5, 0x41, 0x54, 0x49, 0x89, 0xF4,
+    0x55, 0x53, 0x8B, 0x77, 0x0C, 0x48, 0x89, 0xFB, 0x4C, 0x8B, 0x37, 0x8B, 0x47, 0x08, 0x85, 0xF6,
+    0x74, 0x44, 0xB9, 0x2D, 0x00, 0x00, 0x00, 0x8D, 0x44, 0x06, 0xFF, 0x31, 0xD2, 0xF7, 0xF1, 0x31,
+    0xC9, 0x89, 0xD2, 0x48, 0x69, 0xD2, 0x04, 0x01, 0x00, 0x00, 0x4C, 0x01, 0xF2, 0x8B, 0x3A, 0x39,
+    0xF9, 0x73, 0x16, 0x0F, 0xB7, 0x44, 0x8A, 0x04, 0x48, 0xFF, 0xC1, 0x48, 0x6B, 0xC0, 0x0C, 0x48,
+    0x03, 0x43, 0x10, 0xC6, 0x40, 0x07, 0x00, 0xEB, 0xE6, 0x83, 0xFE, 0x2D, 0x75, 0x08, 0x48, 0x89,
+    0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x43, 0x0C, 0x8B, 0x53, 0x08, 0xB9, 0x2D, 0x00, 0x00,
+    0x00, 0x44, 0x89, 0xEE, 0x4C, 0x89, 0xE7, 0xFF, 0xC0, 0x89, 0x43, 0x0C, 0x8D, 0x44, 0x10, 0xFF,
+    0x31, 0xD2, 0xF7, 0xF1, 0x89, 0xD5, 0x48, 0x69, 0xED, 0x04, 0x01, 0x00, 0x00, 0x4C, 0x01, 0xF5,
+    0x48, 0x89, 0xEA, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x45, 0x31, 0xD2, 0x44, 0x3B, 0x55, 0x00, 0x73,
+    0x15, 0x44, 0x89, 0xD0, 0x48, 0x89, 0xDF, 0x41, 0xFF, 0xC2, 0x48, 0x8D, 0x74, 0x85, 0x04, 0xE8,
+    0x00, 0x00, 0x00, 0x00, 0xEB, 0xE5, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0x41, 0x5E, 0xC3, 0x90,
+    0x31, 0xC0, 0xBA, 0x00, 0xFF, 0x00, 0x00, 0x40, 0x3A, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x72, 0x06,
+    0x8B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xC0, 0x08, 0x48, 0x83, 0xF8, 0x20, 0x75, 0xE7,
+    0x89, 0xD0, 0xC3, 0x90, 0x48, 0x85, 0xF6, 0x74, 0x25, 0x83, 0xFA, 0x01, 0x76, 0x20, 0x83, 0xEA,
+    0x02, 0x49, 0x89, 0xFB, 0xB8, 0x38, 0x01, 0x00, 0x00, 0x81, 0xFA, 0x1C, 0x06, 0x00, 0x00, 0x77,
+    0x10, 0x89, 0xD0, 0xB9, 0x05, 0x00, 0x00, 0x00, 0x31, 0xD2, 0xF7, 0xF1, 0xEB, 0x03, 0x31, 0xC0,
+    0xC3, 0x49, 0x8B, 0x53, 0x08, 0x4C, 0x8D, 0x46, 0x02, 0x8B, 0x52, 0x20, 0x39, 0xD0, 0x0F, 0x46,
+    0xD0, 0x45, 0x31, 0xD2, 0x89, 0xD0, 0x41, 0x89, 0xD1, 0x86, 0xE0, 0x66, 0x89, 0x06, 0x41, 0x39,
+    0xD2, 0x72, 0x07, 0x8D, 0x04, 0x92, 0x83, 0xC0, 0x02, 0xC3, 0x53, 0x48, 0x83, 0xEC, 0x10, 0x49,
+    0x8B, 0x7B, 0x08, 0x48, 0x8B, 0x47, 0x18, 0x42, 0x0F, 0xB7, 0x34, 0x50, 0x89, 0xF3, 0xE8, 0x00,
+    0x00, 0x00, 0x00, 0x31, 0xFF, 0x89, 0x44, 0x24, 0x0C, 0x80, 0x7C, 0x24, 0x0F, 0x00, 0x74, 0x05,
+    0x0F, 0xB6, 0x7C, 0x24, 0x0E, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0xCF, 0x49, 0xFF, 0xC2,
+    0x41, 0x88, 0x58, 0x01, 0x89, 0xC2, 0x41, 0x88, 0x08, 0x0F, 0xB6, 0xCC, 0x49, 0x83, 0xC0, 0x05,
+    0xC1, 0xEA, 0x10, 0x41, 0x88, 0x48, 0xFE, 0x41, 0x88, 0x50, 0xFD, 0x41, 0x88, 0x40, 0xFF, 0x45,
+    0x39, 0xCA, 0x72, 0xAB, 0x43, 0x8D, 0x04, 0x89, 0x48, 0x83, 0xC4, 0x10, 0x83, 0xC0, 0x02, 0x5B,
+    0xC3, 0x8B, 0x05, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x50, 0x01, 0x8D, 0x48, 0x02, 0x31, 0xC0, 0x89,
+    0x15, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xE9, 0x83, 0xE1, 0x01, 0x48, 0x69, 0xC9, 0xA0, 0x07, 0x00,
+    0x00, 0x48, 0x03, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x89, 0x01, 0x48, 0x8B, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x85, 0xC0, 0x74, 0x42, 0x48, 0x8B, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x48, 0x03, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x31, 0xD2, 0x48, 0xFF, 0xC8, 0x48, 0x8D, 0x77, 0x01, 0x48, 0xF7, 0xF6,
+    0x31, 0xC0, 0x48, 0x69, 0xD2, 0xA0, 0x07, 0x00, 0x00, 0x48, 0x03, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x8B, 0x32, 0x39, 0xF0, 0x73, 0x10, 0x89, 0xC6, 0xFF, 0xC0, 0x40, 0x8A, 0x7C, 0x32, 0x04, 0x40,
+    0x88, 0x7C, 0x31, 0x04, 0xEB, 0xEA, 0x89, 0x31, 0x8B, 0x05, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
+    0x89, 0x05, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x48, 0x83, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75,
+    0x6C, 0x48, 0x83, 0xEC, 0x18, 0xBE, 0x01, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x5E, 0x01, 0x00, 0xE8,
+    0x00, 0x00, 0x00, 0x00, 0xBE, 0x01, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x0F, 0x00, 0x00, 0x48, 0x89,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x05, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0x05, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x34, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x0C, 0x31, 0xC0, 0x89, 0x44,
+    0x24, 0x0C, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x54, 0x24, 0x0C, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0xC6, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xC4, 0x18, 0xC3, 0xC3, 0x52, 0x31,
+    0xC9, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x89, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x31, 0xF6, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x35, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x35, 0x00, 0x00, 0x00, 0x00,
+    0xE8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE8,
+    0xBD, 0xFE, 0xFF, 0xFF, 0x80, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x07, 0xC6, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xC3, 0x89, 0x3D, 0x00,
+    0x00, 0x00, 0x00, 0xC3, 0x8B, 0x05, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x89, 0x3D, 0x00, 0x00, 0x00,
+    0x00, 0xC3, 0x8B, 0x05, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x48, 0x89, 0x7C, 0x24, 0xF8, 0x80, 0x7C,
+    0x24, 0xFC, 0x00, 0x74, 0x17, 0x80, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x0E, 0x8B, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x39, 0x44, 0x24, 0xF8, 0x74, 0x1A, 0x83, 0x3D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x75, 0x11, 0x80, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x14, 0xC6, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x48, 0x8B, 0x44, 0x24, 0xF8, 0x48, 0x89, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0xC3, 0x48, 0x8B, 0x05, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x48, 0x89, 0x7C, 0x24, 0xF8,
+    0x8A, 0x44, 0x24, 0xFC, 0x84, 0xC0, 0x74, 0x17, 0x80, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74,
+    0x10, 0x8B, 0x44, 0x24, 0xF8, 0x39, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x92, 0xC0, 0xC3, 0xB0,
+    0x01, 0xC3, 0x8A, 0x05, 0x00, 0x00, 0x00, 0x00, 0x84, 0xC0, 0x74, 0x11, 0x48, 0x8B, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x39, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x94, 0xC0, 0xC3, 0x8B, 0x15,
+    0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x85, 0xD2, 0x74, 0x1B, 0xB8, 0x00, 0x00,
+    0x00, 0x00, 0x83, 0xFA, 0x01, 0x74, 0x11, 0x83, 0xFA, 0x02, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xBA,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x0F, 0x45, 0xC2, 0xC3, 0x8B, 0x05, 0x00, 0x00, 0x00, 0x00, 0x31,
+    0xD2, 0x83, 0xF8, 0x03, 0x77, 0x08, 0x48, 0x8B, 0x14, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0xD0, 0xC3, 0x31, 0xC0, 0x89, 0x47, 0x1C, 0x6B, 0x47, 0x14, 0x03, 0x83, 0xC0, 0x08, 0x89, 0x47,
+    0x20, 0xC3, 0x53, 0x31, 0xC0, 0x48, 0x89, 0xFB, 0x48, 0x83, 0xEC, 0x40, 0x48, 0x89, 0x47, 0x08,
+    0x48, 0x89, 0x47, 0x10, 0x48, 0x89, 0x47, 0x18, 0xC7, 0x47, 0x20, 0x08, 0x00, 0x00, 0x00, 0x48,
+    0x85, 0xF6, 0x74, 0x50, 0x83, 0xFA, 0x07, 0x76, 0x4B, 0x80, 0x3E, 0x54, 0x75, 0x46, 0x80, 0x7E,
+    0x01, 0x42, 0x75, 0x40, 0x80, 0x7E, 0x02, 0x4F, 0x75, 0x3A, 0x80, 0x7E, 0x03, 0x44, 0x75, 0x34,
+    0x80, 0x7E, 0x04, 0x01, 0x75, 0x2E, 0x0F, 0xB6, 0x46, 0x05, 0x3C, 0x40, 0x77, 0x26, 0x8D, 0x04,
+    0x40, 0x83, 0xC0, 0x08, 0x39, 0xC2, 0x72, 0x1C, 0x48, 0x89, 0x77, 0x08, 0x89, 0x57, 0x10, 0x0F,
+    0xB6, 0x46, 0x05, 0x89, 0x47, 0x14, 0x0F, 0xB7, 0x46, 0x06, 0x89, 0x47, 0x18, 0xE8, 0x00, 0x00,
+    0x00, 0x00, 0xEB, 0x20, 0x48, 0x8D, 0x7C, 0x24, 0x0C, 0xB9, 0x0D, 0x00, 0x00, 0x00, 0x31, 0xC0,
+    0xF3, 0xAB, 0x48, 0x8D, 0x7C, 0x24, 0x0C, 0xC7, 0x44, 0x24, 0x10, 0x13, 0x0B, 0xD0, 0xE2, 0xE8,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0x7B, 0x08, 0x00, 0x0F, 0x95, 0xC0, 0x48, 0x83, 0xC4, 0x40,
+    0x5B, 0xC3, 0x48, 0x85, 0xF6, 0x0F, 0x84, 0x0F, 0x01, 0x00, 0x00, 0x85, 0xD2, 0x0F, 0x84, 0x07,
+    0x01, 0x00, 0x00, 0x83, 0x7F, 0x18, 0x00, 0x0F, 0x84, 0xFD, 0x00, 0x00, 0x00, 0x8B, 0x47, 0x20,
+    0x49, 0x89, 0xF3, 0x8B, 0x77, 0x10, 0x8D, 0x48, 0x02, 0x39, 0xCE, 0x0F, 0x82, 0xE9, 0x00, 0x00,
+    0x00, 0x4C, 0x8B, 0x47, 0x08, 0x89, 0xC1, 0x66, 0x41, 0x8B, 0x0C, 0x08, 0x86, 0xE9, 0x81, 0xE1,
+    0xFF, 0x3F, 0x00, 0x00, 0x44, 0x8D, 0x04, 0x89, 0x41, 0x83, 0xC0, 0x02, 0x81, 0xF9, 0x38, 0x01,
+    0x00, 0x00, 0x41, 0x0F, 0x97, 0xC1, 0x44, 0x39, 0xC2, 0x0F, 0x92, 0xC2, 0x41, 0x08, 0xD1, 0x0F,
+    0x85, 0xB5, 0x00, 0x00, 0x00, 0x55, 0x53, 0x8D, 0x5C, 0x09, 0x02, 0x01, 0xD8, 0x39, 0xC6, 0x73,
+    0x08, 0x45, 0x31, 0xC0, 0xE9, 0x9B, 0x00, 0x00, 0x00, 0x89, 0xC8, 0x45, 0x31, 0xD2, 0x86, 0xE0,
+    0x66, 0x41, 0x89, 0x03, 0xB0, 0x01, 0x41, 0x39, 0xCA, 0x41, 0x0F, 0x92, 0xC1, 0x41, 0x20, 0xC1,
+    0x74, 0x65, 0x8B, 0x47, 0x20, 0x48, 0x8B, 0x77, 0x08, 0x42, 0x8D, 0x04, 0x50, 0x8D, 0x50, 0x02,
+    0x83, 0xC0, 0x03, 0x0F, 0xB6, 0x14, 0x16, 0x0F, 0xB6, 0x04, 0x06, 0xC1, 0xE2, 0x08, 0x09, 0xC2,
+    0x83, 0xE0, 0x3F, 0x3B, 0x47, 0x14, 0x73, 0x34, 0x8D, 0x04, 0x40, 0x89, 0xD5, 0xC1, 0xFA, 0x06,
+    0x83, 0xC0, 0x08, 0xC1, 0xFD, 0x0E, 0x48, 0x01, 0xF0, 0x43, 0x8D, 0x34, 0x92, 0x83, 0xC6, 0x02,
+    0x4C, 0x01, 0xDE, 0x40, 0x88, 0x2E, 0x88, 0x56, 0x01, 0x8A, 0x10, 0x88, 0x56, 0x02, 0x8A, 0x50,
+    0x01, 0x88, 0x56, 0x03, 0x8A, 0x40, 0x02, 0x88, 0x46, 0x04, 0xEB, 0x03, 0x45, 0x31, 0xC9, 0x41,
+    0xFF, 0xC2, 0x44, 0x89, 0xC8, 0xEB, 0x8F, 0x84, 0xC0, 0x0F, 0x84, 0x72, 0xFF, 0xFF, 0xFF, 0x8B,
+    0x47, 0x1C, 0x01, 0x5F, 0x20, 0xFF, 0xC0, 0x89, 0x47, 0x1C, 0x3B, 0x47, 0x18, 0x72, 0x05, 0xE8,
+    0x00, 0x00, 0x00, 0x00, 0x44, 0x89, 0xC0, 0x5B, 0x5D, 0xC3, 0x31, 0xC0, 0xC3, 0x8D, 0x46, 0x02,
+    0x8D, 0x4E, 0x03, 0x48, 0x89, 0xFA, 0x0F, 0xB6, 0x04, 0x07, 0x0F, 0xB6, 0x0C, 0x0F, 0xC1, 0xE0,
+    0x10, 0xC1, 0xE1, 0x08, 0x01, 0xC8, 0x8D, 0x4E, 0x04, 0x0F, 0xB6, 0x0C, 0x0F, 0x89, 0xF7, 0xFF,
+    0xC6, 0x0F, 0xB6, 0x3C, 0x3A, 0x0F, 0xB6, 0x14, 0x32, 0x01, 0xC1, 0xC1, 0xE8, 0x10, 0x88, 0x44,
+    0x24, 0xFC, 0x89, 0xC8, 0xC1, 0xE7, 0x08, 0x86, 0xE0, 0x09, 0xFA, 0x66, 0x89, 0x54, 0x24, 0xFA,
+    0x66, 0x89, 0x44, 0x24, 0xFD, 0x0F, 0xB7, 0x54, 0x24, 0xFE, 0x8B, 0x44, 0x24, 0xFA, 0x48, 0xC1,
+    0xE2, 0x20, 0x48, 0x09, 0xD0, 0xC3, 0x48, 0x83, 0xEC, 0x48, 0x89, 0xFA, 0x31, 0xC0, 0xB9, 0x0D,
+    0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x0C, 0xF3, 0xAB, 0x48, 0x8D, 0x7C, 0x24, 0x0C, 0x88,
+    0x54, 0x24, 0x14, 0x89, 0x74, 0x24, 0x10, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xC4, 0x48,
+    0xC3, 0x48, 0x83, 0xEC, 0x48, 0x41, 0x89, 0xF8, 0x31, 0xC0, 0xB9, 0x0D, 0x00, 0x00, 0x00, 0x48,
+    0x8D, 0x7C, 0x24, 0x0C, 0xF3, 0xAB, 0x48, 0x8D, 0x7C, 0x24, 0x0C, 0x44, 0x89, 0x44, 0x24, 0x10,
+    0x89, 0x74, 0x24, 0x18, 0x89, 0x54, 0x24, 0x1C, 0xC6, 0x44, 0x24, 0x15, 0x02, 0xE8, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x83, 0xC4, 0x48, 0xC3, 0x41, 0x54, 0x49, 0x89, 0xFC, 0x53, 0x89, 0xF3, 0x48,
+    0x83, 0xEC, 0x18, 0x48, 0x85, 0xFF, 0x75, 0x14, 0xBE, 0x36, 0xD9, 0x32, 0xD2, 0x31, 0xFF, 0x89,
+    0x54, 0x24, 0x0C, 0xE8, 0x7E, 0xFF, 0xFF, 0xFF, 0x8B, 0x54, 0x24, 0x0C, 0x85, 0xDB, 0x75, 0x0E,
+    0xBE, 0xB8, 0x2F, 0xAF, 0x7D, 0x31, 0xFF, 0xE8, 0x6A, 0xFF, 0xFF, 0xFF, 0xEB, 0x18, 0x39, 0xDA,
+    0x72, 0x08, 0x4D, 0x85, 0xE4, 0x0F, 0x94, 0xC0, 0xEB, 0x0E, 0x89, 0xDE, 0xBF, 0xCC, 0x18, 0xE2,
+    0x7B, 0xE8, 0x7B, 0xFF, 0xFF, 0xFF, 0xB0, 0x01, 0x48, 0x83, 0xC4, 0x18, 0x5B, 0x41, 0x5C, 0xC3,
+    0x66, 0x8B, 0x37, 0x66, 0xC1, 0xC6, 0x08, 0x81, 0xE6, 0xFF, 0x3F, 0x00, 0x00, 0x8D, 0x14, 0xB6,
+    0x8D, 0x42, 0x02, 0x0F, 0xB6, 0x0C, 0x07, 0x8D, 0x42, 0x03, 0x0F, 0xB6, 0x04, 0x07, 0xC1, 0xE1,
+    0x08, 0x09, 0xC1, 0x83, 0xF9, 0x40, 0x0F, 0x96, 0xC0, 0x83, 0xC2, 0x06, 0x48, 0x01, 0xD7, 0x31,
+    0xD2, 0x39, 0xCA, 0x73, 0x2A, 0x84, 0xC0, 0x74, 0x26, 0x0F, 0xB6, 0x07, 0x44, 0x0F, 0xB6, 0x47,
+    0x01, 0xC1, 0xE0, 0x08, 0x44, 0x09, 0xC0, 0x39, 0xF0, 0x0F, 0x92, 0xC0, 0x80, 0x7F, 0x02, 0x01,
+    0x41, 0x0F, 0x96, 0xC0, 0xFF, 0xC2, 0x48, 0x83, 0xC7, 0x05, 0x44, 0x21, 0xC0, 0xEB, 0xD2, 0xC3,
+    0x55, 0xBA, 0x9C, 0x07, 0x00, 0x00, 0x89, 0xF5, 0x53, 0x48, 0x89, 0xFB, 0x51, 0xE8, 0x35, 0xFF,
+    0xFF, 0xFF, 0x84, 0xC0, 0x75, 0x3F, 0x89, 0xEE, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00,
+    0x89, 0xC2, 0x39, 0xC5, 0x74, 0x0E, 0x89, 0xEE, 0xBF, 0x7D, 0xD3, 0xFA, 0x99, 0xE8, 0xDF, 0xFE,
+    0xFF, 0xFF, 0xEB, 0x21, 0x66, 0x8B, 0x2B, 0x66, 0xC1, 0xC5, 0x08, 0x89, 0xE8, 0x25, 0xFF, 0x3F,
+    0x00, 0x00, 0x3D, 0x38, 0x01, 0x00, 0x00, 0x7E, 0x10, 0xBE, 0x5D, 0xA4, 0xDD, 0x73, 0x31, 0xFF,
+    0xE8, 0x91, 0xFE, 0xFF, 0xFF, 0x31, 0xC0, 0xEB, 0x33, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00,
+    0x00, 0x89, 0xC2, 0x66, 0xF7, 0xC5, 0x00, 0x40, 0x74, 0x0B, 0xBE, 0x8B, 0x07, 0x56, 0x29, 0x84,
+    0xC0, 0x75, 0x08, 0xEB, 0xD9, 0xB0, 0x01, 0x84, 0xD2, 0x74, 0x11, 0x48, 0x89, 0xDF, 0xE8, 0x1D,
+    0xFF, 0xFF, 0xFF, 0xBE, 0x2A, 0x95, 0x27, 0xE7, 0x84, 0xC0, 0x74, 0xC2, 0x5A, 0x5B, 0x5D, 0xC3,
+    0x41, 0x57, 0x41, 0x56, 0x49, 0x89, 0xFE, 0x41, 0x55, 0x41, 0x89, 0xD5, 0xBA, 0x6C, 0x56, 0x01,
+    0x00, 0x41, 0x54, 0x55, 0x89, 0xF5, 0x53, 0x48, 0x83, 0xEC, 0x18, 0xE8, 0x97, 0xFE, 0xFF, 0xFF,
+    0x84, 0xC0, 0x74, 0x04, 0x31, 0xC0, 0xEB, 0x68, 0x89, 0xEA, 0x83, 0xFD, 0x02, 0x76, 0xF5, 0x45,
+    0x31, 0xFF, 0x31, 0xDB, 0x89, 0xEE, 0x49, 0x8D, 0x3C, 0x1E, 0x48, 0x89, 0x54, 0x24, 0x08, 0x49,
+    0xFF, 0xC7, 0x29, 0xDE, 0x48, 0x89, 0x3C, 0x24, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x3C,
+    0x24, 0x41, 0x89, 0xC4, 0x44, 0x89, 0xE6, 0x4C, 0x01, 0xE3, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x49,
+    0x83, 0xFF, 0x2D, 0x48, 0x8B, 0x54, 0x24, 0x08, 0x74, 0x20, 0x48, 0x8D, 0x4B, 0x02, 0x48, 0x39,
+    0xD1, 0x73, 0x06, 0x84, 0xC0, 0x75, 0xBD, 0xEB, 0xAB, 0x84, 0xC0, 0x74, 0xA7, 0x4D, 0x39, 0xEF,
+    0x72, 0xA2, 0x48, 0x39, 0xD3, 0x0F, 0x94, 0xC0, 0xEB, 0x06, 0x84, 0xC0, 0x75, 0xF4, 0xEB, 0x94,
+    0x48, 0x83, 0xC4, 0x18, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0x41, 0x5E, 0x41, 0x5F, 0xC3, 0xBA,
+    0x2D, 0x00, 0x00, 0x00, 0xE9, 0x57, 0xFF, 0xFF, 0xFF, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xE9, 0x4D,
+    0xFF, 0xFF, 0xFF, 0x41, 0x56, 0x45, 0x31, 0xC9, 0x41, 0x55, 0x41, 0x54, 0x55, 0x53, 0x48, 0x83,
+    0xEC, 0x10, 0x4C, 0x89, 0x0C, 0x24, 0x48, 0x85, 0xFF, 0x74, 0x16, 0x41, 0x89, 0xF5, 0x85, 0xF6,
+    0x74, 0x0F, 0x49, 0x89, 0xD4, 0x48, 0x85, 0xD2, 0x74, 0x07, 0x41, 0x89, 0xCE, 0x85, 0xC9, 0x75,
+    0x11, 0xBE, 0xDB, 0xC6, 0xF7, 0x84, 0x40, 0xB7, 0x03, 0xE8, 0x68, 0xFD, 0xFF, 0xFF, 0x31, 0xC0,
+    0xEB, 0x2C, 0x66, 0x8B, 0x1F, 0x48, 0x89, 0xFD, 0x86, 0xFB, 0x81, 0xE3, 0xFF, 0x3F, 0x00, 0x00,
+    0xE8, 0x00, 0x00, 0x00, 0x00, 0x41, 0x39, 0xDE, 0x72, 0x05, 0x41, 0x39, 0xC5, 0x74, 0x13, 0xBE,
+    0x31, 0x50, 0xBC, 0x82, 0x40, 0xB7, 0x03, 0xE8, 0x3A, 0xFD, 0xFF, 0xFF, 0xB0, 0x01, 0x31, 0xDB,
+    0xEB, 0x49, 0x45, 0x31, 0xC0, 0x41, 0x39, 0xD8, 0x73, 0x3F, 0x43, 0x8D, 0x34, 0x80, 0x48, 0x89,
+    0xEF, 0x83, 0xC6, 0x02, 0xE8, 0xC4, 0xFC, 0xFF, 0xFF, 0x48, 0x89, 0xC2, 0x66, 0x89, 0x44, 0x24,
+    0x08, 0x48, 0xC1, 0xE8, 0x20, 0x48, 0xC1, 0xEA, 0x10, 0x66, 0x89, 0x44, 0x24, 0x0C, 0x66, 0x89,
+    0x54, 0x24, 0x0A, 0x49, 0x6B, 0xD0, 0x06, 0x8B, 0x4C, 0x24, 0x08, 0x49, 0xFF, 0xC0, 0x41, 0x89,
+    0x0C, 0x14, 0x41, 0x88, 0x44, 0x14, 0x04, 0xEB, 0xBC, 0xB0, 0x01, 0x89, 0x1C, 0x24, 0x88, 0x44,
+    0x24, 0x04, 0x48, 0x8B, 0x04, 0x24, 0x48, 0x83, 0xC4, 0x10, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D,
+    0x41, 0x5E, 0xC3, 0x41, 0x55, 0x31, 0xC0, 0x41, 0x54, 0x55, 0x53, 0x48, 0x89, 0xD3, 0x48, 0x83,
+    0xEC, 0x18, 0x48, 0x85, 0xFF, 0x48, 0x89, 0x04, 0x24, 0x0F, 0x94, 0xC0, 0x85, 0xF6, 0x0F, 0x94,
+    0xC2, 0x08, 0xD0, 0x75, 0x0C, 0x48, 0x85, 0xDB, 0x74, 0x07, 0x41, 0x89, 0xCC, 0x85, 0xC9, 0x75,
+    0x14, 0xBE, 0xDB, 0xC6, 0xF7, 0x84, 0x40, 0xB7, 0x03, 0xE8, 0x98, 0xFC, 0xFF, 0xFF, 0x31, 0xC0,
+    0xE9, 0x03, 0x01, 0x00, 0x00, 0x48, 0x89, 0xFD, 0x41, 0x89, 0xF5, 0xE8, 0x00, 0x00, 0x00, 0x00,
+    0x84, 0xC0, 0x0F, 0x84, 0xEE, 0x00, 0x00, 0x00, 0x44, 0x89, 0xEE, 0x48, 0x89, 0xEF, 0xE8, 0x00,
+    0x00, 0x00, 0x00, 0x44, 0x39, 0xE8, 0x0F, 0x85, 0xDA, 0x00, 0x00, 0x00, 0x48, 0x89, 0xEF, 0xE8,
+    0x1C, 0xFD, 0xFF, 0xFF, 0x84, 0xC0, 0x0F, 0x84, 0xCA, 0x00, 0x00, 0x00, 0x66, 0x44, 0x8B, 0x45,
+    0x00, 0x66, 0x41, 0xC1, 0xC0, 0x08, 0x41, 0x81, 0xE0, 0xFF, 0x3F, 0x00, 0x00, 0x47, 0x8D, 0x04,
+    0x80, 0x41, 0x8D, 0x40, 0x02, 0x44, 0x0F, 0xB6, 0x4C, 0x05, 0x00, 0x41, 0x8D, 0x40, 0x03, 0x0F,
+    0xB6, 0x44, 0x05, 0x00, 0x41, 0xC1, 0xE1, 0x08, 0x41, 0x09, 0xC1, 0x45, 0x39, 0xE1, 0x45, 0x0F,
+    0x47, 0xCC, 0x41, 0x83, 0xC0, 0x06, 0x49, 0x01, 0xE8, 0x45, 0x89, 0xCA, 0x4D, 0x6B, 0xD2, 0x0C,
+    0x49, 0x01, 0xDA, 0x49, 0x39, 0xDA, 0x74, 0x7A, 0x41, 0x0F, 0xB6, 0x30, 0x41, 0x0F, 0xB6, 0x40,
+    0x01, 0x48, 0x89, 0xEF, 0xC1, 0xE6, 0x08, 0x09, 0xC6, 0x8D, 0x34, 0xB6, 0x83, 0xC6, 0x02, 0xE8,
+    0x99, 0xFB, 0xFF, 0xFF, 0x41, 0x0F, 0xB6, 0x78, 0xFE, 0x41, 0x0F, 0xB6, 0x70, 0xFF, 0x48, 0x89,
+    0xC2, 0x66, 0x89, 0x43, 0x02, 0x48, 0x89, 0xC1, 0x48, 0xC1, 0xEA, 0x10, 0xC1, 0xE7, 0x08, 0x66,
+    0x89, 0x44, 0x24, 0x08, 0x66, 0x89, 0x54, 0x24, 0x0A, 0x09, 0xFE, 0x0F, 0xB6, 0x44, 0x24, 0x0B,
+    0x48, 0xC1, 0xE9, 0x20, 0x66, 0x89, 0x33, 0x0F, 0xB6, 0xD2, 0x41, 0x80, 0x78, 0x02, 0x00, 0x0F,
+    0x94, 0x43, 0x04, 0xC1, 0xE2, 0x10, 0x49, 0x83, 0xC0, 0x05, 0x48, 0x83, 0xC3, 0x0C, 0xC1, 0xE0,
+    0x08, 0x66, 0x89, 0x4C, 0x24, 0x0C, 0x0F, 0xB6, 0xC9, 0x09, 0xC2, 0x09, 0xCA, 0x89, 0x53, 0xFC,
+    0xEB, 0x81, 0xB0, 0x01, 0xEB, 0x05, 0xB0, 0x01, 0x45, 0x31, 0xC9, 0x44, 0x89, 0x0C, 0x24, 0x88,
+    0x44, 0x24, 0x04, 0x48, 0x8B, 0x04, 0x24, 0x48, 0x83, 0xC4, 0x18, 0x5B, 0x5D, 0x41, 0x5C, 0x41,
+    0x5D, 0xC3, 0x48, 0x89, 0xF2, 0x48, 0x8B, 0x77, 0x08, 0x48, 0x3B, 0x77, 0x10, 0x74, 0x10, 0x66,
+    0x8B, 0x02, 0x48, 0x83, 0xC6, 0x02, 0x66, 0x89, 0x46, 0xFE, 0x48, 0x89, 0x77, 0x08, 0xC3, 0xE9,
+    0x00, 0x00, 0x00, 0x00, 0x53, 0x48, 0x89, 0xFB, 0x48, 0x89, 0xD7, 0x48, 0x83, 0xEC, 0x20, 0x80,
+    0x7B, 0x01, 0x00, 0x74, 0x7D, 0x2B, 0x73, 0x04, 0x81, 0xE6, 0xFF, 0xFF, 0xFF, 0x7F, 0x80, 0x7B,
+    0x02, 0x00, 0x75, 0x4F, 0x81, 0xFE, 0xE7, 0x03, 0x00, 0x00, 0x0F, 0x86, 0x8E, 0x00, 0x00, 0x00,
+    0x80, 0x7B, 0x03, 0x00, 0x74, 0x1F, 0x48, 0x8D, 0x74, 0x24, 0x1E, 0x66, 0xC7, 0x44, 0x24, 0x1E,
+    0x06, 0x00, 0x48, 0x89, 0x54, 0x24, 0x08, 0xE8, 0x96, 0xFF, 0xFF, 0xFF, 0xC6, 0x43, 0x03, 0x00,
+    0x48, 0x8B, 0x7C, 0x24, 0x08, 0x48, 0x8D, 0x74, 0x24, 0x1E, 0x66, 0xC7, 0x44, 0x24, 0x1E, 0x07,
+    0x00, 0xE8, 0x7C, 0xFF, 0xFF, 0xFF, 0xC6, 0x43, 0x02, 0x01, 0xC7, 0x43, 0x0C, 0xDC, 0x05, 0x00,
+    0x00, 0xEB, 0x4B, 0x3B, 0x73, 0x0C, 0x72, 0x46, 0x48, 0x8D, 0x74, 0x24, 0x1E, 0x66, 0xC7, 0x44,
+    0x24, 0x1E, 0x09, 0x00, 0xE8, 0x59, 0xFF, 0xFF, 0xFF, 0x81, 0x43, 0x0C, 0xF4, 0x01, 0x00, 0x00,
+    0xEB, 0x2C, 0x80, 0x7B, 0x03, 0x00, 0x74, 0x26, 0x2B, 0x73, 0x08, 0x81, 0xE6, 0xFF, 0xFF, 0xFF,
+    0x7F, 0x81, 0xFE, 0xFA, 0x00, 0x00, 0x00, 0x76, 0x15, 0x48, 0x8D, 0x74, 0x24, 0x1E, 0x66, 0xC7,
+    0x44, 0x24, 0x1E, 0x06, 0x00, 0xE8, 0x28, 0xFF, 0xFF, 0xFF, 0xC6, 0x43, 0x03, 0x00, 0x48, 0x83,
+    0xC4, 0x20, 0x5B, 0xC3, 0x53, 0x48, 0x89, 0xFB, 0x48, 0x83, 0xEC, 0x10, 0x80, 0x7F, 0x02, 0x00,
+    0xC6, 0x47, 0x01, 0x00, 0x75, 0x4E, 0x89, 0xF0, 0x2B, 0x47, 0x04, 0x25, 0xFF, 0xFF, 0xFF, 0x7F,
+    0x83, 0xF8, 0x63, 0x76, 0x3F, 0x80, 0x3B, 0x00, 0x48, 0x89, 0xD7, 0x75, 0x13, 0x48, 0x8D, 0x74,
+    0x24, 0x0E, 0x66, 0xC7, 0x44, 0x24, 0x0E, 0x06, 0x00, 0xE8, 0xE4, 0xFE, 0xFF, 0xFF, 0xEB, 0x24,
+    0x80, 0x7B, 0x03, 0x00, 0x74, 0x17, 0x48, 0x8D, 0x74, 0x24, 0x0E, 0x66, 0xC7, 0x44, 0x24, 0x0E,
+    0x08, 0x00, 0xE8, 0xCB, 0xFE, 0xFF, 0xFF, 0xC6, 0x43, 0x03, 0x00, 0xEB, 0x07, 0xC6, 0x43, 0x03,
+    0x01, 0x89, 0x73, 0x08, 0x48, 0x83, 0xC4, 0x10, 0x5B, 0xC3, 0x55, 0x89, 0xF5, 0x53, 0x48, 0x89,
+    0xFB, 0x48, 0x83, 0xEC, 0x18, 0x80, 0x7F, 0x03, 0x00, 0x74, 0x29, 0x89, 0xF0, 0x2B, 0x47, 0x08,
+    0x25, 0xFF, 0xFF, 0xFF, 0x7F, 0x3D, 0xFA, 0x00, 0x00, 0x00, 0x76, 0x18, 0x48, 0x89, 0xD7, 0x48,
+    0x8D, 0x74, 0x24, 0x0E, 0x66, 0xC7, 0x44, 0x24, 0x0E, 0x06, 0x00, 0xE8, 0x82, 0xFE, 0xFF, 0xFF,
+    0xC6, 0x43, 0x03, 0x00, 0x66, 0xC7, 0x43, 0x01, 0x01, 0x00, 0x89, 0x6B, 0x04, 0x48, 0x83, 0xC4,
+    0x18, 0x5B, 0x5D, 0xC3, 0x41, 0x54, 0x8D, 0x04, 0x12, 0x41, 0x89, 0xD4, 0x89, 0xF2, 0x83, 0xE2,
+    0xFE, 0x55, 0x48, 0x89, 0xCD, 0x29, 0xD0, 0x53, 0x48, 0x89, 0xFB, 0x83, 0xF8, 0x62, 0x76, 0x24,
+    0x89, 0xF0, 0x83, 0xE0, 0x01, 0x89, 0xC2, 0x83, 0xF2, 0x01, 0x38, 0x57, 0x01, 0x74, 0x15, 0xD1,
+    0xEE, 0x48, 0x89, 0xCA, 0x85, 0xC0, 0x75, 0x07, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x05, 0xE8,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xEA, 0x44, 0x89, 0xE6, 0x48, 0x89, 0xDF, 0x5B, 0x5D, 0x41,
+    0x5C, 0xE9, 0x3E, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF,
+    0x15, 0xE2, 0x80, 0x9B, 0xDB, 0x74, 0xEC, 0x82, 0x03, 0x98, 0xE3, 0x66, 0x2E, 0x76, 0x1E, 0xBD,
+    0xF9, 0xDF, 0xD6, 0x05, 0x21, 0xDB, 0x54, 0x54, 0xEE, 0x9B, 0x78, 0xE8, 0x5E, 0xDD, 0x0B, 0x97,
+};
+
+const std::array<uint8_t, 10512> firmware_target = {
+    0xE9, 0x02, 0x02, 0x0F, 0x1C, 0x5A, 0x37, 0x40, 0xEE, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x3C, 0x00, 0x03, 0x00, 0x00,
+    0x32, 0x54, 0xCD, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x2E, 0x31, 0x31, 0x2E, 0x30, 0x2D, 0x34, 0x32, 0x2D, 0x67, 0x34, 0x63, 0x62, 0x34, 0x39,
+    0x30, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x54, 0x72, 0x61, 0x69, 0x6E, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x30, 0x3A, 0x35, 0x36, 0x3A, 0x33, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0x63, 0x74, 0x20, 0x31, 0x39, 0x20, 0x32, 0x30, 0x32, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x76, 0x34, 0x2E, 0x34, 0x2E, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4C, 0xBA, 0xC4, 0xF0, 0xB7, 0xCF, 0x4C, 0xD0, 0x80, 0xF2, 0x41, 0x3C, 0x31, 0x7A, 0x9A, 0xD3,
+    0x9D, 0x2F, 0x67, 0xDA, 0x25, 0x39, 0xCC, 0xC4, 0x65, 0xC1, 0x95, 0x50, 0x8E, 0x3E, 0x4E, 0xCE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x76, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x3A, 0x3A, 0x5F, 0x4D, 0x5F, 0x72, 0x65, 0x61, 0x6C, 0x6C,
+    0x6F, 0x63, 0x5F, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x32, 0x34, 0x32, 0x35, 0x32, 0x36, 0x32, 0x37, 0x32, 0x38, 0x32, 0x39, 0x33, 0x30, 0x33, 0x31,
+    0x33, 0x32, 0x33, 0x33, 0x33, 0x34, 0x33, 0x35, 0x33, 0x36, 0x33, 0x37, 0x33, 0x38, 0x33, 0x39,
+    0x34, 0x30, 0x34, 0x31, 0x34, 0x32, 0x34, 0x33, 0x34, 0x34, 0x34, 0x35, 0x34, 0x36, 0x34, 0x37,
+    0x34, 0x38, 0x34, 0x39, 0x35, 0x30, 0x35, 0x31, 0x35, 0x32, 0x35, 0x33, 0x35, 0x34, 0x35, 0x35,
+    0x35, 0x36, 0x35, 0x37, 0x35, 0x38, 0x35, 0x39, 0x36, 0x30, 0x36, 0x31, 0x36, 0x32, 0x36, 0x33,
+    0x36, 0x34, 0x36, 0x35, 0x36, 0x36, 0x36, 0x37, 0x36, 0x38, 0x36, 0x39, 0x37, 0x30, 0x37, 0x31,
+    0x37, 0x32, 0x37, 0x33, 0x37, 0x34, 0x37, 0x35, 0x37, 0x36, 0x37, 0x37, 0x37, 0x38, 0x37, 0x39,
+    0x38, 0x30, 0x38, 0x31, 0x38, 0x32, 0x38, 0x33, 0x38, 0x34, 0x38, 0x35, 0x38, 0x36, 0x38, 0x37,
+    0x38, 0x38, 0x38, 0x39, 0x39, 0x30, 0x39, 0x31, 0x39, 0x32, 0x39, 0x33, 0x39, 0x34, 0x39, 0x35,
+    0x39, 0x36, 0x39, 0x37, 0x39, 0x38, 0x39, 0x39, 0x00, 0x6F, 0x6E, 0x67, 0x20, 0x74, 0x61, 0x72,
+    0x67, 0x65, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x00, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20,
+    0x6C, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x61, 0x6E, 0x6E, 0x6F,
+    0x75, 0x6E, 0x63, 0x65, 0x64, 0x00, 0x55, 0x6E, 0x6B, 0x6E, 0x6F, 0x77, 0x6E, 0x20, 0x6F, 0x70,
+    0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x3A, 0x3A, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x00, 0x52, 0x65, 0x71,
+    0x75, 0x65, 0x73, 0x74, 0x73, 0x3A, 0x20, 0x00, 0x2C, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x3A,
+    0x20, 0x00, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x3A, 0x00, 0x20, 0x00, 0x3A, 0x20, 0x6E, 0x20,
+    0x00, 0x2C, 0x20, 0x70, 0x35, 0x30, 0x20, 0x00, 0x2C, 0x20, 0x70, 0x39, 0x30, 0x20, 0x00, 0x2C,
+    0x20, 0x6D, 0x61, 0x78, 0x20, 0x00, 0x2C, 0x20, 0x6C, 0x6F, 0x67, 0x32, 0x20, 0x68, 0x69, 0x73,
+    0x74, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x00, 0x6E, 0x6F, 0x6E, 0x65, 0x00, 0x64, 0x6E, 0x73, 0x00,
+    0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x00, 0x74, 0x6C, 0x73, 0x00, 0x74, 0x69, 0x6D, 0x65,
+    0x6F, 0x75, 0x74, 0x00, 0x6C, 0x6F, 0x73, 0x74, 0x00, 0x34, 0x78, 0x78, 0x00, 0x35, 0x78, 0x78,
+    0x00, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x65, 0x72, 0x00, 0x64, 0x6E, 0x73, 0x20, 0x6D, 0x73,
+    0x00, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x20, 0x6D, 0x73, 0x00, 0x66, 0x69, 0x72, 0x73,
+    0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x6D, 0x73, 0x00, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66,
+    0x65, 0x72, 0x20, 0x6D, 0x73, 0x00, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20, 0x6D, 0x73, 0x00, 0x70,
+    0x61, 0x79, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x00, 0x66, 0x72, 0x61,
+    0x6D, 0x65, 0x00, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x00, 0x69, 0x64, 0x00, 0x64, 0x61, 0x74, 0x61,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x42, 0xB8, 0x25, 0x00, 0x00, 0x48, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x3F, 0x41, 0x57, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x55, 0x53, 0x48, 0x83, 0xEC, 0x18,
+    0x48, 0x8B, 0x47, 0x08, 0x4C, 0x8B, 0x27, 0x48, 0x89, 0xC3, 0x48, 0x89, 0x04, 0x24, 0x4C, 0x29,
+    0xE3, 0x48, 0xD1, 0xFB, 0x48, 0x39, 0xCB, 0x75, 0x0A, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00,
+    0x00, 0x00, 0x00, 0x4C, 0x39, 0x24, 0x24, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x49, 0x89, 0xD6, 0x48,
+    0x89, 0xF2, 0x48, 0x0F, 0x45, 0xC3, 0x49, 0x89, 0xFF, 0x49, 0x89, 0xF5, 0x48, 0x01, 0xC3, 0x0F,
+    0x92, 0xC0, 0x4C, 0x29, 0xE2, 0x0F, 0xB6, 0xC0, 0x48, 0x85, 0xC0, 0x75, 0x1A, 0x31, 0xED, 0x48,
+    0x85, 0xDB, 0x74, 0x2C, 0x48, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x48, 0x39,
+    0xC3, 0x48, 0x0F, 0x47, 0xD8, 0xEB, 0x03, 0x48, 0x89, 0xCB, 0x48, 0x8D, 0x3C, 0x1B, 0x48, 0x89,
+    0x54, 0x24, 0x08, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x54, 0x24, 0x08, 0x48, 0x89, 0xC5,
+    0x66, 0x41, 0x8B, 0x06, 0x48, 0x85, 0xD2, 0x4C, 0x8D, 0x72, 0x02, 0x66, 0x89, 0x44, 0x15, 0x00,
+    0x7E, 0x2A, 0x4C, 0x89, 0xE6, 0x48, 0x89, 0xEF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x0C,
+    0x24, 0x4A, 0x8D, 0x44, 0x35, 0x00, 0x4C, 0x29, 0xE9, 0x4C, 0x8D, 0x34, 0x08, 0x48, 0x85, 0xC9,
+    0x7E, 0x2E, 0x48, 0x89, 0xC7, 0x4C, 0x89, 0xEE, 0xF3, 0xA4, 0xEB, 0x24, 0x4A, 0x8D, 0x54, 0x35,
+    0x00, 0x4C, 0x8B, 0x34, 0x24, 0x4D, 0x29, 0xEE, 0x4D, 0x85, 0xF6, 0x7E, 0x0B, 0x48, 0x89, 0xD7,
+    0x4C, 0x89, 0xEE, 0x4C, 0x89, 0xF1, 0xF3, 0xA4, 0x49, 0x01, 0xD6, 0x4D, 0x85, 0xE4, 0x74, 0x0F,
+    0x49, 0x8B, 0x77, 0x10, 0x4C, 0x89, 0xE7, 0x4C, 0x29, 0xE6, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x01, 0xDB, 0x49, 0x89, 0x2F, 0x48, 0x01, 0xDD, 0x4D, 0x89, 0x77, 0x08, 0x49, 0x89, 0x6F, 0x10,
+    0x48, 0x83, 0xC4, 0x18, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0x41, 0x5E, 0x41, 0x5F, 0xC3, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xC7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0xC7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xC7,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00,
+    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00,
+    0xBA, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0xC7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xC7, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0xBE,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0xC7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0xC7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0xC7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x41, 0x58, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xDF, 0x88, 0x44, 0x24, 0x08, 0xE8,
+    0x00, 0x00, 0x00, 0x00, 0x8A, 0x44, 0x24, 0x08, 0x01, 0xAB, 0x84, 0x00, 0x00, 0x00, 0x48, 0x83,
+    0xC4, 0x18, 0x5B, 0x5D, 0xC3, 0x90, 0x41, 0x57, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x55, 0x53,
+    0x48, 0x89, 0xFB, 0x48, 0x83, 0xEC, 0x18, 0x8B, 0x47, 0x7C, 0x39, 0xF0, 0x72, 0x0C, 0x29, 0xF0,
+    0x41, 0x89, 0xF4, 0x41, 0x89, 0xD5, 0x39, 0xD0, 0x73, 0x11, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x31, 0xC0, 0xEB, 0x6A, 0x31, 0xED, 0xB0, 0x01, 0x4C,
+    0x8D, 0xB7, 0x00, 0x01, 0x00, 0x00, 0x44, 0x39, 0xED, 0x73, 0x5A, 0x84, 0xC0, 0x74, 0x56, 0x45,
+    0x89, 0xEF, 0xB8, 0x00, 0x01, 0x00, 0x00, 0x48, 0x8B, 0x3B, 0x42, 0x8D, 0x74, 0x25, 0x00, 0x41,
+    0x29, 0xEF, 0x4C, 0x89, 0xF2, 0x41, 0x39, 0xC7, 0x44, 0x0F, 0x47, 0xF8, 0x48, 0x8B, 0x07, 0x44,
+    0x89, 0xF9, 0xFF, 0x10, 0x84, 0xC0, 0x88, 0x44, 0x24, 0x0F, 0x75, 0x13, 0xBE, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x44, 0x24, 0x0F, 0xEB, 0x0E, 0x44,
+    0x89, 0xFA, 0x4C, 0x89, 0xF6, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x81, 0xC5, 0x00,
+    0x01, 0x00, 0x00, 0xEB, 0xA1, 0x48, 0x83, 0xC4, 0x18, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0x41,
+    0x5E, 0x41, 0x5F, 0xC3, 0x53, 0x48, 0x8D, 0x77, 0x14, 0x48, 0x89, 0xFB, 0xBA, 0x04, 0x00, 0x00,
+    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xEC, 0x10, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x85,
+    0xC0, 0x75, 0x06, 0x80, 0x7B, 0x18, 0x01, 0x74, 0x07, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x2C,
+    0x48, 0x8D, 0x7B, 0x1C, 0xE8, 0x2F, 0xFD, 0xFF, 0xFF, 0x48, 0x8D, 0x7B, 0x20, 0x89, 0x43, 0x7C,
+    0xE8, 0x23, 0xFD, 0xFF, 0xFF, 0x48, 0x89, 0xDF, 0x89, 0x83, 0x80, 0x00, 0x00, 0x00, 0xE8, 0x00,
+    0x00, 0x00, 0x00, 0x84, 0xC0, 0x75, 0x11, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xDF, 0xE8,
+    0x00, 0x00, 0x00, 0x00, 0x31, 0xC0, 0xEB, 0x3A, 0x48, 0x8B, 0x7B, 0x08, 0x8B, 0xB3, 0x80, 0x00,
+    0x00, 0x00, 0x48, 0x8B, 0x07, 0xFF, 0x10, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x84, 0xC0, 0x74, 0xDC,
+    0xC6, 0x83, 0x88, 0x00, 0x00, 0x00, 0x01, 0x48, 0x8D, 0xBB, 0x90, 0x00, 0x00, 0x00, 0x88, 0x44,
+    0x24, 0x0F, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x43, 0x10, 0x01, 0x00, 0x00, 0x00, 0x8A, 0x44,
+    0x24, 0x0F, 0x48, 0x83, 0xC4, 0x10, 0x5B, 0xC3, 0x55, 0x48, 0x8D, 0xB7, 0x90, 0x00, 0x00, 0x00,
+    0x53, 0x48, 0x89, 0xFB, 0x48, 0x83, 0xEC, 0x68, 0x48, 0x8D, 0x7C, 0x24, 0x0C, 0xE8, 0x00, 0x00,
+    0x00, 0x00, 0x8B, 0x83, 0x80, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x39, 0x83, 0x84,
+    0x00, 0x00, 0x00, 0x75, 0x1E, 0x48, 0x8D, 0x73, 0x44, 0xBA, 0x20, 0x00, 0x00, 0x00, 0x48, 0x8D,
+    0x7C, 0x24, 0x0C, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x89, 0xC5, 0x85, 0xC0, 0x74, 0x11, 0xBE, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x31, 0xC0, 0xEB, 0x4A, 0x48,
+    0x8B, 0x7B, 0x08, 0xBE, 0x01, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x07, 0xFF, 0x50, 0x10, 0x84, 0xC0,
+    0x75, 0x30, 0x89, 0xE8, 0x48, 0x8D, 0x7C, 0x24, 0x2C, 0xB9, 0x0D, 0x00, 0x00, 0x00, 0xF3, 0xAB,
+    0x48, 0x8D, 0x7C, 0x24, 0x2C, 0x48, 0xB8, 0xF3, 0x98, 0xA6, 0xDE, 0x01, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x44, 0x24, 0x30, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x43, 0x10, 0x04, 0x00, 0x00, 0x00,
+    0xEB, 0xB9, 0xC7, 0x43, 0x10, 0x03, 0x00, 0x00, 0x00, 0x48, 0x83, 0xC4, 0x68, 0x5B, 0x5D, 0xC3,
+    0x41, 0x50, 0x48, 0x89, 0xF9, 0x40, 0x8A, 0x77, 0x68, 0x48, 0x83, 0xC7, 0x69, 0xE8, 0x06, 0xFC,
+    0xFF, 0xFF, 0x89, 0xC2, 0x8B, 0x81, 0x80, 0x00, 0x00, 0x00, 0x2B, 0x81, 0x84, 0x00, 0x00, 0x00,
+    0x39, 0xD0, 0x73, 0x07, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x49, 0x40, 0x84, 0xF6, 0x75, 0x0D,
+    0x85, 0xD2, 0x75, 0x09, 0x48, 0x89, 0xCF, 0x5E, 0xE9, 0x1B, 0xFF, 0xFF, 0xFF, 0x40, 0x80, 0xFE,
+    0x01, 0x75, 0x14, 0x48, 0x8D, 0x79, 0x6D, 0xE8, 0xCC, 0xFB, 0xFF, 0xFF, 0x48, 0x89, 0xCF, 0x59,
+    0x89, 0xC6, 0xE9, 0xAF, 0xFD, 0xFF, 0xFF, 0x40, 0x80, 0xFE, 0x02, 0x75, 0x12, 0x83, 0xFA, 0x01,
+    0x89, 0x51, 0x78, 0x19, 0xC0, 0x83, 0xC0, 0x02, 0x89, 0x41, 0x10, 0xB0, 0x01, 0xEB, 0x0F, 0xBE,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xCF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x31, 0xC0, 0x5A, 0xC3,
+    0x41, 0x57, 0x41, 0xBF, 0x50, 0x00, 0x00, 0x00, 0x41, 0x56, 0x49, 0x89, 0xF6, 0x41, 0x55, 0x41,
+    0x89, 0xD5, 0x41, 0x54, 0x55, 0x31, 0xED, 0x53, 0x48, 0x89, 0xFB, 0x41, 0x50, 0x8B, 0x43, 0x10,
+    0x44, 0x39, 0xED, 0x0F, 0x83, 0x0F, 0x01, 0x00, 0x00, 0x8D, 0x50, 0xFD, 0x83, 0xFA, 0x01, 0x0F,
+    0x86, 0x03, 0x01, 0x00, 0x00, 0x44, 0x89, 0xEA, 0x89, 0xEE, 0x29, 0xEA, 0x4C, 0x01, 0xF6, 0x85,
+    0xC0, 0x75, 0x46, 0x8B, 0x43, 0x64, 0x45, 0x89, 0xFC, 0x41, 0x29, 0xC4, 0x41, 0x39, 0xD4, 0x72,
+    0x07, 0x89, 0xD1, 0x41, 0x89, 0xD4, 0xEB, 0x08, 0x45, 0x85, 0xE4, 0x74, 0x10, 0x44, 0x89, 0xE1,
+    0x48, 0x8D, 0x7C, 0x03, 0x14, 0x48, 0x89, 0xCA, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x43, 0x64,
+    0x44, 0x01, 0xE0, 0x89, 0x43, 0x64, 0x83, 0xF8, 0x50, 0x0F, 0x85, 0xB1, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x50, 0xFF, 0xC8, 0x75, 0x59, 0x48, 0x89, 0xDF,
+    0xE8, 0x00, 0x00, 0x00, 0x00, 0x41, 0x89, 0xC4, 0x8B, 0x43, 0x74, 0x41, 0x29, 0xC4, 0x41, 0x39,
+    0xD4, 0x73, 0x07, 0x45, 0x85, 0xE4, 0x74, 0x12, 0xEB, 0x03, 0x41, 0x89, 0xD4, 0x44, 0x89, 0xE2,
+    0x48, 0x8D, 0x7C, 0x03, 0x68, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x53, 0x74, 0x48, 0x89, 0xDF,
+    0x44, 0x01, 0xE2, 0x89, 0x53, 0x74, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x39, 0xC2, 0x75, 0x61, 0x31,
+    0xC9, 0x89, 0x4B, 0x74, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x84, 0xC0, 0x75, 0x53, 0xC7, 0x43, 0x10,
+    0x04, 0x00, 0x00, 0x00, 0xEB, 0x4A, 0x8B, 0x43, 0x78, 0x48, 0x89, 0xDF, 0x39, 0xC2, 0x0F, 0x46,
+    0xC2, 0x89, 0xC2, 0x41, 0x89, 0xC4, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x84, 0xC0, 0x75, 0x07, 0xC7,
+    0x43, 0x10, 0x04, 0x00, 0x00, 0x00, 0x8B, 0x43, 0x78, 0x44, 0x01, 0xE5, 0x44, 0x29, 0xE0, 0x83,
+    0x7B, 0x10, 0x02, 0x89, 0x43, 0x78, 0x0F, 0x85, 0x01, 0xFF, 0xFF, 0xFF, 0x85, 0xC0, 0x0F, 0x85,
+    0xF9, 0xFE, 0xFF, 0xFF, 0xC7, 0x43, 0x10, 0x01, 0x00, 0x00, 0x00, 0xE9, 0xED, 0xFE, 0xFF, 0xFF,
+    0x44, 0x01, 0xE5, 0xE9, 0xE5, 0xFE, 0xFF, 0xFF, 0x83, 0xF8, 0x03, 0x74, 0x0A, 0x83, 0xF8, 0x04,
+    0x0F, 0x94, 0xC2, 0x31, 0xC9, 0xEB, 0x04, 0xB2, 0x01, 0xB1, 0x01, 0x0F, 0xB6, 0xC1, 0x88, 0xD4,
+    0x5A, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0x41, 0x5E, 0x41, 0x5F, 0xC3, 0x85, 0xF6, 0x75, 0x05,
+    0xBE, 0xB9, 0x79, 0x37, 0x9E, 0x89, 0x77, 0x08, 0xC3, 0x90, 0x66, 0x0F, 0x6E, 0x4F, 0x08, 0xFF,
+    0xC6, 0x31, 0xD2, 0x0F, 0x28, 0xD1, 0x66, 0x0F, 0x72, 0xF2, 0x0D, 0x0F, 0x28, 0xC2, 0x0F, 0x57,
+    0xC1, 0x0F, 0x28, 0xD8, 0x66, 0x0F, 0x72, 0xD3, 0x11, 0x0F, 0x28, 0xCB, 0x0F, 0x57, 0xC8, 0x0F,
+    0x28, 0xE1, 0x66, 0x0F, 0x72, 0xF4, 0x05, 0x0F, 0x28, 0xC4, 0x0F, 0x57, 0xC1, 0x66, 0x0F, 0x7E,
+    0xC0, 0x66, 0x0F, 0x7E, 0x47, 0x08, 0xF7, 0xF6, 0x89, 0xD0, 0xC3, 0x90, 0x48, 0x83, 0xEC, 0x18,
+    0x31, 0xC0, 0x48, 0x89, 0x74, 0x24, 0x08, 0x80, 0x7C, 0x24, 0x0C, 0x00, 0x89, 0x47, 0x04, 0x74,
+    0x2C, 0x8B, 0x44, 0x24, 0x08, 0xBA, 0x84, 0x03, 0x00, 0x00, 0xBE, 0x70, 0x17, 0x00, 0x00, 0x39,
+    0xD0, 0x0F, 0x47, 0xC2, 0x69, 0xC8, 0xE8, 0x03, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xBA,
+    0xD0, 0x07, 0x00, 0x00, 0x01, 0xC8, 0x39, 0xD0, 0x0F, 0x42, 0xC2, 0xEB, 0x0F, 0xBE, 0xE0, 0x2E,
+    0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF0, 0xD2, 0x00, 0x00, 0x89, 0x07, 0x48, 0x83,
+    0xC4, 0x18, 0xC3, 0x90, 0x48, 0x83, 0xEC, 0x18, 0x8B, 0x4F, 0x04, 0x48, 0x89, 0x74, 0x24, 0x08,
+    0x8D, 0x41, 0x01, 0x89, 0x47, 0x04, 0xB8, 0x2C, 0x01, 0x00, 0x00, 0x83, 0xF9, 0x10, 0x77, 0x11,
+    0xB8, 0x02, 0x00, 0x00, 0x00, 0xBA, 0x2C, 0x01, 0x00, 0x00, 0xD3, 0xE0, 0x39, 0xD0, 0x0F, 0x47,
+    0xC2, 0x69, 0xC0, 0xE8, 0x03, 0x00, 0x00, 0xD1, 0xE8, 0x89, 0xC6, 0x89, 0xC1, 0xE8, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xC8, 0x80, 0x7C, 0x24, 0x0C, 0x00, 0x89, 0x07, 0x74, 0x1B, 0x8B, 0x54, 0x24,
+    0x08, 0xB9, 0x84, 0x03, 0x00, 0x00, 0x39, 0xCA, 0x0F, 0x47, 0xD1, 0x69, 0xD2, 0xE8, 0x03, 0x00,
+    0x00, 0x39, 0xC2, 0x0F, 0x42, 0xD0, 0x89, 0x17, 0x8B, 0x07, 0x48, 0x83, 0xC4, 0x18, 0xC3, 0x90,
+    0x48, 0x8D, 0x42, 0xFF, 0x49, 0x89, 0xF1, 0x41, 0x89, 0xC8, 0x48, 0x89, 0xD6, 0xB9, 0x02, 0x00,
+    0x00, 0x00, 0x48, 0x99, 0x48, 0xF7, 0xF9, 0x4C, 0x89, 0xC9, 0x48, 0x39, 0xC1, 0x7D, 0x23, 0x4C,
+    0x8D, 0x51, 0x01, 0x46, 0x8B, 0x5C, 0xD7, 0xFC, 0x4B, 0x8D, 0x14, 0x12, 0x46, 0x39, 0x1C, 0xD7,
+    0x73, 0x03, 0x48, 0xFF, 0xCA, 0x44, 0x8B, 0x14, 0x97, 0x44, 0x89, 0x14, 0x8F, 0x48, 0x89, 0xD1,
+    0xEB, 0xD8, 0x40, 0xF6, 0xC6, 0x01, 0x75, 0x25, 0x48, 0x8D, 0x46, 0xFE, 0xBE, 0x02, 0x00, 0x00,
+    0x00, 0x48, 0x99, 0x48, 0xF7, 0xFE, 0x48, 0x39, 0xC1, 0x75, 0x12, 0x48, 0x8D, 0x41, 0x01, 0x48,
+    0x01, 0xC0, 0x8B, 0x54, 0x87, 0xFC, 0x89, 0x14, 0x8F, 0x48, 0x8D, 0x48, 0xFF, 0x48, 0x8D, 0x41,
+    0xFF, 0xBE, 0x02, 0x00, 0x00, 0x00, 0x48, 0x99, 0x48, 0xF7, 0xFE, 0x48, 0x8D, 0x14, 0x8F, 0x49,
+    0x39, 0xC9, 0x7D, 0x16, 0x8B, 0x0C, 0x87, 0x44, 0x39, 0xC1, 0x73, 0x0E, 0x89, 0x0A, 0x48, 0x8D,
+    0x50, 0xFF, 0x48, 0x89, 0xC1, 0x48, 0x89, 0xD0, 0xEB, 0xDC, 0x44, 0x89, 0x02, 0xC3, 0x55, 0x48,
+    0x89, 0xF5, 0x53, 0x48, 0x89, 0xFB, 0x48, 0x89, 0xF7, 0x50, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x8B, 0x53, 0x08, 0x48, 0x89, 0xE9, 0x41, 0x59, 0x48, 0x89, 0xDF, 0x49, 0x89, 0xC0, 0x5B, 0x31,
+    0xF6, 0x5D, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x90, 0x53, 0x48, 0x89, 0xFB, 0x48, 0x89, 0xF7, 0x48,
+    0x83, 0xEC, 0x10, 0x48, 0x89, 0x74, 0x24, 0x08, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x74,
+    0x24, 0x08, 0x48, 0x89, 0xC2, 0x48, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x48,
+    0x2B, 0x43, 0x08, 0x48, 0x39, 0xD0, 0x73, 0x0A, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x83, 0xC4, 0x10, 0x48, 0x89, 0xDF, 0x5B, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x39, 0xF7, 0x75, 0x01, 0xC3, 0x41, 0x56, 0x41, 0xBE, 0x04, 0x00, 0x00, 0x00, 0x41, 0x55, 0x41,
+    0x54, 0x49, 0x89, 0xF4, 0x55, 0x48, 0x8D, 0x6F, 0x04, 0x53, 0x48, 0x89, 0xFB, 0x49, 0x39, 0xEC,
+    0x74, 0x41, 0x44, 0x8B, 0x6D, 0x00, 0x44, 0x3B, 0x2B, 0x73, 0x1C, 0x48, 0x39, 0xEB, 0x74, 0x12,
+    0x48, 0x89, 0xEA, 0x4A, 0x8D, 0x3C, 0x33, 0x48, 0x89, 0xDE, 0x48, 0x29, 0xDA, 0xE8, 0x00, 0x00,
+    0x00, 0x00, 0x44, 0x89, 0x2B, 0xEB, 0x16, 0x48, 0x89, 0xE8, 0x8B, 0x50, 0xFC, 0x41, 0x39, 0xD5,
+    0x73, 0x08, 0x89, 0x10, 0x48, 0x83, 0xE8, 0x04, 0xEB, 0xF0, 0x44, 0x89, 0x28, 0x48, 0x83, 0xC5,
+    0x04, 0xEB, 0xBA, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0x41, 0x5E, 0xC3, 0x41, 0x56, 0x41, 0x55,
+    0x49, 0x89, 0xD5, 0x41, 0x54, 0x55, 0x48, 0x89, 0xF5, 0x53, 0x48, 0x89, 0xFB, 0x48, 0x89, 0xE8,
+    0x48, 0x29, 0xD8, 0x48, 0x83, 0xF8, 0x40, 0x0F, 0x8E, 0xE7, 0x00, 0x00, 0x00, 0x49, 0x89, 0xC6,
+    0x49, 0xC1, 0xFE, 0x02, 0x4D, 0x85, 0xED, 0x75, 0x55, 0x4D, 0x8D, 0x66, 0xFE, 0x49, 0xD1, 0xFC,
+    0x42, 0x8B, 0x0C, 0xA3, 0x4C, 0x89, 0xF2, 0x4C, 0x89, 0xE6, 0x48, 0x89, 0xDF, 0xE8, 0x3E, 0xFE,
+    0xFF, 0xFF, 0x4D, 0x85, 0xE4, 0x74, 0x05, 0x49, 0xFF, 0xCC, 0xEB, 0xE4, 0x48, 0x89, 0xE8, 0x48,
+    0x29, 0xD8, 0x48, 0x83, 0xF8, 0x04, 0x0F, 0x8E, 0xA8, 0x00, 0x00, 0x00, 0x8B, 0x03, 0x48, 0x83,
+    0xED, 0x04, 0x8B, 0x4D, 0x00, 0x31, 0xF6, 0x48, 0x89, 0xEA, 0x48, 0x89, 0xDF, 0x89, 0x45, 0x00,
+    0x48, 0x29, 0xDA, 0x48, 0xC1, 0xFA, 0x02, 0xE8, 0x04, 0xFE, 0xFF, 0xFF, 0xEB, 0xCE, 0x48, 0xC1,
+    0xF8, 0x03, 0x8B, 0x73, 0x04, 0x8B, 0x55, 0xFC, 0x4C, 0x8D, 0x63, 0x04, 0x48, 0x8D, 0x3C, 0x83,
+    0x8B, 0x03, 0x8B, 0x0F, 0x39, 0xCE, 0x73, 0x13, 0x39, 0xD1, 0x73, 0x09, 0x89, 0x0B, 0x89, 0x07,
+    0x48, 0x89, 0xE8, 0xEB, 0x26, 0x39, 0xD6, 0x73, 0x06, 0xEB, 0x0F, 0x39, 0xD6, 0x73, 0x07, 0x89,
+    0x33, 0x89, 0x43, 0x04, 0xEB, 0xEA, 0x39, 0xD1, 0x73, 0xE2, 0x89, 0x13, 0x89, 0x45, 0xFC, 0xEB,
+    0xDF, 0x41, 0x89, 0x0C, 0x24, 0x49, 0x83, 0xC4, 0x04, 0x89, 0x10, 0x8B, 0x33, 0x41, 0x8B, 0x14,
+    0x24, 0x39, 0xF2, 0x73, 0x06, 0x49, 0x83, 0xC4, 0x04, 0xEB, 0xF2, 0x8B, 0x48, 0xFC, 0x48, 0x83,
+    0xE8, 0x04, 0x39, 0xCE, 0x72, 0xF5, 0x49, 0x39, 0xC4, 0x72, 0xD6, 0x49, 0xFF, 0xCD, 0x48, 0x89,
+    0xEE, 0x4C, 0x89, 0xE7, 0x4C, 0x89, 0xE5, 0x4C, 0x89, 0xEA, 0xE8, 0xFD, 0xFE, 0xFF, 0xFF, 0xE9,
+    0x09, 0xFF, 0xFF, 0xFF, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0x41, 0x5E, 0xC3, 0x90, 0x48, 0x89,
+    0xF8, 0x31, 0xD2, 0x80, 0x7C, 0x16, 0x04, 0x00, 0x74, 0x3E, 0x44, 0x8B, 0x04, 0x16, 0x8B, 0x88,
+    0x80, 0x00, 0x00, 0x00, 0x44, 0x89, 0x04, 0x88, 0x8B, 0x88, 0x80, 0x00, 0x00, 0x00, 0x41, 0xB8,
+    0x20, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x84, 0x00, 0x00, 0x00, 0xFF, 0xC1, 0x83, 0xE1, 0x1F, 0x89,
+    0x88, 0x80, 0x00, 0x00, 0x00, 0x8B, 0x88, 0x84, 0x00, 0x00, 0x00, 0x44, 0x39, 0xC1, 0x41, 0x0F,
+    0x47, 0xC8, 0x89, 0x88, 0x84, 0x00, 0x00, 0x00, 0x48, 0x83, 0xC2, 0x08, 0x48, 0x05, 0x88, 0x00,
+    0x00, 0x00, 0x48, 0x83, 0xFA, 0x30, 0x75, 0xAB, 0x0F, 0xB6, 0x46, 0x30, 0xFF, 0x87, 0x54, 0x03,
+    0x00, 0x00, 0xFF, 0x84, 0x87, 0x30, 0x03, 0x00, 0x00, 0x31, 0xC0, 0x80, 0x7E, 0x2C, 0x00, 0x74,
+    0x03, 0x8B, 0x46, 0x28, 0x01, 0x87, 0x58, 0x03, 0x00, 0x00, 0xC3, 0x90, 0x48, 0x89, 0xFA, 0x31,
+    0xC0, 0xB9, 0xCC, 0x00, 0x00, 0x00, 0xF3, 0xAB, 0x48, 0x8D, 0xBA, 0x30, 0x03, 0x00, 0x00, 0xB9,
+    0x09, 0x00, 0x00, 0x00, 0xF3, 0xAB, 0x31, 0xC0, 0x48, 0x89, 0x82, 0x54, 0x03, 0x00, 0x00, 0xC3,
+    0x41, 0x56, 0x31, 0xC0, 0x41, 0x55, 0x44, 0x0F, 0xB6, 0xEE, 0x41, 0x54, 0x49, 0x69, 0xF5, 0x88,
+    0x00, 0x00, 0x00, 0x55, 0x53, 0x89, 0xD3, 0x31, 0xD2, 0x48, 0x01, 0xFE, 0x48, 0x81, 0xEC, 0x90,
+    0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0x8B, 0x86, 0x84, 0x00, 0x00, 0x00, 0x85, 0xC0,
+    0x0F, 0x84, 0xBB, 0x00, 0x00, 0x00, 0x8D, 0x4B, 0xFF, 0x80, 0xF9, 0x63, 0x0F, 0x87, 0xAD, 0x00,
+    0x00, 0x00, 0x48, 0x8D, 0x2C, 0x85, 0x00, 0x00, 0x00, 0x00, 0x49, 0x89, 0xFC, 0xB9, 0x20, 0x00,
+    0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x10, 0x48, 0x89, 0xEA, 0x48, 0x8D, 0x44, 0x24, 0x10, 0xF3,
+    0xA5, 0x48, 0xC1, 0xFA, 0x02, 0x4C, 0x8D, 0x34, 0x28, 0x48, 0x89, 0xC7, 0x48, 0x0F, 0xBD, 0xD2,
+    0x4C, 0x89, 0xF6, 0x48, 0x63, 0xD2, 0x48, 0x01, 0xD2, 0xE8, 0xCE, 0xFD, 0xFF, 0xFF, 0x48, 0x83,
+    0xFD, 0x40, 0x76, 0x35, 0x48, 0x8D, 0x74, 0x24, 0x50, 0x48, 0x8D, 0x7C, 0x24, 0x10, 0xE8, 0x4C,
+    0xFD, 0xFF, 0xFF, 0x48, 0x8D, 0x44, 0x24, 0x50, 0x49, 0x39, 0xC6, 0x74, 0x29, 0x8B, 0x08, 0x48,
+    0x89, 0xC2, 0x8B, 0x72, 0xFC, 0x39, 0xF1, 0x73, 0x08, 0x89, 0x32, 0x48, 0x83, 0xEA, 0x04, 0xEB,
+    0xF1, 0x89, 0x0A, 0x48, 0x83, 0xC0, 0x04, 0xEB, 0xDF, 0x4C, 0x89, 0xF6, 0x48, 0x8D, 0x7C, 0x24,
+    0x10, 0xE8, 0x19, 0xFD, 0xFF, 0xFF, 0x4D, 0x69, 0xED, 0x88, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0xC3,
+    0xB9, 0x64, 0x00, 0x00, 0x00, 0x31, 0xD2, 0x43, 0x0F, 0xAF, 0x84, 0x2C, 0x84, 0x00, 0x00, 0x00,
+    0x8D, 0x40, 0x63, 0xF7, 0xF1, 0xB2, 0x01, 0xFF, 0xC8, 0x8B, 0x44, 0x84, 0x10, 0xEB, 0x02, 0x31,
+    0xC0, 0x89, 0x44, 0x24, 0x08, 0x88, 0x54, 0x24, 0x0C, 0x48, 0x8B, 0x44, 0x24, 0x08, 0x48, 0x81,
+    0xC4, 0x90, 0x00, 0x00, 0x00, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0x41, 0x5E, 0xC3, 0x40, 0x0F,
+    0xB6, 0xF6, 0x48, 0x69, 0xF6, 0x88, 0x00, 0x00, 0x00, 0x8B, 0x84, 0x3E, 0x84, 0x00, 0x00, 0x00,
+    0xC3, 0x90, 0x31, 0xC0, 0x85, 0xFF, 0x74, 0x0B, 0x83, 0xF8, 0x12, 0x77, 0x06, 0xD1, 0xEF, 0xFF,
+    0xC0, 0xEB, 0xF1, 0xC3, 0x0F, 0xB6, 0xD2, 0x31, 0xC0, 0xB9, 0x0A, 0x00, 0x00, 0x00, 0x49, 0x89,
+    0xF8, 0xF3, 0xAB, 0x48, 0x69, 0xD2, 0x88, 0x00, 0x00, 0x00, 0x48, 0x01, 0xD6, 0x8B, 0x86, 0x84,
+    0x00, 0x00, 0x00, 0x48, 0x8D, 0x14, 0x86, 0x48, 0x39, 0xD6, 0x74, 0x14, 0x8B, 0x3E, 0x48, 0x83,
+    0xC6, 0x04, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x89, 0xC0, 0x66, 0x41, 0xFF, 0x04, 0x40, 0xEB, 0xE7,
+    0x4C, 0x89, 0xC0, 0xC3, 0x55, 0x53, 0x48, 0x89, 0xF3, 0x48, 0x83, 0xEC, 0x28, 0x84, 0xD2, 0x75,
+    0x0C, 0x31, 0xC0, 0x48, 0x89, 0x46, 0x08, 0x48, 0x8B, 0x06, 0xC6, 0x00, 0x00, 0x8B, 0x2F, 0xBE,
+    0x0A, 0x00, 0x00, 0x00, 0x89, 0xEF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x54, 0x24, 0x10,
+    0x48, 0x89, 0xE7, 0x89, 0xC6, 0x48, 0x89, 0x14, 0x24, 0x31, 0xD2, 0xE8, 0x00, 0x00, 0x00, 0x00,
+    0x8B, 0x74, 0x24, 0x08, 0x48, 0x8B, 0x3C, 0x24, 0x89, 0xEA, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x8B, 0x54, 0x24, 0x08, 0x48, 0x8B, 0x34, 0x24, 0x48, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x3F, 0x48, 0x2B, 0x43, 0x08, 0x48, 0x39, 0xD0, 0x73, 0x0A, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xE7,
+    0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xC4, 0x28, 0x5B, 0x5D, 0xC3, 0x41, 0x57, 0xBA, 0x00,
+    0x00, 0x00, 0x00, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x49, 0x89, 0xF4, 0xBE, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0x31, 0xED, 0x53, 0x48, 0x89, 0xFB, 0x4C, 0x8D, 0xAB, 0x34, 0x03, 0x00, 0x00, 0x48,
+    0x81, 0xEC, 0x88, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x28, 0x48, 0x89, 0x7C, 0x24, 0x18,
+    0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x44, 0x24, 0x18, 0xBA, 0x01, 0x00, 0x00, 0x00, 0x48,
+    0xC7, 0x44, 0x24, 0x20, 0x0A, 0x00, 0x00, 0x00, 0x48, 0x8D, 0xBB, 0x54, 0x03, 0x00, 0x00, 0x48,
+    0x8D, 0x74, 0x24, 0x18, 0xC6, 0x40, 0x0A, 0x00, 0xE8, 0x17, 0xFF, 0xFF, 0xFF, 0xBE, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x18, 0xE8, 0x2C, 0xFB, 0xFF, 0xFF, 0xBA, 0x01, 0x00, 0x00,
+    0x00, 0x48, 0x8D, 0x74, 0x24, 0x18, 0x48, 0x8D, 0xBB, 0x58, 0x03, 0x00, 0x00, 0xE8, 0xF2, 0xFE,
+    0xFF, 0xFF, 0x48, 0x8B, 0x7C, 0x24, 0x18, 0x41, 0xFF, 0xD4, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x8D, 0x7C, 0x24, 0x18, 0xE8, 0xD5, 0xFA, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8D,
+    0x7C, 0x24, 0x18, 0xE8, 0xF0, 0xFA, 0xFF, 0xFF, 0x48, 0x8B, 0xB4, 0x2D, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8D, 0x7C, 0x24, 0x18, 0xE8, 0xDE, 0xFA, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x8D, 0x7C, 0x24, 0x18, 0xE8, 0xCF, 0xFA, 0xFF, 0xFF, 0x49, 0x8D, 0x7C, 0x2D, 0x00, 0xBA, 0x01,
+    0x00, 0x00, 0x00, 0x48, 0x8D, 0x74, 0x24, 0x18, 0xE8, 0x97, 0xFE, 0xFF, 0xFF, 0x48, 0x83, 0xC5,
+    0x04, 0x48, 0x83, 0xFD, 0x20, 0x75, 0xB2, 0x48, 0x8B, 0x7C, 0x24, 0x18, 0x4C, 0x8D, 0xAB, 0x84,
+    0x00, 0x00, 0x00, 0x31, 0xED, 0x41, 0xFF, 0xD4, 0x48, 0x8B, 0x34, 0xED, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8D, 0x7C, 0x24, 0x18, 0xE8, 0x64, 0xFA, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x8D, 0x7C, 0x24, 0x18, 0xE8, 0x7F, 0xFA, 0xFF, 0xFF, 0x41, 0x8B, 0x45, 0x00, 0xBA, 0x01, 0x00,
+    0x00, 0x00, 0x48, 0x8D, 0x74, 0x24, 0x18, 0x48, 0x8D, 0x7C, 0x24, 0x58, 0x89, 0x44, 0x24, 0x58,
+    0xE8, 0x3F, 0xFE, 0xFF, 0xFF, 0x41, 0x83, 0x7D, 0x00, 0x00, 0x0F, 0x84, 0xB5, 0x01, 0x00, 0x00,
+    0xBE, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x18, 0x41, 0x89, 0xEE, 0xE8, 0x46, 0xFA,
+    0xFF, 0xFF, 0xBA, 0x32, 0x00, 0x00, 0x00, 0x89, 0xEE, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0x44, 0x24, 0x58, 0x31, 0xC0, 0x80, 0x7C, 0x24, 0x5C, 0x00, 0x74, 0x04, 0x8B,
+    0x44, 0x24, 0x58, 0xBA, 0x01, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x74, 0x24, 0x18, 0x48, 0x8D, 0x7C,
+    0x24, 0x38, 0x89, 0x44, 0x24, 0x38, 0xE8, 0xE9, 0xFD, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8D, 0x7C, 0x24, 0x18, 0xE8, 0xFE, 0xF9, 0xFF, 0xFF, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x44,
+    0x89, 0xF6, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x58, 0x31,
+    0xC0, 0x80, 0x7C, 0x24, 0x5C, 0x00, 0x74, 0x04, 0x8B, 0x44, 0x24, 0x58, 0xBA, 0x01, 0x00, 0x00,
+    0x00, 0x48, 0x8D, 0x74, 0x24, 0x18, 0x48, 0x8D, 0x7C, 0x24, 0x38, 0x89, 0x44, 0x24, 0x38, 0xE8,
+    0xA0, 0xFD, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x18, 0xE8, 0xB5,
+    0xF9, 0xFF, 0xFF, 0xBA, 0x64, 0x00, 0x00, 0x00, 0x44, 0x89, 0xF6, 0x48, 0x89, 0xDF, 0xE8, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x58, 0x31, 0xC0, 0x80, 0x7C, 0x24, 0x5C, 0x00, 0x74,
+    0x04, 0x8B, 0x44, 0x24, 0x58, 0xBA, 0x01, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x74, 0x24, 0x18, 0x48,
+    0x8D, 0x7C, 0x24, 0x38, 0x89, 0x44, 0x24, 0x38, 0xE8, 0x57, 0xFD, 0xFF, 0xFF, 0xBE, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x18, 0x49, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x3F, 0xE8, 0x62, 0xF9, 0xFF, 0xFF, 0x44, 0x89, 0xF2, 0x48, 0x89, 0xDE, 0x48, 0x8D, 0x7C, 0x24,
+    0x58, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x8D, 0x74, 0x24, 0x58, 0x66, 0x41, 0x8B, 0x06, 0xBE,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x18, 0x66, 0x89, 0x44, 0x24, 0x08, 0xE8, 0x35,
+    0xF9, 0xFF, 0xFF, 0x0F, 0xB7, 0x44, 0x24, 0x08, 0xBE, 0x0A, 0x00, 0x00, 0x00, 0x89, 0xC7, 0x89,
+    0x44, 0x24, 0x08, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x2D, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C,
+    0x24, 0x38, 0x89, 0x44, 0x24, 0x0C, 0x8B, 0x74, 0x24, 0x0C, 0x48, 0x8D, 0x44, 0x24, 0x48, 0x48,
+    0x89, 0x44, 0x24, 0x38, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x54, 0x24, 0x08, 0x8B, 0x74, 0x24,
+    0x0C, 0x48, 0x8B, 0x7C, 0x24, 0x38, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x54, 0x24, 0x40,
+    0x4C, 0x89, 0xF8, 0x48, 0x2B, 0x44, 0x24, 0x20, 0x48, 0x8B, 0x74, 0x24, 0x38, 0x48, 0x39, 0xD0,
+    0x73, 0x0A, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24,
+    0x18, 0x49, 0x83, 0xC6, 0x02, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x38, 0xE8,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x84, 0x24, 0x80, 0x00, 0x00, 0x00, 0x49, 0x39, 0xC6, 0x0F,
+    0x85, 0x56, 0xFF, 0xFF, 0xFF, 0x48, 0xFF, 0xC5, 0x48, 0x8B, 0x7C, 0x24, 0x18, 0x49, 0x81, 0xC5,
+    0x88, 0x00, 0x00, 0x00, 0x41, 0xFF, 0xD4, 0x48, 0x83, 0xFD, 0x06, 0x0F, 0x85, 0xE7, 0xFD, 0xFF,
+    0xFF, 0x48, 0x8D, 0x7C, 0x24, 0x18, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x81, 0xC4, 0x88, 0x00,
+    0x00, 0x00, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0x41, 0x5E, 0x41, 0x5F, 0xC3, 0x90, 0x48, 0x8B,
+    0x47, 0x30, 0x31, 0xD2, 0x48, 0x89, 0x57, 0x38, 0xC6, 0x00, 0x00, 0x80, 0x7F, 0x54, 0x00, 0x74,
+    0x04, 0xC6, 0x47, 0x54, 0x00, 0x31, 0xC0, 0x66, 0xC7, 0x47, 0x60, 0x00, 0x01, 0x48, 0x89, 0x47,
+    0x58, 0xC3, 0x48, 0x8B, 0x47, 0x08, 0x31, 0xD2, 0x31, 0xC9, 0x89, 0x17, 0x48, 0x89, 0x4F, 0x10,
+    0xC6, 0x00, 0x00, 0x83, 0x7F, 0x58, 0x00, 0x74, 0x08, 0x31, 0xC0, 0x89, 0x87, 0x00, 0x08, 0x00,
+    0x00, 0xEB, 0xBB, 0x90, 0x55, 0x53, 0x48, 0x89, 0xFB, 0x51, 0x40, 0x8A, 0x6F, 0x61, 0x40, 0x84,
+    0xED, 0x75, 0x04, 0x31, 0xED, 0xEB, 0x2A, 0x48, 0x8D, 0x7F, 0x30, 0xBE, 0x00, 0x00, 0x00, 0x00,
+    0xE8, 0x00, 0x00, 0x00, 0x00, 0x85, 0xC0, 0x75, 0xEA, 0x8B, 0x43, 0x58, 0x85, 0xC0, 0x74, 0xE3,
+    0x89, 0x83, 0x00, 0x08, 0x00, 0x00, 0x48, 0x8B, 0x43, 0x50, 0x48, 0x89, 0x83, 0x04, 0x08, 0x00,
+    0x00, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x89, 0xE8, 0x5A, 0x5B, 0x5D, 0xC3, 0x90,
+    0x55, 0x48, 0x8D, 0x6F, 0x08, 0x53, 0x48, 0x89, 0xFB, 0x56, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xC6,
+    0x47, 0x28, 0x01, 0x48, 0x89, 0xEF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x85, 0xC0, 0x75, 0x14, 0x48,
+    0x8B, 0x43, 0x30, 0x31, 0xC9, 0x48, 0x89, 0x4B, 0x38, 0xC6, 0x00, 0x00, 0xB8, 0x02, 0x00, 0x00,
+    0x00, 0xEB, 0x38, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xEF, 0xE8, 0x00, 0x00, 0x00, 0x00,
+    0x85, 0xC0, 0x75, 0x10, 0x31, 0xD2, 0xC6, 0x43, 0x54, 0x01, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x89,
+    0x53, 0x50, 0xEB, 0x17, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xEF, 0xE8, 0x00, 0x00, 0x00,
+    0x00, 0x83, 0xF8, 0x01, 0x19, 0xC0, 0x83, 0xE0, 0x03, 0xFF, 0xC0, 0x89, 0x03, 0x58, 0x5B, 0x5D,
+    0xC3, 0x90, 0x53, 0x8D, 0x56, 0xBF, 0x48, 0x89, 0xFB, 0x0F, 0xB6, 0xC2, 0x48, 0x83, 0xEC, 0x40,
+    0x80, 0xFA, 0x19, 0x76, 0x43, 0x8D, 0x46, 0x9F, 0x8D, 0x4E, 0xB9, 0x3C, 0x19, 0x76, 0x0A, 0x8D,
+    0x46, 0xD0, 0x3C, 0x09, 0x77, 0x07, 0x8D, 0x4E, 0x04, 0xB2, 0x01, 0xEB, 0x1A, 0xB8, 0x3E, 0x00,
+    0x00, 0x00, 0x40, 0x80, 0xFE, 0x2B, 0x74, 0x20, 0xB8, 0x3F, 0x00, 0x00, 0x00, 0x40, 0x80, 0xFE,
+    0x2F, 0x74, 0x15, 0x31, 0xD2, 0x31, 0xC9, 0x0F, 0xB6, 0xC1, 0x88, 0xD4, 0x89, 0xC7, 0x66, 0xC1,
+    0xEF, 0x08, 0x0F, 0x84, 0x89, 0x00, 0x00, 0x00, 0x8B, 0x73, 0x58, 0x85, 0xF6, 0x75, 0x08, 0x31,
+    0xD2, 0x89, 0x93, 0x00, 0x08, 0x00, 0x00, 0x8B, 0x53, 0x5C, 0x8A, 0x4B, 0x60, 0x0F, 0xB6, 0xC0,
+    0xC1, 0xE2, 0x06, 0x09, 0xD0, 0x8D, 0x51, 0x06, 0x89, 0x43, 0x5C, 0x80, 0xFA, 0x07, 0x77, 0x05,
+    0x88, 0x53, 0x60, 0xEB, 0x66, 0x83, 0xE9, 0x02, 0x88, 0x4B, 0x60, 0x81, 0xFE, 0x9B, 0x07, 0x00,
+    0x00, 0x77, 0x0F, 0x89, 0xF2, 0xD3, 0xE8, 0xFF, 0xC6, 0x88, 0x44, 0x13, 0x62, 0x89, 0x73, 0x58,
+    0xEB, 0x2F, 0x80, 0x7B, 0x61, 0x00, 0x74, 0x29, 0x31, 0xC0, 0x48, 0x8D, 0x7C, 0x24, 0x0C, 0xB9,
+    0x0D, 0x00, 0x00, 0x00, 0xF3, 0xAB, 0xB8, 0x71, 0x55, 0xB2, 0xAB, 0x48, 0x8D, 0x7C, 0x24, 0x0C,
+    0x48, 0x01, 0xC0, 0x48, 0x89, 0x44, 0x24, 0x10, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x43, 0x61,
+    0x00, 0x0F, 0xB6, 0x4B, 0x60, 0x83, 0xC8, 0xFF, 0xD3, 0xE0, 0xF7, 0xD0, 0x21, 0x43, 0x5C, 0xEB,
+    0x0A, 0x40, 0x80, 0xFE, 0x3D, 0x74, 0x04, 0xC6, 0x43, 0x61, 0x00, 0x48, 0x83, 0xC4, 0x40, 0x5B,
+    0xC3, 0x90, 0x53, 0x80, 0x7F, 0x28, 0x00, 0x48, 0x89, 0xFB, 0x74, 0x06, 0x40, 0x80, 0xFE, 0x20,
+    0x74, 0x65, 0x8B, 0x03, 0x83, 0xF8, 0x02, 0x75, 0x16, 0x48, 0x83, 0x7B, 0x38, 0x07, 0x77, 0x57,
+    0x40, 0x0F, 0xBE, 0xF6, 0x48, 0x8D, 0x7B, 0x30, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x48, 0x83,
+    0xF8, 0x03, 0x75, 0x37, 0x8D, 0x46, 0xD0, 0x8A, 0x53, 0x54, 0x3C, 0x09, 0x77, 0x1D, 0x31, 0xC0,
+    0x84, 0xD2, 0x74, 0x03, 0x8B, 0x43, 0x50, 0x6B, 0xC0, 0x0A, 0x40, 0x0F, 0xBE, 0xF6, 0xC6, 0x43,
+    0x54, 0x01, 0x8D, 0x44, 0x30, 0xD0, 0x89, 0x43, 0x50, 0xEB, 0x1C, 0x84, 0xD2, 0x74, 0x04, 0xC6,
+    0x43, 0x54, 0x00, 0xC7, 0x03, 0x01, 0x00, 0x00, 0x00, 0xEB, 0x0C, 0x40, 0x0F, 0xBE, 0xF6, 0x48,
+    0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x43, 0x28, 0x00, 0x5B, 0xC3, 0x90, 0x40, 0x80,
+    0xFE, 0x0D, 0x0F, 0x84, 0x8C, 0x00, 0x00, 0x00, 0x48, 0x83, 0xEC, 0x18, 0x8B, 0x07, 0x40, 0x80,
+    0xFE, 0x0A, 0x75, 0x3B, 0x85, 0xC0, 0x75, 0x22, 0x48, 0x83, 0x7F, 0x10, 0x00, 0x48, 0x89, 0x7C,
+    0x24, 0x08, 0x75, 0x0C, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x7C, 0x24, 0x08, 0xEB, 0x0C,
+    0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x7C, 0x24, 0x08, 0x31, 0xC0, 0x31, 0xD2, 0x31, 0xC9,
+    0x89, 0x17, 0x48, 0x8B, 0x57, 0x08, 0x48, 0x89, 0x4F, 0x10, 0xC6, 0x02, 0x00, 0xEB, 0x40, 0x85,
+    0xC0, 0x75, 0x2D, 0x40, 0x80, 0xFE, 0x3A, 0x75, 0x07, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x0D,
+    0x48, 0x83, 0x7F, 0x10, 0x07, 0x76, 0x0A, 0xC7, 0x07, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC0, 0xEB,
+    0x1E, 0x40, 0x0F, 0xBE, 0xF6, 0x48, 0x83, 0xC7, 0x08, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xED,
+    0xFF, 0xC8, 0x74, 0xE9, 0x40, 0x0F, 0xBE, 0xF6, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xDE, 0x48,
+    0x83, 0xC4, 0x18, 0xC3, 0x31, 0xC0, 0xC3, 0x90, 0x48, 0xB8, 0x67, 0xE6, 0x09, 0x6A, 0x85, 0xAE,
+    0x67, 0xBB, 0x31, 0xD2, 0x48, 0x89, 0x07, 0x48, 0xB8, 0x72, 0xF3, 0x6E, 0x3C, 0x3A, 0xF5, 0x4F,
+    0xA5, 0x48, 0x89, 0x47, 0x08, 0x48, 0xB8, 0x7F, 0x52, 0x0E, 0x51, 0x8C, 0x68, 0x05, 0x9B, 0x48,
+    0x89, 0x47, 0x10, 0x48, 0xB8, 0xAB, 0xD9, 0x83, 0x1F, 0x19, 0xCD, 0xE0, 0x5B, 0x48, 0x89, 0x47,
+    0x18, 0x31, 0xC0, 0x89, 0x47, 0x60, 0x48, 0x89, 0x57, 0x68, 0xC3, 0x90, 0x41, 0x57, 0x48, 0x89,
+    0xF8, 0x31, 0xC9, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x55, 0x53, 0x48, 0x81, 0xEC, 0xA0, 0x00,
+    0x00, 0x00, 0x0F, 0xB6, 0x14, 0x0E, 0x0F, 0xB6, 0x7C, 0x0E, 0x01, 0xC1, 0xE2, 0x18, 0xC1, 0xE7,
+    0x10, 0x09, 0xFA, 0x0F, 0xB6, 0x7C, 0x0E, 0x03, 0x09, 0xFA, 0x0F, 0xB6, 0x7C, 0x0E, 0x02, 0xC1,
+    0xE7, 0x08, 0x09, 0xFA, 0x89, 0x54, 0x0C, 0xA0, 0x48, 0x83, 0xC1, 0x04, 0x48, 0x83, 0xF9, 0x40,
+    0x75, 0xD0, 0x48, 0x8D, 0x54, 0x24, 0xA0, 0x4C, 0x8D, 0x44, 0x24, 0x60, 0x8B, 0x72, 0x04, 0x8B,
+    0x7A, 0x38, 0x48, 0x83, 0xC2, 0x04, 0x89, 0xF1, 0x41, 0x89, 0xF1, 0xC1, 0xEE, 0x03, 0x41, 0xC1,
+    0xC1, 0x0E, 0xC1, 0xC9, 0x07, 0x44, 0x31, 0xC9, 0x41, 0x89, 0xF9, 0x31, 0xF1, 0x8B, 0x72, 0x20,
+    0x03, 0x72, 0xFC, 0x41, 0xC1, 0xC1, 0x0D, 0x01, 0xF1, 0x89, 0xFE, 0xC1, 0xEF, 0x0A, 0xC1, 0xC6,
+    0x0F, 0x44, 0x31, 0xCE, 0x31, 0xFE, 0x01, 0xF1, 0x89, 0x4A, 0x3C, 0x49, 0x39, 0xD0, 0x75, 0xBC,
+    0x8B, 0x58, 0x08, 0x44, 0x8B, 0x28, 0x45, 0x31, 0xD2, 0x44, 0x8B, 0x60, 0x04, 0x89, 0x5C, 0x24,
+    0x88, 0x8B, 0x58, 0x0C, 0x44, 0x89, 0xEF, 0x44, 0x8B, 0x44, 0x24, 0x88, 0x45, 0x89, 0xE1, 0x89,
+    0x5C, 0x24, 0x8C, 0x8B, 0x58, 0x10, 0x44, 0x8B, 0x74, 0x24, 0x8C, 0x89, 0x5C, 0x24, 0x90, 0x8B,
+    0x58, 0x14, 0x8B, 0x74, 0x24, 0x90, 0x89, 0x5C, 0x24, 0x94, 0x8B, 0x58, 0x18, 0x8B, 0x6C, 0x24,
+    0x94, 0x89, 0x5C, 0x24, 0x98, 0x8B, 0x58, 0x1C, 0x89, 0x5C, 0x24, 0x9C, 0x41, 0x89, 0xDB, 0x8B,
+    0x5C, 0x24, 0x98, 0x89, 0xF1, 0x89, 0xF2, 0x41, 0x89, 0xF7, 0xC1, 0xC9, 0x06, 0xC1, 0xCA, 0x0B,
+    0x41, 0x21, 0xEF, 0x31, 0xCA, 0x89, 0xF1, 0xC1, 0xC1, 0x07, 0x31, 0xCA, 0x42, 0x8B, 0x4C, 0x14,
+    0xA0, 0x41, 0x03, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x49, 0x83, 0xC2, 0x04, 0x01, 0xCA, 0x89, 0xF1,
+    0xF7, 0xD1, 0x21, 0xD9, 0x44, 0x31, 0xF9, 0x45, 0x89, 0xCF, 0x01, 0xCA, 0x89, 0xF9, 0x45, 0x21,
+    0xC7, 0x44, 0x01, 0xDA, 0x41, 0x89, 0xFB, 0xC1, 0xC9, 0x02, 0x41, 0xC1, 0xCB, 0x0D, 0x41, 0x31,
+    0xCB, 0x89, 0xF9, 0xC1, 0xC1, 0x0A, 0x41, 0x31, 0xCB, 0x44, 0x89, 0xC9, 0x44, 0x31, 0xC1, 0x21,
+    0xF9, 0x44, 0x31, 0xF9, 0x46, 0x8D, 0x3C, 0x32, 0x45, 0x89, 0xC6, 0x44, 0x01, 0xD9, 0x41, 0x89,
+    0xDB, 0x01, 0xD1, 0x49, 0x81, 0xFA, 0x00, 0x01, 0x00, 0x00, 0x74, 0x14, 0x89, 0xEB, 0x45, 0x89,
+    0xC8, 0x89, 0xF5, 0x41, 0x89, 0xF9, 0x44, 0x89, 0xFE, 0x89, 0xCF, 0xE9, 0x73, 0xFF, 0xFF, 0xFF,
+    0x8B, 0x54, 0x24, 0x88, 0x41, 0x01, 0xCD, 0x41, 0x01, 0xFC, 0x44, 0x89, 0x28, 0x44, 0x01, 0xCA,
+    0x44, 0x89, 0x60, 0x04, 0x89, 0x50, 0x08, 0x8B, 0x54, 0x24, 0x8C, 0x44, 0x01, 0xC2, 0x89, 0x50,
+    0x0C, 0x8B, 0x54, 0x24, 0x90, 0x44, 0x01, 0xFA, 0x89, 0x50, 0x10, 0x8B, 0x54, 0x24, 0x94, 0x01,
+    0xF2, 0x89, 0x50, 0x14, 0x8B, 0x54, 0x24, 0x98, 0x01, 0xEA, 0x89, 0x50, 0x18, 0x8B, 0x54, 0x24,
+    0x9C, 0x01, 0xDA, 0x89, 0x50, 0x1C, 0x48, 0x81, 0xC4, 0xA0, 0x00, 0x00, 0x00, 0x5B, 0x5D, 0x41,
+    0x5C, 0x41, 0x5D, 0x41, 0x5E, 0x41, 0x5F, 0xC3, 0x41, 0x55, 0x89, 0xD2, 0x4C, 0x8D, 0x6F, 0x20,
+    0x41, 0x54, 0x4C, 0x8D, 0x24, 0x16, 0x55, 0x48, 0x89, 0xF5, 0x53, 0x48, 0x89, 0xFB, 0x48, 0x01,
+    0x57, 0x68, 0x4C, 0x39, 0xE5, 0x74, 0x2C, 0x8B, 0x43, 0x60, 0x8A, 0x55, 0x00, 0x88, 0x54, 0x03,
+    0x20, 0x8B, 0x43, 0x60, 0xFF, 0xC0, 0x89, 0x43, 0x60, 0x83, 0xF8, 0x40, 0x75, 0x10, 0x4C, 0x89,
+    0xEE, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x31, 0xC0, 0x89, 0x43, 0x60, 0x48, 0xFF,
+    0xC5, 0xEB, 0xCF, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0xC3, 0x41, 0x54, 0x55, 0x48, 0x89, 0xFD,
+    0x53, 0x48, 0x8B, 0x46, 0x68, 0x48, 0x89, 0xF3, 0x4C, 0x8D, 0x24, 0xC5, 0x00, 0x00, 0x00, 0x00,
+    0x8B, 0x46, 0x60, 0xC6, 0x44, 0x06, 0x20, 0x80, 0x8B, 0x46, 0x60, 0xFF, 0xC0, 0x89, 0x46, 0x60,
+    0x83, 0xF8, 0x38, 0x76, 0x23, 0x8B, 0x53, 0x60, 0x83, 0xFA, 0x3F, 0x77, 0x0A, 0xC6, 0x44, 0x13,
+    0x20, 0x00, 0xFF, 0x43, 0x60, 0xEB, 0xEE, 0x48, 0x8D, 0x73, 0x20, 0x48, 0x89, 0xDF, 0xE8, 0x00,
+    0x00, 0x00, 0x00, 0x31, 0xC0, 0x89, 0x43, 0x60, 0x8B, 0x53, 0x60, 0x83, 0xFA, 0x37, 0x77, 0x0A,
+    0xC6, 0x44, 0x13, 0x20, 0x00, 0xFF, 0x43, 0x60, 0xEB, 0xEE, 0x31, 0xC0, 0x6B, 0xC8, 0xF8, 0x4C,
+    0x89, 0xE2, 0x48, 0xD3, 0xEA, 0x88, 0x54, 0x03, 0x5F, 0x48, 0xFF, 0xC8, 0x48, 0x83, 0xF8, 0xF8,
+    0x75, 0xEA, 0x48, 0x89, 0xDF, 0x48, 0x8D, 0x73, 0x20, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x31, 0xC0,
+    0xB9, 0x08, 0x00, 0x00, 0x00, 0x48, 0x89, 0xEF, 0xF3, 0xAB, 0x48, 0x89, 0xE8, 0x31, 0xFF, 0x8B,
+    0x0C, 0x3B, 0x48, 0x83, 0xC7, 0x04, 0x48, 0x83, 0xC0, 0x04, 0x89, 0xCE, 0x88, 0x68, 0xFE, 0xC1,
+    0xEE, 0x18, 0x88, 0x48, 0xFF, 0x40, 0x88, 0x70, 0xFC, 0x89, 0xCE, 0xC1, 0xEE, 0x10, 0x40, 0x88,
+    0x70, 0xFD, 0x48, 0x83, 0xFF, 0x20, 0x75, 0xD7, 0x48, 0x89, 0xE8, 0x5B, 0x5D, 0x41, 0x5C, 0xC3,
+    0x48, 0x83, 0x7F, 0x08, 0x00, 0x75, 0x16, 0x53, 0x48, 0x89, 0xFB, 0x8B, 0x3F, 0xBE, 0x01, 0x00,
+    0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x43, 0x08, 0x5B, 0xC3, 0xC3, 0x48, 0x8B,
+    0x57, 0x10, 0x48, 0x8B, 0x47, 0x08, 0x48, 0x85, 0xD2, 0x74, 0x05, 0x48, 0x39, 0xF2, 0x75, 0x05,
+    0x48, 0x89, 0x77, 0x10, 0xC3, 0x48, 0x83, 0xEC, 0x48, 0x31, 0xC0, 0xB9, 0x0D, 0x00, 0x00, 0x00,
+    0x48, 0x8D, 0x7C, 0x24, 0x0C, 0xF3, 0xAB, 0x48, 0x8D, 0x7C, 0x24, 0x0C, 0xC7, 0x44, 0x24, 0x10,
+    0x39, 0xBB, 0x7B, 0x42, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x31, 0xC0, 0x48, 0x83, 0xC4, 0x48, 0xC3,
+    0x48, 0x39, 0x77, 0x10, 0x75, 0x06, 0x31, 0xC0, 0x48, 0x89, 0x47, 0x10, 0xC3, 0x90, 0x8B, 0x4F,
+    0x20, 0x31, 0xD2, 0x39, 0xCA, 0x73, 0x21, 0x48, 0x8B, 0x47, 0x18, 0x31, 0xF6, 0x45, 0x31, 0xC0,
+    0x0F, 0xB7, 0x04, 0x50, 0x48, 0xFF, 0xC2, 0x48, 0x6B, 0xC0, 0x0C, 0x48, 0x03, 0x47, 0x10, 0x48,
+    0x89, 0x30, 0x44, 0x89, 0x40, 0x08, 0xEB, 0xDB, 0x31, 0xC0, 0x31, 0xD2, 0x89, 0x47, 0x20, 0x48,
+    0x89, 0x57, 0x08, 0xC3, 0x53, 0x48, 0x83, 0x3F, 0x00, 0x48, 0x89, 0xFB, 0x75, 0x38, 0xBE, 0x01,
+    0x00, 0x00, 0x00, 0xBF, 0xB4, 0x2D, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x01, 0x00,
+    0x00, 0x00, 0xBF, 0x00, 0x30, 0x00, 0x00, 0x48, 0x89, 0x03, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xBE,
+    0x01, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x08, 0x00, 0x00, 0x48, 0x89, 0x43, 0x10, 0xE8, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x43, 0x18, 0x48, 0x89, 0xDF, 0x5B, 0xEB, 0x82, 0x66, 0x81, 0xFE, 0xFF,
+    0x03, 0x77, 0x3A, 0x48, 0x8B, 0x47, 0x10, 0x48, 0x85, 0xC0, 0x74, 0x31, 0x0F, 0xB7, 0xF6, 0x48,
+    0x6B, 0xF6, 0x0C, 0x48, 0x01, 0xF0, 0x8B, 0x50, 0x04, 0x8B, 0x08, 0x40, 0x8A, 0x70, 0x06, 0x40,
+    0x8A, 0x78, 0x07, 0x66, 0x85, 0xD2, 0x74, 0x15, 0x89, 0xD0, 0x66, 0xD1, 0xE8, 0x0F, 0xB7, 0xC0,
+    0x01, 0xC8, 0x0F, 0xB7, 0xCA, 0x31, 0xD2, 0xF7, 0xF1, 0xB2, 0x01, 0xEB, 0x08, 0x31, 0xD2, 0x31,
+    0xC0, 0x31, 0xF6, 0x31, 0xFF, 0x40, 0x88, 0x7C, 0x24, 0xFC, 0x40, 0x88, 0x74, 0x24, 0xFD, 0x88,
+    0x44, 0x24, 0xFE, 0x88, 0x54, 0x24, 0xFF, 0x8B, 0x44, 0x24, 0xFC, 0xC3, 0x48, 0x8B, 0x47, 0x18,
+    0x89, 0xF6, 0x66, 0x8B, 0x04, 0x70, 0xC3, 0x90, 0x0F, 0xB7, 0x06, 0x48, 0x89, 0xC1, 0x48, 0x6B,
+    0xC0, 0x0C, 0x48, 0x03, 0x47, 0x10, 0x66, 0x83, 0x78, 0x04, 0x00, 0x75, 0x1A, 0x44, 0x8B, 0x4F,
+    0x20, 0x4C, 0x8B, 0x47, 0x18, 0x4C, 0x89, 0xCA, 0x66, 0x44, 0x89, 0x48, 0x08, 0xFF, 0xC2, 0x66,
+    0x43, 0x89, 0x0C, 0x48, 0x89, 0x57, 0x20, 0x0F, 0xB6, 0x56, 0x02, 0x66, 0xFF, 0x40, 0x04, 0x01,
+    0x10, 0x8A, 0x50, 0x06, 0x8A, 0x4E, 0x02, 0x38, 0xCA, 0x0F, 0x42, 0xD1, 0x88, 0x50, 0x06, 0x8A,
+    0x50, 0x07, 0x8A, 0x4E, 0x02, 0x38, 0xCA, 0x0F, 0x42, 0xD1, 0x88, 0x50, 0x07, 0xC3, 0x44, 0x8B,
+    0x57, 0x0C, 0x48, 0x89, 0xF9, 0x31, 0xFF, 0x41, 0x89, 0xF0, 0x41, 0xB9, 0x2D, 0x00, 0x00, 0x00,
+    0x31, 0xF6, 0x41, 0x39, 0xFA, 0x75, 0x03, 0x89, 0xF0, 0xC3, 0x53, 0x8B, 0x41, 0x08, 0x31, 0xD2,
+    0x01, 0xF8, 0x41, 0xF7, 0xF1, 0x31, 0xC0, 0x89, 0xD2, 0x48, 0x69, 0xD2, 0x04, 0x01, 0x00, 0x00,
+    0x48, 0x03, 0x11, 0x8B, 0x1A, 0x39, 0xD8, 0x73, 0x19, 0x66, 0x44, 0x39, 0x44, 0x82, 0x04, 0x75,
+    0x0C, 0x44, 0x8A, 0x5C, 0x82, 0x06, 0x44, 0x38, 0xDE, 0x41, 0x0F, 0x42, 0xF3, 0x48, 0xFF, 0xC0,
+    0xEB, 0xE3, 0xFF, 0xC7, 0x41, 0x39, 0xFA, 0x75, 0xC2, 0x89, 0xF0, 0x5B, 0xC3, 0x90, 0x53, 0x0F,
+    0xB7, 0x1E, 0x4C, 0x8B, 0x47, 0x10, 0x0F, 0xB6, 0x56, 0x02, 0x48, 0x89, 0xD8, 0x48, 0x6B, 0xDB,
+    0x0C, 0x4C, 0x01, 0xC3, 0x29, 0x13, 0x66, 0xFF, 0x4B, 0x04, 0x75, 0x34, 0x8B, 0x47, 0x20, 0x48,
+    0x8B, 0x4F, 0x18, 0x0F, 0xB7, 0x73, 0x08, 0xFF, 0xC8, 0x48, 0x89, 0xC2, 0x0F, 0xB7, 0x04, 0x41,
+    0x66, 0x89, 0x04, 0x71, 0x48, 0x6B, 0xC0, 0x0C, 0x8B, 0x4B, 0x08, 0x66, 0x41, 0x89, 0x4C, 0x00,
+    0x08, 0x31, 0xC0, 0x89, 0x57, 0x20, 0x31, 0xD2, 0x48, 0x89, 0x03, 0x89, 0x53, 0x08, 0xEB, 0x10,
+    0x3A, 0x53, 0x06, 0x75, 0x0B, 0x0F, 0xB7, 0xF0, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x88, 0x43, 0x06,
+    0x5B, 0xC3, 0x41, 0x54, 0xB9, 0x2D, 0x00, 0x00, 0x00, 0x31, 0xD2, 0x45, 0x31, 0xE4, 0x55, 0x53,
+    0x8B, 0x6F, 0x08, 0x48, 0x89, 0xFB, 0xFF, 0x4F, 0x0C, 0x48, 0x89, 0xE8, 0x48, 0x69, 0xED, 0x04,
+    0x01, 0x00, 0x00, 0x48, 0x03, 0x2F, 0xFF, 0xC0, 0xF7, 0xF1, 0x89, 0x57, 0x08, 0x44, 0x3B, 0x65,
+    0x00, 0x73, 0x15, 0x44, 0x89, 0xE0, 0x48, 0x89, 0xDF, 0x41, 0xFF, 0xC4, 0x48, 0x8D, 0x74, 0x85,
+    0x04, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xE5, 0x5B, 0x5D, 0x41, 0x5C, 0xC3, 0x90, 0x45, 0x31,
+    0xC0, 0x44, 0x89, 0x02, 0x48, 0x85, 0xFF, 0x0F, 0x84, 0xFF, 0x00, 0x00, 0x00, 0x41, 0x57, 0x41,
+    0x89, 0xF7, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x55, 0x53, 0x51, 0x83, 0xFE, 0x01, 0x0F, 0x86,
+    0xDC, 0x00, 0x00, 0x00, 0x66, 0x8B, 0x2F, 0x48, 0x89, 0xFB, 0x66, 0xC1, 0xC5, 0x08, 0x89, 0xE8,
+    0x66, 0x25, 0x00, 0xC0, 0x66, 0x3D, 0x00, 0xC0, 0x0F, 0x85, 0xC2, 0x00, 0x00, 0x00, 0x49, 0x89,
+    0xD5, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x44, 0x8D, 0x70, 0x02, 0x41, 0x89, 0xC4, 0x45, 0x39, 0xF7,
+    0x0F, 0x82, 0xAA, 0x00, 0x00, 0x00, 0x89, 0xC0, 0x41, 0x8D, 0x54, 0x24, 0x01, 0x0F, 0xB6, 0x04,
+    0x03, 0x0F, 0xB6, 0x14, 0x13, 0xC1, 0xE0, 0x08, 0x09, 0xD0, 0x6B, 0xC0, 0x06, 0x44, 0x01, 0xF0,
+    0x41, 0x39, 0xC7, 0x0F, 0x85, 0x87, 0x00, 0x00, 0x00, 0x48, 0x89, 0xDF, 0x81, 0xE5, 0xFF, 0x3F,
+    0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x40, 0x00, 0x00, 0x00, 0x39, 0xC8, 0x0F, 0x46,
+    0xC8, 0x8D, 0x04, 0x80, 0x41, 0x83, 0xC4, 0x04, 0x31, 0xFF, 0x42, 0x8D, 0x14, 0x30, 0x39, 0xCF,
+    0x74, 0x5E, 0x44, 0x89, 0xE0, 0x41, 0x8D, 0x74, 0x24, 0x01, 0x0F, 0xB6, 0x04, 0x03, 0x0F, 0xB6,
+    0x34, 0x33, 0xC1, 0xE0, 0x08, 0x09, 0xF0, 0x39, 0xE8, 0x73, 0x3D, 0x8D, 0x04, 0x80, 0x8D, 0x70,
+    0x02, 0x83, 0xC0, 0x03, 0x0F, 0xB6, 0x34, 0x33, 0x0F, 0xB6, 0x04, 0x03, 0xC1, 0xE6, 0x08, 0x09,
+    0xF0, 0x3D, 0xFF, 0x03, 0x00, 0x00, 0x7F, 0x20, 0x41, 0x8B, 0x75, 0x00, 0x44, 0x8D, 0x04, 0x17,
+    0x46, 0x8A, 0x0C, 0x03, 0x41, 0x89, 0xF0, 0xFF, 0xC6, 0x66, 0x43, 0x89, 0x44, 0x85, 0x04, 0x47,
+    0x88, 0x4C, 0x85, 0x06, 0x41, 0x89, 0x75, 0x00, 0xFF, 0xC7, 0x41, 0x83, 0xC4, 0x05, 0xEB, 0x9E,
+    0x58, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0x41, 0x5E, 0x41, 0x5F, 0xC3, 0xC3, 0x90, 0x41, 0x56,
+    0x41, 0x55, 0x41, 0x89, 0xD5, 0x41, 0x54, 0x49, 0x89, 0xF4, 0x55, 0x53, 0x8B, 0x77, 0x0C, 0x48,
+    0x89, 0xFB, 0x4C, 0x8B, 0x37, 0x8B, 0x47, 0x08, 0x85, 0xF6, 0x74, 0x44, 0xB9, 0x2D, 0x00, 0x00,
+    0x00, 0x8D, 0x44, 0x06, 0xFF, 0x31, 0xD2, 0xF7, 0xF1, 0x31, 0xC9, 0x89, 0xD2, 0x48, 0x69, 0xD2,
+    0x04, 0x01, 0x00, 0x00, 0x4C, 0x01, 0xF2, 0x8B, 0x3A, 0x39, 0xF9, 0x73, 0x16, 0x0F, 0xB7, 0x44,
+    0x8A, 0x04, 0x48, 0xFF, 0xC1, 0x48, 0x6B, 0xC0, 0x0C, 0x48, 0x03, 0x43, 0x10, 0xC6, 0x40, 0x07,
+    0x00, 0xEB, 0xE6, 0x83, 0xFE, 0x2D, 0x75, 0x08, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00,
+    0x8B, 0x43, 0x0C, 0x8B, 0x53, 0x08, 0xB9, 0x2D, 0x00, 0x00, 0x00, 0x44, 0x89, 0xEE, 0x4C, 0x89,
+    0xE7, 0xFF, 0xC0, 0x89, 0x43, 0x0C, 0x8D, 0x44, 0x10, 0xFF, 0x31, 0xD2, 0xF7, 0xF1, 0x89, 0xD5,
+    0x48, 0x69, 0xED, 0x04, 0x01, 0x00, 0x00, 0x4C, 0x01, 0xF5, 0x48, 0x89, 0xEA, 0xE8, 0x00, 0x00,
+    0x00, 0x00, 0x45, 0x31, 0xD2, 0x44, 0x3B, 0x55, 0x00, 0x73, 0x15, 0x44, 0x89, 0xD0, 0x48, 0x89,
+    0xDF, 0x41, 0xFF, 0xC2, 0x48, 0x8D, 0x74, 0x85, 0x04, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xE5,
+    0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0x41, 0x5E, 0xC3, 0x90, 0x31, 0xC0, 0xBA, 0x00, 0xFF, 0x00,
+    0x00, 0x40, 0x3A, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x72, 0x06, 0x8B, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xC0, 0x08, 0x48, 0x83, 0xF8, 0x20, 0x75, 0xE7, 0x89, 0xD0, 0xC3, 0x90, 0x48, 0x85,
+    0xF6, 0x74, 0x25, 0x83, 0xFA, 0x01, 0x76, 0x20, 0x83, 0xEA, 0x02, 0x49, 0x89, 0xFB, 0xB8, 0x38,
+    0x01, 0x00, 0x00, 0x81, 0xFA, 0x1C, 0x06, 0x00, 0x00, 0x77, 0x10, 0x89, 0xD0, 0xB9, 0x05, 0x00,
+    0x00, 0x00, 0x31, 0xD2, 0xF7, 0xF1, 0xEB, 0x03, 0x31, 0xC0, 0xC3, 0x49, 0x8B, 0x53, 0x08, 0x4C,
+    0x8D, 0x46, 0x02, 0x8B, 0x52, 0x20, 0x39, 0xD0, 0x0F, 0x46, 0xD0, 0x45, 0x31, 0xD2, 0x89, 0xD0,
+    0x41, 0x89, 0xD1, 0x86, 0xE0, 0x66, 0x89, 0x06, 0x41, 0x39, 0xD2, 0x72, 0x07, 0x8D, 0x04, 0x92,
+    0x83, 0xC0, 0x02, 0xC3, 0x53, 0x48, 0x83, 0xEC, 0x10, 0x49, 0x8B, 0x7B, 0x08, 0x48, 0x8B, 0x47,
+    0x18, 0x42, 0x0F, 0xB7, 0x34, 0x50, 0x89, 0xF3, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x31, 0xFF, 0x89,
+    0x44, 0x24, 0x0C, 0x80, 0x7C, 0x24, 0x0F, 0x00, 0x74, 0x05, 0x0F, 0xB6, 0x7C, 0x24, 0x0E, 0xE8,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0xCF, 0x49, 0xFF, 0xC2, 0x41, 0x88, 0x58, 0x01, 0x89, 0xC2,
+    0x41, 0x88, 0x08, 0x0F, 0xB6, 0xCC, 0x49, 0x83, 0xC0, 0x05, 0xC1, 0xEA, 0x10, 0x41, 0x88, 0x48,
+    0xFE, 0x41, 0x88, 0x50, 0xFD, 0x41, 0x88, 0x40, 0xFF, 0x45, 0x39, 0xCA, 0x72, 0xAB, 0x43, 0x8D,
+    0x04, 0x89, 0x48, 0x83, 0xC4, 0x10, 0x83, 0xC0, 0x02, 0x5B, 0xC3, 0x8B, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x8D, 0x50, 0x01, 0x8D, 0x48, 0x02, 0x31, 0xC0, 0x89, 0x15, 0x00, 0x00, 0x00, 0x00, 0xD1,
+    0xE9, 0x83, 0xE1, 0x01, 0x48, 0x69, 0xC9, 0xA0, 0x07, 0x00, 0x00, 0x48, 0x03, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x89, 0x01, 0x48, 0x8B, 0x05, 0x00, 0x00, 0x00, 0x00, 0x48, 0x85, 0xC0, 0x74, 0x42,
+    0x48, 0x8B, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x48, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x31, 0xD2,
+    0x48, 0xFF, 0xC8, 0x48, 0x8D, 0x77, 0x01, 0x48, 0xF7, 0xF6, 0x31, 0xC0, 0x48, 0x69, 0xD2, 0xA0,
+    0x07, 0x00, 0x00, 0x48, 0x03, 0x15, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x32, 0x39, 0xF0, 0x73, 0x10,
+    0x89, 0xC6, 0xFF, 0xC0, 0x40, 0x8A, 0x7C, 0x32, 0x04, 0x40, 0x88, 0x7C, 0x31, 0x04, 0xEB, 0xEA,
+    0x89, 0x31, 0x8B, 0x05, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x89, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0xC3, 0x48, 0x83, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x6C, 0x48, 0x83, 0xEC, 0x18, 0xBE,
+    0x01, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x5E, 0x01, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x01,
+    0x00, 0x00, 0x00, 0xBF, 0x40, 0x0F, 0x00, 0x00, 0x48, 0x89, 0x05, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x89, 0x05, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0xE8, 0x34, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x8D, 0x7C, 0x24, 0x0C, 0x31, 0xC0, 0x89, 0x44, 0x24, 0x0C, 0xE8, 0x00, 0x00, 0x00,
+    0x00, 0x8B, 0x54, 0x24, 0x0C, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC6, 0xE8, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x83, 0xC4, 0x18, 0xC3, 0xC3, 0x52, 0x31, 0xC9, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x89, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xE8, 0x00, 0x00, 0x00, 0x00, 0x31, 0xF6, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x35, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x89, 0x35, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xBD, 0xFE, 0xFF, 0xFF, 0x80, 0x3D,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x07, 0xC6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xC3, 0x89, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x8B, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0xC3, 0x89, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x8B, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0xC3, 0x48, 0x89, 0x7C, 0x24, 0xF8, 0x80, 0x7C, 0x24, 0xFC, 0x00, 0x74, 0x17, 0x80,
+    0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x0E, 0x8B, 0x05, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
+    0x39, 0x44, 0x24, 0xF8, 0x74, 0x1A, 0x83, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x11, 0x80,
+    0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x14, 0xC6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3,
+    0x48, 0x8B, 0x44, 0x24, 0xF8, 0x48, 0x89, 0x05, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x48, 0x8B, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0xC3, 0x48, 0x89, 0x7C, 0x24, 0xF8, 0x8A, 0x44, 0x24, 0xFC, 0x84, 0xC0,
+    0x74, 0x17, 0x80, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x10, 0x8B, 0x44, 0x24, 0xF8, 0x39,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x92, 0xC0, 0xC3, 0xB0, 0x01, 0xC3, 0x8A, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x84, 0xC0, 0x74, 0x11, 0x48, 0x8B, 0x05, 0x00, 0x00, 0x00, 0x00, 0x48, 0x39, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0x94, 0xC0, 0xC3, 0x8B, 0x15, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00,
+    0x00, 0x00, 0x00, 0x85, 0xD2, 0x74, 0x1B, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x83, 0xFA, 0x01, 0x74,
+    0x11, 0x83, 0xFA, 0x02, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x48, 0x0F,
+    0x45, 0xC2, 0xC3, 0x8B, 0x05, 0x00, 0x00, 0x00, 0x00, 0x31, 0xD2, 0x83, 0xF8, 0x03, 0x77, 0x08,
+    0x48, 0x8B, 0x14, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xD0, 0xC3, 0x31, 0xC0, 0x89, 0x47,
+    0x1C, 0x6B, 0x47, 0x14, 0x03, 0x83, 0xC0, 0x08, 0x89, 0x47, 0x20, 0xC3, 0x53, 0x31, 0xC0, 0x48,
+    0x89, 0xFB, 0x48, 0x83, 0xEC, 0x40, 0x48, 0x89, 0x47, 0x08, 0x48, 0x89, 0x47, 0x10, 0x48, 0x89,
+    0x47, 0x18, 0xC7, 0x47, 0x20, 0x08, 0x00, 0x00, 0x00, 0x48, 0x85, 0xF6, 0x74, 0x50, 0x83, 0xFA,
+    0x07, 0x76, 0x4B, 0x80, 0x3E, 0x54, 0x75, 0x46, 0x80, 0x7E, 0x01, 0x42, 0x75, 0x40, 0x80, 0x7E,
+    0x02, 0x4F, 0x75, 0x3A, 0x80, 0x7E, 0x03, 0x44, 0x75, 0x34, 0x80, 0x7E, 0x04, 0x01, 0x75, 0x2E,
+    0x0F, 0xB6, 0x46, 0x05, 0x3C, 0x40, 0x77, 0x26, 0x8D, 0x04, 0x40, 0x83, 0xC0, 0x08, 0x39, 0xC2,
+    0x72, 0x1C, 0x48, 0x89, 0x77, 0x08, 0x89, 0x57, 0x10, 0x0F, 0xB6, 0x46, 0x05, 0x89, 0x47, 0x14,
+    0x0F, 0xB7, 0x46, 0x06, 0x89, 0x47, 0x18, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x20, 0x48, 0x8D,
+    0x7C, 0x24, 0x0C, 0xB9, 0x0D, 0x00, 0x00, 0x00, 0x31, 0xC0, 0xF3, 0xAB, 0x48, 0x8D, 0x7C, 0x24,
+    0x0C, 0xC7, 0x44, 0x24, 0x10, 0x13, 0x0B, 0xD0, 0xE2, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83,
+    0x7B, 0x08, 0x00, 0x0F, 0x95, 0xC0, 0x48, 0x83, 0xC4, 0x40, 0x5B, 0xC3, 0x48, 0x85, 0xF6, 0x0F,
+    0x84, 0x0F, 0x01, 0x00, 0x00, 0x85, 0xD2, 0x0F, 0x84, 0x07, 0x01, 0x00, 0x00, 0x83, 0x7F, 0x18,
+    0x00, 0x0F, 0x84, 0xFD, 0x00, 0x00, 0x00, 0x8B, 0x47, 0x20, 0x49, 0x89, 0xF3, 0x8B, 0x77, 0x10,
+    0x8D, 0x48, 0x02, 0x39, 0xCE, 0x0F, 0x82, 0xE9, 0x00, 0x00, 0x00, 0x4C, 0x8B, 0x47, 0x08, 0x89,
+    0xC1, 0x66, 0x41, 0x8B, 0x0C, 0x08, 0x86, 0xE9, 0x81, 0xE1, 0xFF, 0x3F, 0x00, 0x00, 0x44, 0x8D,
+    0x04, 0x89, 0x41, 0x83, 0xC0, 0x02, 0x81, 0xF9, 0x38, 0x01, 0x00, 0x00, 0x41, 0x0F, 0x97, 0xC1,
+    0x44, 0x39, 0xC2, 0x0F, 0x92, 0xC2, 0x41, 0x08, 0xD1, 0x0F, 0x85, 0xB5, 0x00, 0x00, 0x00, 0x55,
+    0x53, 0x8D, 0x5C, 0x09, 0x02, 0x01, 0xD8, 0x39, 0xC6, 0x73, 0x08, 0x45, 0x31, 0xC0, 0xE9, 0x9B,
+    0x00, 0x00, 0x00, 0x89, 0xC8, 0x45, 0x31, 0xD2, 0x86, 0xE0, 0x66, 0x41, 0x89, 0x03, 0xB0, 0x01,
+    0x41, 0x39, 0xCA, 0x41, 0x0F, 0x92, 0xC1, 0x41, 0x20, 0xC1, 0x74, 0x65, 0x8B, 0x47, 0x20, 0x48,
+    0x8B, 0x77, 0x08, 0x42, 0x8D, 0x04, 0x50, 0x8D, 0x50, 0x02, 0x83, 0xC0, 0x03, 0x0F, 0xB6, 0x14,
+    0x16, 0x0F, 0xB6, 0x04, 0x06, 0xC1, 0xE2, 0x08, 0x09, 0xC2, 0x83, 0xE0, 0x3F, 0x3B, 0x47, 0x14,
+    0x73, 0x34, 0x8D, 0x04, 0x40, 0x89, 0xD5, 0xC1, 0xFA, 0x06, 0x83, 0xC0, 0x08, 0xC1, 0xFD, 0x0E,
+    0x48, 0x01, 0xF0, 0x43, 0x8D, 0x34, 0x92, 0x83, 0xC6, 0x02, 0x4C, 0x01, 0xDE, 0x40, 0x88, 0x2E,
+    0x88, 0x56, 0x01, 0x8A, 0x10, 0x88, 0x56, 0x02, 0x8A, 0x50, 0x01, 0x88, 0x56, 0x03, 0x8A, 0x40,
+    0x02, 0x88, 0x46, 0x04, 0xEB, 0x03, 0x45, 0x31, 0xC9, 0x41, 0xFF, 0xC2, 0x44, 0x89, 0xC8, 0xEB,
+    0x8F, 0x84, 0xC0, 0x0F, 0x84, 0x72, 0xFF, 0xFF, 0xFF, 0x8B, 0x47, 0x1C, 0x01, 0x5F, 0x20, 0xFF,
+    0xC0, 0x89, 0x47, 0x1C, 0x3B, 0x47, 0x18, 0x72, 0x05, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x44, 0x89,
+    0xC0, 0x5B, 0x5D, 0xC3, 0x31, 0xC0, 0xC3, 0x8D, 0x46, 0x02, 0x8D, 0x4E, 0x03, 0x48, 0x89, 0xFA,
+    0x0F, 0xB6, 0x04, 0x07, 0x0F, 0xB6, 0x0C, 0x0F, 0xC1, 0xE0, 0x10, 0xC1, 0xE1, 0x08, 0x01, 0xC8,
+    0x8D, 0x4E, 0x04, 0x0F, 0xB6, 0x0C, 0x0F, 0x89, 0xF7, 0xFF, 0xC6, 0x0F, 0xB6, 0x3C, 0x3A, 0x0F,
+    0xB6, 0x14, 0x32, 0x01, 0xC1, 0xC1, 0xE8, 0x10, 0x88, 0x44, 0x24, 0xFC, 0x89, 0xC8, 0xC1, 0xE7,
+    0x08, 0x86, 0xE0, 0x09, 0xFA, 0x66, 0x89, 0x54, 0x24, 0xFA, 0x66, 0x89, 0x44, 0x24, 0xFD, 0x0F,
+    0xB7, 0x54, 0x24, 0xFE, 0x8B, 0x44, 0x24, 0xFA, 0x48, 0xC1, 0xE2, 0x20, 0x48, 0x09, 0xD0, 0xC3,
+    0x48, 0x83, 0xEC, 0x48, 0x89, 0xFA, 0x31, 0xC0, 0xB9, 0x0D, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C,
+    0x24, 0x0C, 0xF3, 0xAB, 0x48, 0x8D, 0x7C, 0x24, 0x0C, 0x88, 0x54, 0x24, 0x14, 0x89, 0x74, 0x24,
+    0x10, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xC4, 0x48, 0xC3, 0x48, 0x83, 0xEC, 0x48, 0x41,
+    0x89, 0xF8, 0x31, 0xC0, 0xB9, 0x0D, 0x00, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x0C, 0xF3, 0xAB,
+    0x48, 0x8D, 0x7C, 0x24, 0x0C, 0x44, 0x89, 0x44, 0x24, 0x10, 0x89, 0x74, 0x24, 0x18, 0x89, 0x54,
+    0x24, 0x1C, 0xC6, 0x44, 0x24, 0x15, 0x02, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xC4, 0x48,
+    0xC3, 0x41, 0x54, 0x49, 0x89, 0xFC, 0x53, 0x89, 0xF3, 0x48, 0x83, 0xEC, 0x18, 0x48, 0x85, 0xFF,
+    0x75, 0x14, 0xBE, 0x36, 0xD9, 0x32, 0xD2, 0x31, 0xFF, 0x89, 0x54, 0x24, 0x0C, 0xE8, 0x7E, 0xFF,
+    0xFF, 0xFF, 0x8B, 0x54, 0x24, 0x0C, 0x85, 0xDB, 0x75, 0x0E, 0xBE, 0xB8, 0x2F, 0xAF, 0x7D, 0x31,
+    0xFF, 0xE8, 0x6A, 0xFF, 0xFF, 0xFF, 0xEB, 0x18, 0x39, 0xDA, 0x72, 0x08, 0x4D, 0x85, 0xE4, 0x0F,
+    0x94, 0xC0, 0xEB, 0x0E, 0x89, 0xDE, 0xBF, 0xCC, 0x18, 0xE2, 0x7B, 0xE8, 0x7B, 0xFF, 0xFF, 0xFF,
+    0xB0, 0x01, 0x48, 0x83, 0xC4, 0x18, 0x5B, 0x41, 0x5C, 0xC3, 0x66, 0x8B, 0x37, 0x66, 0xC1, 0xC6,
+    0x08, 0x81, 0xE6, 0xFF, 0x3F, 0x00, 0x00, 0x8D, 0x14, 0xB6, 0x8D, 0x42, 0x02, 0x0F, 0xB6, 0x0C,
+    0x07, 0x8D, 0x42, 0x03, 0x0F, 0xB6, 0x04, 0x07, 0xC1, 0xE1, 0x08, 0x09, 0xC1, 0x83, 0xF9, 0x40,
+    0x0F, 0x96, 0xC0, 0x83, 0xC2, 0x06, 0x48, 0x01, 0xD7, 0x31, 0xD2, 0x39, 0xCA, 0x73, 0x2A, 0x84,
+    0xC0, 0x74, 0x26, 0x0F, 0xB6, 0x07, 0x44, 0x0F, 0xB6, 0x47, 0x01, 0xC1, 0xE0, 0x08, 0x44, 0x09,
+    0xC0, 0x39, 0xF0, 0x0F, 0x92, 0xC0, 0x80, 0x7F, 0x02, 0x01, 0x41, 0x0F, 0x96, 0xC0, 0xFF, 0xC2,
+    0x48, 0x83, 0xC7, 0x05, 0x44, 0x21, 0xC0, 0xEB, 0xD2, 0xC3, 0x55, 0xBA, 0x9C, 0x07, 0x00, 0x00,
+    0x89, 0xF5, 0x53, 0x48, 0x89, 0xFB, 0x51, 0xE8, 0x35, 0xFF, 0xFF, 0xFF, 0x84, 0xC0, 0x75, 0x3F,
+    0x89, 0xEE, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x89, 0xC2, 0x39, 0xC5, 0x74, 0x0E,
+    0x89, 0xEE, 0xBF, 0x7D, 0xD3, 0xFA, 0x99, 0xE8, 0xDF, 0xFE, 0xFF, 0xFF, 0xEB, 0x21, 0x66, 0x8B,
+    0x2B, 0x66, 0xC1, 0xC5, 0x08, 0x89, 0xE8, 0x25, 0xFF, 0x3F, 0x00, 0x00, 0x3D, 0x38, 0x01, 0x00,
+    0x00, 0x7E, 0x10, 0xBE, 0x5D, 0xA4, 0xDD, 0x73, 0x31, 0xFF, 0xE8, 0x91, 0xFE, 0xFF, 0xFF, 0x31,
+    0xC0, 0xEB, 0x33, 0x48, 0x89, 0xDF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x89, 0xC2, 0x66, 0xF7, 0xC5,
+    0x00, 0x40, 0x74, 0x0B, 0xBE, 0x8B, 0x07, 0x56, 0x29, 0x84, 0xC0, 0x75, 0x08, 0xEB, 0xD9, 0xB0,
+    0x01, 0x84, 0xD2, 0x74, 0x11, 0x48, 0x89, 0xDF, 0xE8, 0x1D, 0xFF, 0xFF, 0xFF, 0xBE, 0x2A, 0x95,
+    0x27, 0xE7, 0x84, 0xC0, 0x74, 0xC2, 0x5A, 0x5B, 0x5D, 0xC3, 0x41, 0x57, 0x41, 0x56, 0x49, 0x89,
+    0xFE, 0x41, 0x55, 0x41, 0x89, 0xD5, 0xBA, 0x6C, 0x56, 0x01, 0x00, 0x41, 0x54, 0x55, 0x89, 0xF5,
+    0x53, 0x48, 0x83, 0xEC, 0x18, 0xE8, 0x97, 0xFE, 0xFF, 0xFF, 0x84, 0xC0, 0x74, 0x04, 0x31, 0xC0,
+    0xEB, 0x68, 0x89, 0xEA, 0x83, 0xFD, 0x02, 0x76, 0xF5, 0x45, 0x31, 0xFF, 0x31, 0xDB, 0x89, 0xEE,
+    0x49, 0x8D, 0x3C, 0x1E, 0x48, 0x89, 0x54, 0x24, 0x08, 0x49, 0xFF, 0xC7, 0x29, 0xDE, 0x48, 0x89,
+    0x3C, 0x24, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x3C, 0x24, 0x41, 0x89, 0xC4, 0x44, 0x89,
+    0xE6, 0x4C, 0x01, 0xE3, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x49, 0x83, 0xFF, 0x2D, 0x48, 0x8B, 0x54,
+    0x24, 0x08, 0x74, 0x20, 0x48, 0x8D, 0x4B, 0x02, 0x48, 0x39, 0xD1, 0x73, 0x06, 0x84, 0xC0, 0x75,
+    0xBD, 0xEB, 0xAB, 0x84, 0xC0, 0x74, 0xA7, 0x4D, 0x39, 0xEF, 0x72, 0xA2, 0x48, 0x39, 0xD3, 0x0F,
+    0x94, 0xC0, 0xEB, 0x06, 0x84, 0xC0, 0x75, 0xF4, 0xEB, 0x94, 0x48, 0x83, 0xC4, 0x18, 0x5B, 0x5D,
+    0x41, 0x5C, 0x41, 0x5D, 0x41, 0x5E, 0x41, 0x5F, 0xC3, 0xBA, 0x2D, 0x00, 0x00, 0x00, 0xE9, 0x57,
+    0xFF, 0xFF, 0xFF, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xE9, 0x4D, 0xFF, 0xFF, 0xFF, 0x41, 0x56, 0x45,
+    0x31, 0xC9, 0x41, 0x55, 0x41, 0x54, 0x55, 0x53, 0x48, 0x83, 0xEC, 0x10, 0x4C, 0x89, 0x0C, 0x24,
+    0x48, 0x85, 0xFF, 0x74, 0x16, 0x41, 0x89, 0xF5, 0x85, 0xF6, 0x74, 0x0F, 0x49, 0x89, 0xD4, 0x48,
+    0x85, 0xD2, 0x74, 0x07, 0x41, 0x89, 0xCE, 0x85, 0xC9, 0x75, 0x11, 0xBE, 0xDB, 0xC6, 0xF7, 0x84,
+    0x40, 0xB7, 0x03, 0xE8, 0x68, 0xFD, 0xFF, 0xFF, 0x31, 0xC0, 0xEB, 0x2C, 0x66, 0x8B, 0x1F, 0x48,
+    0x89, 0xFD, 0x86, 0xFB, 0x81, 0xE3, 0xFF, 0x3F, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x41,
+    0x39, 0xDE, 0x72, 0x05, 0x41, 0x39, 0xC5, 0x74, 0x13, 0xBE, 0x31, 0x50, 0xBC, 0x82, 0x40, 0xB7,
+    0x03, 0xE8, 0x3A, 0xFD, 0xFF, 0xFF, 0xB0, 0x01, 0x31, 0xDB, 0xEB, 0x49, 0x45, 0x31, 0xC0, 0x41,
+    0x39, 0xD8, 0x73, 0x3F, 0x43, 0x8D, 0x34, 0x80, 0x48, 0x89, 0xEF, 0x83, 0xC6, 0x02, 0xE8, 0xC4,
+    0xFC, 0xFF, 0xFF, 0x48, 0x89, 0xC2, 0x66, 0x89, 0x44, 0x24, 0x08, 0x48, 0xC1, 0xE8, 0x20, 0x48,
+    0xC1, 0xEA, 0x10, 0x66, 0x89, 0x44, 0x24, 0x0C, 0x66, 0x89, 0x54, 0x24, 0x0A, 0x49, 0x6B, 0xD0,
+    0x06, 0x8B, 0x4C, 0x24, 0x08, 0x49, 0xFF, 0xC0, 0x41, 0x89, 0x0C, 0x14, 0x41, 0x88, 0x44, 0x14,
+    0x04, 0xEB, 0xBC, 0xB0, 0x01, 0x89, 0x1C, 0x24, 0x88, 0x44, 0x24, 0x04, 0x48, 0x8B, 0x04, 0x24,
+    0x48, 0x83, 0xC4, 0x10, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0x41, 0x5E, 0xC3, 0x41, 0x55, 0x31,
+    0xC0, 0x41, 0x54, 0x55, 0x53, 0x48, 0x89, 0xD3, 0x48, 0x83, 0xEC, 0x18, 0x48, 0x85, 0xFF, 0x48,
+    0x89, 0x04, 0x24, 0x0F, 0x94, 0xC0, 0x85, 0xF6, 0x0F, 0x94, 0xC2, 0x08, 0xD0, 0x75, 0x0C, 0x48,
+    0x85, 0xDB, 0x74, 0x07, 0x41, 0x89, 0xCC, 0x85, 0xC9, 0x75, 0x14, 0xBE, 0xDB, 0xC6, 0xF7, 0x84,
+    0x40, 0xB7, 0x03, 0xE8, 0x98, 0xFC, 0xFF, 0xFF, 0x31, 0xC0, 0xE9, 0x03, 0x01, 0x00, 0x00, 0x48,
+    0x89, 0xFD, 0x41, 0x89, 0xF5, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x84, 0xC0, 0x0F, 0x84, 0xEE, 0x00,
+    0x00, 0x00, 0x44, 0x89, 0xEE, 0x48, 0x89, 0xEF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x44, 0x39, 0xE8,
+    0x0F, 0x85, 0xDA, 0x00, 0x00, 0x00, 0x48, 0x89, 0xEF, 0xE8, 0x1C, 0xFD, 0xFF, 0xFF, 0x84, 0xC0,
+    0x0F, 0x84, 0xCA, 0x00, 0x00, 0x00, 0x66, 0x44, 0x8B, 0x45, 0x00, 0x66, 0x41, 0xC1, 0xC0, 0x08,
+    0x41, 0x81, 0xE0, 0xFF, 0x3F, 0x00, 0x00, 0x47, 0x8D, 0x04, 0x80, 0x41, 0x8D, 0x40, 0x02, 0x44,
+    0x0F, 0xB6, 0x4C, 0x05, 0x00, 0x41, 0x8D, 0x40, 0x03, 0x0F, 0xB6, 0x44, 0x05, 0x00, 0x41, 0xC1,
+    0xE1, 0x08, 0x41, 0x09, 0xC1, 0x45, 0x39, 0xE1, 0x45, 0x0F, 0x47, 0xCC, 0x41, 0x83, 0xC0, 0x06,
+    0x49, 0x01, 0xE8, 0x45, 0x89, 0xCA, 0x4D, 0x6B, 0xD2, 0x0C, 0x49, 0x01, 0xDA, 0x49, 0x39, 0xDA,
+    0x74, 0x7A, 0x41, 0x0F, 0xB6, 0x30, 0x41, 0x0F, 0xB6, 0x40, 0x01, 0x48, 0x89, 0xEF, 0xC1, 0xE6,
+    0x08, 0x09, 0xC6, 0x8D, 0x34, 0xB6, 0x83, 0xC6, 0x02, 0xE8, 0x99, 0xFB, 0xFF, 0xFF, 0x41, 0x0F,
+    0xB6, 0x78, 0xFE, 0x41, 0x0F, 0xB6, 0x70, 0xFF, 0x48, 0x89, 0xC2, 0x66, 0x89, 0x43, 0x02, 0x48,
+    0x89, 0xC1, 0x48, 0xC1, 0xEA, 0x10, 0xC1, 0xE7, 0x08, 0x66, 0x89, 0x44, 0x24, 0x08, 0x66, 0x89,
+    0x54, 0x24, 0x0A, 0x09, 0xFE, 0x0F, 0xB6, 0x44, 0x24, 0x0B, 0x48, 0xC1, 0xE9, 0x20, 0x66, 0x89,
+    0x33, 0x0F, 0xB6, 0xD2, 0x41, 0x80, 0x78, 0x02, 0x00, 0x0F, 0x94, 0x43, 0x04, 0xC1, 0xE2, 0x10,
+    0x49, 0x83, 0xC0, 0x05, 0x48, 0x83, 0xC3, 0x0C, 0xC1, 0xE0, 0x08, 0x66, 0x89, 0x4C, 0x24, 0x0C,
+    0x0F, 0xB6, 0xC9, 0x09, 0xC2, 0x09, 0xCA, 0x89, 0x53, 0xFC, 0xEB, 0x81, 0xB0, 0x01, 0xEB, 0x05,
+    0xB0, 0x01, 0x45, 0x31, 0xC9, 0x44, 0x89, 0x0C, 0x24, 0x88, 0x44, 0x24, 0x04, 0x48, 0x8B, 0x04,
+    0x24, 0x48, 0x83, 0xC4, 0x18, 0x5B, 0x5D, 0x41, 0x5C, 0x41, 0x5D, 0xC3, 0x48, 0x89, 0xF2, 0x48,
+    0x8B, 0x77, 0x08, 0x48, 0x3B, 0x77, 0x10, 0x74, 0x10, 0x66, 0x8B, 0x02, 0x48, 0x83, 0xC6, 0x02,
+    0x66, 0x89, 0x46, 0xFE, 0x48, 0x89, 0x77, 0x08, 0xC3, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x53, 0x48,
+    0x89, 0xFB, 0x48, 0x89, 0xD7, 0x48, 0x83, 0xEC, 0x20, 0x80, 0x7B, 0x01, 0x00, 0x74, 0x7D, 0x2B,
+    0x73, 0x04, 0x81, 0xE6, 0xFF, 0xFF, 0xFF, 0x7F, 0x80, 0x7B, 0x02, 0x00, 0x75, 0x4F, 0x81, 0xFE,
+    0xE7, 0x03, 0x00, 0x00, 0x0F, 0x86, 0x8E, 0x00, 0x00, 0x00, 0x80, 0x7B, 0x03, 0x00, 0x74, 0x1F,
+    0x48, 0x8D, 0x74, 0x24, 0x1E, 0x66, 0xC7, 0x44, 0x24, 0x1E, 0x06, 0x00, 0x48, 0x89, 0x54, 0x24,
+    0x08, 0xE8, 0x96, 0xFF, 0xFF, 0xFF, 0xC6, 0x43, 0x03, 0x00, 0x48, 0x8B, 0x7C, 0x24, 0x08, 0x48,
+    0x8D, 0x74, 0x24, 0x1E, 0x66, 0xC7, 0x44, 0x24, 0x1E, 0x07, 0x00, 0xE8, 0x7C, 0xFF, 0xFF, 0xFF,
+    0xC6, 0x43, 0x02, 0x01, 0xC7, 0x43, 0x0C, 0xDC, 0x05, 0x00, 0x00, 0xEB, 0x4B, 0x3B, 0x73, 0x0C,
+    0x72, 0x46, 0x48, 0x8D, 0x74, 0x24, 0x1E, 0x66, 0xC7, 0x44, 0x24, 0x1E, 0x09, 0x00, 0xE8, 0x59,
+    0xFF, 0xFF, 0xFF, 0x81, 0x43, 0x0C, 0xF4, 0x01, 0x00, 0x00, 0xEB, 0x2C, 0x80, 0x7B, 0x03, 0x00,
+    0x74, 0x26, 0x2B, 0x73, 0x08, 0x81, 0xE6, 0xFF, 0xFF, 0xFF, 0x7F, 0x81, 0xFE, 0xFA, 0x00, 0x00,
+    0x00, 0x76, 0x15, 0x48, 0x8D, 0x74, 0x24, 0x1E, 0x66, 0xC7, 0x44, 0x24, 0x1E, 0x06, 0x00, 0xE8,
+    0x28, 0xFF, 0xFF, 0xFF, 0xC6, 0x43, 0x03, 0x00, 0x48, 0x83, 0xC4, 0x20, 0x5B, 0xC3, 0x53, 0x48,
+    0x89, 0xFB, 0x48, 0x83, 0xEC, 0x10, 0x80, 0x7F, 0x02, 0x00, 0xC6, 0x47, 0x01, 0x00, 0x75, 0x4E,
+    0x89, 0xF0, 0x2B, 0x47, 0x04, 0x25, 0xFF, 0xFF, 0xFF, 0x7F, 0x83, 0xF8, 0x63, 0x76, 0x3F, 0x80,
+    0x3B, 0x00, 0x48, 0x89, 0xD7, 0x75, 0x13, 0x48, 0x8D, 0x74, 0x24, 0x0E, 0x66, 0xC7, 0x44, 0x24,
+    0x0E, 0x06, 0x00, 0xE8, 0xE4, 0xFE, 0xFF, 0xFF, 0xEB, 0x24, 0x80, 0x7B, 0x03, 0x00, 0x74, 0x17,
+    0x48, 0x8D, 0x74, 0x24, 0x0E, 0x66, 0xC7, 0x44, 0x24, 0x0E, 0x08, 0x00, 0xE8, 0xCB, 0xFE, 0xFF,
+    0xFF, 0xC6, 0x43, 0x03, 0x00, 0xEB, 0x07, 0xC6, 0x43, 0x03, 0x01, 0x89, 0x73, 0x08, 0x48, 0x83,
+    0xC4, 0x10, 0x5B, 0xC3, 0x55, 0x89, 0xF5, 0x53, 0x48, 0x89, 0xFB, 0x48, 0x83, 0xEC, 0x18, 0x80,
+    0x7F, 0x03, 0x00, 0x74, 0x29, 0x89, 0xF0, 0x2B, 0x47, 0x08, 0x25, 0xFF, 0xFF, 0xFF, 0x7F, 0x3D,
+    0xFA, 0x00, 0x00, 0x00, 0x76, 0x18, 0x48, 0x89, 0xD7, 0x48, 0x8D, 0x74, 0x24, 0x0E, 0x66, 0xC7,
+    0x44, 0x24, 0x0E, 0x06, 0x00, 0xE8, 0x82, 0xFE, 0xFF, 0xFF, 0xC6, 0x43, 0x03, 0x00, 0x66, 0xC7,
+    0x43, 0x01, 0x01, 0x00, 0x89, 0x6B, 0x04, 0x48, 0x83, 0xC4, 0x18, 0x5B, 0x5D, 0xC3, 0x41, 0x54,
+    0x8D, 0x04, 0x12, 0x41, 0x89, 0xD4, 0x89, 0xF2, 0x83, 0xE2, 0xFE, 0x55, 0x48, 0x89, 0xCD, 0x29,
+    0xD0, 0x53, 0x48, 0x89, 0xFB, 0x83, 0xF8, 0x62, 0x76, 0x24, 0x89, 0xF0, 0x83, 0xE0, 0x01, 0x89,
+    0xC2, 0x83, 0xF2, 0x01, 0x38, 0x57, 0x01, 0x74, 0x15, 0xD1, 0xEE, 0x48, 0x89, 0xCA, 0x85, 0xC0,
+    0x75, 0x07, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x05, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0xEA, 0x44, 0x89, 0xE6, 0x48, 0x89, 0xDF, 0x5B, 0x5D, 0x41, 0x5C, 0xE9, 0x3E, 0xFE, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+    0x94, 0x9D, 0x18, 0x5D, 0xFB, 0x0D, 0x8D, 0x3F, 0x51, 0x6E, 0xD4, 0x43, 0x2F, 0xAE, 0x60, 0x2F,
+    0xC0, 0x4F, 0x37, 0xCA, 0x1C, 0xD8, 0xCB, 0x0D, 0xD9, 0xA3, 0x1D, 0xC8, 0xE1, 0x29, 0x18, 0xCC,
+};
+
+const std::array<uint8_t, 286> firmware_patch = {
+    0x54, 0x42, 0x44, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x10, 0x29, 0x00, 0x00,
+    0xDB, 0x9D, 0x1D, 0xAE, 0x0D, 0x0A, 0xD7, 0x70, 0x13, 0xCC, 0x1C, 0xDD, 0xEB, 0x3C, 0x29, 0xF2,
+    0x7E, 0x49, 0xDA, 0x09, 0x3C, 0xD0, 0xA6, 0xBC, 0x62, 0xCB, 0xBF, 0x25, 0xF6, 0xE2, 0x0B, 0x20,
+    0x13, 0x31, 0x19, 0x70, 0xC3, 0xAF, 0xF5, 0x74, 0x74, 0xFE, 0x17, 0xD0, 0x00, 0xD4, 0xB6, 0xE5,
+    0x50, 0xD5, 0x53, 0x3A, 0xCC, 0x73, 0xF8, 0x69, 0xAA, 0x3E, 0x7B, 0x34, 0xE8, 0x89, 0xCD, 0x96,
+    0x01, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0A, 0x00, 0x00, 0x00, 0x32, 0x2D,
+    0x67, 0x34, 0x63, 0x62, 0x34, 0x39, 0x30, 0x36, 0x01, 0x31, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00,
+    0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x35, 0x36, 0x3A, 0x33, 0x37, 0x01, 0x38, 0x00, 0x00, 0x00,
+    0x78, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x4C, 0xBA, 0xC4, 0xF0, 0xB7, 0xCF, 0x4C,
+    0xD0, 0x80, 0xF2, 0x41, 0x3C, 0x31, 0x7A, 0x9A, 0xD3, 0x9D, 0x2F, 0x67, 0xDA, 0x25, 0x39, 0xCC,
+    0xC4, 0x65, 0xC1, 0x95, 0x50, 0x8E, 0x3E, 0x4E, 0xCE, 0x01, 0x54, 0x02, 0x00, 0x00, 0xD0, 0x00,
+    0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x01, 0x2B, 0x06, 0x00, 0x00, 0x25, 0x03, 0x00,
+    0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x2C, 0x01, 0x1E, 0x00, 0x00, 0x00, 0x51, 0x09, 0x00, 0x00,
+    0x02, 0x0F, 0x00, 0x00, 0x00, 0xBA, 0xD0, 0x07, 0x00, 0x00, 0x01, 0xC8, 0x39, 0xD0, 0x0F, 0x42,
+    0xC2, 0xEB, 0x0F, 0xBE, 0x01, 0x6B, 0x1F, 0x00, 0x00, 0x74, 0x09, 0x00, 0x00, 0x02, 0x27, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x94, 0x9D, 0x18, 0x5D, 0xFB, 0x0D, 0x8D,
+    0x3F, 0x51, 0x6E, 0xD4, 0x43, 0x2F, 0xAE, 0x60, 0x2F, 0xC0, 0x4F, 0x37, 0xCA, 0x1C, 0xD8, 0xCB,
+    0x0D, 0xD9, 0xA3, 0x1D, 0xC8, 0xE1, 0x29, 0x18, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+// clang-format on
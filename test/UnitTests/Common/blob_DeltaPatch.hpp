@@ -0,0 +1,27 @@
+#ifndef BLOB_DELTAPATCH_HPP_
+#define BLOB_DELTAPATCH_HPP_
+
+#include <array>
+#include <cstdint>
+
+// Image pair and the patch created between them by build/make_delta_patch.py, to check the firmware applies the
+// patches of the script. The images are the .text sections of two host builds of the connectivity code: the new one
+// adds PollScheduler.cpp between Sha256.cpp and SseParser.cpp.
+//
+//   python3 build/make_delta_patch.py delta_source.bin delta_target.bin delta_patch.bin
+extern const std::array<uint8_t, 1613> delta_source;
+extern const std::array<uint8_t, 1879> delta_target;
+extern const std::array<uint8_t, 374> delta_patch;
+
+// Two consecutive firmware images, before and after a change of PollScheduler.cpp, and the patch between them.
+// They have the firmware.bin layout of an ESP32-S3 app: image header, application description with the version and
+// build time, segments, checksum and SHA-256. The segments hold the -Os host builds of the sources that build for
+// the host (Connectivity, Database, Led, Periphery and Util); with the board toolchain at hand, real firmware.bin
+// files of two consecutive commits can replace them, the tests do not depend on their content.
+//
+//   python3 build/make_delta_patch.py firmware_source.bin firmware_target.bin firmware_patch.bin
+extern const std::array<uint8_t, 10496> firmware_source;
+extern const std::array<uint8_t, 10512> firmware_target;
+extern const std::array<uint8_t, 286> firmware_patch;
+
+#endif  // BLOB_DELTAPATCH_HPP_
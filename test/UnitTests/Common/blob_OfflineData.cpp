@@ -0,0 +1,26 @@
+#include "blob_OfflineData.hpp"
+
+#include "OfflineData.h"
+
+// clang-format off
+const std::array<uint8_t, 26> offline_dataset = {
+    'T', 'B', 'O', 'D', 1, 2, 3, 0,  // Header: version 1, 2 colors, 3 frames
+    255, 0, 0,                       // Palette: red
+    0, 0, 255,                       //          blue
+    0, 1, 0x42, 0x80,                // Frame 0: strip 1, position 10, red
+    0, 2, 0x24, 0x41, 0xC0, 0x00,    // Frame 1: strip 0, position 145, blue, and strip 3, position 0, red
+    0, 0,                            // Frame 2: no LED
+};
+
+const std::vector<std::vector<uint8_t>> offline_frames = {
+    {0, 1, 1, 10, 255, 0, 0},
+    {0, 2, 0, 145, 0, 0, 255, 3, 0, 255, 0, 0},
+    {0, 0},
+};
+// clang-format on
+
+const uint8_t* OfflineData_GetBlob(uint32_t& size)
+{
+    size = static_cast<uint32_t>(offline_dataset.size());
+    return offline_dataset.data();
+}
@@ -0,0 +1,14 @@
+#ifndef BLOB_OFFLINEDATA_HPP_
+#define BLOB_OFFLINEDATA_HPP_
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Small offline dataset, see OfflineDataReader for the format. It stands in for the dataset embedded in the firmware.
+extern const std::array<uint8_t, 26> offline_dataset;
+
+// The frames encoded in `offline_dataset`
+extern const std::vector<std::vector<uint8_t>> offline_frames;
+
+#endif  // BLOB_OFFLINEDATA_HPP_
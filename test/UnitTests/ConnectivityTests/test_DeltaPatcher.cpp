@@ -0,0 +1,351 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "gtest/gtest.h"
+
+#include "DeltaPatcher.h"
+#include "blob_DeltaPatch.hpp"
+
+#include <vector>
+
+using Bytes = std::vector<uint8_t>;
+
+class MemorySource : public PatchSource
+{
+  public:
+    explicit MemorySource(const Bytes& image) : image_(image) {}
+    bool Read(uint32_t offset, uint8_t* const buffer, uint32_t length) override
+    {
+        bool could_read = (offset + length) <= image_.size();
+        if (could_read && !fail_reads_)
+        {
+            std::copy(image_.begin() + offset, image_.begin() + offset + length, buffer);
+        }
+        return could_read && !fail_reads_;
+    }
+    bool fail_reads_{false};
+
+  private:
+    const Bytes& image_;
+};
+
+class MemoryTarget : public PatchTarget
+{
+  public:
+    bool Begin(uint32_t size) override
+    {
+        begin_cnt_++;
+        announced_size_ = size;
+        image_.clear();
+        return true;
+    }
+    bool Write(const uint8_t* const data, uint32_t length) override
+    {
+        image_.insert(image_.end(), data, data + length);
+        return true;
+    }
+    bool End(bool is_valid) override
+    {
+        end_cnt_++;
+        is_valid_ = is_valid;
+        return true;
+    }
+    Bytes image_{};
+    uint32_t announced_size_{0U};
+    uint32_t begin_cnt_{0U};
+    uint32_t end_cnt_{0U};
+    bool is_valid_{false};
+};
+
+/// Writes patches the same way build/make_delta_patch.py does
+class PatchBuilder
+{
+  public:
+    PatchBuilder& Copy(uint32_t offset, uint32_t length)
+    {
+        Operation(0x01, length);
+        Append32(offset);
+        return *this;
+    }
+    PatchBuilder& Insert(const Bytes& data)
+    {
+        Operation(0x02, static_cast<uint32_t>(data.size()));
+        operations_.insert(operations_.end(), data.begin(), data.end());
+        return *this;
+    }
+    PatchBuilder& End()
+    {
+        Operation(0x00, 0U);
+        return *this;
+    }
+    PatchBuilder& Raw(const Bytes& data)
+    {
+        operations_.insert(operations_.end(), data.begin(), data.end());
+        return *this;
+    }
+    Bytes Build(const Bytes& source, const Bytes& target) const
+    {
+        Bytes patch{'T', 'B', 'D', 'P', 1U, 0U, 0U, 0U};
+        AppendTo(patch, static_cast<uint32_t>(source.size()));
+        AppendTo(patch, static_cast<uint32_t>(target.size()));
+        const auto source_hash = Hash(source);
+        const auto target_hash = Hash(target);
+        patch.insert(patch.end(), source_hash.begin(), source_hash.end());
+        patch.insert(patch.end(), target_hash.begin(), target_hash.end());
+        patch.insert(patch.end(), operations_.begin(), operations_.end());
+        return patch;
+    }
+
+  private:
+    static Sha256::Digest Hash(const Bytes& data)
+    {
+        Sha256 sha;
+        sha.Update(data.data(), static_cast<uint32_t>(data.size()));
+        return sha.Finish();
+    }
+    static void AppendTo(Bytes& bytes, uint32_t value)
+    {
+        for (auto i = 0; i < 4; i++)
+        {
+            bytes.push_back(static_cast<uint8_t>(value >> (8 * i)));
+        }
+    }
+    void Operation(uint8_t op_code, uint32_t length)
+    {
+        operations_.push_back(op_code);
+        Append32(length);
+    }
+    void Append32(uint32_t value) { AppendTo(operations_, value); }
+
+    Bytes operations_{};
+};
+
+class DeltaPatcherTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // Firmware-like image: code that is mostly kept, with some changes and a shift
+        uint32_t random = 0x12345678U;
+        for (auto i = 0; i < 64 * 1024; i++)
+        {
+            random ^= random << 13;
+            random ^= random >> 17;
+            random ^= random << 5;
+            source_.push_back(static_cast<uint8_t>(random));
+        }
+
+        inserted_ = Bytes(40U, 0xAB);
+        replaced_tail_ = Bytes(300U, 0xCD);
+        target_.insert(target_.end(), source_.begin(), source_.begin() + 10000);
+        target_.insert(target_.end(), inserted_.begin(), inserted_.end());
+        target_.insert(target_.end(), source_.begin() + 10000, source_.end() - 1000);
+        target_.insert(target_.end(), replaced_tail_.begin(), replaced_tail_.end());
+
+        patch_ = PatchBuilder()
+                     .Copy(0U, 10000U)
+                     .Insert(inserted_)
+                     .Copy(10000U, static_cast<uint32_t>(source_.size()) - 11000U)
+                     .Insert(replaced_tail_)
+                     .End()
+                     .Build(source_, target_);
+    }
+
+    std::optional<bool> FeedInChunks(const Bytes& patch, uint32_t chunk_size)
+    {
+        std::optional<bool> result{std::nullopt};
+        for (uint32_t i = 0U; (i < patch.size()) && !result.has_value(); i += chunk_size)
+        {
+            const auto length = std::min(chunk_size, static_cast<uint32_t>(patch.size()) - i);
+            result = patcher_.Feed(patch.data() + i, length);
+        }
+        return result;
+    }
+
+    Bytes source_{};
+    Bytes target_{};
+    Bytes inserted_{};
+    Bytes replaced_tail_{};
+    Bytes patch_{};
+    MemorySource source_reader_{source_};
+    MemoryTarget target_writer_{};
+    DeltaPatcher patcher_{source_reader_, target_writer_};
+};
+
+TEST_F(DeltaPatcherTest, WholePatch_ProducesTarget)
+{
+    EXPECT_EQ(patcher_.Feed(patch_.data(), static_cast<uint32_t>(patch_.size())), true);
+    EXPECT_EQ(target_writer_.image_, target_);
+    EXPECT_EQ(target_writer_.announced_size_, target_.size());
+    EXPECT_EQ(target_writer_.end_cnt_, 1U);
+    EXPECT_TRUE(target_writer_.is_valid_);
+    EXPECT_EQ(patcher_.GetWrittenSize(), target_.size());
+}
+
+TEST_F(DeltaPatcherTest, PatchByteByByte_ProducesTarget)
+{
+    EXPECT_EQ(FeedInChunks(patch_, 1U), true);
+    EXPECT_EQ(target_writer_.image_, target_);
+    EXPECT_TRUE(target_writer_.is_valid_);
+}
+
+TEST_F(DeltaPatcherTest, PatchInNetworkChunks_ProducesTarget)
+{
+    EXPECT_EQ(FeedInChunks(patch_, 1460U), true);
+    EXPECT_EQ(target_writer_.image_, target_);
+}
+
+TEST_F(DeltaPatcherTest, IncompletePatch_WaitsForMoreData)
+{
+    EXPECT_FALSE(patcher_.Feed(patch_.data(), static_cast<uint32_t>(patch_.size()) - 1U).has_value());
+    EXPECT_EQ(target_writer_.end_cnt_, 0U);
+}
+
+TEST_F(DeltaPatcherTest, PatchIsSmallerThanTarget)
+{
+    EXPECT_LT(patch_.size(), target_.size() / 100U);
+}
+
+TEST_F(DeltaPatcherTest, MemoryIsBounded)
+{
+    EXPECT_LT(sizeof(DeltaPatcher), 1024U);
+}
+
+TEST_F(DeltaPatcherTest, OtherSource_IsRejectedBeforeWriting)
+{
+    source_[42] ^= 0xFF;
+    EXPECT_EQ(FeedInChunks(patch_, 100U), false);
+    EXPECT_EQ(target_writer_.begin_cnt_, 0U);
+    EXPECT_EQ(target_writer_.end_cnt_, 0U);
+}
+
+TEST_F(DeltaPatcherTest, UnreadableSource_IsRejected)
+{
+    source_reader_.fail_reads_ = true;
+    EXPECT_EQ(FeedInChunks(patch_, 100U), false);
+    EXPECT_EQ(target_writer_.begin_cnt_, 0U);
+}
+
+TEST_F(DeltaPatcherTest, WrongMagic_IsRejected)
+{
+    patch_[0] = 'X';
+    EXPECT_EQ(FeedInChunks(patch_, 100U), false);
+    EXPECT_EQ(target_writer_.begin_cnt_, 0U);
+}
+
+TEST_F(DeltaPatcherTest, UnsupportedVersion_IsRejected)
+{
+    patch_[4] = 2U;
+    EXPECT_EQ(FeedInChunks(patch_, 100U), false);
+}
+
+TEST_F(DeltaPatcherTest, CorruptedInsertData_IsDiscarded)
+{
+    patch_[patch_.size() - 10U] ^= 0x01;
+    EXPECT_EQ(FeedInChunks(patch_, 100U), false);
+    EXPECT_EQ(target_writer_.end_cnt_, 1U);
+    EXPECT_FALSE(target_writer_.is_valid_);
+}
+
+TEST_F(DeltaPatcherTest, CopyOutOfSource_IsDiscarded)
+{
+    const auto patch = PatchBuilder().Copy(static_cast<uint32_t>(source_.size()) - 10U, 20U).End().Build(source_, target_);
+    EXPECT_EQ(FeedInChunks(patch, 100U), false);
+    EXPECT_EQ(target_writer_.end_cnt_, 1U);
+    EXPECT_FALSE(target_writer_.is_valid_);
+}
+
+TEST_F(DeltaPatcherTest, CopyOffsetOverflow_IsDiscarded)
+{
+    const auto patch = PatchBuilder().Copy(0xFFFFFFF0U, 0x20U).End().Build(source_, target_);
+    EXPECT_EQ(FeedInChunks(patch, 100U), false);
+    EXPECT_FALSE(target_writer_.is_valid_);
+}
+
+TEST_F(DeltaPatcherTest, TargetLongerThanAnnounced_IsDiscarded)
+{
+    const auto short_target = Bytes(target_.begin(), target_.begin() + 100);
+    const auto patch = PatchBuilder().Copy(0U, 10000U).End().Build(source_, short_target);
+    EXPECT_EQ(FeedInChunks(patch, 100U), false);
+    EXPECT_EQ(target_writer_.image_.size(), 0U);
+    EXPECT_FALSE(target_writer_.is_valid_);
+}
+
+TEST_F(DeltaPatcherTest, TargetShorterThanAnnounced_IsDiscarded)
+{
+    const auto patch = PatchBuilder().Copy(0U, 100U).End().Build(source_, target_);
+    EXPECT_EQ(FeedInChunks(patch, 100U), false);
+    EXPECT_FALSE(target_writer_.is_valid_);
+}
+
+TEST_F(DeltaPatcherTest, UnknownOperation_IsDiscarded)
+{
+    const auto patch = PatchBuilder().Raw({0x07, 0U, 0U, 0U, 0U}).End().Build(source_, target_);
+    EXPECT_EQ(FeedInChunks(patch, 100U), false);
+    EXPECT_EQ(target_writer_.end_cnt_, 1U);
+    EXPECT_FALSE(target_writer_.is_valid_);
+}
+
+TEST_F(DeltaPatcherTest, AfterFailure_MoreDataIsRefused)
+{
+    patch_[0] = 'X';
+    EXPECT_EQ(FeedInChunks(patch_, 100U), false);
+    EXPECT_EQ(patcher_.Feed(patch_.data(), 10U), false);
+}
+
+TEST_F(DeltaPatcherTest, Reset_DiscardsStartedTargetAndAllowsNewPatch)
+{
+    EXPECT_FALSE(patcher_.Feed(patch_.data(), 200U).has_value());
+    patcher_.Reset();
+    EXPECT_EQ(target_writer_.end_cnt_, 1U);
+    EXPECT_FALSE(target_writer_.is_valid_);
+
+    EXPECT_EQ(FeedInChunks(patch_, 512U), true);
+    EXPECT_EQ(target_writer_.image_, target_);
+    EXPECT_TRUE(target_writer_.is_valid_);
+}
+
+TEST(DeltaPatcherScriptTest, PatchFromScript_ProducesTargetByteForByte)
+{
+    const Bytes source(delta_source.begin(), delta_source.end());
+    MemorySource source_reader{source};
+    MemoryTarget target_writer{};
+    DeltaPatcher patcher{source_reader, target_writer};
+
+    EXPECT_EQ(patcher.Feed(delta_patch.data(), static_cast<uint32_t>(delta_patch.size())), true);
+    EXPECT_EQ(target_writer.image_, Bytes(delta_target.begin(), delta_target.end()));
+    EXPECT_EQ(target_writer.announced_size_, delta_target.size());
+    EXPECT_TRUE(target_writer.is_valid_);
+}
+
+TEST(DeltaPatcherScriptTest, FirmwarePatch_ProducesTargetByteForByte)
+{
+    const Bytes source(firmware_source.begin(), firmware_source.end());
+    MemorySource source_reader{source};
+    MemoryTarget target_writer{};
+    DeltaPatcher patcher{source_reader, target_writer};
+
+    EXPECT_EQ(patcher.Feed(firmware_patch.data(), static_cast<uint32_t>(firmware_patch.size())), true);
+    EXPECT_EQ(target_writer.image_, Bytes(firmware_target.begin(), firmware_target.end()));
+    EXPECT_TRUE(target_writer.is_valid_);
+}
+
+TEST(DeltaPatcherScriptTest, FirmwarePatch_IsUnderTenPercentOfTarget)
+{
+    // Between consecutive builds most of the code only moves, it is copied from the running firmware
+    EXPECT_LT(firmware_patch.size() * 10U, firmware_target.size());
+}
@@ -0,0 +1,145 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "gtest/gtest.h"
+
+#include "PollScheduler.h"
+
+#include "FwConfig.h"
+
+constexpr uint32_t kIntervalMs = kPollIntervalSeconds * 1000U;
+constexpr uint32_t kJitterMs = (kIntervalMs / 100U) * kPollJitterPercent;
+
+TEST(PollSchedulerTest, Default_IsPollInterval)
+{
+    PollScheduler scheduler;
+    EXPECT_EQ(scheduler.GetDelayMilliSeconds(), kIntervalMs);
+    EXPECT_EQ(scheduler.GetFailCount(), 0U);
+}
+
+TEST(PollSchedulerTest, Success_IsPollIntervalWithJitter)
+{
+    PollScheduler scheduler;
+    scheduler.Seed(42U);
+    for (auto i = 0; i < 1000; i++)
+    {
+        const auto delay = scheduler.OnSuccess(std::nullopt);
+        EXPECT_GE(delay, kIntervalMs - kJitterMs);
+        EXPECT_LE(delay, kIntervalMs + kJitterMs);
+        EXPECT_EQ(delay, scheduler.GetDelayMilliSeconds());
+    }
+}
+
+TEST(PollSchedulerTest, DifferentSeeds_SpreadThePolls)
+{
+    PollScheduler scheduler1;
+    PollScheduler scheduler2;
+    scheduler1.Seed(1U);
+    scheduler2.Seed(2U);
+    EXPECT_NE(scheduler1.OnSuccess(std::nullopt), scheduler2.OnSuccess(std::nullopt));
+}
+
+TEST(PollSchedulerTest, ZeroSeed_StillJitters)
+{
+    PollScheduler scheduler;
+    scheduler.Seed(0U);
+    const auto delay1 = scheduler.OnSuccess(std::nullopt);
+    const auto delay2 = scheduler.OnSuccess(std::nullopt);
+    EXPECT_NE(delay1, delay2);
+}
+
+TEST(PollSchedulerTest, SuccessWithHint_PollsAfterTheHint)
+{
+    PollScheduler scheduler;
+    for (auto i = 0; i < 1000; i++)
+    {
+        const auto delay = scheduler.OnSuccess(17U);
+        EXPECT_GE(delay, 17000U);
+        EXPECT_LE(delay, 17000U + kJitterMs);
+    }
+}
+
+TEST(PollSchedulerTest, SuccessWithZeroHint_WaitsTheMinimumRetryDelay)
+{
+    PollScheduler scheduler;
+    for (auto i = 0; i < 1000; i++)
+    {
+        const auto delay = scheduler.OnSuccess(0U);
+        EXPECT_GE(delay, kPollRetryMinSeconds * 1000U);
+        EXPECT_GT(delay, 2U * kTickPeriodMilliSeconds);  // The poll timer can be started
+    }
+}
+
+TEST(PollSchedulerTest, Hint_IsCapped)
+{
+    PollScheduler scheduler;
+    EXPECT_LE(scheduler.OnSuccess(0xFFFFFFFFU), (kPollHintMaxSeconds * 1000U) + kJitterMs);
+    EXPECT_LE(scheduler.OnFailure(0xFFFFFFFFU), kPollHintMaxSeconds * 1000U);
+}
+
+TEST(PollSchedulerTest, Failures_BackOffExponentially)
+{
+    PollScheduler scheduler;
+    for (uint32_t fails = 1U; fails <= 6U; fails++)
+    {
+        const uint32_t backoff_ms = (kPollRetryMinSeconds * 1000U) << (fails - 1U);
+        const auto delay = scheduler.OnFailure(std::nullopt);
+        EXPECT_GE(delay, backoff_ms / 2U);
+        EXPECT_LE(delay, backoff_ms);
+        EXPECT_EQ(scheduler.GetFailCount(), fails);
+    }
+}
+
+TEST(PollSchedulerTest, Backoff_IsCapped)
+{
+    PollScheduler scheduler;
+    for (auto i = 0; i < 100; i++)
+    {
+        const auto delay = scheduler.OnFailure(std::nullopt);
+        EXPECT_LE(delay, kPollRetryMaxSeconds * 1000U);
+    }
+    EXPECT_GE(scheduler.GetDelayMilliSeconds(), (kPollRetryMaxSeconds * 1000U) / 2U);
+}
+
+TEST(PollSchedulerTest, RetryAfter_IsTheMinimumDelay)
+{
+    PollScheduler scheduler;
+    EXPECT_EQ(scheduler.OnFailure(120U), 120000U);
+}
+
+TEST(PollSchedulerTest, ShortRetryAfter_DoesNotShortenBackoff)
+{
+    PollScheduler scheduler;
+    for (auto i = 0; i < 5; i++)
+    {
+        (void)scheduler.OnFailure(std::nullopt);
+    }
+    const uint32_t min_backoff_ms = ((kPollRetryMinSeconds * 1000U) << 5U) / 2U;
+    EXPECT_GE(scheduler.OnFailure(1U), min_backoff_ms);
+}
+
+TEST(PollSchedulerTest, Success_ResetsBackoff)
+{
+    PollScheduler scheduler;
+    for (auto i = 0; i < 10; i++)
+    {
+        (void)scheduler.OnFailure(std::nullopt);
+    }
+    (void)scheduler.OnSuccess(std::nullopt);
+    EXPECT_EQ(scheduler.GetFailCount(), 0U);
+    EXPECT_LE(scheduler.OnFailure(std::nullopt), kPollRetryMinSeconds * 1000U);
+}
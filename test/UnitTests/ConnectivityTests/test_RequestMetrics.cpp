@@ -0,0 +1,175 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "gtest/gtest.h"
+
+#include "RequestMetrics.h"
+
+#include <string>
+#include <vector>
+
+using Metric = RequestMetrics::Metric;
+using Error = RequestMetrics::Error;
+
+static RequestMetrics::Sample MakeSample(uint32_t total_ms, uint32_t bytes)
+{
+    RequestMetrics::Sample sample{};
+    sample.Set(Metric::kDnsMs, 1U);
+    sample.Set(Metric::kConnectMs, 2U);
+    sample.Set(Metric::kFirstByteMs, 3U);
+    sample.Set(Metric::kTransferMs, 4U);
+    sample.Set(Metric::kTotalMs, total_ms);
+    sample.Set(Metric::kPayloadBytes, bytes);
+    return sample;
+}
+
+TEST(RequestMetricsTest, Empty_HasNoPercentile)
+{
+    RequestMetrics metrics;
+    EXPECT_EQ(metrics.GetRequestCount(), 0U);
+    EXPECT_EQ(metrics.GetSampleCount(Metric::kTotalMs), 0U);
+    EXPECT_FALSE(metrics.GetPercentile(Metric::kTotalMs, 50U).has_value());
+}
+
+TEST(RequestMetricsTest, Buckets_ArePowersOfTwo)
+{
+    EXPECT_EQ(RequestMetrics::GetBucket(0U), 0U);
+    EXPECT_EQ(RequestMetrics::GetBucket(1U), 1U);
+    EXPECT_EQ(RequestMetrics::GetBucket(2U), 2U);
+    EXPECT_EQ(RequestMetrics::GetBucket(3U), 2U);
+    EXPECT_EQ(RequestMetrics::GetBucket(4U), 3U);
+    EXPECT_EQ(RequestMetrics::GetBucket(1023U), 10U);
+    EXPECT_EQ(RequestMetrics::GetBucket(1024U), 11U);
+    EXPECT_EQ(RequestMetrics::GetBucket(0xFFFFFFFFU), RequestMetrics::kNumberOfBuckets - 1U);
+}
+
+TEST(RequestMetricsTest, Record_CountsRequestsAndBytes)
+{
+    RequestMetrics metrics;
+    metrics.Record(MakeSample(100U, 1000U));
+    metrics.Record(MakeSample(200U, 500U));
+    EXPECT_EQ(metrics.GetRequestCount(), 2U);
+    EXPECT_EQ(metrics.GetTotalBytes(), 1500U);
+    EXPECT_EQ(metrics.GetErrorCount(Error::kNone), 2U);
+}
+
+TEST(RequestMetricsTest, Percentiles_UseNearestRank)
+{
+    RequestMetrics metrics;
+    for (uint32_t i = 10U; i >= 1U; i--)
+    {
+        metrics.Record(MakeSample(i * 100U, 0U));
+    }
+    EXPECT_EQ(metrics.GetPercentile(Metric::kTotalMs, 1U), 100U);
+    EXPECT_EQ(metrics.GetPercentile(Metric::kTotalMs, 50U), 500U);
+    EXPECT_EQ(metrics.GetPercentile(Metric::kTotalMs, 90U), 900U);
+    EXPECT_EQ(metrics.GetPercentile(Metric::kTotalMs, 100U), 1000U);
+}
+
+TEST(RequestMetricsTest, InvalidPercent_HasNoPercentile)
+{
+    RequestMetrics metrics;
+    metrics.Record(MakeSample(100U, 0U));
+    EXPECT_FALSE(metrics.GetPercentile(Metric::kTotalMs, 0U).has_value());
+    EXPECT_FALSE(metrics.GetPercentile(Metric::kTotalMs, 101U).has_value());
+}
+
+TEST(RequestMetricsTest, Window_KeepsLastSamplesOnly)
+{
+    RequestMetrics metrics;
+    for (uint32_t i = 0U; i < RequestMetrics::kWindowSize; i++)
+    {
+        metrics.Record(MakeSample(10000U, 0U));
+    }
+    for (uint32_t i = 0U; i < RequestMetrics::kWindowSize; i++)
+    {
+        metrics.Record(MakeSample(10U, 0U));
+    }
+    EXPECT_EQ(metrics.GetSampleCount(Metric::kTotalMs), RequestMetrics::kWindowSize);
+    EXPECT_EQ(metrics.GetPercentile(Metric::kTotalMs, 100U), 10U);
+    EXPECT_EQ(metrics.GetRequestCount(), 2U * RequestMetrics::kWindowSize);
+}
+
+TEST(RequestMetricsTest, Histogram_CountsWindow)
+{
+    RequestMetrics metrics;
+    metrics.Record(MakeSample(0U, 0U));
+    metrics.Record(MakeSample(5U, 0U));
+    metrics.Record(MakeSample(6U, 0U));
+    metrics.Record(MakeSample(1500U, 0U));
+    const auto histogram = metrics.GetHistogram(Metric::kTotalMs);
+    EXPECT_EQ(histogram[0], 1U);
+    EXPECT_EQ(histogram[3], 2U);
+    EXPECT_EQ(histogram[11], 1U);
+    uint32_t sum = 0U;
+    for (const auto count : histogram)
+    {
+        sum += count;
+    }
+    EXPECT_EQ(sum, 4U);
+}
+
+TEST(RequestMetricsTest, FailedRequest_OnlyRecordsReachedPhases)
+{
+    RequestMetrics metrics;
+    RequestMetrics::Sample sample{};
+    sample.Set(Metric::kDnsMs, 12U);
+    sample.Set(Metric::kTotalMs, 5000U);
+    sample.error = Error::kTls;
+    metrics.Record(sample);
+
+    EXPECT_EQ(metrics.GetSampleCount(Metric::kDnsMs), 1U);
+    EXPECT_EQ(metrics.GetSampleCount(Metric::kConnectMs), 0U);
+    EXPECT_EQ(metrics.GetSampleCount(Metric::kFirstByteMs), 0U);
+    EXPECT_EQ(metrics.GetErrorCount(Error::kTls), 1U);
+    EXPECT_EQ(metrics.GetErrorCount(Error::kNone), 0U);
+    EXPECT_EQ(metrics.GetTotalBytes(), 0U);
+}
+
+TEST(RequestMetricsTest, Reset_ClearsEverything)
+{
+    RequestMetrics metrics;
+    metrics.Record(MakeSample(100U, 1000U));
+    metrics.Reset();
+    EXPECT_EQ(metrics.GetRequestCount(), 0U);
+    EXPECT_EQ(metrics.GetTotalBytes(), 0U);
+    EXPECT_EQ(metrics.GetSampleCount(Metric::kTotalMs), 0U);
+    EXPECT_EQ(metrics.GetErrorCount(Error::kNone), 0U);
+}
+
+static std::vector<std::string> _report_lines;
+static void PrintLine(const char* line)
+{
+    _report_lines.emplace_back(line);
+}
+
+TEST(RequestMetricsTest, Report_HasOneLinePerMetric)
+{
+    RequestMetrics metrics;
+    metrics.Record(MakeSample(100U, 1000U));
+    RequestMetrics::Sample failed{};
+    failed.error = Error::kTimeout;
+    metrics.Record(failed);
+
+    _report_lines.clear();
+    metrics.Report(PrintLine);
+
+    ASSERT_EQ(_report_lines.size(), 2U + static_cast<uint32_t>(Metric::kNumberOfMetrics));
+    EXPECT_EQ(_report_lines[0], "Requests: 2, bytes: 1000");
+    EXPECT_NE(_report_lines[1].find("timeout 1"), std::string::npos);
+    EXPECT_EQ(_report_lines[6].find("total ms: n 1, p50 100, p90 100, max 100"), 0U);
+}
@@ -0,0 +1,78 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "gtest/gtest.h"
+
+#include "Sha256.h"
+
+#include <string>
+
+static std::string ToHex(const Sha256::Digest& digest)
+{
+    constexpr const char* kHexDigits = "0123456789abcdef";
+    std::string hex;
+    for (const auto byte : digest)
+    {
+        hex += kHexDigits[byte >> 4];
+        hex += kHexDigits[byte & 0x0F];
+    }
+    return hex;
+}
+
+static std::string Hash(const std::string& message)
+{
+    Sha256 sha;
+    sha.Update(reinterpret_cast<const uint8_t*>(message.data()), static_cast<uint32_t>(message.size()));
+    return ToHex(sha.Finish());
+}
+
+TEST(Sha256Test, EmptyMessage)
+{
+    EXPECT_EQ(Hash(""), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+}
+
+TEST(Sha256Test, ShortMessage)
+{
+    EXPECT_EQ(Hash("abc"), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+}
+
+TEST(Sha256Test, TwoBlockMessage)
+{
+    EXPECT_EQ(Hash("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"),
+              "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+}
+
+TEST(Sha256Test, MillionCharacters_InChunks)
+{
+    Sha256 sha;
+    const std::string chunk(1000U, 'a');
+    for (auto i = 0; i < 1000; i++)
+    {
+        sha.Update(reinterpret_cast<const uint8_t*>(chunk.data()), static_cast<uint32_t>(chunk.size()));
+    }
+    EXPECT_EQ(ToHex(sha.Finish()), "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+}
+
+TEST(Sha256Test, Init_StartsNewHash)
+{
+    Sha256 sha;
+    sha.Update(reinterpret_cast<const uint8_t*>("xyz"), 3U);
+    (void)sha.Finish();
+    sha.Init();
+    sha.Update(reinterpret_cast<const uint8_t*>("abc"), 3U);
+    EXPECT_EQ(ToHex(sha.Finish()), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+}
@@ -0,0 +1,157 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "gtest/gtest.h"
+
+#include "SseParser.h"
+
+#include <string>
+
+static bool ParseAll(SseParser& parser, const std::string& stream)
+{
+    bool is_frame_complete = false;
+    for (const auto c : stream)
+    {
+        is_frame_complete = parser.Parse(c);
+    }
+    return is_frame_complete;
+}
+
+TEST(SseParserTest, FrameEvent_IsDecoded)
+{
+    SseParser parser;
+    // 0x00 0x01 0x02 0x03 0xFF 0x00 0x80 = 1 LED
+    EXPECT_TRUE(ParseAll(parser, "event: frame\nid: 46\ndata: AAECA/8AgA==\n\n"));
+
+    ASSERT_EQ(parser.GetFrameLength(), 7U);
+    const uint8_t expected[] = {0x00, 0x01, 0x02, 0x03, 0xFF, 0x00, 0x80};
+    for (uint32_t i = 0U; i < 7U; i++)
+    {
+        EXPECT_EQ(parser.GetFrame()[i], expected[i]);
+    }
+    EXPECT_EQ(parser.GetSequence(), 46U);
+}
+
+TEST(SseParserTest, CrLfLineEndings_AreSupported)
+{
+    SseParser parser;
+    EXPECT_TRUE(ParseAll(parser, "event: frame\r\nid: 7\r\ndata: AAECA/8AgA==\r\n\r\n"));
+    EXPECT_EQ(parser.GetFrameLength(), 7U);
+    EXPECT_EQ(parser.GetSequence(), 7U);
+}
+
+TEST(SseParserTest, MissingSpaceAfterColon_IsSupported)
+{
+    SseParser parser;
+    EXPECT_TRUE(ParseAll(parser, "event:frame\nid:7\ndata:AAECA/8AgA==\n\n"));
+    EXPECT_EQ(parser.GetFrameLength(), 7U);
+}
+
+TEST(SseParserTest, MultipleDataLines_AreConcatenated)
+{
+    SseParser parser;
+    EXPECT_TRUE(ParseAll(parser, "event: frame\ndata: AAEC\ndata: A/8AgA==\n\n"));
+    EXPECT_EQ(parser.GetFrameLength(), 7U);
+}
+
+TEST(SseParserTest, FrameIsOnlyCompleteAfterEmptyLine)
+{
+    SseParser parser;
+    EXPECT_FALSE(ParseAll(parser, "event: frame\ndata: AAECA/8AgA==\n"));
+    EXPECT_EQ(parser.GetFrameLength(), 0U);
+    EXPECT_TRUE(parser.Parse('\n'));
+}
+
+TEST(SseParserTest, CommentsAndUnknownFields_AreIgnored)
+{
+    SseParser parser;
+    EXPECT_FALSE(ParseAll(parser, ": keep-alive\n\nretry: 1000\n\n"));
+    EXPECT_TRUE(ParseAll(parser, ": keep-alive\nevent: frame\nfoo: bar\ndata: AAECA/8AgA==\n\n"));
+    EXPECT_EQ(parser.GetFrameLength(), 7U);
+}
+
+TEST(SseParserTest, OtherEvents_AreIgnored)
+{
+    SseParser parser;
+    EXPECT_FALSE(ParseAll(parser, "event: message\ndata: AAECA/8AgA==\n\n"));
+    EXPECT_FALSE(ParseAll(parser, "data: AAECA/8AgA==\n\n"));
+    EXPECT_FALSE(ParseAll(parser, "event: frames\ndata: AAECA/8AgA==\n\n"));
+    EXPECT_EQ(parser.GetFrameLength(), 0U);
+}
+
+TEST(SseParserTest, EventWithoutData_IsIgnored)
+{
+    SseParser parser;
+    EXPECT_FALSE(ParseAll(parser, "event: frame\nid: 3\n\n"));
+}
+
+TEST(SseParserTest, InvalidBase64_IsIgnored)
+{
+    SseParser parser;
+    EXPECT_FALSE(ParseAll(parser, "event: frame\ndata: AAEC*/8AgA==\n\n"));
+    EXPECT_TRUE(ParseAll(parser, "event: frame\ndata: AAECA/8AgA==\n\n"));
+}
+
+TEST(SseParserTest, MissingId_HasNoSequence)
+{
+    SseParser parser;
+    EXPECT_TRUE(ParseAll(parser, "event: frame\nid: 12\ndata: AAECA/8AgA==\n\n"));
+    EXPECT_TRUE(ParseAll(parser, "event: frame\ndata: AAECA/8AgA==\n\n"));
+    EXPECT_FALSE(parser.GetSequence().has_value());
+}
+
+TEST(SseParserTest, NonNumericId_HasNoSequence)
+{
+    SseParser parser;
+    EXPECT_TRUE(ParseAll(parser, "event: frame\nid: 1a\ndata: AAECA/8AgA==\n\n"));
+    EXPECT_FALSE(parser.GetSequence().has_value());
+}
+
+TEST(SseParserTest, FrameLargerThanBuffer_IsIgnored)
+{
+    SseParser parser;
+    // Every 4 base64 digits make 3 bytes
+    const std::string data((((kBufferSizeInBytes / 3U) + 1U) * 4U), 'A');
+    EXPECT_FALSE(ParseAll(parser, "event: frame\ndata: " + data + "\n\n"));
+    EXPECT_TRUE(ParseAll(parser, "event: frame\ndata: AAECA/8AgA==\n\n"));
+}
+
+TEST(SseParserTest, FrameFillingBuffer_IsAccepted)
+{
+    SseParser parser;
+    const std::string data(((kBufferSizeInBytes / 3U) * 4U), 'A');
+    EXPECT_TRUE(ParseAll(parser, "event: frame\ndata: " + data + "\n\n"));
+    EXPECT_EQ(parser.GetFrameLength(), (kBufferSizeInBytes / 3U) * 3U);
+}
+
+TEST(SseParserTest, Reset_DropsEventBeingParsed)
+{
+    SseParser parser;
+    EXPECT_FALSE(ParseAll(parser, "event: frame\ndata: AAECA/8AgA==\n"));
+    parser.Reset();
+    EXPECT_FALSE(parser.Parse('\n'));
+    EXPECT_EQ(parser.GetFrameLength(), 0U);
+}
+
+TEST(SseParserTest, ConsecutiveFrames_LastOneIsKept)
+{
+    SseParser parser;
+    EXPECT_TRUE(ParseAll(parser, "event: frame\nid: 1\ndata: AAECA/8AgA==\n\n"));
+    EXPECT_TRUE(ParseAll(parser, "event: frame\nid: 2\ndata: AAAA\n\n"));
+    EXPECT_EQ(parser.GetFrameLength(), 3U);
+    EXPECT_EQ(parser.GetSequence(), 2U);
+}
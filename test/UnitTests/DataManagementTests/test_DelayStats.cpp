@@ -0,0 +1,248 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+
+#include "DataManager.h"
+#include "DelayStats.h"
+#include "FrameFormat.h"
+#include "FwConfig.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <map>
+#include <vector>
+
+struct TrainOnSegment
+{
+    uint16_t segment;  // LED id
+    uint8_t delay;
+};
+
+// Frame with one LED per train, its train section and delays
+static std::vector<uint8_t> MakeFrame(const std::vector<TrainOnSegment>& trains, bool has_delays = true)
+{
+    const auto header = static_cast<uint32_t>(trains.size()) | kFrameHasTrainsFlag | (has_delays ? kFrameHasDelaysFlag : 0U);
+    std::vector<uint8_t> frame{static_cast<uint8_t>(header >> 8U), static_cast<uint8_t>(header)};
+    for (const auto& train : trains)
+    {
+        frame.insert(frame.end(), {static_cast<uint8_t>(train.segment >> 8U), static_cast<uint8_t>(train.segment), 0xFF, 0xFF, 0xFF});
+    }
+    frame.insert(frame.end(), {0U, static_cast<uint8_t>(trains.size())});
+    for (auto i = 0U; i < trains.size(); i++)
+    {
+        frame.insert(frame.end(), {0U, static_cast<uint8_t>(i), 0U, static_cast<uint8_t>(i), 0U});
+    }
+    for (const auto& train : trains)
+    {
+        if (has_delays)
+        {
+            frame.push_back(train.delay);
+        }
+    }
+    return frame;
+}
+
+class DelayStatsTests : public ::testing::Test
+{
+  protected:
+    DelayStats delay_stats_{};
+    void SetUp() override
+    {
+        delay_stats_.Init();
+    }
+    void AddFrame(const std::vector<TrainOnSegment>& trains, bool has_delays = true)
+    {
+        const auto frame = MakeFrame(trains, has_delays);
+        delay_stats_.AddFrame(frame.data(), static_cast<uint32_t>(frame.size()));
+    }
+};
+
+TEST_F(DelayStatsTests, NoFrame_NoSegment)
+{
+    EXPECT_EQ(delay_stats_.GetNumberOfSegments(), 0U);
+    EXPECT_FALSE(delay_stats_.GetSegment(0x0102U).has_value());
+}
+
+TEST_F(DelayStatsTests, OneFrame_DelaysOfItsTrains)
+{
+    AddFrame({{0x0102U, 5U}, {0x0305U, 0U}});
+    EXPECT_EQ(delay_stats_.GetNumberOfSegments(), 2U);
+    const auto delay = delay_stats_.GetSegment(0x0102U);
+    ASSERT_TRUE(delay.has_value());
+    EXPECT_EQ(delay->current, 5U);
+    EXPECT_EQ(delay->max, 5U);
+    EXPECT_EQ(delay->average, 5U);
+}
+
+TEST_F(DelayStatsTests, SeveralFrames_MaxAndAverage)
+{
+    AddFrame({{0x0102U, 2U}});
+    AddFrame({{0x0102U, 9U}});
+    AddFrame({{0x0102U, 4U}});
+    const auto delay = delay_stats_.GetSegment(0x0102U);
+    ASSERT_TRUE(delay.has_value());
+    EXPECT_EQ(delay->current, 4U);
+    EXPECT_EQ(delay->max, 9U);
+    EXPECT_EQ(delay->average, 5U);
+}
+
+TEST_F(DelayStatsTests, TrainLeftSegment_NoCurrentDelay)
+{
+    AddFrame({{0x0102U, 7U}});
+    AddFrame({{0x0103U, 7U}});
+    EXPECT_EQ(delay_stats_.GetSegment(0x0102U)->current, 0U);
+    EXPECT_EQ(delay_stats_.GetSegment(0x0102U)->max, 7U);
+    EXPECT_EQ(delay_stats_.GetSegment(0x0103U)->current, 7U);
+}
+
+TEST_F(DelayStatsTests, OldestFrameDropped_MaxAndAverageWithoutIt)
+{
+    AddFrame({{0x0102U, 30U}});
+    for (auto i = 0U; i < kNumberOfHistoryFrames; i++)
+    {
+        AddFrame({{0x0102U, 2U}});
+    }
+    const auto delay = delay_stats_.GetSegment(0x0102U);
+    ASSERT_TRUE(delay.has_value());
+    EXPECT_EQ(delay->max, 2U);
+    EXPECT_EQ(delay->average, 2U);
+}
+
+TEST_F(DelayStatsTests, SegmentNotInHistoryAnymore_Removed)
+{
+    AddFrame({{0x0102U, 3U}, {0x0200U, 1U}});
+    for (auto i = 0U; i < kNumberOfHistoryFrames; i++)
+    {
+        AddFrame({{0x0200U, 1U}});
+    }
+    EXPECT_FALSE(delay_stats_.GetSegment(0x0102U).has_value());
+    EXPECT_EQ(delay_stats_.GetNumberOfSegments(), 1U);
+    EXPECT_EQ(delay_stats_.GetSegmentId(0U), 0x0200U);
+}
+
+TEST_F(DelayStatsTests, FrameWithoutDelays_CountedWithoutTrains)
+{
+    AddFrame({{0x0102U, 3U}});
+    AddFrame({{0x0102U, 3U}}, false);
+    EXPECT_EQ(delay_stats_.GetSegment(0x0102U)->current, 0U);
+    EXPECT_EQ(delay_stats_.GetSegment(0x0102U)->average, 3U);
+}
+
+TEST_F(DelayStatsTests, Clear_NoSegment)
+{
+    AddFrame({{0x0102U, 3U}});
+    delay_stats_.Clear();
+    EXPECT_EQ(delay_stats_.GetNumberOfSegments(), 0U);
+    EXPECT_FALSE(delay_stats_.GetSegment(0x0102U).has_value());
+}
+
+TEST_F(DelayStatsTests, RandomFrames_SameAsRecomputedOverHistory)
+{
+    std::srand(42U);
+    std::deque<std::vector<TrainOnSegment>> history{};
+    for (auto frame_cnt = 0U; frame_cnt < 5U * kNumberOfHistoryFrames; frame_cnt++)
+    {
+        std::vector<TrainOnSegment> trains{};
+        const auto nr_of_trains = static_cast<uint32_t>(std::rand()) % 10U;
+        for (auto i = 0U; i < nr_of_trains; i++)
+        {
+            const auto segment = static_cast<uint16_t>(((std::rand() % 2) << 8U) | (std::rand() % 8));
+            trains.push_back({segment, static_cast<uint8_t>(std::rand() % 20)});
+        }
+        AddFrame(trains);
+        history.push_back(trains);
+        if (history.size() > kNumberOfHistoryFrames)
+        {
+            history.pop_front();
+        }
+
+        // Reference, recomputed over the whole history
+        struct Reference
+        {
+            uint32_t sum;
+            uint32_t count;
+            uint8_t max;
+            uint8_t current;
+        };
+        std::map<uint16_t, Reference> reference{};
+        for (const auto& frame : history)
+        {
+            for (const auto& train : frame)
+            {
+                auto& ref = reference[train.segment];
+                ref.sum += train.delay;
+                ref.count++;
+                ref.max = std::max(ref.max, train.delay);
+                ref.current = (&frame == &history.back()) ? std::max(ref.current, train.delay) : ref.current;
+            }
+        }
+
+        ASSERT_EQ(delay_stats_.GetNumberOfSegments(), reference.size());
+        for (const auto& [segment, ref] : reference)
+        {
+            const auto delay = delay_stats_.GetSegment(segment);
+            ASSERT_TRUE(delay.has_value());
+            EXPECT_EQ(delay->max, ref.max);
+            EXPECT_EQ(delay->current, ref.current);
+            EXPECT_EQ(delay->average, (ref.sum + (ref.count / 2U)) / ref.count);
+        }
+    }
+}
+
+TEST_F(DelayStatsTests, Reader_OneLedPerSegmentWithDelayColor)
+{
+    AddFrame({{0x0102U, 0U}, {0x0305U, 12U}});
+    DelayDataReader reader{delay_stats_};
+    std::vector<uint8_t> data(kBufferSizeInBytes);
+    const auto length = reader.ReadData(data.data(), static_cast<uint32_t>(data.size()));
+    ASSERT_EQ(length, kBytesInHeader + (2U * kBytesPerLed));
+    EXPECT_EQ(FrameFormat_GetNumberOfLeds(data.data()), 2U);
+    EXPECT_FALSE(FrameFormat_HasTrains(data.data()));
+    const std::vector<uint8_t> expected{0x00, 0x02, 0x01, 0x02, 0x00, 0xFF, 0x00, 0x03, 0x05, 0xFF, 0x00, 0x00};
+    EXPECT_EQ(std::vector<uint8_t>(data.begin(), data.begin() + length), expected);
+}
+
+TEST_F(DelayStatsTests, Reader_BufferTooSmall_LedsThatFit)
+{
+    AddFrame({{0x0102U, 0U}, {0x0305U, 12U}});
+    DelayDataReader reader{delay_stats_};
+    std::vector<uint8_t> data(kBytesInHeader + kBytesPerLed);
+    EXPECT_EQ(reader.ReadData(data.data(), static_cast<uint32_t>(data.size())), data.size());
+    EXPECT_EQ(FrameFormat_GetNumberOfLeds(data.data()), 1U);
+    EXPECT_EQ(reader.ReadData(nullptr, 42U), 0U);
+}
+
+TEST_F(DelayStatsTests, DataManager_DelayModeReadsStatsOfSavedFrames)
+{
+    DataMgr_Init();
+    DataMgr_Reset();
+    DataMgr_SetWriterMode(DataWriterMode::kSingle);
+    const auto frame = MakeFrame({{0x0102U, 4U}});
+    EXPECT_TRUE(DataMgr_GetWriter()->SaveData(frame.data(), static_cast<uint32_t>(frame.size())));
+
+    DataMgr_SetReaderMode(DataReaderMode::kDelay);
+    std::vector<uint8_t> data(kBufferSizeInBytes);
+    const auto length = DataMgr_GetReader()->ReadData(data.data(), static_cast<uint32_t>(data.size()));
+    EXPECT_EQ(length, kBytesInHeader + kBytesPerLed);
+    EXPECT_EQ(data[2], 0x01);
+    EXPECT_EQ(data[3], 0x02);
+
+    DataMgr_Reset();
+    DataMgr_SetReaderMode(DataReaderMode::kDelay);
+    EXPECT_EQ(DataMgr_GetReader()->ReadData(data.data(), static_cast<uint32_t>(data.size())), kBytesInHeader);
+}
@@ -18,8 +18,8 @@
 
 #include "DataManager.h"
 #include "DataManagerTypes.h"
-#include "FakeData.h"
 #include "FwConfig.h"
+#include "blob_OfflineData.hpp"
 
 #include <array>
 
@@ -29,6 +29,7 @@ class DataMgrFakeStoreTest : public ::testing::Test
     DataReader* reader_;
     void SetUp() override
     {
+        DataMgr_Init();
         DataMgr_Reset();
         DataMgr_SetReaderMode(DataReaderMode::kOffline);
         reader_ = DataMgr_GetReader();
@@ -49,15 +50,16 @@ TEST_F(DataMgrFakeStoreTest, Reader_LengthZero_ReturnZero)
 
 TEST_F(DataMgrFakeStoreTest, CircularReadThroughFakeData_EnsureCircularBehaviour)
 {
-    for (auto i = 0; i < kNumberOfFakeFrames + 5U; i++)
+    for (auto i = 0U; i < offline_frames.size() + 5U; i++)
     {
         Frame read_frame{};
         const auto read_length = reader_->ReadData(read_frame.data, kBufferSizeInBytes);
 
-        EXPECT_EQ(read_length, g_fake_data[i % kNumberOfHistoryFrames].length);
-        for (auto j = 0; j < read_length; j++)
+        const auto& expected_frame = offline_frames[i % offline_frames.size()];
+        ASSERT_EQ(read_length, expected_frame.size());
+        for (auto j = 0U; j < read_length; j++)
         {
-            ASSERT_EQ(read_frame.data[j], g_fake_data[i % kNumberOfHistoryFrames].data[j]);
+            ASSERT_EQ(read_frame.data[j], expected_frame[j]);
         }
     }
 }
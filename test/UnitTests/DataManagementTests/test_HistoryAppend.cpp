@@ -0,0 +1,196 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+
+#include "DataManager.h"
+#include "FwConfig.h"
+
+#include <array>
+
+class DataMgrHistoryAppendTest : public ::testing::Test
+{
+  protected:
+    static constexpr uint32_t kFrameLength = 7U;
+    static constexpr uint32_t kHistDataBufferLength = kFrameLength * kNumberOfHistoryFrames;
+    std::array<uint8_t, kHistDataBufferLength> hist_buffer = {};
+    DataReader* reader_;
+    void SetUp() override
+    {
+        DataMgr_Init();
+        DataMgr_Reset();
+        DataMgr_SetReaderMode(DataReaderMode::kHistory);
+        reader_ = DataMgr_GetReader();
+        ASSERT_NE(reader_, nullptr);
+
+        // Fake history buffer
+        size_t buffer_index = 0;
+        for (uint8_t i = 0U; i < kNumberOfHistoryFrames; i++, buffer_index += kFrameLength)
+        {
+            hist_buffer[buffer_index + 1] = 1U;  // Number of LEDs
+            hist_buffer[buffer_index + 2] = i;
+        }
+    }
+    void WriteHistory(uint32_t newest_sequence)
+    {
+        DataMgr_SetWriterMode(DataWriterMode::kMultiple);
+        ASSERT_TRUE(DataMgr_GetWriter()->SaveData(hist_buffer.data(), hist_buffer.size()));
+        DataMgr_SetNewestSequence(newest_sequence);
+    }
+    uint8_t ReadFrameId()
+    {
+        std::array<uint8_t, kFrameLength> read_buffer{};
+        EXPECT_EQ(kFrameLength, reader_->ReadData(read_buffer.data(), read_buffer.size()));
+        return read_buffer[2];
+    }
+};
+
+TEST_F(DataMgrHistoryAppendTest, EmptyStore_CannotAppend)
+{
+    EXPECT_FALSE(DataMgr_CanAppendHistory());
+}
+
+TEST_F(DataMgrHistoryAppendTest, HistoryWithoutSequence_CannotAppend)
+{
+    DataMgr_SetWriterMode(DataWriterMode::kMultiple);
+    ASSERT_TRUE(DataMgr_GetWriter()->SaveData(hist_buffer.data(), hist_buffer.size()));
+    EXPECT_FALSE(DataMgr_CanAppendHistory());
+}
+
+TEST_F(DataMgrHistoryAppendTest, HistoryWithSequence_CanAppend)
+{
+    WriteHistory(100U);
+    EXPECT_TRUE(DataMgr_CanAppendHistory());
+    EXPECT_EQ(DataMgr_GetNewestSequence(), 100U);
+}
+
+TEST_F(DataMgrHistoryAppendTest, Reset_SequenceUnknown)
+{
+    WriteHistory(100U);
+    DataMgr_Reset();
+    EXPECT_FALSE(DataMgr_GetNewestSequence().has_value());
+}
+
+TEST_F(DataMgrHistoryAppendTest, Appender_DataNullptr_ReturnFalse)
+{
+    DataMgr_SetWriterMode(DataWriterMode::kAppend);
+    EXPECT_FALSE(DataMgr_GetWriter()->SaveData(nullptr, 42U));
+}
+
+TEST_F(DataMgrHistoryAppendTest, Appender_TruncatedFrame_ReturnFalse)
+{
+    DataMgr_SetWriterMode(DataWriterMode::kAppend);
+    const std::array<uint8_t, kFrameLength> frame{0, 1, 42, 0, 0, 0, 0};
+    EXPECT_FALSE(DataMgr_GetWriter()->SaveData(frame.data(), frame.size() - 1));
+}
+
+TEST_F(DataMgrHistoryAppendTest, AppendTwoFrames_OldestFramesOverwritten)
+{
+    WriteHistory(100U);
+
+    DataMgr_SetWriterMode(DataWriterMode::kAppend);
+    const std::array<uint8_t, 2 * kFrameLength> new_frames{0, 1, 100, 0, 0, 0, 0, 0, 1, 101, 0, 0, 0, 0};
+    EXPECT_TRUE(DataMgr_GetWriter()->SaveData(new_frames.data(), new_frames.size()));
+    DataMgr_SetNewestSequence(102U);
+
+    // Oldest frames 0 and 1 were dropped
+    EXPECT_EQ(2U, ReadFrameId());
+    for (auto i = 0U; i < kNumberOfHistoryFrames - 3U; i++)
+    {
+        (void)ReadFrameId();
+    }
+    EXPECT_EQ(100U, ReadFrameId());
+    EXPECT_EQ(101U, ReadFrameId());
+    EXPECT_TRUE(DataMgr_CanAppendHistory());
+}
+
+TEST_F(DataMgrHistoryAppendTest, AppendWholeHistory_AllFramesReplaced)
+{
+    WriteHistory(100U);
+    for (auto i = 0U; i < kNumberOfHistoryFrames; i++)
+    {
+        hist_buffer[i * kFrameLength + 2] = 100U + i;
+    }
+
+    DataMgr_SetWriterMode(DataWriterMode::kAppend);
+    EXPECT_TRUE(DataMgr_GetWriter()->SaveData(hist_buffer.data(), hist_buffer.size()));
+
+    EXPECT_EQ(100U, ReadFrameId());
+}
+
+TEST_F(DataMgrHistoryAppendTest, LiveFrameFollowsSequence_SequenceKept)
+{
+    WriteHistory(100U);
+    DataMgr_SetWriterMode(DataWriterMode::kSingle);
+    DataMgr_SetNewestSequence(101U);
+    EXPECT_EQ(DataMgr_GetNewestSequence(), 101U);
+    EXPECT_TRUE(DataMgr_CanAppendHistory());
+}
+
+TEST_F(DataMgrHistoryAppendTest, LiveFrameMissed_SequenceUnknown)
+{
+    WriteHistory(100U);
+    DataMgr_SetWriterMode(DataWriterMode::kSingle);
+    DataMgr_SetNewestSequence(102U);
+    EXPECT_FALSE(DataMgr_GetNewestSequence().has_value());
+    EXPECT_FALSE(DataMgr_CanAppendHistory());
+}
+
+TEST_F(DataMgrHistoryAppendTest, LiveFrameReceivedTwice_SequenceUnknown)
+{
+    WriteHistory(100U);
+    DataMgr_SetWriterMode(DataWriterMode::kSingle);
+    DataMgr_SetNewestSequence(100U);
+    EXPECT_FALSE(DataMgr_CanAppendHistory());
+}
+
+TEST_F(DataMgrHistoryAppendTest, Appender_FramesWithTrains_AllAppended)
+{
+    WriteHistory(100U);
+    const std::array<uint8_t, 28U> frames_with_trains{
+        0x80, 1, 0, 5, 255, 0, 0, 0, 1, 0, 7, 0, 0, 0,  // One LED and one train
+        0x80, 1, 0, 6, 255, 0, 0, 0, 1, 0, 7, 0, 0, 0,
+    };
+    DataMgr_SetWriterMode(DataWriterMode::kAppend);
+    EXPECT_TRUE(DataMgr_GetWriter()->SaveData(frames_with_trains.data(), frames_with_trains.size()));
+}
+
+TEST_F(DataMgrHistoryAppendTest, SameFramePushedAgain_NotNewer)
+{
+    WriteHistory(100U);
+    DataMgr_SetWriterMode(DataWriterMode::kSingle);
+    DataMgr_SetNewestSequence(101U);
+
+    EXPECT_FALSE(DataMgr_IsNewerSequence(101U));
+    EXPECT_FALSE(DataMgr_IsNewerSequence(100U));
+    EXPECT_TRUE(DataMgr_CanAppendHistory());
+}
+
+TEST_F(DataMgrHistoryAppendTest, NextFramePushed_Newer)
+{
+    WriteHistory(100U);
+
+    EXPECT_TRUE(DataMgr_IsNewerSequence(101U));
+}
+
+TEST_F(DataMgrHistoryAppendTest, SequenceUnknown_Newer)
+{
+    WriteHistory(100U);
+    EXPECT_TRUE(DataMgr_IsNewerSequence(std::nullopt));
+
+    DataMgr_Reset();
+    EXPECT_TRUE(DataMgr_IsNewerSequence(100U));
+}
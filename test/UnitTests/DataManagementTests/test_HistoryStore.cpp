@@ -31,6 +31,7 @@ class DataMgrHistoryStoreTest : public ::testing::Test
     DataWriter* writer_;
     void SetUp() override
     {
+        DataMgr_Init();
         DataMgr_Reset();
         DataMgr_SetReaderMode(DataReaderMode::kHistory);
         DataMgr_SetWriterMode(DataWriterMode::kMultiple);
@@ -100,6 +101,18 @@ TEST_F(DataMgrHistoryStoreTest, WriterWithValidData_ReadDataWithBufferTooSmall_R
     EXPECT_EQ(0U, reader_->ReadData(read_buffer.data(), read_buffer.size() - 1));
 }
 
+TEST_F(DataMgrHistoryStoreTest, WriterWithValidData_ReadDataWithBufferTooSmall_FrameSkipped)
+{
+    EXPECT_TRUE(writer_->SaveData(hist_buffer.data(), hist_buffer.size()));
+
+    std::array<uint8_t, kFrameLength> read_buffer{};
+    std::array<uint8_t, kFrameLength> expected_frame{0, 1, 1, 2, 3, 4, 5};
+    EXPECT_EQ(0U, reader_->ReadData(read_buffer.data(), read_buffer.size() - 1));
+    EXPECT_FALSE(reader_->WasBusy());
+    EXPECT_EQ(kFrameLength, reader_->ReadData(read_buffer.data(), read_buffer.size()));
+    EXPECT_EQ(read_buffer, expected_frame);
+}
+
 TEST_F(DataMgrHistoryStoreTest, WriterWithValidData_ReadDataTwice_GetSecondFrame)
 {
     EXPECT_TRUE(writer_->SaveData(hist_buffer.data(), hist_buffer.size()));
@@ -29,6 +29,7 @@ class DataMgrLiveStoreTests : public ::testing::Test
     DataWriter* writer_;
     void SetUp() override
     {
+        DataMgr_Init();
         DataMgr_Reset();
         DataMgr_SetReaderMode(DataReaderMode::kLive);
         DataMgr_SetWriterMode(DataWriterMode::kSingle);
@@ -152,3 +153,14 @@ TEST_F(DataMgrLiveStoreTests, ReadWithMaxLengthLessThanFrameSize_ReturnZero)
     const auto length_read = reader_->ReadData(data_read.data(), data_read.size() - 1);
     EXPECT_EQ(0, length_read);
 }
+
+TEST_F(DataMgrLiveStoreTests, WriteData_Reset_NothingRead)
+{
+    const std::array<uint8_t, 5U> data = {1, 2, 3, 4, 5};
+    EXPECT_TRUE(writer_->SaveData(data.data(), data.size()));
+
+    DataMgr_Reset();
+
+    std::array<uint8_t, 5U> data_read = {};
+    EXPECT_EQ(reader_->ReadData(data_read.data(), data_read.size()), 0U);
+}
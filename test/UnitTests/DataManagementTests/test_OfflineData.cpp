@@ -0,0 +1,128 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "gtest/gtest.h"
+
+#include "FwConfig.h"
+#include "OfflineData.h"
+#include "blob_OfflineData.hpp"
+
+#include <array>
+#include <vector>
+
+class OfflineDataTests : public ::testing::Test
+{
+  protected:
+    OfflineDataReader reader_{};
+    std::array<uint8_t, kBufferSizeInBytes> buffer_{};
+    std::vector<uint8_t> dataset_{offline_dataset.begin(), offline_dataset.end()};
+
+    uint32_t Read()
+    {
+        return reader_.ReadData(buffer_.data(), static_cast<uint32_t>(buffer_.size()));
+    }
+    void ExpectFrame(uint32_t length, const std::vector<uint8_t>& expected_frame)
+    {
+        ASSERT_EQ(length, expected_frame.size());
+        for (auto i = 0U; i < length; i++)
+        {
+            EXPECT_EQ(buffer_[i], expected_frame[i]);
+        }
+    }
+};
+
+TEST_F(OfflineDataTests, Init_ValidDataset_ReturnTrue)
+{
+    EXPECT_TRUE(reader_.Init(dataset_.data(), static_cast<uint32_t>(dataset_.size())));
+    EXPECT_EQ(reader_.GetNumberOfFrames(), offline_frames.size());
+}
+
+TEST_F(OfflineDataTests, Init_WrongMagic_ReturnFalseAndReadNothing)
+{
+    dataset_[0] = 'X';
+    EXPECT_FALSE(reader_.Init(dataset_.data(), static_cast<uint32_t>(dataset_.size())));
+    EXPECT_EQ(Read(), 0U);
+}
+
+TEST_F(OfflineDataTests, Init_WrongVersion_ReturnFalse)
+{
+    dataset_[4] = 2U;
+    EXPECT_FALSE(reader_.Init(dataset_.data(), static_cast<uint32_t>(dataset_.size())));
+}
+
+TEST_F(OfflineDataTests, Init_PaletteLongerThanDataset_ReturnFalse)
+{
+    EXPECT_FALSE(reader_.Init(dataset_.data(), 12U));
+}
+
+TEST_F(OfflineDataTests, Read_AllFrames_DecodeThemInOrderAndWrapAround)
+{
+    ASSERT_TRUE(reader_.Init(dataset_.data(), static_cast<uint32_t>(dataset_.size())));
+    for (auto i = 0U; i < 2U * offline_frames.size(); i++)
+    {
+        ExpectFrame(Read(), offline_frames[i % offline_frames.size()]);
+    }
+}
+
+TEST_F(OfflineDataTests, Read_BufferTooSmall_ReturnZeroAndKeepFrame)
+{
+    ASSERT_TRUE(reader_.Init(dataset_.data(), static_cast<uint32_t>(dataset_.size())));
+    EXPECT_EQ(reader_.ReadData(buffer_.data(), 6U), 0U);
+    ExpectFrame(Read(), offline_frames[0]);
+}
+
+TEST_F(OfflineDataTests, Read_PaletteIndexOutOfRange_ReturnZero)
+{
+    dataset_[17] = 0x82;  // Palette index 2 in frame 0
+    ASSERT_TRUE(reader_.Init(dataset_.data(), static_cast<uint32_t>(dataset_.size())));
+    EXPECT_EQ(Read(), 0U);
+}
+
+TEST_F(OfflineDataTests, Read_PaletteIndexOutOfRange_FrameSkipped)
+{
+    dataset_[17] = 0x82;  // Palette index 2 in frame 0
+    ASSERT_TRUE(reader_.Init(dataset_.data(), static_cast<uint32_t>(dataset_.size())));
+    EXPECT_EQ(Read(), 0U);
+    ExpectFrame(Read(), offline_frames[1]);
+    ExpectFrame(Read(), offline_frames[2]);
+    EXPECT_EQ(Read(), 0U);  // Frame 0 again after the wrap around
+}
+
+TEST_F(OfflineDataTests, Read_TruncatedDataset_ReturnZero)
+{
+    ASSERT_TRUE(reader_.Init(dataset_.data(), 20U));  // Frame 1 is cut
+    ExpectFrame(Read(), offline_frames[0]);
+    EXPECT_EQ(Read(), 0U);
+}
+
+TEST_F(OfflineDataTests, Reset_AfterReading_RestartFromFirstFrame)
+{
+    ASSERT_TRUE(reader_.Init(dataset_.data(), static_cast<uint32_t>(dataset_.size())));
+    (void)Read();
+    reader_.Reset();
+    ExpectFrame(Read(), offline_frames[0]);
+}
+
+TEST_F(OfflineDataTests, Read_TrainFlagsInFrameHeader_FlagsIgnored)
+{
+    const auto frames_offset = 8U + (3U * dataset_[5]);
+    dataset_[frames_offset] |= 0xC0U;  // Trains and delays flags
+    ASSERT_TRUE(reader_.Init(dataset_.data(), static_cast<uint32_t>(dataset_.size())));
+
+    ExpectFrame(Read(), offline_frames[0]);
+    ExpectFrame(Read(), offline_frames[1]);
+}
@@ -0,0 +1,75 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "gtest/gtest.h"
+
+#include "StagingArena.h"
+
+class StagingArenaTests : public ::testing::Test
+{
+  protected:
+    static constexpr uint32_t kSize = 64U;
+    StagingArena arena_{kSize};
+    const int owner_a_{0};
+    const int owner_b_{0};
+    void SetUp() override
+    {
+        arena_.Init();
+    }
+};
+
+TEST_F(StagingArenaTests, Acquire_Free_ReturnBuffer)
+{
+    EXPECT_NE(arena_.Acquire(&owner_a_), nullptr);
+    EXPECT_TRUE(arena_.IsHeld());
+    EXPECT_EQ(arena_.GetSize(), kSize);
+}
+
+TEST_F(StagingArenaTests, Acquire_HeldByOther_ReturnNullptr)
+{
+    ASSERT_NE(arena_.Acquire(&owner_a_), nullptr);
+    EXPECT_EQ(arena_.Acquire(&owner_b_), nullptr);
+}
+
+TEST_F(StagingArenaTests, Acquire_HeldBySameOwner_ReturnSameBuffer)
+{
+    const auto first = arena_.Acquire(&owner_a_);
+    EXPECT_EQ(arena_.Acquire(&owner_a_), first);
+}
+
+TEST_F(StagingArenaTests, Release_ThenAcquireByOther_ReturnSameBuffer)
+{
+    const auto first = arena_.Acquire(&owner_a_);
+    arena_.Release(&owner_a_);
+    EXPECT_FALSE(arena_.IsHeld());
+    EXPECT_EQ(arena_.Acquire(&owner_b_), first);
+}
+
+TEST_F(StagingArenaTests, Release_NotOwner_KeepHeld)
+{
+    ASSERT_NE(arena_.Acquire(&owner_a_), nullptr);
+    arena_.Release(&owner_b_);
+    EXPECT_TRUE(arena_.IsHeld());
+    EXPECT_EQ(arena_.Acquire(&owner_b_), nullptr);
+}
+
+TEST_F(StagingArenaTests, Init_Twice_KeepBuffer)
+{
+    const auto first = arena_.Acquire(&owner_a_);
+    arena_.Init();
+    EXPECT_EQ(arena_.Acquire(&owner_a_), first);
+}
@@ -42,64 +42,64 @@ class DataToLedsTest : public ::testing::Test
 
     static constexpr size_t kNumberOfLeds = 58U;
     const etl::array<Led, kNumberOfLeds> leds = {{
-        {832, 16777215, 255},
-        {570, 16777215, 255},
-        {318, 16777215, 255},
-        {852, 16777215, 255},
-        {557, 16777215, 255},
-        {19, 16777215, 255},
-        {19, 16711680, 255},
-        {277, 16711680, 255},
-        {849, 16711680, 255},
-        {779, 16711680, 255},
-        {257, 16711680, 255},
-        {4, 16711680, 255},
-        {579, 16516088, 255},
-        {555, 16516088, 255},
-        {571, 16516088, 255},
-        {562, 16516088, 255},
-        {789, 16516088, 255},
-        {548, 16697099, 255},
-        {580, 16697099, 255},
-        {565, 16697099, 255},
-        {532, 16697099, 255},
-        {797, 38986, 255},
-        {812, 38986, 255},
-        {846, 16744448, 255},
-        {7, 16744448, 255},
-        {769, 16744448, 255},
-        {10, 16744448, 255},
-        {778, 16744448, 255},
-        {834, 16744448, 255},
-        {80, 16744448, 255},
-        {69, 16744448, 255},
-        {51, 16744448, 255},
-        {79, 16744448, 255},
-        {833, 16744448, 255},
-        {770, 16744448, 255},
-        {53, 16744448, 255},
-        {67, 16744448, 255},
-        {516, 16711680, 255},
-        {515, 16711680, 255},
-        {289, 9225790, 255},
-        {300, 16516088, 255},
-        {521, 16516088, 255},
-        {301, 16516088, 255},
-        {836, 35526, 255},
-        {301, 35526, 255},
-        {300, 35526, 255},
-        {834, 35526, 255},
-        {527, 16777215, 255},
-        {529, 16777215, 255},
-        {20, 255, 255},
-        {42, 255, 255},
-        {1, 255, 255},
-        {26, 255, 255},
-        {48, 255, 255},
-        {39, 255, 255},
-        {18, 255, 255},
-        {8, 255, 255},
-        {49, 255, 255},
+        {832, 16777215},
+        {570, 16777215},
+        {318, 16777215},
+        {852, 16777215},
+        {557, 16777215},
+        {19, 16777215},
+        {19, 16711680},
+        {277, 16711680},
+        {849, 16711680},
+        {779, 16711680},
+        {257, 16711680},
+        {4, 16711680},
+        {579, 16516088},
+        {555, 16516088},
+        {571, 16516088},
+        {562, 16516088},
+        {789, 16516088},
+        {548, 16697099},
+        {580, 16697099},
+        {565, 16697099},
+        {532, 16697099},
+        {797, 38986},
+        {812, 38986},
+        {846, 16744448},
+        {7, 16744448},
+        {769, 16744448},
+        {10, 16744448},
+        {778, 16744448},
+        {834, 16744448},
+        {80, 16744448},
+        {69, 16744448},
+        {51, 16744448},
+        {79, 16744448},
+        {833, 16744448},
+        {770, 16744448},
+        {53, 16744448},
+        {67, 16744448},
+        {516, 16711680},
+        {515, 16711680},
+        {289, 9225790},
+        {300, 16516088},
+        {521, 16516088},
+        {301, 16516088},
+        {836, 35526},
+        {301, 35526},
+        {300, 35526},
+        {834, 35526},
+        {527, 16777215},
+        {529, 16777215},
+        {20, 255},
+        {42, 255},
+        {1, 255},
+        {26, 255},
+        {48, 255},
+        {39, 255},
+        {18, 255},
+        {8, 255},
+        {49, 255},
     }};
 };
 
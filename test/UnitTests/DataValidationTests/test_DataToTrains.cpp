@@ -0,0 +1,148 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "gtest/gtest.h"
+
+#include "DataConverter.h"
+#include "FwConfig.h"
+#include "Led.h"
+
+#include <array>
+#include <optional>
+#include <vector>
+
+class DataToTrainsTest : public ::testing::Test
+{
+  protected:
+    std::vector<uint8_t> frame{
+        0x80, 3,              // 3 LEDs and a train section
+        0, 5, 255, 0, 0,      // LED 0
+        1, 10, 0, 255, 0,     // LED 1
+        0, 20, 0, 0, 255,     // LED 2
+        0, 2,                 // 2 trains
+        0x01, 0x02, 0, 0, 0,  // Train 258 on LED 0, forward
+        0, 7, 0, 2, 1,        // Train 7 on LED 2, backward
+    };
+    std::array<Train, kMaxTrains> trains{};
+    std::array<Led, kMaxLedsOn> leds{};
+
+    std::optional<uint32_t> ToTrains()
+    {
+        return DataConv_DataToTrains(frame.data(), static_cast<uint32_t>(frame.size()), trains.data(), static_cast<uint32_t>(trains.size()));
+    }
+};
+
+TEST_F(DataToTrainsTest, FrameWithTrains_IsValid)
+{
+    EXPECT_TRUE(DataConv_IsDataValid(frame.data(), static_cast<uint32_t>(frame.size())));
+}
+
+TEST_F(DataToTrainsTest, FrameWithTrains_LedsConverted)
+{
+    const auto nr_of_leds = DataConv_DataToLeds(frame.data(), static_cast<uint32_t>(frame.size()), leds.data(), static_cast<uint32_t>(leds.size()));
+
+    ASSERT_EQ(nr_of_leds, 3U);
+    EXPECT_EQ(leds[0], Led(5U, 0xFF0000U));
+    EXPECT_EQ(leds[1], Led(0x010AU, 0x00FF00U));
+    EXPECT_EQ(leds[2], Led(20U, 0x0000FFU));
+}
+
+TEST_F(DataToTrainsTest, FrameWithTrains_TrainsExtracted)
+{
+    const auto nr_of_trains = ToTrains();
+
+    ASSERT_EQ(nr_of_trains, 2U);
+    EXPECT_EQ(trains[0].id, 258U);
+    EXPECT_EQ(trains[0].led_id, 5U);
+    EXPECT_TRUE(trains[0].is_forward);
+    EXPECT_EQ(trains[0].color, 0xFF0000U);
+    EXPECT_EQ(trains[1].id, 7U);
+    EXPECT_EQ(trains[1].led_id, 20U);
+    EXPECT_FALSE(trains[1].is_forward);
+    EXPECT_EQ(trains[1].color, 0x0000FFU);
+}
+
+TEST_F(DataToTrainsTest, FrameWithoutTrains_Zero)
+{
+    const std::vector<uint8_t> frame_without_trains{0, 1, 0, 5, 255, 0, 0};
+
+    const auto nr_of_trains = DataConv_DataToTrains(frame_without_trains.data(), static_cast<uint32_t>(frame_without_trains.size()), trains.data(), static_cast<uint32_t>(trains.size()));
+
+    EXPECT_EQ(nr_of_trains, 0U);
+}
+
+TEST_F(DataToTrainsTest, TrainsNullptr_Nullopt)
+{
+    EXPECT_EQ(DataConv_DataToTrains(frame.data(), static_cast<uint32_t>(frame.size()), nullptr, 1U), std::nullopt);
+}
+
+TEST_F(DataToTrainsTest, TrainOnMissingLed_Invalid)
+{
+    frame[frame.size() - 2U] = 3U;  // LED index 3 of 3
+
+    EXPECT_FALSE(DataConv_IsDataValid(frame.data(), static_cast<uint32_t>(frame.size())));
+    EXPECT_EQ(ToTrains(), 0U);
+}
+
+TEST_F(DataToTrainsTest, WrongDirection_Invalid)
+{
+    frame.back() = 2U;
+
+    EXPECT_FALSE(DataConv_IsDataValid(frame.data(), static_cast<uint32_t>(frame.size())));
+}
+
+TEST_F(DataToTrainsTest, TruncatedTrainSection_Invalid)
+{
+    frame.pop_back();
+
+    EXPECT_FALSE(DataConv_IsDataValid(frame.data(), static_cast<uint32_t>(frame.size())));
+    EXPECT_EQ(ToTrains(), 0U);
+}
+
+TEST_F(DataToTrainsTest, TrainsBufferTooSmall_FirstTrainsExtracted)
+{
+    const auto nr_of_trains = DataConv_DataToTrains(frame.data(), static_cast<uint32_t>(frame.size()), trains.data(), 1U);
+
+    ASSERT_EQ(nr_of_trains, 1U);
+    EXPECT_EQ(trains[0].id, 258U);
+}
+
+TEST_F(DataToTrainsTest, HistoryUpdateWithTrains_IsValid)
+{
+    std::vector<uint8_t> history{frame};
+    history.insert(history.end(), {0, 1, 0, 5, 255, 0, 0});
+    history.insert(history.end(), frame.begin(), frame.end());
+
+    EXPECT_TRUE(DataConv_IsHistoryUpdateValid(history.data(), static_cast<uint32_t>(history.size())));
+}
+
+TEST_F(DataToTrainsTest, FrameWithDelays_IsValidAndTrainsExtracted)
+{
+    frame[0] |= 0x40U;                     // The train section has delays
+    frame.insert(frame.end(), {3U, 12U});  // Delays of train 258 and 7
+
+    EXPECT_TRUE(DataConv_IsDataValid(frame.data(), static_cast<uint32_t>(frame.size())));
+    EXPECT_EQ(ToTrains(), 2U);
+    EXPECT_EQ(trains[1].id, 7U);
+}
+
+TEST_F(DataToTrainsTest, DelaysWithoutTrains_Invalid)
+{
+    const std::vector<uint8_t> frame_without_trains{0x40, 1, 0, 5, 255, 0, 0};
+
+    EXPECT_FALSE(DataConv_IsDataValid(frame_without_trains.data(), static_cast<uint32_t>(frame_without_trains.size())));
+}
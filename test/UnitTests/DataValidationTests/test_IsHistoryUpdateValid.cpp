@@ -0,0 +1,87 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+
+#include "DataConverter.h"
+
+#include "FwConfig.h"
+#include "blob_HistoryData.hpp"
+
+TEST(IsHistoryUpdateValidTest, NullPtrBuffer_ReturnsFalse)
+{
+    EXPECT_FALSE(DataConv_IsHistoryUpdateValid(nullptr, 42U));
+}
+
+TEST(IsHistoryUpdateValidTest, ZeroLength_ReturnsFalse)
+{
+    uint8_t buffer[42U];
+    EXPECT_FALSE(DataConv_IsHistoryUpdateValid(buffer, 0U));
+}
+
+TEST(IsHistoryUpdateValidTest, LengthGreaterThanMaxBufferSize_ReturnsFalse)
+{
+    uint8_t buffer[42U];
+    EXPECT_FALSE(DataConv_IsHistoryUpdateValid(buffer, (kNumberOfHistoryFrames * kBufferSizeInBytes) + 1U));
+}
+
+TEST(IsHistoryUpdateValidTest, OneFrame_ReturnsTrue)
+{
+    constexpr size_t kNLedsInFrame = 3U;
+    constexpr size_t kFrameLength = kBytesInHeader + kNLedsInFrame * kBytesPerLed;
+    uint8_t buffer[kFrameLength] = {0, kNLedsInFrame};
+    EXPECT_TRUE(DataConv_IsHistoryUpdateValid(buffer, kFrameLength));
+}
+
+TEST(IsHistoryUpdateValidTest, SomeFrames_ReturnsTrue)
+{
+    constexpr size_t kNLedsInFrame = 3U;
+    constexpr size_t kFrameLength = kBytesInHeader + kNLedsInFrame * kBytesPerLed;
+    constexpr size_t kNFrames = 3U;
+    constexpr size_t kBufferLength = kNFrames * kFrameLength;
+    uint8_t buffer[kBufferLength] = {};
+    for (auto i = 0U; i < kNFrames; i++)
+    {
+        buffer[i * kFrameLength + 1] = kNLedsInFrame;
+    }
+    EXPECT_TRUE(DataConv_IsHistoryUpdateValid(buffer, kBufferLength));
+}
+
+TEST(IsHistoryUpdateValidTest, TruncatedLastFrame_ReturnsFalse)
+{
+    constexpr size_t kNLedsInFrame = 3U;
+    constexpr size_t kFrameLength = kBytesInHeader + kNLedsInFrame * kBytesPerLed;
+    constexpr size_t kNFrames = 2U;
+    constexpr size_t kBufferLength = kNFrames * kFrameLength;
+    uint8_t buffer[kBufferLength] = {};
+    for (auto i = 0U; i < kNFrames; i++)
+    {
+        buffer[i * kFrameLength + 1] = kNLedsInFrame;
+    }
+    EXPECT_FALSE(DataConv_IsHistoryUpdateValid(buffer, kBufferLength - 1));
+}
+
+TEST(IsHistoryUpdateValidTest, WrongFrame_ReturnFalse)
+{
+    std::array<uint8_t, HISTORY_BUFFER_LENGTH> buffer(history_buffer);
+    buffer.at(1) = 42U;  // wrong nr of leds
+    EXPECT_FALSE(DataConv_IsHistoryUpdateValid(buffer.data(), HISTORY_BUFFER_LENGTH));
+}
+
+TEST(IsHistoryUpdateValidTest, WholeHistoryFromServer_ReturnsTrue)
+{
+    EXPECT_TRUE(DataConv_IsHistoryUpdateValid(history_buffer.data(), HISTORY_BUFFER_LENGTH));
+}
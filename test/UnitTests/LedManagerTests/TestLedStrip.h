@@ -18,6 +18,8 @@
 
 #include <array>
 
+#include "FrameBlend.h"
+
 template<size_t N>
 class TestLedStrip : public LedStrip, public LedPresenter
 {
@@ -27,6 +29,42 @@ class TestLedStrip : public LedStrip, public LedPresenter
         leds.fill(0);
     }
     void Set(uint32_t pos, uint32_t html_color, uint8_t scaling) override
+    {
+        set_cnt_++;
+        SetLed(pos, html_color, scaling);
+    }
+    void SetMany(const LedUpdate* updates, uint32_t number_of_updates) override
+    {
+        set_many_cnt_++;
+        for (uint32_t i = 0; i < number_of_updates; i++)
+        {
+            SetLed(updates[i].position, updates[i].html_color, updates[i].scaling);
+        }
+    }
+    void SaveBlendStart() override
+    {
+        blend_start_ = leds;
+    }
+    void SaveBlendTarget() override
+    {
+        blend_target_ = leds;
+    }
+    void Blend(uint8_t progress) override
+    {
+        blend_cnt_++;
+        FrameBlend_Blend(reinterpret_cast<const uint8_t*>(blend_start_.data()), reinterpret_cast<const uint8_t*>(blend_target_.data()),
+                         reinterpret_cast<uint8_t*>(leds.data()), N * sizeof(uint32_t), progress);
+    }
+    uint32_t GetBlendCount() const { return blend_cnt_; }
+    uint32_t GetSetCount() const { return set_cnt_; }
+    uint32_t GetSetManyCount() const { return set_many_cnt_; }
+    void ResetCallCounts()
+    {
+        set_cnt_ = 0;
+        set_many_cnt_ = 0;
+        blend_cnt_ = 0;
+    }
+    void SetLed(uint32_t pos, uint32_t html_color, uint8_t scaling)
     {
         if (pos < N)
         {
@@ -55,8 +93,7 @@ class TestLedStrip : public LedStrip, public LedPresenter
     uint32_t GetSize() const override { return N; }
     void ClearAll() override
     {
-        std::array<uint32_t, N> leds_off{};
-        leds.swap(leds_off);
+        leds.fill(0U);
     }
     void Test() override
     {
@@ -65,14 +102,25 @@ class TestLedStrip : public LedStrip, public LedPresenter
             leds.at(i) = 0xFFFFFF;
         }
     }
+    void Commit() override { commit_cnt_++; }
+    uint32_t GetCommitCount() const { return commit_cnt_; }
     void SetBrightness(uint8_t brightness) override { brightness_ = brightness; }
     uint8_t GetBrightness() const { return brightness_; }
     void Show() override { did_show_ = true; }
     void ResetDidShow() { did_show_ = false; }
     bool GetDidShow() const { return did_show_; }
+    bool IsShowDone() override { return is_show_done_; }
+    void SetIsShowDone(bool is_show_done) { is_show_done_ = is_show_done; }
 
   private:
     std::array<uint32_t, N> leds{};
     uint8_t brightness_{UINT8_MAX};
     bool did_show_{false};
+    bool is_show_done_{true};
+    uint32_t commit_cnt_{0};
+    uint32_t set_cnt_{0};
+    uint32_t set_many_cnt_{0};
+    uint32_t blend_cnt_{0};
+    std::array<uint32_t, N> blend_start_{};
+    std::array<uint32_t, N> blend_target_{};
 };
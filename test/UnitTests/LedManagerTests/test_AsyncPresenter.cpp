@@ -0,0 +1,204 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+
+#include "AsyncLedPresenter.h"
+#include "FwConfig.h"
+#include "Led.h"
+#include "LedManager_Trainboard.h"
+#include "LedPresenter.h"
+#include "OsWrapper.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+// Mocks
+#include "TestLedStrip.h"
+
+// Presenter taking as long to show as the test wants, called from the render task
+class BlockingPresenter : public LedPresenter
+{
+  public:
+    void SetBrightness(uint8_t brightness) override { brightness_ = brightness; }
+    void Show() override
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        shown_brightness_ = brightness_;
+        is_showing_ = true;
+        changed_.notify_all();
+        changed_.wait(lock, [this] { return is_released_; });
+        is_released_ = false;
+        is_showing_ = false;
+        show_cnt_++;
+        changed_.notify_all();
+    }
+    bool IsShowDone() override { return true; }
+
+    bool WaitUntilShowing()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return changed_.wait_for(lock, kTimeout, [this] { return is_showing_; });
+    }
+    void Release()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        is_released_ = true;
+        changed_.notify_all();
+    }
+    uint32_t GetShowCount()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return show_cnt_;
+    }
+    uint8_t GetShownBrightness()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return shown_brightness_;
+    }
+
+  private:
+    static constexpr std::chrono::seconds kTimeout{2};
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    uint8_t brightness_{0};
+    uint8_t shown_brightness_{0};
+    bool is_showing_{false};
+    bool is_released_{false};
+    uint32_t show_cnt_{0};
+};
+
+class AsyncPresenterTest : public ::testing::Test
+{
+  protected:
+    static constexpr uint32_t kTransitionDurationInTicks = 20;
+    static constexpr size_t kStripLength = 8U;
+    static constexpr size_t kNumberOfStrips = 1U;
+
+    // The render task runs until the end of the tests, as on the target
+    static BlockingPresenter& GetBlockingPresenter()
+    {
+        static BlockingPresenter presenter{};
+        return presenter;
+    }
+    static AsyncLedPresenter& GetAsyncPresenter()
+    {
+        static AsyncLedPresenter presenter{GetBlockingPresenter()};
+        static bool is_initialized = false;
+        if (!is_initialized)
+        {
+            presenter.Init(kRenderTaskStackSize, kRenderTaskPriority, kRenderTaskCore);
+            is_initialized = true;
+        }
+        return presenter;
+    }
+
+    BlockingPresenter& blocking_presenter = GetBlockingPresenter();
+    AsyncLedPresenter& async_presenter = GetAsyncPresenter();
+    TestLedStrip<kStripLength> strip;
+    using Manager = TrainboardLedManager<kNumberOfStrips>;
+    etl::array<Manager::Strip, kNumberOfStrips> strips{strip};
+    Manager led_manager{strips, async_presenter, kTransitionDurationInTicks};
+
+    // Polls as the main loop does
+    bool WaitForShowDone()
+    {
+        auto is_done = async_presenter.IsShowDone();
+        for (auto i = 0U; (i < 2000U) && !is_done; i++)
+        {
+            OswTaskDelay(1U);
+            is_done = async_presenter.IsShowDone();
+        }
+        return is_done;
+    }
+
+    void TearDown() override
+    {
+        // Leave the render task idle for the next test
+        if (!async_presenter.IsShowDone())
+        {
+            blocking_presenter.Release();
+            EXPECT_TRUE(WaitForShowDone());
+        }
+    }
+};
+
+TEST_F(AsyncPresenterTest, Show_ReturnsBeforeTheLedsAreShown)
+{
+    const auto show_cnt = blocking_presenter.GetShowCount();
+    async_presenter.Show();
+    EXPECT_FALSE(async_presenter.IsShowDone());
+    EXPECT_TRUE(blocking_presenter.WaitUntilShowing());
+    EXPECT_FALSE(async_presenter.IsShowDone());
+
+    blocking_presenter.Release();
+    EXPECT_TRUE(WaitForShowDone());
+    EXPECT_EQ(blocking_presenter.GetShowCount(), show_cnt + 1U);
+}
+
+TEST_F(AsyncPresenterTest, LongShow_IsTheMaxShowTime)
+{
+    async_presenter.Show();
+    EXPECT_TRUE(blocking_presenter.WaitUntilShowing());
+    OswTaskDelay(5U);
+    blocking_presenter.Release();
+    EXPECT_TRUE(WaitForShowDone());
+    EXPECT_GE(async_presenter.GetMaxShowMicroSeconds(), 5000U);
+}
+
+TEST_F(AsyncPresenterTest, SetBrightness_AppliedByTheRenderTaskWithTheFrame)
+{
+    async_presenter.SetBrightness(42U);
+    async_presenter.Show();
+    EXPECT_TRUE(blocking_presenter.WaitUntilShowing());
+    EXPECT_EQ(blocking_presenter.GetShownBrightness(), 42U);
+}
+
+TEST_F(AsyncPresenterTest, FrameWhileShowing_NotCommittedUntilShowDone)
+{
+    // First frame, being shown
+    led_manager.SetStatusLed(LedColor::kBlue);
+    led_manager.ShowFrame();
+    EXPECT_EQ(strip.GetCommitCount(), 1U);
+    EXPECT_TRUE(blocking_presenter.WaitUntilShowing());
+
+    // Second frame composed meanwhile, the main loop is not held
+    led_manager.SetStatusLed(LedColor::kRed);
+    led_manager.ShowFrame();
+    led_manager.ShowFrame();
+    EXPECT_EQ(strip.GetCommitCount(), 1U);
+    EXPECT_EQ(strip.GetData().at(0), static_cast<uint32_t>(LedColor::kRed));
+
+    // Shown at the next tick after the first frame is done
+    blocking_presenter.Release();
+    EXPECT_TRUE(WaitForShowDone());
+    led_manager.ShowFrame();
+    EXPECT_EQ(strip.GetCommitCount(), 2U);
+}
+
+TEST_F(AsyncPresenterTest, NothingChanged_RenderTaskStaysIdle)
+{
+    const auto show_cnt = blocking_presenter.GetShowCount();
+    led_manager.SetBrightness(UINT8_MAX);
+    for (auto i = 0U; i < 3U * kBrightnessFramePeriodInTicks; i++)
+    {
+        led_manager.ShowFrame();
+    }
+    EXPECT_TRUE(async_presenter.IsShowDone());
+    EXPECT_EQ(strip.GetCommitCount(), 0U);
+    EXPECT_EQ(blocking_presenter.GetShowCount(), show_cnt);
+}
@@ -0,0 +1,84 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "gtest/gtest.h"
+
+#include "ColorCalibration.h"
+
+class ColorCalibrationTest : public ::testing::Test
+{
+  protected:
+    struct Pixel
+    {
+        uint8_t r;
+        uint8_t g;
+        uint8_t b;
+    };
+    static constexpr ColorCalibration kCalibration{2.2, 255U, 200U, 220U};
+    static constexpr ColorLut kLut{kCalibration};
+    Pixel pixel{};
+};
+
+TEST_F(ColorCalibrationTest, FullWhite_WhitePointOfCalibration)
+{
+    kLut.Apply(0xFFFFFFU, UINT8_MAX, pixel);
+
+    EXPECT_EQ(pixel.r, 255U);
+    EXPECT_EQ(pixel.g, 200U);
+    EXPECT_EQ(pixel.b, 220U);
+}
+
+TEST_F(ColorCalibrationTest, ScalingZero_Black)
+{
+    kLut.Apply(0xFFFFFFU, 0U, pixel);
+
+    EXPECT_EQ(pixel.r, 0U);
+    EXPECT_EQ(pixel.g, 0U);
+    EXPECT_EQ(pixel.b, 0U);
+}
+
+TEST_F(ColorCalibrationTest, HalfLevel_GammaCorrected)
+{
+    // 0.5^2.2 = 0.218
+    EXPECT_EQ(kLut.GetRed(128U), 56U);
+}
+
+TEST_F(ColorCalibrationTest, HalfScaling_SameAsHalfLevel)
+{
+    kLut.Apply(0xFF0000U, 128U, pixel);
+
+    EXPECT_EQ(pixel.r, kLut.GetRed(128U));
+}
+
+TEST_F(ColorCalibrationTest, Lut_Monotonic)
+{
+    for (auto i = 1U; i <= UINT8_MAX; i++)
+    {
+        EXPECT_GE(kLut.GetRed(static_cast<uint8_t>(i)), kLut.GetRed(static_cast<uint8_t>(i - 1U)));
+        EXPECT_GE(kLut.GetGreen(static_cast<uint8_t>(i)), kLut.GetGreen(static_cast<uint8_t>(i - 1U)));
+        EXPECT_GE(kLut.GetBlue(static_cast<uint8_t>(i)), kLut.GetBlue(static_cast<uint8_t>(i - 1U)));
+    }
+}
+
+TEST_F(ColorCalibrationTest, Channels_ReadFromHtmlColor)
+{
+    kLut.Apply(0xFF0000U, UINT8_MAX, pixel);
+
+    EXPECT_EQ(pixel.r, 255U);
+    EXPECT_EQ(pixel.g, 0U);
+    EXPECT_EQ(pixel.b, 0U);
+}
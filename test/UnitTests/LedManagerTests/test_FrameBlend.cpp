@@ -0,0 +1,126 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "gtest/gtest.h"
+
+#include "FrameBlend.h"
+
+#include <array>
+#include <cstdint>
+#include <random>
+
+class FrameBlendTest : public ::testing::Test
+{
+  protected:
+    static constexpr uint32_t kLength = 3U * 67U;  // Like a strip of CRGB, not a multiple of a word
+    using Frame = std::array<uint8_t, kLength>;
+    Frame start{};
+    Frame target{};
+    Frame frame{};
+
+    void SetUp() override
+    {
+        std::mt19937 generator{42U};
+        std::uniform_int_distribution<uint32_t> distribution{0U, UINT8_MAX};
+        for (auto i = 0U; i < kLength; i++)
+        {
+            start[i] = static_cast<uint8_t>(distribution(generator));
+            target[i] = static_cast<uint8_t>(distribution(generator));
+        }
+    }
+
+    // Scalar reference, one channel at a time
+    static uint8_t BlendReference(uint8_t start_channel, uint8_t target_channel, uint8_t progress)
+    {
+        const uint32_t weight = (progress < 128U) ? progress : (progress + 1U);
+        return static_cast<uint8_t>(((start_channel * (256U - weight)) + (target_channel * weight)) / 256U);
+    }
+};
+
+TEST_F(FrameBlendTest, AllProgresses_SameAsScalarReference)
+{
+    for (auto progress = 0U; progress <= UINT8_MAX; progress++)
+    {
+        FrameBlend_Blend(start.data(), target.data(), frame.data(), kLength, static_cast<uint8_t>(progress));
+
+        for (auto i = 0U; i < kLength; i++)
+        {
+            ASSERT_EQ(frame[i], BlendReference(start[i], target[i], static_cast<uint8_t>(progress))) << "progress " << progress << ", byte " << i;
+        }
+    }
+}
+
+TEST_F(FrameBlendTest, ExtremeChannels_SameAsScalarReference)
+{
+    // Largest products, a carry into the next channel would show here
+    const std::array<uint8_t, 8U> start_channels{0U, 255U, 0U, 255U, 255U, 255U, 0U, 0U};
+    const std::array<uint8_t, 8U> target_channels{255U, 0U, 255U, 0U, 255U, 255U, 0U, 0U};
+    std::array<uint8_t, 8U> channels{};
+    for (auto progress = 0U; progress <= UINT8_MAX; progress++)
+    {
+        FrameBlend_Blend(start_channels.data(), target_channels.data(), channels.data(), channels.size(), static_cast<uint8_t>(progress));
+
+        for (auto i = 0U; i < channels.size(); i++)
+        {
+            ASSERT_EQ(channels[i], BlendReference(start_channels[i], target_channels[i], static_cast<uint8_t>(progress)));
+        }
+    }
+}
+
+TEST_F(FrameBlendTest, ProgressZero_StartFrame)
+{
+    FrameBlend_Blend(start.data(), target.data(), frame.data(), kLength, 0U);
+
+    EXPECT_EQ(frame, start);
+}
+
+TEST_F(FrameBlendTest, ProgressMax_TargetFrame)
+{
+    FrameBlend_Blend(start.data(), target.data(), frame.data(), kLength, UINT8_MAX);
+
+    EXPECT_EQ(frame, target);
+}
+
+TEST_F(FrameBlendTest, BlendInStartFrame_SameAsSeparateFrame)
+{
+    FrameBlend_Blend(start.data(), target.data(), frame.data(), kLength, 100U);
+
+    FrameBlend_Blend(start.data(), target.data(), start.data(), kLength, 100U);
+
+    EXPECT_EQ(start, frame);
+}
+
+TEST_F(FrameBlendTest, UnalignedFrames_SameAsScalarReference)
+{
+    constexpr uint32_t kOffset = 1U;
+    constexpr uint32_t kBlendLength = kLength - 2U;
+    FrameBlend_Blend(&start[kOffset], &target[kOffset + 1U], &frame[kOffset], kBlendLength, 200U);
+
+    for (auto i = 0U; i < kBlendLength; i++)
+    {
+        ASSERT_EQ(frame[kOffset + i], BlendReference(start[kOffset + i], target[kOffset + 1U + i], 200U));
+    }
+    EXPECT_EQ(frame[0], 0U);
+    EXPECT_EQ(frame[kLength - 1U], 0U);
+}
+
+TEST_F(FrameBlendTest, ZeroLength_NothingWritten)
+{
+    FrameBlend_Blend(start.data(), target.data(), frame.data(), 0U, 100U);
+
+    EXPECT_EQ(frame, Frame{});
+}
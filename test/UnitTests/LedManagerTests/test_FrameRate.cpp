@@ -0,0 +1,158 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+
+#include "FwConfig.h"
+#include "Led.h"
+#include "LedManager_Trainboard.h"
+#include "LedStrip.h"
+
+#include <array>
+
+// Mocks
+#include "TestLedStrip.h"
+
+class FrameRateTest : public ::testing::Test
+{
+  protected:
+    static constexpr uint32_t kTransitionDurationInTicks = 20;
+    static constexpr size_t kStripLength = 8U;
+    static constexpr size_t kNumberOfStrips = 1U;
+    TestLedStrip<kStripLength> strip;
+    using Manager = TrainboardLedManager<kNumberOfStrips>;
+    etl::array<Manager::Strip, kNumberOfStrips> strips{strip};
+    Manager led_manager{strips, strip, kTransitionDurationInTicks};
+    void SetUp() override
+    {
+        const std::array<Led, 2> leds{Led(0, 42), Led(3, 7)};
+        led_manager.SetLeds(leds.data(), leds.size());
+        for (auto i = 0U; i < kTransitionDurationInTicks; i++)
+        {
+            (void)led_manager.RefreshTransition();
+            led_manager.ShowFrame();
+        }
+        strip.ResetDidShow();
+    }
+
+    // Count the frames shown over some ticks, as the board does without any event
+    uint32_t CountShownFrames(uint32_t ticks)
+    {
+        uint32_t frames = 0U;
+        for (auto i = 0U; i < ticks; i++)
+        {
+            led_manager.RefreshMotion();
+            led_manager.ShowFrame();
+            frames += strip.GetDidShow() ? 1U : 0U;
+            strip.ResetDidShow();
+        }
+        return frames;
+    }
+};
+
+TEST_F(FrameRateTest, SteadyState_NoFrameShown)
+{
+    EXPECT_EQ(CountShownFrames(100U), 0U);
+}
+
+TEST_F(FrameRateTest, Transitioning_OneFramePerTick)
+{
+    const std::array<Led, 1> leds{Led(5, 9)};
+    led_manager.SetLeds(leds.data(), leds.size());
+    uint32_t frames = 0U;
+    for (auto i = 0U; i < kTransitionDurationInTicks; i++)
+    {
+        (void)led_manager.RefreshTransition();
+        led_manager.ShowFrame();
+        frames += strip.GetDidShow() ? 1U : 0U;
+        strip.ResetDidShow();
+    }
+    EXPECT_EQ(frames, kTransitionDurationInTicks);
+}
+
+TEST_F(FrameRateTest, SeveralChangesInATick_ShownOnce)
+{
+    led_manager.ClearAllLeds();
+    led_manager.SetStatusLed(LedColor::kBlue);
+    EXPECT_FALSE(strip.GetDidShow());
+    EXPECT_EQ(CountShownFrames(1U), 1U);
+    EXPECT_EQ(strip.GetData().at(0), static_cast<uint32_t>(LedColor::kBlue));
+}
+
+TEST_F(FrameRateTest, BrightnessChangeAlone_ShownOncePerPeriod)
+{
+    // Light sensor creeping by one step at every tick
+    uint32_t frames = 0U;
+    for (auto i = 0U; i < 2U * kBrightnessFramePeriodInTicks; i++)
+    {
+        led_manager.SetBrightness(static_cast<uint8_t>(100U + i));
+        led_manager.ShowFrame();
+        frames += strip.GetDidShow() ? 1U : 0U;
+        strip.ResetDidShow();
+    }
+    EXPECT_EQ(frames, 2U);
+}
+
+TEST_F(FrameRateTest, BrightnessChangeAlone_AppliedAfterPeriod)
+{
+    led_manager.SetBrightness(100U);
+    (void)CountShownFrames(kBrightnessFramePeriodInTicks);
+    led_manager.SetBrightness(101U);
+    EXPECT_EQ(CountShownFrames(kBrightnessFramePeriodInTicks - 1U), 0U);
+    EXPECT_EQ(strip.GetBrightness(), 100U);
+    EXPECT_EQ(CountShownFrames(1U), 1U);
+    EXPECT_EQ(strip.GetBrightness(), 101U);
+}
+
+TEST_F(FrameRateTest, BrightnessChangeDuringTransition_BatchedIntoNextFrame)
+{
+    const std::array<Led, 1> leds{Led(5, 9)};
+    led_manager.SetLeds(leds.data(), leds.size());
+    (void)led_manager.RefreshTransition();
+    led_manager.ShowFrame();
+    led_manager.SetBrightness(42U);
+    (void)led_manager.RefreshTransition();
+    led_manager.ShowFrame();
+    EXPECT_EQ(strip.GetBrightness(), 42U);
+}
+
+TEST_F(FrameRateTest, SameBrightness_NoFrameShown)
+{
+    led_manager.SetBrightness(100U);
+    (void)CountShownFrames(kBrightnessFramePeriodInTicks);
+    for (auto i = 0U; i < 3U * kBrightnessFramePeriodInTicks; i++)
+    {
+        led_manager.SetBrightness(100U);
+        led_manager.ShowFrame();
+    }
+    EXPECT_FALSE(strip.GetDidShow());
+}
+
+TEST_F(FrameRateTest, ChangeWhileShowing_ShowDoneOnceShown)
+{
+    EXPECT_TRUE(led_manager.IsShowDone());
+    strip.SetIsShowDone(false);
+    led_manager.ClearAllLeds();
+    led_manager.ShowFrame();
+    EXPECT_FALSE(strip.GetDidShow());
+    EXPECT_FALSE(led_manager.IsShowDone());
+
+    strip.SetIsShowDone(true);
+    EXPECT_FALSE(led_manager.IsShowDone());  // Not shown yet
+    led_manager.ShowFrame();
+    EXPECT_TRUE(strip.GetDidShow());
+    EXPECT_TRUE(led_manager.IsShowDone());
+}
@@ -0,0 +1,83 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "gtest/gtest.h"
+
+#include "Led.h"
+#include "LedVector.h"
+
+class LedVectorTest : public ::testing::Test
+{
+  protected:
+    static constexpr size_t kCapacity = 8U;
+    LedVector<kCapacity> leds;
+};
+
+TEST_F(LedVectorTest, Led_IsPacked)
+{
+    EXPECT_LE(sizeof(Led), 6U);
+}
+
+TEST_F(LedVectorTest, PushBack_Led_KeepIdAndColor)
+{
+    leds.PushBack(Led(0x0102, 0xABCDEFU));
+
+    ASSERT_EQ(leds.GetSize(), 1U);
+    EXPECT_EQ(leds.GetId(0), 0x0102);
+    EXPECT_EQ(leds.GetColor(0), 0xABCDEFU);
+    EXPECT_EQ(leds.Get(0), Led(0x0102, 0xABCDEFU));
+}
+
+TEST_F(LedVectorTest, Clear_Leds_BecomeEmpty)
+{
+    leds.PushBack(Led(1, 1));
+    leds.Clear();
+
+    EXPECT_TRUE(leds.IsEmpty());
+    EXPECT_EQ(leds.GetSize(), 0U);
+}
+
+TEST_F(LedVectorTest, Find_SameIdAndColor_ReturnIndex)
+{
+    leds.PushBack(Led(1, 10));
+    leds.PushBack(Led(2, 20));
+    leds.PushBack(Led(3, 30));
+
+    EXPECT_EQ(leds.Find(Led(2, 20)), 1U);
+    EXPECT_EQ(leds.Find(Led(2, 21)), leds.GetSize());
+    EXPECT_EQ(leds.Find(Led(4, 20)), leds.GetSize());
+}
+
+TEST_F(LedVectorTest, FindColorChange_SameIdOtherColor_ReturnIndex)
+{
+    leds.PushBack(Led(1, 10));
+    leds.PushBack(Led(2, 20));
+
+    EXPECT_EQ(leds.FindColorChange(Led(2, 21)), 1U);
+    EXPECT_EQ(leds.FindColorChange(Led(2, 20)), leds.GetSize());
+    EXPECT_EQ(leds.FindColorChange(Led(3, 20)), leds.GetSize());
+}
+
+TEST_F(LedVectorTest, Find_DuplicatedIds_SkipOtherColors)
+{
+    leds.PushBack(Led(5, 10));
+    leds.PushBack(Led(5, 20));
+
+    EXPECT_EQ(leds.Find(Led(5, 20)), 1U);
+    EXPECT_EQ(leds.FindColorChange(Led(5, 10)), 1U);
+    EXPECT_EQ(leds.FindColorChange(Led(5, 20)), 0U);
+}
@@ -158,3 +158,35 @@ TEST_F(MultipleStripsTest, ImpossibleLedId_Ignore)
     EXPECT_EQ(strip2_data, strip2_data_expected);
     EXPECT_EQ(strip3_data, strip3_data_expected);
 }
+
+TEST_F(MultipleStripsTest, Transition_LedsSetInOneCallPerStrip)
+{
+    constexpr uint32_t kIdStrip1 = 0 << 8U;
+    constexpr uint32_t kIdStrip2 = 1 << 8U;
+    constexpr uint32_t kIdStrip3 = 2 << 8U;
+    const std::array<Led, 6> new_leds{
+        Led(kIdStrip1 | 0, 1),
+        Led(kIdStrip2 | 1, 2),
+        Led(kIdStrip3 | 2, 3),
+        Led(kIdStrip1 | 3, 4),
+        Led(kIdStrip2 | 4, 5),
+        Led(kIdStrip3 | 5, 6),
+    };
+    led_manager.SetLeds(new_leds.data(), new_leds.size());
+    strip1.ResetCallCounts();
+    strip2.ResetCallCounts();
+    strip3.ResetCallCounts();
+
+    // WHEN
+    (void)led_manager.RefreshTransition();
+
+    // THEN the LEDs fading in and out are set with one call each per strip, none one by one
+    EXPECT_LE(strip1.GetSetManyCount(), 2U);
+    EXPECT_LE(strip2.GetSetManyCount(), 2U);
+    EXPECT_LE(strip3.GetSetManyCount(), 2U);
+    EXPECT_EQ(0U, strip1.GetSetCount() + strip2.GetSetCount() + strip3.GetSetCount());
+
+    ExecuteWholeTransition();
+    const std::array<uint32_t, kStripLength1> strip1_data_expected{1, 0, 0, 4, 0, 0, 0, 0};
+    EXPECT_EQ(strip1.GetData(), strip1_data_expected);
+}
@@ -51,6 +51,7 @@ class StatusLedsTest : public ::testing::Test
         };
         led_manager.SetLeds(new_leds.data(), new_leds.size());
         ExecuteWholeTransition();
+        led_manager.ShowFrame();
     }
 
     void ExecuteWholeTransition()
@@ -68,6 +69,7 @@ TEST_F(StatusLedsTest, Transitioning_SetStatusLed_ReturnFalse)
     Led led{};
     led_manager.SetLeds(&led, 0);  // Dummy led, starts the transition algorithm
     const auto did_set_leds = led_manager.SetStatusLed(LedColor::kBlue);
+    led_manager.ShowFrame();
     EXPECT_FALSE(did_set_leds);
     EXPECT_FALSE(strip1.GetDidShow());
 }
@@ -76,6 +78,7 @@ TEST_F(StatusLedsTest, NotTransitioning_SetStatusLed_ReturnTrue)
 {
     strip1.ResetDidShow();
     const auto did_set_leds = led_manager.SetStatusLed(LedColor::kBlue);
+    led_manager.ShowFrame();
     EXPECT_TRUE(did_set_leds);
     EXPECT_TRUE(strip1.GetDidShow());
 }
@@ -84,6 +87,7 @@ TEST_F(StatusLedsTest, SetStatusLeds_FirstLedOfEachStripOn)
 {
     strip1.ResetDidShow();
     led_manager.SetStatusLed(LedColor::kRed);
+    led_manager.ShowFrame();
     const auto strip1_data = strip1.GetData();
     const auto strip2_data = strip2.GetData();
     const std::array<uint32_t, kStripLength> strip1_data_expected{static_cast<uint32_t>(LedColor::kRed), 0};
@@ -100,6 +104,7 @@ TEST_F(StatusLedsTest, ClearLeds_LedsOffAndNoMoreActiveLeds)
 
     // WHEN
     led_manager.ClearAllLeds();
+    led_manager.ShowFrame();
 
     // THEN
     const std::array<uint32_t, kStripLength> strip1_data_expected{0};
@@ -122,7 +127,9 @@ TEST_F(StatusLedsTest, ClearLeds_LedsOffAndNoMoreActiveLeds)
 
 TEST_F(StatusLedsTest, NotTransitioning_SetTestLeds_ReturnTrue)
 {
+    strip1.ResetDidShow();
     const auto did_set_leds = led_manager.SetTestLeds();
+    led_manager.ShowFrame();
     EXPECT_TRUE(did_set_leds);
     EXPECT_TRUE(strip1.GetDidShow());
 }
@@ -133,6 +140,7 @@ TEST_F(StatusLedsTest, Transitioning_SetTestLeds_ReturnFalse)
     led_manager.SetLeds(&dummy_led, 0);
     strip1.ResetDidShow();
     const auto did_set_leds = led_manager.SetTestLeds();
+    led_manager.ShowFrame();
     EXPECT_FALSE(did_set_leds);
     EXPECT_FALSE(strip1.GetDidShow());
 }
@@ -140,6 +148,7 @@ TEST_F(StatusLedsTest, Transitioning_SetTestLeds_ReturnFalse)
 TEST_F(StatusLedsTest, SetTestLeds_AllLedsWhite)
 {
     led_manager.SetTestLeds();
+    led_manager.ShowFrame();
     const auto strip1_data = strip1.GetData();
     const auto strip2_data = strip2.GetData();
     std::array<uint32_t, kStripLength> strip1_data_expected;
@@ -154,10 +163,14 @@ TEST_F(StatusLedsTest, SetTestLeds_AllLedsWhite)
     EXPECT_TRUE(strip1.GetDidShow());
 }
 
-TEST_F(StatusLedsTest, SetBrightness_BrighnessSet)
+TEST_F(StatusLedsTest, SetBrightness_BrighnessSetAtLatestAfterFramePeriod)
 {
     constexpr uint8_t kBrightness = 42U;
     led_manager.SetBrightness(kBrightness);
+    for (auto i = 0U; i < kBrightnessFramePeriodInTicks; i++)
+    {
+        led_manager.ShowFrame();
+    }
     EXPECT_EQ(strip1.GetBrightness(), kBrightness);  // Strip1 is the presenter
 }
 
@@ -0,0 +1,202 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "gtest/gtest.h"
+
+#include "Led.h"
+#include "LedManager_Trainboard.h"
+#include "LedStrip.h"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include "etl/array.h"
+
+// Mocks
+#include "TestLedStrip.h"
+
+class TrainMotionTest : public ::testing::Test
+{
+  protected:
+    static constexpr uint32_t kTransitionDurationInTicks = 20;
+    static constexpr uint32_t kMotionDurationInTicks = 40;
+    static constexpr size_t kStripLength = 12U;
+    static constexpr size_t kNumberOfStrips = 1U;
+    static constexpr uint16_t kTrainId = 42U;
+    static constexpr uint32_t kTrainColor = 7U;
+    using Manager = TrainboardLedManager<kNumberOfStrips>;
+    TestLedStrip<kStripLength> strip;
+    etl::array<std::reference_wrapper<LedStrip>, kNumberOfStrips> strips{strip};
+    Manager led_manager{strips, strip, kTransitionDurationInTicks, kMotionDurationInTicks};
+
+    void ExecuteTransition()
+    {
+        for (auto i = 0U; i < kTransitionDurationInTicks; i++)
+        {
+            (void)led_manager.RefreshTransition();
+        }
+    }
+    void ExecuteMotion(uint32_t number_of_ticks)
+    {
+        for (auto i = 0U; i < number_of_ticks; i++)
+        {
+            led_manager.RefreshMotion();
+        }
+    }
+    void ShowTrain(uint16_t position, bool is_forward)
+    {
+        const std::array<Train, 1U> trains{Train{kTrainId, position, is_forward, kTrainColor}};
+        const std::array<Led, 1U> leds{Led(position, kTrainColor)};
+        led_manager.SetTrains(trains.data(), trains.size());
+        led_manager.SetLeds(leds.data(), leds.size());
+        ExecuteTransition();
+    }
+    size_t GetTrainPosition()
+    {
+        const auto& data = strip.GetData();
+        return static_cast<size_t>(std::find(data.begin(), data.end(), kTrainColor) - data.begin());
+    }
+};
+
+TEST_F(TrainMotionTest, TrainMoved_StaysAtPreviousPositionDuringTransition)
+{
+    ShowTrain(2U, true);
+
+    ShowTrain(6U, true);
+
+    EXPECT_EQ(GetTrainPosition(), 2U);
+    EXPECT_EQ(strip.GetData()[6], 0U);
+}
+
+TEST_F(TrainMotionTest, TrainMoved_InterpolatedAfterTransition)
+{
+    ShowTrain(2U, true);
+    ShowTrain(6U, true);
+
+    ExecuteMotion(kMotionDurationInTicks / 2);
+    EXPECT_EQ(GetTrainPosition(), 4U);
+    EXPECT_EQ(strip.GetData()[2], 0U);
+
+    ExecuteMotion(kMotionDurationInTicks / 2);
+    EXPECT_EQ(GetTrainPosition(), 6U);
+    EXPECT_EQ(strip.GetData()[4], 0U);
+}
+
+TEST_F(TrainMotionTest, TrainMovedBackward_Interpolated)
+{
+    ShowTrain(6U, false);
+    ShowTrain(2U, false);
+
+    ExecuteMotion(kMotionDurationInTicks / 2);
+
+    EXPECT_EQ(GetTrainPosition(), 4U);
+}
+
+TEST_F(TrainMotionTest, TrainMovedAgainstItsDirection_Jumps)
+{
+    ShowTrain(6U, true);
+
+    ShowTrain(2U, true);
+
+    EXPECT_EQ(GetTrainPosition(), 2U);
+    EXPECT_EQ(strip.GetData()[6], 0U);
+}
+
+TEST_F(TrainMotionTest, TrainMovedTooFar_Jumps)
+{
+    ShowTrain(0U, true);
+
+    ShowTrain(static_cast<uint16_t>(kTrainMaxStepLeds + 1U), true);
+
+    EXPECT_EQ(GetTrainPosition(), kTrainMaxStepLeds + 1U);
+}
+
+TEST_F(TrainMotionTest, NewFrameDuringMotion_StartsFromShownPosition)
+{
+    ShowTrain(2U, true);
+    ShowTrain(6U, true);
+    ExecuteMotion(kMotionDurationInTicks / 2);
+
+    ShowTrain(8U, true);
+    EXPECT_EQ(GetTrainPosition(), 4U);
+
+    ExecuteMotion(kMotionDurationInTicks);
+    EXPECT_EQ(GetTrainPosition(), 8U);
+}
+
+TEST_F(TrainMotionTest, TrainPassesOverLed_LedShownAgain)
+{
+    constexpr uint32_t kStationColor = 3U;
+    const std::array<Train, 1U> trains{Train{kTrainId, 2U, true, kTrainColor}};
+    const std::array<Led, 2U> leds{Led(2U, kTrainColor), Led(4U, kStationColor)};
+    led_manager.SetTrains(trains.data(), trains.size());
+    led_manager.SetLeds(leds.data(), leds.size());
+    ExecuteTransition();
+
+    const std::array<Train, 1U> moved_trains{Train{kTrainId, 6U, true, kTrainColor}};
+    const std::array<Led, 2U> moved_leds{Led(6U, kTrainColor), Led(4U, kStationColor)};
+    led_manager.SetTrains(moved_trains.data(), moved_trains.size());
+    led_manager.SetLeds(moved_leds.data(), moved_leds.size());
+    ExecuteTransition();
+    ExecuteMotion(kMotionDurationInTicks);
+
+    EXPECT_EQ(GetTrainPosition(), 6U);
+    EXPECT_EQ(strip.GetData()[4], kStationColor);
+}
+
+TEST_F(TrainMotionTest, NoTrains_LedsJump)
+{
+    ShowTrain(2U, true);
+
+    const std::array<Led, 1U> leds{Led(6U, kTrainColor)};
+    led_manager.SetLeds(leds.data(), leds.size());
+    ExecuteTransition();
+
+    EXPECT_EQ(GetTrainPosition(), 6U);
+}
+
+TEST_F(TrainMotionTest, OtherLedOnTrainPosition_TrainLedMoved)
+{
+    constexpr uint32_t kStationColor = 3U;
+    ShowTrain(2U, true);
+
+    const std::array<Train, 1U> trains{Train{kTrainId, 6U, true, kTrainColor}};
+    const std::array<Led, 2U> leds{Led(6U, kStationColor), Led(6U, kTrainColor)};
+    led_manager.SetTrains(trains.data(), trains.size());
+    led_manager.SetLeds(leds.data(), leds.size());
+    ExecuteTransition();
+
+    EXPECT_EQ(GetTrainPosition(), 2U);
+    ExecuteMotion(kMotionDurationInTicks);
+    EXPECT_EQ(GetTrainPosition(), 6U);
+}
+
+TEST_F(TrainMotionTest, HistoryReplay_TrainsCleared_EachFrameShownWhereItIs)
+{
+    // The replays set no trains and do not refresh the motion, see StateTransitioning
+    ShowTrain(2U, true);
+
+    for (uint16_t position = 3U; position < kStripLength; position++)
+    {
+        const std::array<Led, 1U> leds{Led(position, kTrainColor)};
+        led_manager.SetTrains(nullptr, 0U);
+        led_manager.SetLeds(leds.data(), leds.size());
+        ExecuteTransition();
+
+        EXPECT_EQ(GetTrainPosition(), position);
+    }
+}
@@ -0,0 +1,234 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "gtest/gtest.h"
+
+#include "Led.h"
+#include "LedManager_Trainboard.h"
+#include "LedStrip.h"
+#include "TransitionEffects.h"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include "etl/array.h"
+
+// Mocks
+#include "TestLedStrip.h"
+
+class TransitionEffectsTest : public ::testing::Test
+{
+  protected:
+    static constexpr uint32_t kTransitionDurationInTicks = 20;
+    static constexpr size_t kStripLength = 8U;
+    static constexpr size_t kNumberOfStrips = 1U;
+    static constexpr uint32_t kOldColor = 1U;
+    static constexpr uint32_t kNewColor = 2U;
+    using Manager = TrainboardLedManager<kNumberOfStrips>;
+    TestLedStrip<kStripLength> strip;
+    etl::array<std::reference_wrapper<LedStrip>, kNumberOfStrips> strips{strip};
+    Manager led_manager{strips, strip, kTransitionDurationInTicks};
+
+    void ExecuteTicks(uint32_t number_of_ticks)
+    {
+        for (auto i = 0U; i < number_of_ticks; i++)
+        {
+            (void)led_manager.RefreshTransition();
+        }
+    }
+    void SetAllLeds(uint32_t color)
+    {
+        std::array<Led, kStripLength> leds{};
+        for (auto i = 0U; i < kStripLength; i++)
+        {
+            leds[i] = Led(static_cast<uint16_t>(i), color);
+        }
+        led_manager.SetLeds(leds.data(), leds.size());
+    }
+    void SetInitialLeds()
+    {
+        SetAllLeds(kOldColor);
+        ExecuteTicks(kTransitionDurationInTicks);
+    }
+    size_t CountLeds(uint32_t color)
+    {
+        const auto& data = strip.GetData();
+        return static_cast<size_t>(std::count(data.begin(), data.end(), color));
+    }
+};
+
+TEST_F(TransitionEffectsTest, Wipe_HalfTransition_FirstHalfOfStripChanged)
+{
+    SetInitialLeds();
+    led_manager.SetTransitionEffect(TransitionEffect::kWipe);
+    SetAllLeds(kNewColor);
+
+    ExecuteTicks(kTransitionDurationInTicks / 2);
+
+    const std::array<uint32_t, kStripLength> expected{2, 2, 2, 2, 1, 1, 1, 1};
+    EXPECT_EQ(strip.GetData(), expected);
+}
+
+TEST_F(TransitionEffectsTest, Wipe_WholeTransition_AllLedsChanged)
+{
+    SetInitialLeds();
+    led_manager.SetTransitionEffect(TransitionEffect::kWipe);
+    SetAllLeds(kNewColor);
+
+    ExecuteTicks(kTransitionDurationInTicks);
+
+    EXPECT_EQ(CountLeds(kNewColor), kStripLength);
+}
+
+TEST_F(TransitionEffectsTest, Wipe_LedRemoved_ClearedAfterTransition)
+{
+    SetInitialLeds();
+    led_manager.SetTransitionEffect(TransitionEffect::kWipe);
+    const std::array<Led, 1U> new_leds{Led(0, kOldColor)};
+    led_manager.SetLeds(new_leds.data(), new_leds.size());
+
+    ExecuteTicks(kTransitionDurationInTicks);
+
+    const std::array<uint32_t, kStripLength> expected{1, 0, 0, 0, 0, 0, 0, 0};
+    EXPECT_EQ(strip.GetData(), expected);
+}
+
+TEST_F(TransitionEffectsTest, Sparkle_HalfTransition_SomeLedsChanged)
+{
+    SetInitialLeds();
+    led_manager.SetTransitionEffect(TransitionEffect::kSparkle);
+    SetAllLeds(kNewColor);
+
+    ExecuteTicks(kTransitionDurationInTicks / 2);
+
+    EXPECT_GT(CountLeds(kNewColor), 0U);
+    EXPECT_GT(CountLeds(kOldColor), 0U);
+    EXPECT_EQ(CountLeds(kNewColor) + CountLeds(kOldColor), kStripLength);
+}
+
+TEST_F(TransitionEffectsTest, Sparkle_WholeTransition_AllLedsChanged)
+{
+    SetInitialLeds();
+    led_manager.SetTransitionEffect(TransitionEffect::kSparkle);
+    SetAllLeds(kNewColor);
+
+    ExecuteTicks(kTransitionDurationInTicks);
+
+    EXPECT_EQ(CountLeds(kNewColor), kStripLength);
+}
+
+TEST(SparkleEffectTest, EveryPositionReachedAtItsOwnProgress)
+{
+    std::array<bool, 256> is_progress_used{};
+    for (auto position = 0U; position < is_progress_used.size(); position++)
+    {
+        auto progress = 0U;
+        while ((progress <= UINT8_MAX) && (0U == SparkleEffect::GetScaling(static_cast<uint8_t>(progress), position, 256U)))
+        {
+            progress++;
+        }
+        ASSERT_LE(progress, UINT8_MAX);  // Reached by the end of the transition
+        EXPECT_FALSE(is_progress_used[progress]);
+        is_progress_used[progress] = true;
+    }
+}
+
+TEST_F(TransitionEffectsTest, Instant_FirstTick_AllLedsChanged)
+{
+    SetInitialLeds();
+    led_manager.SetTransitionEffect(TransitionEffect::kInstant);
+    SetAllLeds(kNewColor);
+
+    ExecuteTicks(1U);
+
+    EXPECT_EQ(CountLeds(kNewColor), kStripLength);
+}
+
+TEST_F(TransitionEffectsTest, Instant_DurationOfTransitionUnchanged)
+{
+    led_manager.SetTransitionEffect(TransitionEffect::kInstant);
+    SetAllLeds(kNewColor);
+
+    ExecuteTicks(kTransitionDurationInTicks - 1);
+
+    EXPECT_TRUE(led_manager.RefreshTransition());
+}
+
+TEST_F(TransitionEffectsTest, EffectChangedDuringTransition_KeptForOngoingTransition)
+{
+    SetInitialLeds();
+    SetAllLeds(kNewColor);
+    ExecuteTicks(1U);
+
+    led_manager.SetTransitionEffect(TransitionEffect::kInstant);
+    ExecuteTicks(1U);
+
+    // Crossfade, the old LEDs are still fading out
+    EXPECT_EQ(CountLeds(kOldColor), kStripLength);
+}
+
+TEST_F(TransitionEffectsTest, Blend_HalfTransition_AllLedsBetweenOldAndNewColor)
+{
+    SetAllLeds(0x000000FFU);
+    ExecuteTicks(kTransitionDurationInTicks);
+    led_manager.SetTransitionEffect(TransitionEffect::kBlend);
+    SetAllLeds(0x0000FF00U);
+
+    ExecuteTicks(kTransitionDurationInTicks / 2);
+
+    // Progress 127 of 255: 255 * 127 / 256 green, 255 * 129 / 256 blue
+    EXPECT_EQ(CountLeds(0x00007E80U), kStripLength);
+}
+
+TEST_F(TransitionEffectsTest, Blend_WholeTransition_AllLedsChanged)
+{
+    SetInitialLeds();
+    led_manager.SetTransitionEffect(TransitionEffect::kBlend);
+    SetAllLeds(kNewColor);
+
+    ExecuteTicks(kTransitionDurationInTicks);
+
+    EXPECT_EQ(CountLeds(kNewColor), kStripLength);
+}
+
+TEST_F(TransitionEffectsTest, Blend_LedRemoved_ClearedAfterTransition)
+{
+    SetInitialLeds();
+    led_manager.SetTransitionEffect(TransitionEffect::kBlend);
+    const std::array<Led, 1U> new_leds{Led(0, kOldColor)};
+    led_manager.SetLeds(new_leds.data(), new_leds.size());
+
+    ExecuteTicks(kTransitionDurationInTicks);
+
+    const std::array<uint32_t, kStripLength> expected{1, 0, 0, 0, 0, 0, 0, 0};
+    EXPECT_EQ(strip.GetData(), expected);
+}
+
+TEST_F(TransitionEffectsTest, Blend_OneBlendPerTick_NoLedSetAfterFirstTick)
+{
+    SetInitialLeds();
+    led_manager.SetTransitionEffect(TransitionEffect::kBlend);
+    SetAllLeds(kNewColor);
+    ExecuteTicks(1U);
+    strip.ResetCallCounts();
+
+    ExecuteTicks(kTransitionDurationInTicks - 1U);
+
+    EXPECT_EQ(strip.GetBlendCount(), kTransitionDurationInTicks - 1U);
+    EXPECT_EQ(strip.GetSetManyCount(), 0U);
+    EXPECT_EQ(strip.GetSetCount(), 0U);
+}
@@ -0,0 +1,91 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+
+#include "BrightnessFilter.h"
+
+constexpr uint16_t kDark = 100U;
+constexpr uint16_t kBright = 1100U;
+constexpr uint32_t kShift = 5U;  // Each measurement weighs 1/32
+
+TEST(BrightnessFilterTest, NoMeasurement_InitialBrightness)
+{
+    BrightnessFilter filter{kDark, kBright, kShift, 42U};
+    EXPECT_EQ(filter.GetBrightness(), 42U);
+}
+
+TEST(BrightnessFilterTest, Unfiltered_LinearBetweenDarkAndBright)
+{
+    BrightnessFilter filter{kDark, kBright, 0U, 0U};
+    EXPECT_EQ(filter.Update(kDark), 0U);
+    EXPECT_EQ(filter.Update(600U), 127U);
+    EXPECT_EQ(filter.Update(kBright), UINT8_MAX);
+}
+
+TEST(BrightnessFilterTest, Unfiltered_ClampedOutsideDarkAndBright)
+{
+    BrightnessFilter filter{kDark, kBright, 0U, 128U};
+    EXPECT_EQ(filter.Update(0U), 0U);
+    EXPECT_EQ(filter.Update(kDark - 1U), 0U);
+    EXPECT_EQ(filter.Update(kBright + 1U), UINT8_MAX);
+    EXPECT_EQ(filter.Update(UINT16_MAX), UINT8_MAX);
+}
+
+TEST(BrightnessFilterTest, StepUp_FirstOrderResponse)
+{
+    BrightnessFilter filter{kDark, kBright, kShift, 0U};
+    uint8_t previous = filter.GetBrightness();
+    for (auto i = 1U; i <= 400U; i++)
+    {
+        const auto brightness = filter.Update(kBright);
+        EXPECT_GE(brightness, previous);
+        previous = brightness;
+        if (22U == i)
+        {
+            // (31/32)^22 is about 1/2
+            EXPECT_NEAR(brightness, 128, 3);
+        }
+        else if (32U == i)
+        {
+            // 1 - (31/32)^32 is about 1 - 1/e
+            EXPECT_NEAR(brightness, 162, 3);
+        }
+    }
+    EXPECT_EQ(previous, UINT8_MAX);  // Settles on the step
+}
+
+TEST(BrightnessFilterTest, StepDown_SettlesOnDark)
+{
+    BrightnessFilter filter{kDark, kBright, kShift, UINT8_MAX};
+    uint8_t previous = filter.GetBrightness();
+    for (auto i = 0U; i < 400U; i++)
+    {
+        const auto brightness = filter.Update(0U);  // Below dark, clamped
+        EXPECT_LE(brightness, previous);
+        previous = brightness;
+    }
+    EXPECT_EQ(previous, 0U);
+}
+
+TEST(BrightnessFilterTest, FullSensorRange_NoOverflow)
+{
+    BrightnessFilter filter{0U, UINT16_MAX, 8U, UINT8_MAX};
+    for (auto i = 0U; i < 100U; i++)
+    {
+        EXPECT_EQ(filter.Update(UINT16_MAX), UINT8_MAX);
+    }
+}
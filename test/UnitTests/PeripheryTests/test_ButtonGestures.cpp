@@ -0,0 +1,173 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ButtonGestures.h"
+#include "FwConfig.h"
+#include "Signals.h"
+
+class ButtonGesturesTest : public ::testing::Test
+{
+  protected:
+    static constexpr uint32_t kStartTime = 1000U;
+    static constexpr uint32_t kUpdatePeriod = 20U;  // As the ticks
+    static constexpr uint32_t kShortPushDuration = kShortPushMinDurationMilliSeconds + 50U;
+
+    uint32_t now_{kStartTime};
+    uint32_t edge_{ButtonGestures::PackEdge(kStartTime, true)};
+    std::vector<uint16_t> signals_;
+
+    void Update(ButtonGestures& gestures)
+    {
+        ButtonGestures::Signals signals;
+        gestures.Update(edge_, now_, signals);
+        signals_.insert(signals_.end(), signals.begin(), signals.end());
+    }
+    // Let the time pass, the gestures are updated periodically
+    void Wait(ButtonGestures& gestures, const uint32_t duration)
+    {
+        const uint32_t end = now_ + duration;
+        while (now_ < end)
+        {
+            now_ += std::min(kUpdatePeriod, end - now_);
+            Update(gestures);
+        }
+    }
+    void Push(ButtonGestures& gestures, const uint32_t duration)
+    {
+        edge_ = ButtonGestures::PackEdge(now_, false);
+        Wait(gestures, duration);
+        edge_ = ButtonGestures::PackEdge(now_, true);
+    }
+};
+
+TEST_F(ButtonGesturesTest, ShortPush_PostedOnRelease)
+{
+    ButtonGestures gestures{false};
+    Push(gestures, kShortPushDuration);
+    EXPECT_TRUE(gestures.IsPushed());
+    EXPECT_TRUE(signals_.empty());
+
+    Wait(gestures, kDebounceDurationMilliSeconds);
+    EXPECT_FALSE(gestures.IsPushed());
+    EXPECT_EQ(std::vector<uint16_t>{SHORT_PUSH}, signals_);
+
+    Wait(gestures, kDoublePushMaxGapMilliSeconds * 2U);
+    EXPECT_EQ(std::vector<uint16_t>{SHORT_PUSH}, signals_);
+}
+
+TEST_F(ButtonGesturesTest, TooShortPush_Ignored)
+{
+    ButtonGestures gestures{false};
+    Push(gestures, kShortPushMinDurationMilliSeconds - kUpdatePeriod);
+    Wait(gestures, kDoublePushMaxGapMilliSeconds * 2U);
+    EXPECT_TRUE(signals_.empty());
+}
+
+TEST_F(ButtonGesturesTest, Bouncing_Ignored)
+{
+    ButtonGestures gestures{false};
+    for (uint32_t i = 0; i < 5U; i++)
+    {
+        Push(gestures, kDebounceDurationMilliSeconds / 5U);
+        Wait(gestures, kDebounceDurationMilliSeconds / 5U);
+    }
+    EXPECT_FALSE(gestures.IsPushed());
+    Wait(gestures, kDoublePushMaxGapMilliSeconds * 2U);
+    EXPECT_TRUE(signals_.empty());
+}
+
+TEST_F(ButtonGesturesTest, DoublePushDisabled_TwoShortPushes)
+{
+    ButtonGestures gestures{false};
+    Push(gestures, kShortPushDuration);
+    Wait(gestures, kDoublePushMaxGapMilliSeconds / 2U);
+    Push(gestures, kShortPushDuration);
+    Wait(gestures, kDoublePushMaxGapMilliSeconds * 2U);
+    EXPECT_EQ((std::vector<uint16_t>{SHORT_PUSH, SHORT_PUSH}), signals_);
+}
+
+TEST_F(ButtonGesturesTest, DoublePushEnabled_DoublePush)
+{
+    ButtonGestures gestures{true};
+    Push(gestures, kShortPushDuration);
+    Wait(gestures, kDoublePushMaxGapMilliSeconds / 2U);
+    EXPECT_TRUE(signals_.empty());
+
+    Push(gestures, kShortPushDuration);
+    Wait(gestures, kDoublePushMaxGapMilliSeconds * 2U);
+    EXPECT_EQ(std::vector<uint16_t>{DOUBLE_PUSH}, signals_);
+}
+
+TEST_F(ButtonGesturesTest, DoublePushEnabled_ShortPushPostedAfterTheGap)
+{
+    ButtonGestures gestures{true};
+    Push(gestures, kShortPushDuration);
+    Wait(gestures, kDoublePushMaxGapMilliSeconds);
+    EXPECT_TRUE(signals_.empty());
+
+    Wait(gestures, kDoublePushMaxGapMilliSeconds);
+    EXPECT_EQ(std::vector<uint16_t>{SHORT_PUSH}, signals_);
+}
+
+TEST_F(ButtonGesturesTest, DoublePushEnabled_SecondPushTooLate_TwoShortPushes)
+{
+    ButtonGestures gestures{true};
+    Push(gestures, kShortPushDuration);
+    Wait(gestures, kDoublePushMaxGapMilliSeconds * 2U);
+    Push(gestures, kShortPushDuration);
+    Wait(gestures, kDoublePushMaxGapMilliSeconds * 2U);
+    EXPECT_EQ((std::vector<uint16_t>{SHORT_PUSH, SHORT_PUSH}), signals_);
+}
+
+TEST_F(ButtonGesturesTest, LongPush_PostedWhileHeld)
+{
+    ButtonGestures gestures{false};
+    Push(gestures, kLongPushMinDurationMilliSeconds - kUpdatePeriod);
+    EXPECT_TRUE(signals_.empty());
+
+    Wait(gestures, kUpdatePeriod * 2U);
+    EXPECT_EQ(std::vector<uint16_t>{LONG_PUSH}, signals_);
+
+    // No short push on the release
+    Wait(gestures, kDoublePushMaxGapMilliSeconds * 2U);
+    EXPECT_EQ(std::vector<uint16_t>{LONG_PUSH}, signals_);
+}
+
+TEST_F(ButtonGesturesTest, HeldAfterLongPush_Repeated)
+{
+    ButtonGestures gestures{false};
+    constexpr uint32_t kNumberOfRepeats = 3U;
+    Push(gestures, kLongPushMinDurationMilliSeconds + (kRepeatPushPeriodMilliSeconds * kNumberOfRepeats) + kUpdatePeriod);
+    Wait(gestures, kDoublePushMaxGapMilliSeconds * 2U);
+    EXPECT_EQ((std::vector<uint16_t>{LONG_PUSH, REPEAT_PUSH, REPEAT_PUSH, REPEAT_PUSH}), signals_);
+}
+
+TEST_F(ButtonGesturesTest, ClockWrapsAround_ShortPush)
+{
+    ButtonGestures gestures{false};
+    now_ = (UINT32_MAX >> 1U) - (kShortPushDuration / 2U);
+    edge_ = ButtonGestures::PackEdge(now_, true);
+    Update(gestures);
+
+    Push(gestures, kShortPushDuration);
+    Wait(gestures, kDebounceDurationMilliSeconds);
+    EXPECT_EQ(std::vector<uint16_t>{SHORT_PUSH}, signals_);
+}
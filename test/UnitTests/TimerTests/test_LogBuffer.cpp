@@ -0,0 +1,194 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+
+#include "LogBuffer.h"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+class LogBufferTest : public ::testing::Test
+{
+  protected:
+    static constexpr size_t kLength = 8U;
+    static constexpr size_t kTextLength = 16U;
+    using TestBuffer = LogBuffer<kLength, kTextLength>;
+    TestBuffer buffer{};
+    TestBuffer::Record record{};
+
+    static TestBuffer::Record MakeRecord(const LogLevel level, const uint32_t token, const uint32_t time_ms)
+    {
+        TestBuffer::Record new_record{};
+        new_record.level = level;
+        new_record.token = token;
+        new_record.time_ms = time_ms;
+        return new_record;
+    }
+};
+
+TEST(LogTokenTest, Fnv1aOfTheFormat)
+{
+    static_assert(0x811C9DC5U == LogToken(""));
+    EXPECT_EQ(0xE40C292CU, LogToken("a"));
+    EXPECT_EQ(0xBF9CF968U, LogToken("foobar"));
+    EXPECT_NE(LogToken("Value %u"), LogToken("Value %d"));
+}
+
+TEST(LogRecordTest, Arguments_InOrder)
+{
+    LogRecord<8U> record{};
+    record.AddArgument(7U);
+    record.AddArgument(-1);
+    record.AddArgument(static_cast<uint8_t>(200U));
+    ASSERT_EQ(3U, record.number_of_arguments);
+    EXPECT_EQ(7U, record.arguments[0]);
+    EXPECT_EQ(0xFFFFFFFFU, record.arguments[1]);
+    EXPECT_EQ(200U, record.arguments[2]);
+}
+
+TEST(LogRecordTest, TooManyArguments_Dropped)
+{
+    LogRecord<8U> record{};
+    for (uint32_t i = 0U; i < kLogMaxArguments + 2U; i++)
+    {
+        record.AddArgument(i);
+    }
+    EXPECT_EQ(kLogMaxArguments, record.number_of_arguments);
+    EXPECT_EQ(kLogMaxArguments - 1U, record.arguments[kLogMaxArguments - 1U]);
+}
+
+TEST(LogRecordTest, StringArgument_CopiedAndTruncated)
+{
+    char name[] = "Light Sensor";
+    LogRecord<8U> record{};
+    record.AddArgument(name);
+    std::strcpy(name, "Changed");
+    EXPECT_STREQ("Light S", record.text);
+    EXPECT_EQ(0U, record.number_of_arguments);
+}
+
+TEST(LogRecordTest, NullString_Empty)
+{
+    LogRecord<8U> record{};
+    record.AddArgument(static_cast<const char*>(nullptr));
+    EXPECT_STREQ("", record.text);
+}
+
+TEST_F(LogBufferTest, Empty_NoRecord)
+{
+    EXPECT_FALSE(buffer.Pop(record));
+    EXPECT_EQ(0U, buffer.GetLostRecords());
+}
+
+TEST_F(LogBufferTest, PushPop_SameRecord)
+{
+    auto pushed_record = MakeRecord(LogLevel::kWarn, LogToken("Hello %s %u"), 42U);
+    pushed_record.AddArgument("World");
+    pushed_record.AddArgument(3U);
+    EXPECT_TRUE(buffer.Push(pushed_record));
+    ASSERT_TRUE(buffer.Pop(record));
+    EXPECT_EQ(LogLevel::kWarn, record.level);
+    EXPECT_EQ(LogToken("Hello %s %u"), record.token);
+    EXPECT_EQ(42U, record.time_ms);
+    EXPECT_STREQ("World", record.text);
+    ASSERT_EQ(1U, record.number_of_arguments);
+    EXPECT_EQ(3U, record.arguments[0]);
+    EXPECT_FALSE(buffer.Pop(record));
+}
+
+TEST_F(LogBufferTest, Full_RecordsLostAndCounted)
+{
+    for (size_t i = 0U; i < kLength; i++)
+    {
+        EXPECT_TRUE(buffer.Push(MakeRecord(LogLevel::kDebug, 1U, static_cast<uint32_t>(i))));
+    }
+    EXPECT_FALSE(buffer.Push(MakeRecord(LogLevel::kDebug, 2U, 100U)));
+    EXPECT_FALSE(buffer.Push(MakeRecord(LogLevel::kDebug, 2U, 101U)));
+    EXPECT_EQ(2U, buffer.GetLostRecords());
+
+    for (size_t i = 0U; i < kLength; i++)
+    {
+        ASSERT_TRUE(buffer.Pop(record));
+        EXPECT_EQ(i, record.time_ms);  // Oldest first
+    }
+    EXPECT_FALSE(buffer.Pop(record));
+
+    EXPECT_TRUE(buffer.Push(MakeRecord(LogLevel::kDebug, 3U, 0U)));
+}
+
+TEST_F(LogBufferTest, ManyTimesAround_InOrder)
+{
+    for (uint32_t i = 0U; i < (10U * kLength) + 3U; i++)
+    {
+        EXPECT_TRUE(buffer.Push(MakeRecord(LogLevel::kInfo, 1U, i)));
+        ASSERT_TRUE(buffer.Pop(record));
+        EXPECT_EQ(i, record.time_ms);
+    }
+}
+
+TEST(LogBufferThreadTest, ConcurrentWriters_NoRecordMixedUp)
+{
+    constexpr uint32_t kWriters = 4U;
+    constexpr uint32_t kRecordsPerWriter = 20000U;
+    static LogBuffer<64U, 16U> buffer{};
+    static const char* const kNames[kWriters] = {"Writer zero", "Writer one", "Writer two", "Writer three"};
+
+    std::vector<std::thread> writers;
+    for (uint32_t writer = 0U; writer < kWriters; writer++)
+    {
+        writers.emplace_back([writer]() {
+            for (uint32_t i = 0U; i < kRecordsPerWriter; i++)
+            {
+                LogBuffer<64U, 16U>::Record record{};
+                record.token = writer;
+                record.time_ms = i;
+                record.AddArgument(kNames[writer]);
+                record.AddArgument(i);
+                (void)buffer.Push(record);
+            }
+        });
+    }
+
+    // Each writer's records come out in order, with the writer's own name
+    uint32_t popped_records = 0U;
+    uint32_t next_time[kWriters] = {};
+    bool is_consistent = true;
+    auto pop_all = [&]() {
+        LogBuffer<64U, 16U>::Record record{};
+        while (buffer.Pop(record))
+        {
+            const auto writer = record.token;
+            is_consistent &= (0 == std::strcmp(kNames[writer], record.text)) && (record.time_ms >= next_time[writer]) && (record.time_ms == record.arguments[0]);
+            next_time[writer] = record.time_ms + 1U;
+            popped_records++;
+        }
+    };
+    for (uint32_t i = 0U; i < 1000U; i++)
+    {
+        pop_all();
+        std::this_thread::yield();
+    }
+    for (auto& writer : writers)
+    {
+        writer.join();
+    }
+    pop_all();
+
+    EXPECT_TRUE(is_consistent);
+    EXPECT_EQ(kWriters * kRecordsPerWriter, popped_records + buffer.GetLostRecords());
+}
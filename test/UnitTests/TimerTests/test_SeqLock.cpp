@@ -0,0 +1,232 @@
+// Trainboard.ch
+// Copyright (C) 2024 Emile Décosterd
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "gtest/gtest.h"
+
+#include "SeqLock.h"
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+class SeqLockTest : public ::testing::Test
+{
+  protected:
+    static constexpr uint32_t kMaxAttempts = 3U;
+    static constexpr uint32_t kNumberOfWrites = 20000U;
+    static constexpr uint32_t kNumberOfReaders = 3U;
+
+    // Consistent if all the words are equal
+    using Data = std::array<uint32_t, 64U>;
+
+    static bool IsConsistent(const Data& data)
+    {
+        bool is_consistent = true;
+        for (const auto word : data)
+        {
+            is_consistent = is_consistent && (word == data[0]);
+        }
+        return is_consistent;
+    }
+};
+
+TEST_F(SeqLockTest, NoWrite_ReadOnFirstAttempt)
+{
+    SeqLock sequence{};
+    uint32_t number_of_copies = 0U;
+
+    EXPECT_TRUE(sequence.Read(kMaxAttempts, [&]() { number_of_copies++; }));
+    EXPECT_EQ(number_of_copies, 1U);
+}
+
+TEST_F(SeqLockTest, BeingWritten_ReadFails)
+{
+    SeqLock sequence{};
+    uint32_t number_of_copies = 0U;
+    sequence.BeginWrite();
+
+    EXPECT_FALSE(sequence.Read(kMaxAttempts, [&]() { number_of_copies++; }));
+    EXPECT_EQ(number_of_copies, 0U);
+}
+
+TEST_F(SeqLockTest, WrittenDuringCopy_CopiedAgain)
+{
+    SeqLock sequence{};
+    uint32_t number_of_copies = 0U;
+
+    const auto is_read = sequence.Read(kMaxAttempts, [&]() {
+        number_of_copies++;
+        if (1U == number_of_copies)
+        {
+            sequence.BeginWrite();
+            sequence.EndWrite();
+        }
+    });
+
+    EXPECT_TRUE(is_read);
+    EXPECT_EQ(number_of_copies, 2U);
+}
+
+TEST_F(SeqLockTest, ConcurrentWriterAndReaders_OnlyConsistentDataRead)
+{
+    SeqLock sequence{};
+    Data data{};
+    std::atomic<bool> is_writing{true};
+    std::atomic<uint32_t> inconsistent_reads{0U};
+
+    std::vector<std::thread> readers{};
+    for (auto i = 0U; i < kNumberOfReaders; i++)
+    {
+        readers.emplace_back([&]() {
+            while (is_writing.load())
+            {
+                Data copy{};
+                if (sequence.Read(kMaxAttempts, [&]() { copy = data; }) && !IsConsistent(copy))
+                {
+                    inconsistent_reads++;
+                }
+            }
+        });
+    }
+    for (auto i = 1U; i <= kNumberOfWrites; i++)
+    {
+        sequence.BeginWrite();
+        data.fill(i);
+        sequence.EndWrite();
+    }
+    is_writing.store(false);
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_EQ(inconsistent_reads.load(), 0U);
+}
+
+class SeqLockBufferTest : public SeqLockTest
+{
+  protected:
+    std::array<Data, 2U> banks{};
+    SeqLockBuffer<Data> buffer{};
+
+    void SetUp() override
+    {
+        buffer.Init(banks.data());
+    }
+
+    void Publish(uint32_t value)
+    {
+        buffer.BeginWrite().fill(value);
+        buffer.EndWrite();
+    }
+
+    uint32_t ReadFirstWord()
+    {
+        uint32_t word = 0U;
+        EXPECT_TRUE(buffer.Read(kMaxAttempts, [&](const Data& data) { word = data[0]; }));
+        return word;
+    }
+};
+
+TEST_F(SeqLockBufferTest, Published_ReadBack)
+{
+    Publish(1U);
+
+    EXPECT_EQ(ReadFirstWord(), 1U);
+}
+
+TEST_F(SeqLockBufferTest, PublishedTwice_LastRead)
+{
+    Publish(1U);
+    Publish(2U);
+
+    EXPECT_EQ(ReadFirstWord(), 2U);
+}
+
+TEST_F(SeqLockBufferTest, BeingWritten_PublishedBankRead)
+{
+    Publish(1U);
+
+    buffer.BeginWrite().fill(2U);
+
+    EXPECT_EQ(ReadFirstWord(), 1U);
+}
+
+TEST_F(SeqLockBufferTest, PublishedOnceDuringCopy_NotCopiedAgain)
+{
+    Publish(1U);
+    uint32_t number_of_copies = 0U;
+
+    const auto is_read = buffer.Read(kMaxAttempts, [&](const Data&) {
+        number_of_copies++;
+        Publish(2U);
+    });
+
+    EXPECT_TRUE(is_read);
+    EXPECT_EQ(number_of_copies, 1U);
+}
+
+TEST_F(SeqLockBufferTest, PublishedTwiceDuringCopy_CopiedAgain)
+{
+    Publish(1U);
+    uint32_t number_of_copies = 0U;
+
+    const auto is_read = buffer.Read(kMaxAttempts, [&](const Data&) {
+        number_of_copies++;
+        if (1U == number_of_copies)
+        {
+            Publish(2U);
+            buffer.BeginWrite();
+        }
+    });
+
+    EXPECT_TRUE(is_read);
+    EXPECT_EQ(number_of_copies, 2U);
+}
+
+TEST_F(SeqLockBufferTest, ConcurrentWriterAndReaders_OnlyConsistentDataRead)
+{
+    std::atomic<bool> is_writing{true};
+    std::atomic<uint32_t> inconsistent_reads{0U};
+
+    std::vector<std::thread> readers{};
+    for (auto i = 0U; i < kNumberOfReaders; i++)
+    {
+        readers.emplace_back([&]() {
+            while (is_writing.load())
+            {
+                Data copy{};
+                if (buffer.Read(kMaxAttempts, [&](const Data& data) { copy = data; }) && !IsConsistent(copy))
+                {
+                    inconsistent_reads++;
+                }
+            }
+        });
+    }
+    for (auto i = 1U; i <= kNumberOfWrites; i++)
+    {
+        Publish(i);
+    }
+    is_writing.store(false);
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_EQ(inconsistent_reads.load(), 0U);
+}
@@ -0,0 +1,233 @@
+#!/usr/bin/env python3
+
+# Trainboard Firmware
+# Copyright (C) 2024 Emile Décosterd
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+# Local stand-in for the Trainboard server, used to test the firmware and the
+# data protocol without hitting api.trainboard.ch.
+#
+# Build the firmware with e.g.
+#   -DSERVER_URL=\"https://192.168.1.42:8443\" -DSERVER_INSECURE
+# and start the server with a (self-signed) certificate:
+#   python3 test/local_server.py --port 8443 --cert cert.pem --key key.pem
+
+import argparse
+import base64
+import hashlib
+import math
+import random
+import ssl
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+BYTES_PER_LED = 5
+BYTES_PER_TRAIN = 5
+HEADER_BYTES = 2
+HAS_TRAINS_FLAG = 0x8000
+HAS_DELAYS_FLAG = 0x4000
+NUMBER_OF_HISTORY_FRAMES = 45
+PUSH_KEEP_ALIVE_S = 15
+STRIP_LENGTHS = [84, 65, 75, 86]  # V1.2
+TRAIN_COLORS = [(255, 255, 255), (255, 0, 0), (252, 3, 248), (254, 199, 11), (0, 152, 74), (255, 128, 0)]
+TRAINS_PER_STRIP = 12
+
+
+class FrameSource:
+    """Computes one frame per period, identified by an increasing sequence number."""
+
+    def __init__(self, period_s, has_trains=True):
+        self.period_s = period_s
+        self.has_trains = has_trains
+        self.start = time.time()
+
+    def seconds_to_next_frame(self):
+        elapsed = time.time() - self.start
+        return math.ceil(self.period_s - (elapsed % self.period_s))
+
+    def newest_sequence(self):
+        # Start with a complete history
+        return NUMBER_OF_HISTORY_FRAMES + int((time.time() - self.start) / self.period_s)
+
+    def frame(self, sequence):
+        leds = bytearray()
+        trains = bytearray()
+        delays = bytearray()
+        n_leds = 0
+        for strip_id, strip_length in enumerate(STRIP_LENGTHS):
+            for train in range(TRAINS_PER_STRIP):
+                direction = 1 if (train % 2) == 0 else -1
+                position = (train * strip_length // TRAINS_PER_STRIP + direction * sequence) % strip_length
+                red, green, blue = TRAIN_COLORS[(strip_id + train) % len(TRAIN_COLORS)]
+                leds += bytes([strip_id, position, red, green, blue])
+                # Train id, index of its LED, direction (0 towards the higher positions)
+                train_id = strip_id * TRAINS_PER_STRIP + train
+                trains += train_id.to_bytes(2, "big") + n_leds.to_bytes(2, "big") + bytes([0 if direction > 0 else 1])
+                # Delay in minutes, some trains slowly get late and catch up again
+                delays.append(max(0, (train_id * 7 + sequence // 5) % 20 - 8))
+                n_leds += 1
+        if not self.has_trains:
+            return n_leds.to_bytes(HEADER_BYTES, "big") + bytes(leds)
+        n_trains = len(trains) // BYTES_PER_TRAIN
+        header = n_leds | HAS_TRAINS_FLAG | HAS_DELAYS_FLAG
+        return header.to_bytes(HEADER_BYTES, "big") + bytes(leds) + n_trains.to_bytes(2, "big") + bytes(trains) + bytes(delays)
+
+    def history(self, n_frames, since_sequence=None):
+        newest = self.newest_sequence()
+        oldest = newest - n_frames + 1
+        if since_sequence is not None and oldest <= since_sequence <= newest:
+            # Only send the frames the board does not have yet
+            oldest = since_sequence + 1
+        return b"".join(self.frame(sequence) for sequence in range(oldest, newest + 1))
+
+
+class Handler(BaseHTTPRequestHandler):
+    frame_source = None
+    is_push_enabled = True
+    fail_ratio = 0.0
+    ota_patch = None
+    ota_image = None
+    ota_version = None
+    retry_after_s = 30
+
+    def do_GET(self):
+        if self.path == "/ping":
+            self.send_payload(bytes([0xBE, 0xEF]))
+        elif self.path == "/tb1_1":
+            self.handle_data()
+        elif self.path == "/tb1_1/push" and self.is_push_enabled:
+            self.handle_push()
+        elif self.path == "/ota":
+            if self.ota_image is None or self.is_ota_up_to_date():
+                self.send_not_modified()
+            else:
+                with open(self.ota_image, "rb") as file:
+                    image = file.read()
+                self.send_response(200)
+                self.send_header("Content-Length", str(len(image)))
+                self.send_header("x-MD5", hashlib.md5(image).hexdigest())
+                if self.ota_version is not None:
+                    self.send_header("ETag", '"{}"'.format(self.ota_version))
+                self.end_headers()
+                self.wfile.write(image)
+        elif self.path == "/ota/delta":
+            if self.ota_patch is None or self.is_ota_up_to_date():
+                self.send_not_modified()
+            else:
+                with open(self.ota_patch, "rb") as file:
+                    self.send_payload(file.read())
+        else:
+            self.send_error(404)
+
+    def is_ota_up_to_date(self):
+        # The boards send their firmware version as If-None-Match, see GetOta()
+        return self.ota_version is not None and self.headers.get("If-None-Match") == '"{}"'.format(self.ota_version)
+
+    def send_not_modified(self):
+        self.send_response(304)  # No update available
+        self.end_headers()
+
+    def handle_data(self):
+        if random.random() < self.fail_ratio:
+            # Simulated overload, the boards must back off
+            self.send_response(503)
+            self.send_header("Retry-After", str(self.retry_after_s))
+            self.send_header("Content-Length", "0")
+            self.end_headers()
+            return
+        source = self.frame_source
+        newest = source.newest_sequence()
+        command = self.headers.get("com", "")
+        if command.startswith("history_"):
+            n_frames = min(int(command[len("history_"):]), NUMBER_OF_HISTORY_FRAMES)
+            since = self.headers.get("seq")
+            payload = source.history(n_frames, int(since) if since is not None else None)
+        else:
+            payload = source.frame(newest)
+        self.send_payload(payload, {"seq": str(newest), "next-poll": str(source.seconds_to_next_frame())})
+
+    def handle_push(self):
+        # Server-sent events, one "frame" event per new frame, until the board disconnects
+        self.send_response(200)
+        self.send_header("Content-Type", "text/event-stream")
+        self.send_header("Cache-Control", "no-cache")
+        self.end_headers()
+        source = self.frame_source
+        sent_sequence = None
+        last_write = time.time()
+        try:
+            while True:
+                newest = source.newest_sequence()
+                if newest != sent_sequence:
+                    data = base64.b64encode(source.frame(newest)).decode("ascii")
+                    self.wfile.write("event: frame\nid: {}\ndata: {}\n\n".format(newest, data).encode("ascii"))
+                    sent_sequence = newest
+                    last_write = time.time()
+                    print("{} - pushed frame {}".format(self.address_string(), newest))
+                elif time.time() - last_write > PUSH_KEEP_ALIVE_S:
+                    self.wfile.write(b": keep-alive\n\n")
+                    last_write = time.time()
+                self.wfile.flush()
+                time.sleep(0.5)
+        except (BrokenPipeError, ConnectionResetError):
+            print("{} - push channel closed".format(self.address_string()))
+
+    def send_payload(self, payload, headers={}):
+        self.send_response(200)
+        self.send_header("Content-Type", "application/octet-stream")
+        self.send_header("Content-Length", str(len(payload)))
+        for key, value in headers.items():
+            self.send_header(key, value)
+        self.end_headers()
+        self.wfile.write(payload)
+
+    def log_message(self, format, *args):
+        print("{} - {} [com={}, seq={}]".format(self.address_string(), format % args, self.headers.get("com"), self.headers.get("seq")))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Local stand-in for the Trainboard server")
+    parser.add_argument("--host", default="0.0.0.0")
+    parser.add_argument("--port", type=int, default=8080)
+    parser.add_argument("--period", type=float, default=60.0, help="Seconds between two frames")
+    parser.add_argument("--cert", help="TLS certificate (PEM), serves plain HTTP if omitted")
+    parser.add_argument("--key", help="TLS private key (PEM)")
+    parser.add_argument("--no-trains", action="store_true", help="Send the frames without their train section and delays")
+    parser.add_argument("--no-push", action="store_true", help="Disable the push channel to test the fallback to polling")
+    parser.add_argument("--fail-ratio", type=float, default=0.0, help="Ratio of data requests answered with 503 and Retry-After")
+    parser.add_argument("--ota-image", help="Full firmware image served on /ota")
+    parser.add_argument("--ota-patch", help="Delta patch served on /ota/delta, see build/make_delta_patch.py")
+    parser.add_argument("--ota-version", help="FW_VERSION of the served image, the boards already running it get 304")
+    parser.add_argument("--retry-after", type=int, default=30, help="Retry-After sent with the simulated failures, in seconds")
+    args = parser.parse_args()
+
+    Handler.frame_source = FrameSource(args.period, not args.no_trains)
+    Handler.is_push_enabled = not args.no_push
+    Handler.fail_ratio = args.fail_ratio
+    Handler.retry_after_s = args.retry_after
+    Handler.ota_patch = args.ota_patch
+    Handler.ota_image = args.ota_image
+    Handler.ota_version = args.ota_version
+    server = ThreadingHTTPServer((args.host, args.port), Handler)
+    if args.cert:
+        context = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+        context.load_cert_chain(args.cert, args.key)
+        server.socket = context.wrap_socket(server.socket, server_side=True)
+    print("Serving on {}:{}".format(args.host, args.port))
+    server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()